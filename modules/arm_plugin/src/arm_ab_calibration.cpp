@@ -0,0 +1,178 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <arm_compute/runtime/Allocator.h>
+#include <arm_compute/runtime/OffsetLifetimeManager.h>
+#include <arm_compute/runtime/PoolManager.h>
+#include <arm_compute/runtime/MemoryManagerOnDemand.h>
+#include <arm_compute/runtime/MemoryGroup.h>
+
+#include "arm_ab_calibration.hpp"
+#include "arm_plugin.hpp"
+#include "arm_converter/arm_converter.hpp"
+#include "opset/opset.hpp"
+
+using namespace ArmPlugin;
+
+namespace {
+
+// Node types that have both an ACL conversion and a reference fallback
+// reachable through a NODE_AFFINITY REF pin - the ops guarded in the Arm
+// substitution passes. Everything else has only one engine, so there is
+// nothing to select.
+bool HasReferenceFallback(const ngraph::Node* node) {
+    return ov::is_type<opset::MVN>(node) ||
+           ov::is_type<opset::NormalizeL2>(node) ||
+           ov::is_type<opset::Interpolate>(node) ||
+           ov::is_type<opset::Transpose>(node) ||
+           ov::is_type<opset::StridedSlice>(node) ||
+           ov::is_type<opset::Gather>(node) ||
+           ov::is_type<opset::DFT>(node) ||
+           ov::is_type<opset::IDFT>(node) ||
+           ov::is_type<opset::Convert>(node) ||
+           ov::is_type<opset::Split>(node) ||
+           ov::is_type<opset::Concat>(node);
+}
+
+// Configures the function, runs the whole plan on dummy data and returns the
+// accumulated per-layer wall time for the candidate names. The full plan runs
+// in order so every candidate sees realistic inputs and cache state; only the
+// candidate layers are timed.
+std::map<std::string, float> MeasureLayers(const std::shared_ptr<ngraph::Function>& function,
+                                           const Configuration& cfg,
+                                           const std::set<std::string>& candidates) {
+    auto lifetime = std::make_shared<arm_compute::OffsetLifetimeManager>();
+    auto pool = std::make_shared<arm_compute::PoolManager>();
+    auto memoryManager = std::make_shared<arm_compute::MemoryManagerOnDemand>(lifetime, pool);
+    arm_compute::MemoryGroup memoryGroup{memoryManager};
+    // A throwaway state map keeps stateful networks measurable; the dry runs
+    // never touch the states the real network will use
+    auto states = std::make_shared<VariableStateMap>();
+    auto layers = Converter{function, cfg, states}.Configure(memoryManager, memoryGroup);
+
+    arm_compute::Allocator allocator;
+    memoryManager->populate(allocator, 1);
+    arm_compute::MemoryGroupResourceScope scope{memoryGroup};
+
+    for (auto&& parameter : function->get_parameters()) {
+        auto tensor = layers.at(parameter->get_instance_id())._outputs.at(parameter->output(0))._tensor.get();
+        if (tensor->buffer() == nullptr) {
+            static_cast<arm_compute::Tensor*>(tensor)->allocator()->allocate();
+        }
+        // Decodes to small positive values in f32 and f16 alike - no
+        // denormals or NaNs skewing the timings
+        std::memset(tensor->buffer(), 0x3c, tensor->info()->total_size());
+    }
+    for (auto&& result : function->get_results()) {
+        auto tensor = layers.at(result->get_instance_id())._inputs.at(result->input(0))->_tensor.get();
+        if (tensor->buffer() == nullptr) {
+            static_cast<arm_compute::Tensor*>(tensor)->allocator()->allocate();
+        }
+    }
+
+    struct Entry {
+        arm_compute::IFunction* _function;
+        const std::string*      _candidate;
+    };
+    std::vector<Entry> schedule;
+    std::map<std::string, float> durations;
+    for (auto&& node : function->get_ordered_ops()) {
+        auto layerFunction = layers.at(node->get_instance_id())._function.get();
+        if (layerFunction == nullptr) {
+            continue;
+        }
+        const std::string* candidate = nullptr;
+        auto itCandidate = candidates.find(node->get_friendly_name());
+        if (itCandidate != candidates.end()) {
+            candidate = &(durations.emplace(*itCandidate, 0.0f).first->first);
+        }
+        schedule.emplace_back(Entry{layerFunction, candidate});
+    }
+
+    for (auto&& entry : schedule) {
+        entry._function->prepare();
+    }
+    constexpr int warmupIterations = 3;
+    constexpr int iterations = 16;
+    for (int i = 0; i < warmupIterations; ++i) {
+        for (auto&& entry : schedule) {
+            entry._function->run();
+        }
+    }
+    using Time = std::chrono::steady_clock;
+    for (int i = 0; i < iterations; ++i) {
+        for (auto&& entry : schedule) {
+            if (entry._candidate == nullptr) {
+                entry._function->run();
+            } else {
+                const auto start = Time::now();
+                entry._function->run();
+                durations.at(*entry._candidate) +=
+                    std::chrono::duration<float, std::micro>{Time::now() - start}.count();
+            }
+        }
+    }
+    return durations;
+}
+
+}  // namespace
+
+std::string ArmPlugin::CalibrateNodeAffinity(const Plugin& plugin,
+                                             const std::shared_ptr<const ngraph::Function>& function,
+                                             const Configuration& cfg) {
+    std::set<std::string> candidates;
+    for (auto&& node : function->get_ops()) {
+        if (HasReferenceFallback(node.get())) {
+            candidates.emplace(node->get_friendly_name());
+        }
+    }
+    // Explicit pins are the user's call; calibration only decides the rest
+    std::istringstream pinned{cfg._nodeAffinity};
+    std::string pin;
+    while (std::getline(pinned, pin, ';')) {
+        const auto colon = pin.rfind(':');
+        if (colon != std::string::npos) {
+            candidates.erase(pin.substr(0, colon));
+        }
+    }
+    if (candidates.empty()) {
+        return {};
+    }
+
+    auto aclTimes = MeasureLayers(plugin.Transform(function, cfg), cfg, candidates);
+    Configuration referenceCfg = cfg;
+    {
+        std::ostringstream affinity;
+        for (auto&& candidate : candidates) {
+            affinity << (affinity.tellp() > 0 ? ";" : "") << candidate << ":REF";
+        }
+        referenceCfg._nodeAffinity = affinity.str();
+    }
+    auto referenceTimes = MeasureLayers(plugin.Transform(function, referenceCfg), referenceCfg, candidates);
+
+    std::ostringstream pins;
+    for (auto&& candidate : candidates) {
+        auto itAcl = aclTimes.find(candidate);
+        auto itReference = referenceTimes.find(candidate);
+        if ((itAcl == aclTimes.end()) || (itReference == referenceTimes.end())) {
+            // A substitution fused the layer away in one of the plans; no
+            // one-to-one comparison exists, keep the default
+            continue;
+        }
+        // Require a clear win so measurement noise does not flip layers away
+        // from the better-scaling ACL kernels
+        if (itReference->second < 0.9f * itAcl->second) {
+            pins << (pins.tellp() > 0 ? ";" : "") << candidate << ":REF";
+        }
+    }
+    return pins.str();
+}
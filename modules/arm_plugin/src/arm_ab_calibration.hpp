@@ -0,0 +1,30 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <ngraph/function.hpp>
+
+#include "arm_config.hpp"
+
+namespace ArmPlugin {
+
+class Plugin;
+
+// Empirical per-layer engine selection (AB_CALIBRATION): configures the
+// network twice - once preferring ACL, once with every dual-engine layer
+// pinned to the reference path - times the matching layers of both plans on
+// dummy data and returns a NODE_AFFINITY-style pin list for the layers where
+// the reference implementation measured faster. The caller merges the pins
+// into the configuration before the final Transform, so the measured choice
+// is baked into the function and survives in exported blobs. Layers already
+// pinned explicitly through NODE_AFFINITY are left alone.
+std::string CalibrateNodeAffinity(const Plugin& plugin,
+                                  const std::shared_ptr<const ngraph::Function>& function,
+                                  const Configuration& cfg);
+
+}  // namespace ArmPlugin
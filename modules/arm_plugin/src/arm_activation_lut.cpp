@@ -0,0 +1,54 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_activation_lut.hpp"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include <ie_parallel.hpp>
+
+namespace ArmPlugin {
+
+ActivationLut::ActivationLut(const std::function<float(float)>& fn) : _table(1 << 16) {
+    for (std::size_t bits = 0; bits < _table.size(); ++bits) {
+        const float x = static_cast<float>(ngraph::float16::from_bits(static_cast<std::uint16_t>(bits)));
+        _table[bits] = ngraph::float16{fn(x)}.to_bits();
+    }
+}
+
+std::shared_ptr<const ActivationLut> ActivationLut::Get(const std::string& key, const std::function<float(float)>& fn) {
+    static std::mutex mutex;
+    static std::map<std::string, std::shared_ptr<const ActivationLut>> tables;
+    std::lock_guard<std::mutex> lock{mutex};
+    auto& table = tables[key];
+    if (table == nullptr) {
+        table = std::shared_ptr<const ActivationLut>{new ActivationLut{fn}};
+    }
+    return table;
+}
+
+void ActivationLut::Apply(const std::uint16_t* src, std::uint16_t* dst, std::size_t size) const {
+    const auto* table = _table.data();
+    // Same chunking as the f32 transcendental kernels: large tensors spread
+    // over the executor, small ones skip the dispatch
+    constexpr std::size_t chunkSize = 16384;
+    const std::size_t chunks = (size + chunkSize - 1) / chunkSize;
+    if (chunks > 1) {
+        InferenceEngine::parallel_for(chunks, [&] (std::size_t chunk) {
+            const std::size_t begin = chunk * chunkSize;
+            const std::size_t end = std::min(size, begin + chunkSize);
+            for (std::size_t i = begin; i < end; ++i) {
+                dst[i] = table[src[i]];
+            }
+        });
+    } else {
+        for (std::size_t i = 0; i < size; ++i) {
+            dst[i] = table[src[i]];
+        }
+    }
+}
+
+}  // namespace ArmPlugin
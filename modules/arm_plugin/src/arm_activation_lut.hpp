@@ -0,0 +1,62 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/type/float16.hpp>
+
+namespace ArmPlugin {
+
+// Exhaustive f16 lookup tables for transcendental activations. Half
+// precision has only 65536 distinct values, so a 128 KB table - comfortably
+// L2-resident next to the activations it transforms - evaluates any unary
+// exactly: every entry is the reference function computed in f32 and rounded
+// once to f16, which is at least as accurate as any polynomial chain the
+// same output precision could carry, at one load per element. Tables are
+// built on first request per (function, parameters) key and shared
+// process-wide across layers and networks, so a transformer full of f16
+// GELUs pays the 65536 evaluations once, at network load.
+struct ActivationLut {
+    // Table for `key` ("sigmoid", "elu:1.5", ...), built with `fn` when not
+    // cached yet; callers agree on canonical keys so equal tables are shared
+    static std::shared_ptr<const ActivationLut> Get(const std::string& key, const std::function<float(float)>& fn);
+    // dst[i] = table[src[i]] over raw f16 bit patterns
+    void Apply(const std::uint16_t* src, std::uint16_t* dst, std::size_t size) const;
+    // Single-value lookup for kernels that mix table and arithmetic steps
+    std::uint16_t operator[](std::uint16_t bits) const { return _table[bits]; }
+
+private:
+    explicit ActivationLut(const std::function<float(float)>& fn);
+    std::vector<std::uint16_t> _table;
+};
+
+namespace lut {
+// Reference functions shared between table users, so every site builds the
+// same table under the same key
+inline float sigmoid(float x) {
+    return 1.0f / (1.0f + std::exp(-x));
+}
+// ln(1 + e^x); the large-argument shortcut keeps the f32 exp from
+// overflowing to inf inside the representable f16 domain
+inline float softplus(float x) {
+    return x > 20.0f ? x : std::log1p(std::exp(x));
+}
+}  // namespace lut
+
+// MakeNativeConversion entry point activation layers bind their table and
+// tensors through
+inline void lut_activation(const ngraph::float16* src, ngraph::float16* dst,
+                           const std::shared_ptr<const ActivationLut>& lut, std::size_t size) {
+    lut->Apply(reinterpret_cast<const std::uint16_t*>(src), reinterpret_cast<std::uint16_t*>(dst), size);
+}
+
+}  // namespace ArmPlugin
@@ -0,0 +1,22 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_async_infer_request.hpp"
+
+using namespace ArmPlugin;
+
+ArmAsyncInferRequest::ArmAsyncInferRequest(const ArmInferRequest::Ptr&                inferRequest,
+                                           const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
+                                           const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault{inferRequest, taskExecutor, callbackExecutor},
+    _inferRequest{inferRequest} {
+    _pipeline = {
+        {taskExecutor, [this] { _inferRequest->Preprocess(); }},
+        {taskExecutor, [this] { _inferRequest->Execute(); }},
+        {taskExecutor, [this] { _inferRequest->Postprocess(); }}};
+}
+
+ArmAsyncInferRequest::~ArmAsyncInferRequest() {
+    StopAndWait();
+}
@@ -0,0 +1,26 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+
+#include "arm_infer_request.hpp"
+
+namespace ArmPlugin {
+
+// Decomposes the request into preprocess -> execute -> postprocess tasks on the
+// streams executor, so stages of different in-flight requests interleave on the
+// same cores instead of each request occupying a stream as one opaque task
+struct ArmAsyncInferRequest final : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+    ArmAsyncInferRequest(const ArmInferRequest::Ptr&                 inferRequest,
+                         const InferenceEngine::ITaskExecutor::Ptr&  taskExecutor,
+                         const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    ~ArmAsyncInferRequest() override;
+
+private:
+    ArmInferRequest::Ptr _inferRequest;
+};
+
+}  // namespace ArmPlugin
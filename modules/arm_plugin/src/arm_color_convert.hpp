@@ -0,0 +1,129 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+
+#include <ie_parallel.hpp>
+
+namespace ArmPlugin {
+namespace yuv {
+// BT.601 limited-range YUV -> RGB, the same constants the ngraph reference
+// uses. The u8 path runs them as Q13 fixed point so a whole row stays in
+// integer NEON registers; float inputs keep the float formula
+constexpr std::int16_t kY = 9535;   // 1.164 * 8192
+constexpr std::int16_t kRV = 13074; // 1.596 * 8192
+constexpr std::int16_t kGU = -3203; // -0.391 * 8192
+constexpr std::int16_t kGV = -6660; // -0.813 * 8192
+constexpr std::int16_t kBU = 16531; // 2.018 * 8192
+
+template <typename T>
+void ConvertRow(const T* y_row, const T* u_row, const T* v_row, std::size_t u_step,
+                T* dst, std::size_t width, bool bgr) {
+    for (std::size_t x = 0; x < width; ++x) {
+        const float c = static_cast<float>(y_row[x]) - 16.f;
+        const float d = static_cast<float>(u_row[(x / 2) * u_step]) - 128.f;
+        const float e = static_cast<float>(v_row[(x / 2) * u_step]) - 128.f;
+        auto clip = [] (float value) { return std::min(std::max(value, 0.f), 255.f); };
+        const float r = clip(1.164f * c + 1.596f * e);
+        const float g = clip(1.164f * c - 0.391f * d - 0.813f * e);
+        const float b = clip(1.164f * c + 2.018f * d);
+        dst[3 * x + (bgr ? 2 : 0)] = static_cast<T>(r);
+        dst[3 * x + 1]             = static_cast<T>(g);
+        dst[3 * x + (bgr ? 0 : 2)] = static_cast<T>(b);
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+// u0..u7 -> u0 u0 u1 u1 ... : replicates each chroma sample over its 2x1 pair
+inline uint8x16_t ExpandChroma(uint8x8_t half) {
+    const auto zipped = vzip_u8(half, half);
+    return vcombine_u8(zipped.val[0], zipped.val[1]);
+}
+
+// clip((kc * c + kd * d + ke * e) >> 13) over 8 lanes
+inline uint8x8_t BlendChannel(int16x8_t c, int16x8_t d, int16x8_t e,
+                              std::int16_t kc, std::int16_t kd, std::int16_t ke) {
+    auto lo = vmull_s16(vget_low_s16(c), vdup_n_s16(kc));
+    auto hi = vmull_s16(vget_high_s16(c), vdup_n_s16(kc));
+    lo = vmlal_s16(lo, vget_low_s16(d), vdup_n_s16(kd));
+    hi = vmlal_s16(hi, vget_high_s16(d), vdup_n_s16(kd));
+    lo = vmlal_s16(lo, vget_low_s16(e), vdup_n_s16(ke));
+    hi = vmlal_s16(hi, vget_high_s16(e), vdup_n_s16(ke));
+    return vqmovun_s16(vcombine_s16(vqrshrn_n_s32(lo, 13), vqrshrn_n_s32(hi, 13)));
+}
+
+inline void ConvertRow(const std::uint8_t* y_row, const std::uint8_t* u_row, const std::uint8_t* v_row,
+                       std::size_t u_step, std::uint8_t* dst, std::size_t width, bool bgr) {
+    std::size_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const auto y16 = vld1q_u8(y_row + x);
+        uint8x8_t u_half, v_half;
+        if (u_step == 2) {
+            const auto uv = vld2_u8(u_row + x);
+            u_half = uv.val[0];
+            v_half = uv.val[1];
+        } else {
+            u_half = vld1_u8(u_row + x / 2);
+            v_half = vld1_u8(v_row + x / 2);
+        }
+        const auto u16x = ExpandChroma(u_half);
+        const auto v16x = ExpandChroma(v_half);
+        uint8x8_t r[2], g[2], b[2];
+        for (int half = 0; half < 2; ++half) {
+            auto narrow = [&] (uint8x16_t wide) {
+                return half == 0 ? vget_low_u8(wide) : vget_high_u8(wide);
+            };
+            const auto c = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(narrow(y16))), vdupq_n_s16(16));
+            const auto d = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(narrow(u16x))), vdupq_n_s16(128));
+            const auto e = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(narrow(v16x))), vdupq_n_s16(128));
+            r[half] = BlendChannel(c, d, e, kY, 0, kRV);
+            g[half] = BlendChannel(c, d, e, kY, kGU, kGV);
+            b[half] = BlendChannel(c, d, e, kY, kBU, 0);
+        }
+        uint8x16x3_t rgb;
+        rgb.val[0] = bgr ? vcombine_u8(b[0], b[1]) : vcombine_u8(r[0], r[1]);
+        rgb.val[1] = vcombine_u8(g[0], g[1]);
+        rgb.val[2] = bgr ? vcombine_u8(r[0], r[1]) : vcombine_u8(b[0], b[1]);
+        vst3q_u8(dst + 3 * x, rgb);
+    }
+    for (; x < width; ++x) {
+        const auto c = static_cast<std::int32_t>(y_row[x]) - 16;
+        const auto d = static_cast<std::int32_t>(u_row[(x / 2) * u_step]) - 128;
+        const auto e = static_cast<std::int32_t>(v_row[(x / 2) * u_step]) - 128;
+        auto clip = [] (std::int32_t value) {
+            return static_cast<std::uint8_t>(std::min(std::max(value, 0), 255));
+        };
+        dst[3 * x + (bgr ? 2 : 0)] = clip((kY * c + kRV * e + 4096) >> 13);
+        dst[3 * x + 1]             = clip((kY * c + kGU * d + kGV * e + 4096) >> 13);
+        dst[3 * x + (bgr ? 0 : 2)] = clip((kY * c + kBU * d + 4096) >> 13);
+    }
+}
+#endif
+
+// Full conversion, parallel over batch x luma rows; every row pulls its
+// chroma from row / 2 so bands never share output. u_step is 2 for the
+// interleaved NV12 chroma plane and 1 for the split I420 planes
+template <typename T>
+void ConvertYUV(const T* y, const T* u, const T* v, std::size_t u_step,
+                T* dst, std::size_t batch, std::size_t height, std::size_t width,
+                std::size_t stride_y, std::size_t stride_uv, bool bgr) {
+    const auto uv_row_elems = (width / 2) * u_step;
+    InferenceEngine::parallel_for2d(batch, height, [&] (std::size_t n, std::size_t row) {
+        ConvertRow(y + n * stride_y + row * width,
+                   u + n * stride_uv + (row / 2) * uv_row_elems,
+                   v + n * stride_uv + (row / 2) * uv_row_elems,
+                   u_step,
+                   dst + (n * height + row) * width * 3,
+                   width,
+                   bgr);
+    });
+}
+}  // namespace yuv
+}  // namespace ArmPlugin
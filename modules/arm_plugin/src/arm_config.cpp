@@ -9,10 +9,36 @@
 
 #include <ie_plugin_config.hpp>
 
+#include <arm_compute/runtime/Scheduler.h>
+
 #include "arm_config.hpp"
+#include "arm_load_profile.hpp"
 
 using namespace ArmPlugin;
 
+// Derives the THROUGHPUT stream layout from the detected core topology: cores
+// are grouped by reported CPU model (big.LITTLE clusters on mobile SoCs, one
+// uniform group on server parts) and each stream gets up to four cores of one
+// group, so a stream never straddles heterogeneous clusters
+static std::pair<int, int> ThroughputStreamLayout() {
+    const auto& cpuInfo = arm_compute::Scheduler::get().cpu_info();
+    const int cores = std::max<int>(1, cpuInfo.get_cpu_num());
+
+    std::map<arm_compute::CPUModel, int> clusters;
+    for (int cpu = 0; cpu < cores; ++cpu) {
+        ++clusters[cpuInfo.get_cpu_model(cpu)];
+    }
+
+    int streams = 0;
+    int threadsPerStream = 1;
+    for (auto&& cluster : clusters) {
+        const int perStream = std::min(cluster.second, 4);
+        streams += std::max(1, cluster.second / perStream);
+        threadsPerStream = std::max(threadsPerStream, perStream);
+    }
+    return {std::max(1, streams), threadsPerStream};
+}
+
 Configuration::Configuration() {
     _streamsExecutorConfig._streams = 1;
     _streamsExecutorConfig._threadsPerStream = std::thread::hardware_concurrency();
@@ -21,14 +47,18 @@ Configuration::Configuration() {
 
 Configuration::Configuration(const ConfigMap& config, const Configuration& defaultCfg, bool throwOnUnsupported) {
     *this = defaultCfg;
+    // Every network load gets its own profile; copying defaultCfg must not
+    // leak the previous load's timings into this one
+    _loadProfile = std::make_shared<LoadProfile>();
     auto streamExecutorConfigKeys = _streamsExecutorConfig.SupportedKeys();
     for (auto&& c : config) {
         const auto& key = c.first;
         const auto& value = c.second;
         if ((streamExecutorConfigKeys.end() !=
              std::find(std::begin(streamExecutorConfigKeys), std::end(streamExecutorConfigKeys), key))) {
+            // CPU_BIND_THREAD is among the supported keys, so the user choice of
+            // binding (CORES/NUMA/HYBRID_AWARE) is preserved; the default stays NONE
             _streamsExecutorConfig.SetConfig(key, value);
-            _streamsExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::NONE;
         } else if (CONFIG_KEY(PERF_COUNT) == key) {
             _perfCount = (CONFIG_VALUE(YES) == value);
         } else if (CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS) == key) {
@@ -39,10 +69,116 @@ Configuration::Configuration(const ConfigMap& config, const Configuration& defau
             _lpt = (CONFIG_VALUE(YES) == value);
         } else if (CONFIG_KEY_INTERNAL(DUMP_GRAPH) == key) {
             _dump = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(WAVEFRONT_EXEC) == key) {
+            _wavefront = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(INTRA_OP_THREADS) == key) {
+            _intraOpThreads = std::stoi(value);
+        } else if (CONFIG_KEY_INTERNAL(AUTO_BATCH_SIZE) == key) {
+            _autoBatch = std::stoi(value);
+        } else if (CONFIG_KEY_INTERNAL(AUTO_BATCH_TIMEOUT) == key) {
+            _autoBatchTimeout = std::stoi(value);
+        } else if (CONFIG_KEY_INTERNAL(SCHED_TUNING_PATH) == key) {
+            _schedTuningPath = value;
+        } else if (CONFIG_KEY_INTERNAL(SCHED_TELEMETRY) == key) {
+            _schedTelemetry = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(SCHED_TELEMETRY_PATH) == key) {
+            _schedTelemetryPath = value;
+        } else if (CONFIG_KEY_INTERNAL(KERNEL_ISA) == key) {
+            _kernelIsa = value;
+        } else if (CONFIG_KEY_INTERNAL(LAZY_PREPARE) == key) {
+            _lazyPrepare = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(HUGE_PAGES) == key) {
+            _hugePages = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(FP16_ACTIVATIONS) == key) {
+            _fp16Activations = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(FP32_SENSITIVE_OPS) == key) {
+            _fp32SensitiveOps = value;
+        } else if (CONFIG_KEY_INTERNAL(EMB_PREFETCH_DISTANCE) == key) {
+            _embPrefetchDistance = std::stoi(value);
+        } else if (CONFIG_KEY_INTERNAL(DYNAMIC_QUANTIZATION) == key) {
+            _dynamicQuantization = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(NODE_AFFINITY) == key) {
+            _nodeAffinity = value;
+        } else if (CONFIG_KEY_INTERNAL(AB_CALIBRATION) == key) {
+            _abCalibration = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(EXEC_TRACE) == key) {
+            _execTrace = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(PMU_COUNTERS) == key) {
+            _pmuCounters = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(ADAPTIVE_THROTTLING) == key) {
+            _adaptiveThrottling = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(SHARED_EXECUTOR) == key) {
+            _sharedExecutor = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(EXEC_WEIGHT) == key) {
+            _execWeight = std::stoi(value);
+            if (_execWeight < 1) {
+                IE_THROW() << "Executor weight should be positive: " << value;
+            }
+        } else if (CONFIG_KEY_INTERNAL(WEIGHT_COMPRESSION) == key) {
+            _weightCompression = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(COST_MODEL_PATH) == key) {
+            _costModelPath = value;
+        } else if (CONFIG_KEY_INTERNAL(CGROUP_LIMITS) == key) {
+            _cgroupLimits = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(CONV_METHOD) == key) {
+            _convMethod = value;
+        } else if (CONFIG_KEY_INTERNAL(CONV_TUNING_PATH) == key) {
+            _convTuningPath = value;
+        } else if (CONFIG_KEY_INTERNAL(FAST_MATH) == key) {
+            _fastMath = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(SHAPE_BUCKETS) == key) {
+            _shapeBuckets = value;
+        } else if (CONFIG_KEY_INTERNAL(WEIGHT_STREAMING) == key) {
+            _weightStreaming = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(WEIGHT_WINDOW_MB) == key) {
+            _weightWindowMb = std::stoi(value);
+            if (_weightWindowMb < 1) {
+                IE_THROW() << "Weight window should be positive: " << value;
+            }
+        } else if (CONFIG_KEY_INTERNAL(SPARSE_KERNELS) == key) {
+            _sparseKernels = (CONFIG_VALUE(YES) == value);
+        } else if (CONFIG_KEY_INTERNAL(MODEL_BUDGET_MB) == key) {
+            _modelBudgetMb = std::stoi(value);
+            if (_modelBudgetMb < 0) {
+                IE_THROW() << "Model budget should not be negative: " << value;
+            }
+        } else if (CONFIG_KEY_INTERNAL(REQUEST_PRIORITY) == key) {
+            if ((value != "HIGH") && (value != "NORMAL")) {
+                IE_THROW() << "Unsupported request priority value: " << value;
+            }
+            _requestPriority = value;
+        } else if (CONFIG_KEY(PERFORMANCE_HINT) == key) {
+            if (!value.empty() && CONFIG_VALUE(LATENCY) != value && CONFIG_VALUE(THROUGHPUT) != value) {
+                IE_THROW() << "Unsupported performance hint value: " << value;
+            }
+            _performanceHint = value;
+        } else if (CONFIG_KEY(PERFORMANCE_HINT_NUM_REQUESTS) == key) {
+            _performanceHintNumRequests = std::stoi(value);
         }  else if (throwOnUnsupported) {
             IE_THROW(NotFound) << ": " << key;
         }
     }
+    // The hint is a fallback for users who do not hand-tune the executor:
+    // explicit stream/thread settings always win
+    if (!_performanceHint.empty() &&
+        0 == config.count(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) &&
+        0 == config.count(CONFIG_KEY(CPU_THREADS_NUM))) {
+        if (CONFIG_VALUE(LATENCY) == _performanceHint) {
+            // One stream over every core; the scheduler's inline fast path keeps
+            // small kernels on the calling thread, so the wide fan-out only
+            // happens where it pays off
+            _streamsExecutorConfig._streams = 1;
+            _streamsExecutorConfig._threadsPerStream = std::thread::hardware_concurrency();
+        } else {
+            const auto layout = ThroughputStreamLayout();
+            int streams = layout.first;
+            if (_performanceHintNumRequests > 0) {
+                streams = std::min(streams, _performanceHintNumRequests);
+            }
+            _streamsExecutorConfig._streams = streams;
+            _streamsExecutorConfig._threadsPerStream = layout.second;
+        }
+    }
     if (_exclusiveAsyncRequests)
         _streamsExecutorConfig._streams = 1;
 }
@@ -62,6 +198,76 @@ InferenceEngine::Parameter Configuration::Get(const std::string& name) const {
         return {_lpt ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
     } else if (name == CONFIG_KEY_INTERNAL(DUMP_GRAPH)) {
         return {_dump ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(WAVEFRONT_EXEC)) {
+        return {_wavefront ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(INTRA_OP_THREADS)) {
+        return {std::to_string(_intraOpThreads)};
+    } else if (name == CONFIG_KEY_INTERNAL(AUTO_BATCH_SIZE)) {
+        return {std::to_string(_autoBatch)};
+    } else if (name == CONFIG_KEY_INTERNAL(AUTO_BATCH_TIMEOUT)) {
+        return {std::to_string(_autoBatchTimeout)};
+    } else if (name == CONFIG_KEY_INTERNAL(SCHED_TUNING_PATH)) {
+        return {_schedTuningPath};
+    } else if (name == CONFIG_KEY_INTERNAL(SCHED_TELEMETRY)) {
+        return {_schedTelemetry ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(SCHED_TELEMETRY_PATH)) {
+        return {_schedTelemetryPath};
+    } else if (name == CONFIG_KEY_INTERNAL(KERNEL_ISA)) {
+        return {_kernelIsa};
+    } else if (name == CONFIG_KEY_INTERNAL(LAZY_PREPARE)) {
+        return {_lazyPrepare ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(HUGE_PAGES)) {
+        return {_hugePages ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(FP16_ACTIVATIONS)) {
+        return {_fp16Activations ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(FP32_SENSITIVE_OPS)) {
+        return {_fp32SensitiveOps};
+    } else if (name == CONFIG_KEY_INTERNAL(EMB_PREFETCH_DISTANCE)) {
+        return {std::to_string(_embPrefetchDistance)};
+    } else if (name == CONFIG_KEY_INTERNAL(DYNAMIC_QUANTIZATION)) {
+        return {_dynamicQuantization ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(NODE_AFFINITY)) {
+        return {_nodeAffinity};
+    } else if (name == CONFIG_KEY_INTERNAL(AB_CALIBRATION)) {
+        return {_abCalibration ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(EXEC_TRACE)) {
+        return {_execTrace ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(PMU_COUNTERS)) {
+        return {_pmuCounters ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(ADAPTIVE_THROTTLING)) {
+        return {_adaptiveThrottling ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(SHARED_EXECUTOR)) {
+        return {_sharedExecutor ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(EXEC_WEIGHT)) {
+        return {std::to_string(_execWeight)};
+    } else if (name == CONFIG_KEY_INTERNAL(WEIGHT_COMPRESSION)) {
+        return {_weightCompression ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(COST_MODEL_PATH)) {
+        return {_costModelPath};
+    } else if (name == CONFIG_KEY_INTERNAL(CGROUP_LIMITS)) {
+        return {_cgroupLimits ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(CONV_METHOD)) {
+        return {_convMethod};
+    } else if (name == CONFIG_KEY_INTERNAL(CONV_TUNING_PATH)) {
+        return {_convTuningPath};
+    } else if (name == CONFIG_KEY_INTERNAL(FAST_MATH)) {
+        return {_fastMath ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(SHAPE_BUCKETS)) {
+        return {_shapeBuckets};
+    } else if (name == CONFIG_KEY_INTERNAL(WEIGHT_STREAMING)) {
+        return {_weightStreaming ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(WEIGHT_WINDOW_MB)) {
+        return {std::to_string(_weightWindowMb)};
+    } else if (name == CONFIG_KEY_INTERNAL(SPARSE_KERNELS)) {
+        return {_sparseKernels ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (name == CONFIG_KEY_INTERNAL(MODEL_BUDGET_MB)) {
+        return {std::to_string(_modelBudgetMb)};
+    } else if (name == CONFIG_KEY_INTERNAL(REQUEST_PRIORITY)) {
+        return {_requestPriority};
+    } else if (name == CONFIG_KEY(PERFORMANCE_HINT)) {
+        return {_performanceHint};
+    } else if (name == CONFIG_KEY(PERFORMANCE_HINT_NUM_REQUESTS)) {
+        return {std::to_string(_performanceHintNumRequests)};
     }  else {
         IE_THROW(NotFound) << ": " << name;
     }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <map>
 
@@ -15,10 +16,44 @@ namespace InferenceEngine {
 namespace PluginConfigInternalParams {
 DECLARE_CONFIG_KEY(USE_REF_IMPL);
 DECLARE_CONFIG_KEY(DUMP_GRAPH);
+DECLARE_CONFIG_KEY(WAVEFRONT_EXEC);
+DECLARE_CONFIG_KEY(INTRA_OP_THREADS);
+DECLARE_CONFIG_KEY(AUTO_BATCH_SIZE);
+DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+DECLARE_CONFIG_KEY(SCHED_TUNING_PATH);
+DECLARE_CONFIG_KEY(SCHED_TELEMETRY);
+DECLARE_CONFIG_KEY(SCHED_TELEMETRY_PATH);
+DECLARE_CONFIG_KEY(KERNEL_ISA);
+DECLARE_CONFIG_KEY(LAZY_PREPARE);
+DECLARE_CONFIG_KEY(HUGE_PAGES);
+DECLARE_CONFIG_KEY(FP16_ACTIVATIONS);
+DECLARE_CONFIG_KEY(FP32_SENSITIVE_OPS);
+DECLARE_CONFIG_KEY(EMB_PREFETCH_DISTANCE);
+DECLARE_CONFIG_KEY(DYNAMIC_QUANTIZATION);
+DECLARE_CONFIG_KEY(NODE_AFFINITY);
+DECLARE_CONFIG_KEY(AB_CALIBRATION);
+DECLARE_CONFIG_KEY(EXEC_TRACE);
+DECLARE_CONFIG_KEY(PMU_COUNTERS);
+DECLARE_CONFIG_KEY(ADAPTIVE_THROTTLING);
+DECLARE_CONFIG_KEY(REQUEST_PRIORITY);
+DECLARE_CONFIG_KEY(SHARED_EXECUTOR);
+DECLARE_CONFIG_KEY(EXEC_WEIGHT);
+DECLARE_CONFIG_KEY(WEIGHT_COMPRESSION);
+DECLARE_CONFIG_KEY(COST_MODEL_PATH);
+DECLARE_CONFIG_KEY(CGROUP_LIMITS);
+DECLARE_CONFIG_KEY(CONV_METHOD);
+DECLARE_CONFIG_KEY(CONV_TUNING_PATH);
+DECLARE_CONFIG_KEY(FAST_MATH);
+DECLARE_CONFIG_KEY(SHAPE_BUCKETS);
+DECLARE_CONFIG_KEY(WEIGHT_STREAMING);
+DECLARE_CONFIG_KEY(WEIGHT_WINDOW_MB);
+DECLARE_CONFIG_KEY(SPARSE_KERNELS);
+DECLARE_CONFIG_KEY(MODEL_BUDGET_MB);
 }  // namespace PluginConfigInternalParams
 }  // namespace InferenceEngine
 
 namespace ArmPlugin {
+struct LoadProfile;
 using ConfigMap = std::map<std::string, std::string>;
 struct Configuration {
     Configuration();
@@ -40,6 +75,162 @@ struct Configuration {
     bool _ref                    = true;
     bool _lpt                    = true;
     bool _dump                   = false;
+    // Run independent graph branches concurrently on the streams executor.
+    // Disables activation memory reuse, so it trades memory for parallelism.
+    bool _wavefront              = false;
+    // Cap on threads used inside a single kernel, 0 keeps the executor default
+    int  _intraOpThreads         = 0;
+    // Fuse up to N concurrent single-image requests into one batched execution (1 disables)
+    int  _autoBatch              = 1;
+    // How long an incomplete batch waits for more requests before flushing, microseconds
+    int  _autoBatchTimeout       = 100;
+    // File the scheduler split-granularity tuning table is loaded from at network
+    // load and stored to at network release; empty keeps tuning in-memory only
+    std::string _schedTuningPath;
+    // Collect per-kernel scheduler telemetry (split dim, window count, worker
+    // spread, queue wait), queryable via the SCHED_TELEMETRY network metric
+    bool _schedTelemetry         = false;
+    // CSV file the telemetry is dumped to at network release; empty disables the dump
+    std::string _schedTelemetryPath;
+    // Comma-separated ISA extensions kernels may rely on (e.g. "NEON,FP16");
+    // empty allows everything the CPU reports. See arm_isa.hpp.
+    std::string _kernelIsa;
+    // Defer per-layer weight packing (IFunction::prepare) to first execution,
+    // amortizing load time across early inferences; default prepares at load
+    bool _lazyPrepare            = false;
+    // Back activation pool slabs with 2 MB huge pages (explicit, falling back
+    // to transparent) to cut dTLB misses on large activations; Linux only
+    bool _hugePages              = false;
+    // Run f32 models in f16 (~2x FLOPS on Armv8.2+ and half the activation
+    // pool) while ops listed in _fp32SensitiveOps execute in f32 with converts
+    // at their boundaries; applied only when the CPU has FP16 kernels and the
+    // graph is not quantized. See pass::MixedPrecisionStorage
+    bool _fp16Activations        = false;
+    std::string _fp32SensitiveOps = "Softmax,Exp,Log,Erf,Power,MVN,NormalizeL2,ReduceSum,ReduceMean";
+    // How many embedding rows ahead the bag-sum kernels software-prefetch;
+    // latency-bound tables benefit from larger distances, 0 disables
+    int  _embPrefetchDistance    = 8;
+    // Run uncalibrated f32 MatMuls through the int8 GEMM: weights are
+    // quantized symmetrically per output channel at load, activations per
+    // inference from their observed range; see NEDynamicQuantizedMatMul
+    bool _dynamicQuantization    = false;
+    // Per-node execution affinity: "name1:REF;name2:ACL". Nodes pinned to REF
+    // keep their generic opset form through the Arm substitution passes and
+    // execute on the reference path, so one misbehaving ACL kernel can be
+    // routed around without flipping the whole network to USE_REF_IMPL
+    std::string _nodeAffinity;
+    // Measure ACL against the reference implementation for every dual-engine
+    // layer at network load and pin the faster one (for some shapes, e.g.
+    // small-channel cases, the reference loop beats a poorly tiled kernel);
+    // winners are merged into _nodeAffinity, so the empirical choice is baked
+    // into the transformed function and exported blobs. Costs a few dry runs
+    // of the network per load. See CalibrateNodeAffinity
+    bool _abCalibration          = false;
+    // Record pipeline stages, per-layer spans and scheduler kernel dispatches
+    // into the process-wide trace ring, dumpable as Chrome trace JSON through
+    // the "DUMP_TRACE" SetConfig key; see TraceRecorder
+    bool _execTrace              = false;
+    // Sample PMU counters (cycles, instructions, cache refills, backend
+    // stalls via linux perf_event) around each layer run on the profiled
+    // path, exposed through ArmInferRequest::GetPmuCounts; tells memory-bound
+    // layers from compute-bound ones. Needs perf_event access and PERF_COUNT
+    bool _pmuCounters            = false;
+    // Adapt to thermal/DVFS throttling at run time: when the smoothed graph
+    // time drifts well above its post-warmup baseline, per-stream kernel
+    // parallelism is stepped down and the THROTTLE_STATE metric raises a
+    // frame-skip signal; see ExecutableNetwork::RecordGraphTime
+    bool _adaptiveThrottling     = false;
+    // Run this network on the process-wide shared streams executor instead of
+    // its own: all participating networks share one fixed thread set and each
+    // gets a weighted share of the streams, so concurrent cascades degrade
+    // into predictable time slicing instead of core oversubscription. See
+    // SharedExecutor
+    bool _sharedExecutor        = false;
+    // This network's relative share of the shared executor's streams (only
+    // meaningful with SHARED_EXECUTOR); a weight-2 network gets twice the
+    // concurrent task quota of a weight-1 one
+    int  _execWeight            = 1;
+    // Block-compress the weights section of exported blobs (see WeightCodec);
+    // import auto-detects the framing, so the key only matters at export time.
+    // Keeps peak import memory at compressed-size + weights instead of 2x
+    // weights, which is what fits a 4 GB device loading a GB-scale model
+    bool _weightCompression     = false;
+    // Stream weights through a bounded resident window for models larger
+    // than device RAM: unpadded constants already alias the IR reader's
+    // file-backed buffer, so the serial executor issues kernel readahead a
+    // couple of layers ahead of execution and hands consumed weight pages
+    // back once the resident estimate exceeds the window. Trades re-read
+    // bandwidth per inference for a weight footprint bounded by the window.
+    // Serial execution only. See WeightStreamer
+    bool _weightStreaming       = false;
+    // Resident weight window of the streaming mode, megabytes
+    int  _weightWindowMb        = 512;
+    // Run structurally pruned f32 MatMuls and pointwise convolutions on
+    // compressed-weight kernels that skip the zeros (block-CSR GEMM,
+    // per-output-channel compressed 1x1 conv) instead of the dense packed
+    // GEMM; engaged per layer when the weight density sits below the
+    // crossover, overridable per SoC through the cost table
+    // ("sparse-matmul"/"sparse-conv1x1"). See arm_sparse_gemm.hpp
+    bool _sparseKernels         = false;
+    // Memory budget shared by every network this plugin instance has loaded
+    // with the key set, megabytes; 0 keeps all models fully resident. When
+    // the summed active footprint (activation pool slabs plus resident
+    // weights) exceeds the budget, the least recently used idle networks are
+    // hibernated - pool slabs freed, weight pages handed back to the file
+    // backing - and woken transparently on their next inference. Bounds RSS
+    // for multi-tenant serving where only a few of many loaded models are
+    // hot at a time. See ModelLifecycle
+    int  _modelBudgetMb         = 0;
+    // Per-SoC cost table file consulted by shape-dependent transform
+    // decisions (reduce-to-pooling and friends); empty keeps the built-in
+    // heuristics. See CostModel for the format and calibration workflow
+    std::string _costModelPath;
+    // Size thread pools against the container's cgroup CPU quota/cpuset
+    // instead of the host core count (see CgroupLimitedCpus); explicit
+    // CPU_THREADS_NUM / INTRA_OP_THREADS settings still win. On when deployed,
+    // a no-op outside containers, switchable off for quota-oblivious baselines
+    bool _cgroupLimits          = true;
+    // Convolution method control: "name:WINOGRAD;name2:GEMM" pins individual
+    // layers past the NEConvolutionLayer heuristic (GEMM/WINOGRAD/DIRECT),
+    // "AUTO" benchmarks the candidates per layer during warm-up and locks in
+    // the fastest; empty keeps the heuristic. See NEConvolutionLayerQI
+    std::string _convMethod;
+    // File the autotuned convolution method winners are loaded from at network
+    // load and stored to at release (per-SoC, like SCHED_TUNING_PATH); empty
+    // keeps the winners in-memory only. See ConvMethodTuner
+    std::string _convTuningPath;
+    // Route f32 transcendental unaries without an ACL kernel (Erf, Cos,
+    // Atanh) through the NEON polynomial approximations in arm_neon_math.hpp
+    // instead of the scalar libm reference loops; the approximation error
+    // bounds are documented with the kernels. FAST_MATH(NO) restores the
+    // bit-exact libm path for accuracy-strict deployments
+    bool _fastMath              = true;
+    // Shape buckets compiled next to the full-shape graph, sharing its
+    // weights: "input:1,128|input:1,256" describes one bucket per
+    // '|'-separated group, each group in the RESHAPE per-input format. Infer
+    // requests route to the smallest bucket the actual input fits into, so
+    // variable-length workloads (e.g. sequences of 16-512 tokens) stop paying
+    // for full-shape compute on short inputs. Empty disables bucketing. See
+    // ExecutableNetwork::InitShapeBuckets
+    std::string _shapeBuckets;
+    // Priority class ("HIGH" or "NORMAL") stamped on infer requests created
+    // while it is in effect (changeable at run time through the network
+    // SetConfig): HIGH requests are admitted to their execution context before
+    // any waiting NORMAL request, so an interactive class keeps its tail
+    // latency under queued batch work. See ExecutableNetwork::GraphLock
+    std::string _requestPriority = "NORMAL";
+    // Standard PERFORMANCE_HINT: empty keeps the explicit stream-executor
+    // settings; LATENCY runs one stream over every core, THROUGHPUT derives
+    // the stream count and per-stream core share from the detected topology.
+    // Explicit CPU_THROUGHPUT_STREAMS/CPU_THREADS_NUM settings win over the hint
+    std::string _performanceHint;
+    // PERFORMANCE_HINT_NUM_REQUESTS: caps the streams derived from the
+    // THROUGHPUT hint at the application's request concurrency, 0 means no cap
+    int  _performanceHintNumRequests = 0;
+    // Per-load wall-time breakdown (transformation stages, ACL configure),
+    // shared by every Configuration copy made during one LoadNetwork and
+    // exposed through the LOAD_TIME_PROFILE network metric
+    std::shared_ptr<LoadProfile> _loadProfile;
     mutable InferenceEngine::IStreamsExecutor::Config _streamsExecutorConfig;
 };
 }  //  namespace ArmPlugin
@@ -0,0 +1,51 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+
+#include "arm_conv_tuner.hpp"
+
+using namespace ArmPlugin;
+
+ConvMethodTuner& ConvMethodTuner::get() {
+    static ConvMethodTuner tuner;
+    return tuner;
+}
+
+std::string ConvMethodTuner::Winner(const std::string& key) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto it = _winners.find(key);
+    return it != _winners.end() ? it->second : std::string{};
+}
+
+void ConvMethodTuner::SetWinner(const std::string& key, const std::string& method) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _winners[key] = method;
+}
+
+void ConvMethodTuner::Load(const std::string& path) {
+    std::ifstream file{path};
+    if (!file.is_open()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{_mutex};
+    std::string key;
+    std::string method;
+    while (std::getline(file, key, '\t') && std::getline(file, method)) {
+        if (!method.empty()) {
+            _winners[key] = method;
+        }
+    }
+}
+
+void ConvMethodTuner::Store(const std::string& path) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    std::ofstream file{path};
+    if (!file.is_open()) {
+        return;
+    }
+    for (auto&& entry : _winners) {
+        file << entry.first << '\t' << entry.second << '\n';
+    }
+}
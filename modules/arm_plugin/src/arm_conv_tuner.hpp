@@ -0,0 +1,40 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ArmPlugin {
+
+/**
+ * @brief Process-wide table of autotuned convolution method winners.
+ *
+ * NEConvolutionLayer picks its GEMM/Winograd/Direct method from a built-in
+ * heuristic that gets some shapes wrong. With CONV_METHOD(AUTO) each
+ * convolution benchmarks its candidate methods during warm-up and records
+ * the fastest here, keyed by the conv signature (shapes, strides, dilation,
+ * data type), so later loads of the same or similar models skip the
+ * benchmarking. CONV_TUNING_PATH persists the table per SoC across
+ * processes, same as the scheduler split-granularity tuner: one
+ * "key<TAB>method" line per converged convolution.
+ */
+struct ConvMethodTuner {
+    static ConvMethodTuner& get();
+
+    /// Converged winner for a conv signature; empty when not tuned yet
+    std::string Winner(const std::string& key);
+    void SetWinner(const std::string& key, const std::string& method);
+    void Load(const std::string& path);
+    void Store(const std::string& path);
+
+private:
+    ConvMethodTuner() = default;
+    std::unordered_map<std::string, std::string>    _winners;
+    std::mutex                                      _mutex;
+};
+
+}  // namespace ArmPlugin
@@ -0,0 +1,83 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <cstdint>
+
+#include <ie_parallel.hpp>
+
+namespace ArmPlugin {
+namespace cast {
+template <typename Src, typename Dst>
+void ConvertBlock(const Src* src, Dst* dst, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] = static_cast<Dst>(src[i]);
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+inline void ConvertBlock(const std::int64_t* src, std::int32_t* dst, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_s32(dst + i, vcombine_s32(vmovn_s64(vld1q_s64(src + i)),
+                                        vmovn_s64(vld1q_s64(src + i + 2))));
+    }
+    for (; i < count; ++i) {
+        dst[i] = static_cast<std::int32_t>(src[i]);
+    }
+}
+
+inline void ConvertBlock(const std::uint64_t* src, std::int32_t* dst, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_s32(dst + i, vreinterpretq_s32_u32(vcombine_u32(vmovn_u64(vld1q_u64(src + i)),
+                                                              vmovn_u64(vld1q_u64(src + i + 2)))));
+    }
+    for (; i < count; ++i) {
+        dst[i] = static_cast<std::int32_t>(src[i]);
+    }
+}
+
+inline void ConvertBlock(const std::int32_t* src, std::int64_t* dst, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto values = vld1q_s32(src + i);
+        vst1q_s64(dst + i,     vmovl_s32(vget_low_s32(values)));
+        vst1q_s64(dst + i + 2, vmovl_s32(vget_high_s32(values)));
+    }
+    for (; i < count; ++i) {
+        dst[i] = static_cast<std::int64_t>(src[i]);
+    }
+}
+
+inline void ConvertBlock(const std::uint32_t* src, std::int64_t* dst, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto values = vld1q_u32(src + i);
+        vst1q_s64(dst + i,     vreinterpretq_s64_u64(vmovl_u32(vget_low_u32(values))));
+        vst1q_s64(dst + i + 2, vreinterpretq_s64_u64(vmovl_u32(vget_high_u32(values))));
+    }
+    for (; i < count; ++i) {
+        dst[i] = static_cast<std::int64_t>(src[i]);
+    }
+}
+#endif
+
+// Block-parallel element conversion; narrowing/widening blocks vectorize
+// with NEON where the lane types allow it and truncate like static_cast
+template <typename Src, typename Dst>
+void Convert(const Src* src, Dst* dst, std::size_t count) {
+    constexpr std::size_t block = 1 << 15;
+    const auto blocks = (count + block - 1) / block;
+    InferenceEngine::parallel_for(blocks, [&] (std::size_t b) {
+        const auto start = b * block;
+        ConvertBlock(src + start, dst + start, std::min(block, count - start));
+    });
+}
+}  // namespace cast
+}  // namespace ArmPlugin
@@ -2,14 +2,47 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_isa.hpp"
+#include "arm_itt.hpp"
+#include "arm_load_profile.hpp"
 #include "opset/opset.hpp"
 
 using namespace InferenceEngine::details;
 
 namespace ArmPlugin {
+void CopyTensorRows(arm_compute::ITensor& dst, const arm_compute::ITensor& src) {
+    const auto& shape = src.info()->tensor_shape();
+    const auto rowBytes = shape[0] * src.info()->element_size();
+    std::size_t rows = 1;
+    for (std::size_t dim = 1; dim < shape.num_dimensions(); ++dim) {
+        rows *= shape[dim];
+    }
+    const auto& srcStrides = src.info()->strides_in_bytes();
+    const auto& dstStrides = dst.info()->strides_in_bytes();
+    const auto* srcBase = src.buffer() + src.info()->offset_first_element_in_bytes();
+    auto* dstBase = dst.buffer() + dst.info()->offset_first_element_in_bytes();
+    InferenceEngine::parallel_for(rows, [&] (std::size_t row) {
+        auto remainder = row;
+        std::size_t srcOffset = 0;
+        std::size_t dstOffset = 0;
+        for (std::size_t dim = 1; dim < shape.num_dimensions(); ++dim) {
+            auto index = remainder % shape[dim];
+            remainder /= shape[dim];
+            srcOffset += index * srcStrides[dim];
+            dstOffset += index * dstStrides[dim];
+        }
+        std::memcpy(dstBase + dstOffset, srcBase + srcOffset, rowBytes);
+    });
+}
+
 arm_compute::TensorShape ShapeCast(const ngraph::Shape& shape) {
     arm_compute::TensorShape tensorShape;
     for (std::size_t i = 0; i < shape.size(); ++i) {
@@ -41,8 +74,10 @@ std::size_t AxisCast(const std::size_t axis, const std::size_t shapeSize) {
     return shapeSize - axis - 1;
 }
 
-Converter::Converter(const std::shared_ptr<const ngraph::Function> function, const Configuration& cfg) :
-    _function{function}, _cfg{cfg} {
+Converter::Converter(const std::shared_ptr<const ngraph::Function> function, const Configuration& cfg,
+                     const std::shared_ptr<VariableStateMap>& variableStates,
+                     const std::shared_ptr<AllocationLedger>& allocationLedger) :
+    _function{function}, _cfg{cfg}, _variableStates{variableStates}, _allocationLedger{allocationLedger} {
     Register<opset::Parameter>();
     Register<opset::Constant>();
     Register<opset::ArmConvolution>();
@@ -78,6 +113,8 @@ Converter::Converter(const std::shared_ptr<const ngraph::Function> function, con
     Register<opset::Pad>();
     Register<opset::BatchNormInference>();
     Register<opset::HSwish>();
+    Register<opset::Swish>();
+    Register<opset::Mish>();
     Register<opset::SoftPlus>();
     Register<opset::Log>();
     Register<opset::Sin>();
@@ -101,6 +138,8 @@ Converter::Converter(const std::shared_ptr<const ngraph::Function> function, con
     Register<opset::Greater>();
     Register<opset::GreaterEqual>();
     Register<opset::Select>();
+    Register<opset::ArmFusedSelect>();
+    Register<opset::ArmSoftmaxTopK>();
     Register<opset::ReorgYolo>();
     Register<opset::BatchToSpace>();
     Register<opset::SpaceToBatch>();
@@ -169,7 +208,9 @@ Converter::Converter(const std::shared_ptr<const ngraph::Function> function, con
         Register<opset::LSTMSequence>();
         Register<opset::GRUSequence>();
         Register<opset::RNNSequence>();
+        Register<opset::TensorIterator>();
         Register<opset::Bucketize>();
+        Register<opset::Tile>();
         Register<opset::DFT>();
         Register<opset::IDFT>();
         Register<opset::FakeQuantize>();
@@ -182,8 +223,39 @@ Converter::Converter(const std::shared_ptr<const ngraph::Function> function, con
         Register<ngraph::op::v8::I420toRGB>();
         Register<ngraph::op::v8::MaxPool>();
     }
+    Register<opset::ReadValue>();
+    Register<opset::Assign>();
     Register<opset::Result>();
-    for (auto&& node : function->get_ordered_ops()) {
+    // An Assign writes the next value into the persistent state tensor of its
+    // variable, so every other reader of the matching ReadValue output must
+    // run first; the control dependencies pin that order into orderedOps.
+    for (auto&& node : function->get_ops()) {
+        auto assign = std::dynamic_pointer_cast<opset::Assign>(node);
+        if (!assign) {
+            continue;
+        }
+        for (auto&& other : function->get_ops()) {
+            auto readValue = std::dynamic_pointer_cast<opset::ReadValue>(other);
+            if (!readValue || readValue->get_variable_id() != assign->get_variable_id()) {
+                continue;
+            }
+            for (auto&& targetInput : readValue->output(0).get_target_inputs()) {
+                auto consumer = targetInput.get_node();
+                if (consumer != assign.get()) {
+                    assign->add_control_dependency(consumer->shared_from_this());
+                }
+            }
+        }
+    }
+    auto orderedOps = function->get_ordered_ops();
+    auto minId = std::numeric_limits<std::size_t>::max();
+    std::size_t maxId = 0;
+    for (auto&& node : orderedOps) {
+        minId = std::min(minId, node->get_instance_id());
+        maxId = std::max(maxId, node->get_instance_id());
+    }
+    _layers.reserve(minId, maxId, orderedOps.size());
+    for (auto&& node : orderedOps) {
         auto& layer = _layers[node->get_instance_id()];
         for (auto&& input : node->inputs()) {
             auto sourceOutput = input.get_source_output();
@@ -212,10 +284,265 @@ Converter::Converter(const std::shared_ptr<const ngraph::Function> function, con
             }
         }
     }
+    // In-place planning: a unary activation that is the only consumer of its
+    // float input writes into the producer's tensor (ACL activation kernels
+    // accept src == dst), so the chain adds nothing to the activation pool.
+    // Parameters and constants are never aliased (their memory is imported),
+    // and neither are network outputs (their tensors get user memory bound).
+    for (auto&& node : orderedOps) {
+        if (!(ov::is_type<opset::Relu>(node)    || ov::is_type<opset::Sigmoid>(node) ||
+              ov::is_type<opset::Tanh>(node)    || ov::is_type<opset::Abs>(node)     ||
+              ov::is_type<opset::Clamp>(node)   || ov::is_type<opset::Sqrt>(node)    ||
+              ov::is_type<opset::Elu>(node)     || ov::is_type<opset::Exp>(node)     ||
+              ov::is_type<opset::Negative>(node) || ov::is_type<opset::Floor>(node)  ||
+              ov::is_type<opset::Log>(node)     || ov::is_type<opset::HSwish>(node)  ||
+              ov::is_type<opset::SoftPlus>(node))) {
+            continue;
+        }
+        auto sourceOutput = node->input(0).get_source_output();
+        auto sourceNode = sourceOutput.get_node();
+        // ReadValue outputs are the persistent state tensors; writing an
+        // activation result into them in place would corrupt the state
+        if (ngraph::op::is_constant(sourceNode) || ngraph::op::is_parameter(sourceNode) ||
+            ov::is_type<opset::ReadValue>(sourceNode)) {
+            continue;
+        }
+        if (sourceOutput.get_target_inputs().size() != 1) {
+            continue;
+        }
+        auto output = node->output(0);
+        auto elementType = output.get_element_type();
+        if ((elementType != sourceOutput.get_element_type()) ||
+            (elementType == ngraph::element::u8) || (elementType == ngraph::element::i8) ||
+            (output.get_partial_shape() != sourceOutput.get_partial_shape())) {
+            continue;
+        }
+        auto targetInputs = output.get_target_inputs();
+        if (std::any_of(std::begin(targetInputs), std::end(targetInputs), [] (auto& targetInput) {
+                return ngraph::op::is_output(targetInput.get_node());
+            })) {
+            continue;
+        }
+        auto root = sourceOutput;
+        auto itAlias = _aliases.find(root);
+        if (itAlias != _aliases.end()) {
+            root = itAlias->second;
+        }
+        _layers.at(node->get_instance_id())._outputs.at(output)._tensor =
+            _layers.at(root.get_node()->get_instance_id())._outputs.at(root)._tensor;
+        _aliases.emplace(output, root);
+    }
+    // Concat placement: inputs of an outermost-axis Concat are contiguous
+    // blocks of its output, so producers configure their ACL function against
+    // a sub-region view of the concat tensor and the Concat layer itself
+    // disappears from the execution plan. Only node types whose conversion is
+    // unconditionally an ACL function may target a view: native and reference
+    // conversions write through raw pointers that know nothing about views.
+    for (auto&& node : orderedOps) {
+        if (!(ov::is_type<opset::Concat>(node) || ov::is_type<opset::ArmConcat>(node))) {
+            continue;
+        }
+        auto concat = std::dynamic_pointer_cast<opset::Concat>(node);
+        auto output = concat->output(0);
+        const auto& outputShape = output.get_shape();
+        if (outputShape.empty() || concat->get_input_size() < 2) {
+            continue;
+        }
+        auto axis = concat->get_axis();
+        if (axis < 0) {
+            axis += outputShape.size();
+        }
+        // Sub-regions are contiguous iff every dimension outer to the axis is 1:
+        // axis 0, or e.g. the channel axis of a batch-1 tensor (the layout the
+        // grouped convolution decomposition produces)
+        if (!std::all_of(outputShape.begin(), outputShape.begin() + axis,
+                         [] (std::size_t dim) { return dim == 1; })) {
+            continue;
+        }
+        auto elementType = output.get_element_type();
+        // Quantized tensors carry per-tensor QuantizationInfo a view can not override
+        if ((elementType == ngraph::element::u8) || (elementType == ngraph::element::i8)) {
+            continue;
+        }
+        auto targetInputs = output.get_target_inputs();
+        // Network outputs get user memory imported per request; keep them whole
+        if (targetInputs.empty() || std::any_of(std::begin(targetInputs), std::end(targetInputs), [] (auto& targetInput) {
+                return ngraph::op::is_output(targetInput.get_node());
+            })) {
+            continue;
+        }
+        bool eligible = true;
+        for (auto&& input : concat->inputs()) {
+            auto sourceOutput = input.get_source_output();
+            auto sourceNode = sourceOutput.get_node();
+            if (!(ov::is_type<opset::ArmConvolution>(sourceNode) ||
+                  ov::is_type<opset::ArmGroupConvolution>(sourceNode) ||
+                  ov::is_type<opset::ArmMatMulBias>(sourceNode)) ||
+                (sourceOutput.get_target_inputs().size() != 1) ||
+                (sourceOutput.get_element_type() != elementType)) {
+                eligible = false;
+                break;
+            }
+        }
+        if (!eligible) {
+            continue;
+        }
+        auto& concatTensor = _layers.at(node->get_instance_id())._outputs.at(output)._tensor;
+        std::size_t offset = 0;
+        for (auto&& input : concat->inputs()) {
+            auto sourceOutput = input.get_source_output();
+            const auto& sourceShape = sourceOutput.get_shape();
+            arm_compute::Coordinates coords;
+            coords.set_num_dimensions(outputShape.size());
+            // ngraph dimension d is ACL dimension rank-1-d
+            coords.set(outputShape.size() - 1 - axis, static_cast<int>(offset));
+            auto& sourceTensor = _layers.at(sourceOutput.get_node()->get_instance_id())._outputs.at(sourceOutput);
+            sourceTensor._view = std::make_shared<arm_compute::SubTensor>(concatTensor.get(), ShapeCast(sourceShape), coords, true);
+            _concatPlacements.emplace(sourceOutput, output);
+            offset += sourceShape[axis];
+        }
+        _mergedConcats.emplace(node.get());
+    }
+    // Split placement: outputs of an outermost-axis Split are contiguous
+    // blocks of its input, so consumers that are unconditionally ACL functions
+    // read through a sub-region view of the input tensor and the Split layer
+    // disappears. The views join _aliases so the input tensor stays alive
+    // until the last split consumer has run.
+    for (auto&& node : orderedOps) {
+        if (!(ov::is_type<opset::Split>(node) || ov::is_type<opset::ArmSplit>(node))) {
+            continue;
+        }
+        auto split = std::dynamic_pointer_cast<opset::Split>(node);
+        if (split->get_output_size() < 2) {
+            continue;
+        }
+        auto axisConstant = std::dynamic_pointer_cast<opset::Constant>(split->input_value(1).get_node_shared_ptr());
+        if (!axisConstant) {
+            continue;
+        }
+        auto sourceOutput = split->input_value(0);
+        auto sourceNode = sourceOutput.get_node();
+        const auto& sourceShape = sourceOutput.get_shape();
+        auto axis = axisConstant->cast_vector<std::int64_t>()[0];
+        if (axis < 0) {
+            axis += sourceShape.size();
+        }
+        // Same contiguity rule as the concat placement above
+        if (!std::all_of(sourceShape.begin(), sourceShape.begin() + axis,
+                         [] (std::size_t dim) { return dim == 1; })) {
+            continue;
+        }
+        auto elementType = sourceOutput.get_element_type();
+        if ((elementType == ngraph::element::u8) || (elementType == ngraph::element::i8) ||
+            ngraph::op::is_constant(sourceNode) || ngraph::op::is_parameter(sourceNode) ||
+            ov::is_type<opset::ReadValue>(sourceNode)) {
+            continue;
+        }
+        // The input tensor must be a managed whole tensor, not itself a view
+        if (_layers.at(sourceNode->get_instance_id())._outputs.at(sourceOutput)._view != nullptr) {
+            continue;
+        }
+        auto sourceTargets = sourceOutput.get_target_inputs();
+        if (std::any_of(std::begin(sourceTargets), std::end(sourceTargets), [] (auto& targetInput) {
+                return ngraph::op::is_output(targetInput.get_node());
+            })) {
+            continue;
+        }
+        bool eligible = true;
+        for (auto&& output : split->outputs()) {
+            auto targetInputs = output.get_target_inputs();
+            if (targetInputs.empty()) {
+                eligible = false;
+                break;
+            }
+            for (auto&& targetInput : targetInputs) {
+                auto targetNode = targetInput.get_node();
+                // Only consumers configured as ACL functions can read a view
+                if (!(ov::is_type<opset::ArmConvolution>(targetNode) ||
+                      ov::is_type<opset::ArmGroupConvolution>(targetNode) ||
+                      ov::is_type<opset::ArmMatMulBias>(targetNode) ||
+                      ov::is_type<opset::MatMul>(targetNode))) {
+                    eligible = false;
+                    break;
+                }
+            }
+            if (!eligible) {
+                break;
+            }
+        }
+        if (!eligible) {
+            continue;
+        }
+        auto root = sourceOutput;
+        auto itAlias = _aliases.find(root);
+        if (itAlias != _aliases.end()) {
+            root = itAlias->second;
+        }
+        auto& sourceTensor = _layers.at(sourceNode->get_instance_id())._outputs.at(sourceOutput)._tensor;
+        std::size_t offset = 0;
+        for (auto&& output : split->outputs()) {
+            const auto& outputShape = output.get_shape();
+            arm_compute::Coordinates coords;
+            coords.set_num_dimensions(sourceShape.size());
+            coords.set(sourceShape.size() - 1 - axis, static_cast<int>(offset));
+            auto& outputTensor = _layers.at(node->get_instance_id())._outputs.at(output);
+            outputTensor._view = std::make_shared<arm_compute::SubTensor>(sourceTensor.get(), ShapeCast(outputShape), coords, true);
+            // Share the backing tensor like an in-place output so the lifetime
+            // bookkeeping in Configure allocates the input tensor, not a dummy
+            outputTensor._tensor = sourceTensor;
+            _aliases.emplace(output, root);
+            offset += outputShape[axis];
+        }
+        _mergedSplits.emplace(node.get());
+    }
+}
+
+arm_compute::Status Converter::ValidateIsa(const ngraph::Node* node) const {
+    auto precisionNeeds = [&] (const ngraph::element::Type& type, const char** extension) {
+        switch (type) {
+            case ngraph::element::Type_t::f16  : *extension = "FP16"; return true;
+            case ngraph::element::Type_t::bf16 : *extension = "BF16"; return true;
+            default : return false;
+        }
+    };
+    auto check = [&] (const ngraph::element::Type& type) -> arm_compute::Status {
+        const char* extension = nullptr;
+        if (precisionNeeds(type, &extension) && !IsaEnabled(extension, _cfg._kernelIsa)) {
+            return arm_compute::Status{arm_compute::ErrorCode::RUNTIME_ERROR,
+                std::string{extension} + " kernels are unavailable or excluded by KERNEL_ISA"};
+        }
+        return {};
+    };
+    for (auto&& input : node->inputs()) {
+        auto status = check(input.get_element_type());
+        if (status.error_code() != arm_compute::ErrorCode::OK) {
+            return status;
+        }
+    }
+    for (auto&& output : node->outputs()) {
+        auto status = check(output.get_element_type());
+        if (status.error_code() != arm_compute::ErrorCode::OK) {
+            return status;
+        }
+    }
+    // int8 layers are legal on any CPU, but a configured pin list demands the
+    // dot-product GEMM path: without SDOT/I8MM ACL silently takes the ~3x
+    // slower s8 kernels, and a pinned load should fail loudly instead
+    if (!_cfg._kernelIsa.empty()) {
+        auto quantized = std::any_of(node->input_values().begin(), node->input_values().end(), [] (auto& input) {
+            return (input.get_element_type() == ngraph::element::u8) || (input.get_element_type() == ngraph::element::i8);
+        });
+        if (quantized && !IsaEnabled("I8MM", _cfg._kernelIsa) && !IsaEnabled("DOTPROD", _cfg._kernelIsa)) {
+            return arm_compute::Status{arm_compute::ErrorCode::RUNTIME_ERROR,
+                "dot-product int8 kernels are unavailable or excluded by KERNEL_ISA"};
+        }
+    }
+    return {};
 }
 
 Layer::Map Converter::Configure(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
                                 arm_compute::MemoryGroup& memoryGroup) {
+    OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, "Converter::Configure");
     auto orderedOps = _function->get_ordered_ops();
     std::string unsupported;
     for (auto&& node : orderedOps) {
@@ -226,45 +553,170 @@ Layer::Map Converter::Configure(const std::shared_ptr<arm_compute::IMemoryManage
     if (!unsupported.empty()) {
         IE_THROW() << "Arm Plugin: Nodes from " << _function->get_friendly_name() << " are not supported by plugin:\n" << unsupported;
     }
-    for (const auto& node : orderedOps) {
+    // Conversion creation and ACL validation neither touch the memory manager nor
+    // depend on each other, so they run in parallel; the configure pass below has
+    // to stay ordered for the lifetime manager
+    std::vector<std::string> nodeErrors(orderedOps.size());
+    auto validateStart = std::chrono::high_resolution_clock::now();
+    InferenceEngine::parallel_for(orderedOps.size(), [&] (std::size_t i) {
+        const auto& node = orderedOps[i];
         Conversion::Ptr conversion;
         try {
             conversion = _conversions.at(node->get_type_info())(*node);
         } catch(std::exception& e) {
-            unsupported += ("\t" + node->get_friendly_name() +
+            nodeErrors[i] = ("\t" + node->get_friendly_name() +
                 " (" + node->get_type_name() + '.' + std::to_string(node->get_type_info().version) + ")- " + e.what() + ";\n");
         }
         if (conversion != nullptr) {
-            auto status = conversion->Validate();
+            auto status = ValidateIsa(node.get());
+            if (status.error_code() == arm_compute::ErrorCode::OK) {
+                status = conversion->Validate();
+            }
+            if ((status.error_code() != arm_compute::ErrorCode::OK) &&
+                _cfg._ref && !ForcedToReference(node.get())) {
+                // An ACL kernel rejecting this configuration is not fatal while
+                // reference fallbacks are allowed: pin the node to REF and let
+                // the conversion pick its in-process reference path. Keeps
+                // HETERO subgraphs loadable for every node QueryNetwork
+                // reported as supported (see Plugin::QueryNetwork)
+                node->get_rt_info()["ArmAffinity"] = std::string{"REF"};
+                Conversion::Ptr refConversion;
+                try {
+                    refConversion = _conversions.at(node->get_type_info())(*node);
+                } catch(...) {}
+                if ((refConversion != nullptr) && (refConversion->ExecType() != "Arm Compute") &&
+                    (refConversion->Validate().error_code() == arm_compute::ErrorCode::OK)) {
+                    status = {};
+                } else {
+                    node->get_rt_info().erase("ArmAffinity");
+                }
+            }
             if (status.error_code() != arm_compute::ErrorCode::OK) {
-                unsupported += ("\t" + node->get_friendly_name() +
+                nodeErrors[i] = ("\t" + node->get_friendly_name() +
                     " (" + node->get_type_name() + '.' + std::to_string(node->get_type_info().version) + ")- " + status.error_description() + ";\n");
             }
         }
+    });
+    if (_cfg._loadProfile != nullptr) {
+        _cfg._loadProfile->Record("Configure/Validate",
+            std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(
+                std::chrono::high_resolution_clock::now() - validateStart).count());
+    }
+    for (auto&& error : nodeErrors) {
+        unsupported += error;
     }
     if (!unsupported.empty()) {
         IE_THROW() << "Arm Plugin: Nodes from " << _function->get_friendly_name() << " are not supported:\n" << unsupported;
     }
     std::map<ngraph::Output<ngraph::Node>, std::size_t> counter;
+    std::set<ngraph::Output<ngraph::Node>> managedConcats;
+    auto record = [this] (const ngraph::Node* node, const char* bucket, std::size_t bytes) {
+        if (_allocationLedger != nullptr) {
+            _allocationLedger->emplace_back(AllocationRecord{node->get_friendly_name(), bucket, bytes});
+        }
+    };
     for (auto&& node : orderedOps) {
         const auto& nodeID = node->get_instance_id();
         if (ngraph::op::is_constant(node)) {
             auto constNode = safe_cast<opset::Constant>(node);
-            _layers.at(nodeID)._outputs.begin()->second._tensor->allocator()->import_memory(const_cast<void*>(constNode->get_data_ptr()));
+            auto& tensor = *_layers.at(nodeID)._outputs.begin()->second._tensor;
+            if (tensor.info()->has_padding()) {
+                // A padded layout can not alias the raw constant buffer; make
+                // the one padded copy here so every request still shares it
+                tensor.allocator()->allocate();
+                arm_compute::Tensor plain;
+                plain.allocator()->init({tensor.info()->tensor_shape(), 1, tensor.info()->data_type()});
+                plain.allocator()->import_memory(const_cast<void*>(constNode->get_data_ptr()));
+                tensor.copy_from(plain);
+                record(node.get(), "constant-copy", tensor.info()->total_size());
+            } else {
+                // Zero-copy: the tensor aliases the constant payload, which after
+                // the shared-constant clone is the IR reader's file-backed buffer
+                tensor.allocator()->import_memory(const_cast<void*>(constNode->get_data_ptr()));
+                record(node.get(), "constant-mapped", tensor.info()->total_size());
+            }
         } else if (!ngraph::op::is_parameter(node) && !ngraph::op::is_output(node)) {
             auto conversion = _conversions.at(node->get_type_info())(*node);
-            _layers.at(nodeID)._execType = conversion->ExecType();
+            auto& execType = _layers.at(nodeID)._execType;
+            execType = (conversion != nullptr) ? conversion->ExecType() : "Merged";
+            // A REF affinity pin normally keeps the node in its generic opset
+            // form (see ArmOptimizations); landing here on an ACL conversion
+            // means the pinned op has no reference implementation in this plugin
+            if ((execType == "Arm Compute") && ForcedToReference(node.get())) {
+                IE_THROW() << "Arm Plugin: node " << node->get_friendly_name() << " is pinned to reference execution, "
+                           << "but " << node->get_type_name() << " only has an Arm Compute conversion";
+            }
+            // Quantized ACL layers run the lowp GEMM; record which instruction
+            // set the kernel selection engages so slow non-dot-product paths
+            // are visible per layer in the performance counts
+            if ((execType == "Arm Compute") && (node->get_input_size() > 0) &&
+                ((node->get_input_element_type(0) == ngraph::element::u8) ||
+                 (node->get_input_element_type(0) == ngraph::element::i8))) {
+                if (IsaEnabled("I8MM", _cfg._kernelIsa)) {
+                    execType += " (I8MM)";
+                } else if (IsaEnabled("DOTPROD", _cfg._kernelIsa)) {
+                    execType += " (DOTPROD)";
+                } else {
+                    execType += " (NEON)";
+                }
+            }
             for (auto&& output : node->outputs()) {
                 auto targetInputs = output.get_target_inputs();
                 bool isNetworkOutput = std::any_of(std::begin(targetInputs), std::end(targetInputs), [] (auto& targetInput) {
                     return ngraph::op::is_output(targetInput.get_node());
                 });
                 if (!isNetworkOutput) {
-                    counter.emplace(output, targetInputs.size());
-                    memoryGroup.manage(_layers.at(nodeID)._outputs.at(output)._tensor.get());
+                    if (ov::is_type<opset::ReadValue>(node) || ov::is_type<opset::Assign>(node)) {
+                        // State tensors live outside the activation pool so the state
+                        // persists across inferences. Left unmanaged, the lifetime step
+                        // below direct-allocates them once the last consumer has
+                        // configured (padding requests included); a ReadValue output
+                        // no kernel reads directly is allocated here instead.
+                        record(node.get(), "state", _layers.at(nodeID)._outputs.at(output)._tensor->info()->total_size());
+                        if (!targetInputs.empty()) {
+                            counter.emplace(output, targetInputs.size());
+                        } else if (ov::is_type<opset::ReadValue>(node)) {
+                            _layers.at(nodeID)._outputs.at(output)._tensor->allocator()->allocate();
+                        }
+                        continue;
+                    }
+                    auto itAlias = _aliases.find(output);
+                    auto itPlaced = _concatPlacements.find(output);
+                    if (itPlaced != _concatPlacements.end()) {
+                        // Concat-placed output: the producer writes into a view, so
+                        // only the concat tensor is managed, starting its lifetime
+                        // at the first producer
+                        const auto& concatOutput = itPlaced->second;
+                        if (managedConcats.emplace(concatOutput).second) {
+                            if (!_cfg._wavefront) {
+                                memoryGroup.manage(_layers.at(concatOutput.get_node()->get_instance_id())._outputs.at(concatOutput)._tensor.get());
+                            }
+                            record(concatOutput.get_node(), _cfg._wavefront ? "persistent" : "pooled",
+                                   _layers.at(concatOutput.get_node()->get_instance_id())._outputs.at(concatOutput)._tensor->info()->total_size());
+                        }
+                    } else if (itAlias != _aliases.end()) {
+                        // In-place output: extend the shared buffer's lifetime
+                        // by this output's consumers instead of managing a
+                        // second tensor
+                        counter.at(itAlias->second) += targetInputs.size();
+                    } else {
+                        counter.emplace(output, targetInputs.size());
+                        // Wavefront execution runs branches concurrently, so activation memory can not be
+                        // lifetime-reused; leave such tensors outside the memory group and allocate them directly
+                        if (managedConcats.count(output) == 0) {
+                            if (!_cfg._wavefront) {
+                                memoryGroup.manage(_layers.at(nodeID)._outputs.at(output)._tensor.get());
+                            }
+                            record(node.get(), _cfg._wavefront ? "persistent" : "pooled",
+                                   _layers.at(nodeID)._outputs.at(output)._tensor->info()->total_size());
+                        }
+                    }
                 }
             }
             if (conversion != nullptr) {
+                // Per-op-type configure time; ACL kernel configure (and its
+                // weight layout analysis) usually dominates a slow load
+                LoadProfileScope profileScope{_cfg._loadProfile, std::string{"Configure/"} + node->get_type_name()};
                 conversion->Configure(memoryManager);
             }
 
@@ -272,12 +724,21 @@ Layer::Map Converter::Configure(const std::shared_ptr<arm_compute::IMemoryManage
                 auto tensor = _layers.at(input.get_node()->get_instance_id())._inputs.at(input);
                 if (tensor->_tensor->info()->has_padding() && (tensor->_notPaddedTensor != nullptr)) {
                     tensor->_notPaddedTensor->allocator()->init({tensor->_tensor->info()->tensor_shape(), 1, tensor->_tensor->info()->data_type()});
-                    memoryGroup.manage(tensor->_notPaddedTensor.get());
+                    if (!_cfg._wavefront) {
+                        memoryGroup.manage(tensor->_notPaddedTensor.get());
+                    }
+                    record(input.get_source_output().get_node(), "staging",
+                           tensor->_notPaddedTensor->info()->total_size());
                 }
             }
             for (auto&& input : node->inputs()) {
                 auto tensor = _layers.at(input.get_node()->get_instance_id())._inputs.at(input);
-                auto itCounter = counter.find(input.get_source_output());
+                auto sourceOutput = input.get_source_output();
+                auto itAlias = _aliases.find(sourceOutput);
+                if (itAlias != _aliases.end()) {
+                    sourceOutput = itAlias->second;
+                }
+                auto itCounter = counter.find(sourceOutput);
                 if (itCounter != counter.end()) {
                     if ((--(itCounter->second)) == 0) {
                         tensor->_tensor->allocator()->allocate();
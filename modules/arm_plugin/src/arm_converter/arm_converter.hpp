@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <map>
+#include <set>
+
 #include <openvino/util/pp.hpp>
 #include <ie_common.h>
 #include <ie_algorithm.hpp>
@@ -11,12 +14,19 @@
 
 #include <arm_compute/runtime/IFunction.h>
 #include <arm_compute/runtime/Tensor.h>
+#include <arm_compute/runtime/SubTensor.h>
 
 #include "arm_config.hpp"
+#include "arm_state.hpp"
 #include "opset/opset.hpp"
 
 
 namespace ArmPlugin {
+// The plugin executes the whole graph in NCHW: ShapeCast maps ngraph shapes to
+// ACL tensor shapes in reversed (WHCN) dimension order and every conversion
+// below indexes spatial dimensions through these enums. Switching regions to
+// NHWC would have to reassign the layout per tensor here and in the lifetime
+// planner, not per converter.
 struct NCHW {enum {N, C, H, W, DIMS};};
 struct WEIGHTS {enum {C_OUT, C_IN, K_H, K_W};};
 struct D2 {enum D2_e{H, W};};
@@ -68,9 +78,21 @@ struct Output : ngraph::Output<ngraph::Node> {
     Output{reinterpret_cast<const ngraph::Output<ngraph::Node>&>(output)} {}
 };
 
+// Row-wise parallel copy between a padded ACL tensor and its dense twin;
+// replaces the serial ITensor::copy_from on the reference-fallback boundary
+void CopyTensorRows(arm_compute::ITensor& dst, const arm_compute::ITensor& src);
+
+// _tensor is shared so an in-place layer's output can alias its producer's
+// tensor (see the in-place planning pass in the Converter constructor).
+// _view, when set, is a sub-region of a downstream concat tensor that the
+// producer's ACL function targets instead of _tensor (concat placement)
 struct Tensor {
-    std::unique_ptr<arm_compute::Tensor>    _tensor;
-    std::unique_ptr<arm_compute::Tensor>    _notPaddedTensor;
+    arm_compute::ITensor* Get() const {
+        return _view != nullptr ? static_cast<arm_compute::ITensor*>(_view.get()) : _tensor.get();
+    }
+    std::shared_ptr<arm_compute::Tensor>    _tensor;
+    std::shared_ptr<arm_compute::Tensor>    _notPaddedTensor;
+    std::shared_ptr<arm_compute::SubTensor> _view;
 };
 
 template<typename Arg>
@@ -134,14 +156,78 @@ struct Argument<HostTensors> {
     ngraph::HostTensorVector    _hosts;
 };
 
+struct LayerMap;
+
 struct Layer {
-    using Map = std::unordered_map<std::size_t, Layer>;
+    using Map = LayerMap;
     std::unique_ptr<arm_compute::IFunction>     _function;
     std::map<Input, Tensor*>                    _inputs;
     std::map<Output, Tensor>                    _outputs;
     std::string                                 _execType;
 };
 
+// Dense layer storage. Node instance ids of a single function fall into a compact
+// range, so layers live contiguously in a vector and ids resolve through a flat
+// ordinal table instead of hashing — Configure and the per-inference layer walk
+// touch cache-adjacent memory and do no hash lookups.
+struct LayerMap {
+    void reserve(std::size_t minId, std::size_t maxId, std::size_t count) {
+        _minId = minId;
+        _ordinals.assign(maxId - minId + 1, invalidOrdinal);
+        _layers.reserve(count);
+    }
+    Layer& operator[](std::size_t instanceId) {
+        auto& ordinal = _ordinals.at(instanceId - _minId);
+        if (ordinal == invalidOrdinal) {
+            ordinal = _layers.size();
+            _layers.emplace_back();
+        }
+        return _layers[ordinal];
+    }
+    Layer& at(std::size_t instanceId) {
+        return _layers.at(_ordinals.at(instanceId - _minId));
+    }
+    const Layer& at(std::size_t instanceId) const {
+        return _layers.at(_ordinals.at(instanceId - _minId));
+    }
+    bool empty() const {
+        return _layers.empty();
+    }
+    std::vector<Layer>::iterator begin() {
+        return _layers.begin();
+    }
+    std::vector<Layer>::iterator end() {
+        return _layers.end();
+    }
+    void clear() {
+        _minId = 0;
+        _ordinals.clear();
+        _layers.clear();
+    }
+
+private:
+    constexpr static std::size_t invalidOrdinal = static_cast<std::size_t>(-1);
+    std::size_t                  _minId = 0;
+    std::vector<std::size_t>     _ordinals;
+    std::vector<Layer>           _layers;
+};
+
+// One entry per allocation decision taken during Converter::Configure, the
+// owner being the producing node. Buckets separate memory that behaves
+// differently for RSS accounting: "constant-mapped" aliases the (file-backed)
+// IR payload, "constant-copy" is a heap copy forced by a padded layout,
+// "pooled" comes from the shared activation pool and is reused within a run,
+// "persistent" stays allocated for the network lifetime (wavefront
+// activations), "staging" backs the un-padded shadows of padded tensors and
+// "state" holds variable state between inferences. Queryable through the
+// MEMORY_TRACE network metric.
+struct AllocationRecord {
+    std::string _owner;
+    std::string _bucket;
+    std::size_t _bytes;
+};
+using AllocationLedger = std::vector<AllocationRecord>;
+
 static std::size_t GetNodeId(const ngraph::Input<const ngraph::Node>& input) {
     return input.get_node()->get_instance_id();
 }
@@ -239,7 +325,7 @@ struct Converter {
         }
 
         std::string ExecType() const override {
-            return "ngraph Reference";
+            return _execType;
         }
 
         template<typename ... RunArgs>
@@ -257,8 +343,8 @@ struct Converter {
                 if (tensorArgument._tensor->_tensor->info()->has_padding()) {
                     if (tensorArgument._type == type) {
                         switch (type) {
-                        case ArgumentType::Input  : tensorArgument._tensor->_notPaddedTensor->copy_from(*(tensorArgument._tensor->_tensor)); break;
-                        case ArgumentType::Output : tensorArgument._tensor->_tensor->copy_from(*(tensorArgument._tensor->_notPaddedTensor)); break;
+                        case ArgumentType::Input  : CopyTensorRows(*(tensorArgument._tensor->_notPaddedTensor), *(tensorArgument._tensor->_tensor)); break;
+                        case ArgumentType::Output : CopyTensorRows(*(tensorArgument._tensor->_tensor), *(tensorArgument._tensor->_notPaddedTensor)); break;
                         }
                     }
                 }
@@ -278,10 +364,10 @@ struct Converter {
                         if (hostsArgument._type == type) {
                             switch (type) {
                             case ArgumentType::Input  :
-                                hostsArgument._tensors[i]->_notPaddedTensor->copy_from(*(hostsArgument._tensors[i]->_tensor));
+                                CopyTensorRows(*(hostsArgument._tensors[i]->_notPaddedTensor), *(hostsArgument._tensors[i]->_tensor));
                                 break;
                             case ArgumentType::Output :
-                                hostsArgument._tensors[i]->_tensor->copy_from(*(hostsArgument._tensors[i]->_notPaddedTensor));
+                                CopyTensorRows(*(hostsArgument._tensors[i]->_tensor), *(hostsArgument._tensors[i]->_notPaddedTensor));
                                 break;
                             }
                         }
@@ -393,6 +479,7 @@ struct Converter {
         Converter&                          _converter;
         std::decay_t<Callable>              _callable;
         std::tuple<std::decay_t<Args>...>   _args;
+        std::string                         _execType = "ngraph Reference";
     };
 
     template<typename Callable, typename... Args>
@@ -400,11 +487,29 @@ struct Converter {
         return std::make_unique<ConversionCallableImpl<Callable, Args...>>(*this, std::forward<Callable>(callable), std::forward<Args>(args)...);
     }
 
-    Converter(const std::shared_ptr<const ngraph::Function> function, const Configuration& cfg);
+    // Host-callable conversions report the "ngraph Reference" exec class by
+    // default; the multithreaded kernels implemented in the plugin itself
+    // register through this overload so the exec graph and performance
+    // counters no longer flag them as slow-path reference ops
+    template<typename Callable, typename... Args>
+    Conversion::Ptr MakeNativeConversion(Callable&& callable, Args&& ... args) {
+        auto conversion = std::make_unique<ConversionCallableImpl<Callable, Args...>>(*this, std::forward<Callable>(callable), std::forward<Args>(args)...);
+        conversion->_execType = "Native";
+        return conversion;
+    }
+
+    Converter(const std::shared_ptr<const ngraph::Function> function, const Configuration& cfg,
+              const std::shared_ptr<VariableStateMap>& variableStates = nullptr,
+              const std::shared_ptr<AllocationLedger>& allocationLedger = nullptr);
 
     Layer::Map Configure(const std::shared_ptr<arm_compute::IMemoryManager>& memoryManager,
                          arm_compute::MemoryGroup& memoryGroup);
 
+    // Checks that the ISA extensions a node's precisions rely on are available
+    // and allowed by the KERNEL_ISA pin list, so fallback decisions made from
+    // Validate() match the kernels that will actually run
+    arm_compute::Status ValidateIsa(const ngraph::Node* node) const;
+
     template<typename NodeType>
     Conversion::Ptr Convert(const NodeType& node);
 
@@ -423,15 +528,34 @@ struct Converter {
     std::map<ngraph::Node::type_info_t, ConvertFn>  _conversions;
     std::shared_ptr<const ngraph::Function>         _function;
     Layer::Map                                      _layers;
+    // Variable states of the stateful ops (ReadValue/Assign), shared with the
+    // executable network which exposes them through the request QueryState API
+    std::shared_ptr<VariableStateMap>               _variableStates;
+    // Allocation ledger filled during Configure when provided; shared with
+    // the executable network, which reports it as the MEMORY_TRACE metric
+    std::shared_ptr<AllocationLedger>               _allocationLedger;
+    // In-place outputs: maps an aliased output to the producer output whose
+    // tensor it shares; Configure resolves lifetimes through this map so the
+    // shared buffer stays alive until the last aliasing consumer has run
+    std::map<ngraph::Output<ngraph::Node>, ngraph::Output<ngraph::Node>> _aliases;
+    // Concat placement: maps a producer output that writes straight into a
+    // sub-region view of a concatenation result to the concat output, whose
+    // tensor lifetime has to start before the first producer runs. The folded
+    // concat nodes keep no function and are skipped at run time
+    std::map<ngraph::Output<ngraph::Node>, ngraph::Output<ngraph::Node>> _concatPlacements;
+    std::set<const ngraph::Node*>                                        _mergedConcats;
+    // Split placement: outputs of a folded Split are sub-region views of its
+    // input; their lifetimes resolve through _aliases onto the input tensor
+    std::set<const ngraph::Node*>                                        _mergedSplits;
 };
 
 template<>
 struct ConversionArg<ngraph::Input<const ngraph::Node>&> {
     operator arm_compute::ITensorInfo*() {
-        return _converter._layers.at(_input.get_node()->get_instance_id())._inputs.at(_input)->_tensor->info();
+        return _converter._layers.at(_input.get_node()->get_instance_id())._inputs.at(_input)->Get()->info();
     }
     operator arm_compute::ITensor*() {
-        return _converter._layers.at(_input.get_node()->get_instance_id())._inputs.at(_input)->_tensor.get();
+        return _converter._layers.at(_input.get_node()->get_instance_id())._inputs.at(_input)->Get();
     }
     Converter&                    _converter;
     ngraph::Input<const ngraph::Node>&  _input;
@@ -440,10 +564,10 @@ struct ConversionArg<ngraph::Input<const ngraph::Node>&> {
 template<>
 struct ConversionArg<ngraph::Output<const ngraph::Node>&> {
     operator arm_compute::ITensorInfo*() {
-        return _converter._layers.at(_output.get_node()->get_instance_id())._outputs.at(_output)._tensor->info();
+        return _converter._layers.at(_output.get_node()->get_instance_id())._outputs.at(_output).Get()->info();
     }
     operator arm_compute::ITensor*() {
-        return _converter._layers.at(_output.get_node()->get_instance_id())._outputs.at(_output)._tensor.get();
+        return _converter._layers.at(_output.get_node()->get_instance_id())._outputs.at(_output).Get();
     }
     Converter&                    _converter;
     ngraph::Output<const ngraph::Node>&  _output;
@@ -454,14 +578,14 @@ struct ConversionArg<std::vector<ngraph::Input<const ngraph::Node>>&> {
     operator std::vector<const arm_compute::ITensorInfo*>() const {
         std::vector<const arm_compute::ITensorInfo*> infos;
         for (auto&& input : _inputs) {
-            infos.emplace_back(_converter._layers.at(input.get_node()->get_instance_id())._inputs.at(input)->_tensor->info());
+            infos.emplace_back(_converter._layers.at(input.get_node()->get_instance_id())._inputs.at(input)->Get()->info());
         }
         return infos;
     }
     operator std::vector<const arm_compute::ITensor*>() const {
         std::vector<const arm_compute::ITensor*> tensors;
         for (auto&& input : _inputs) {
-            tensors.emplace_back(_converter._layers.at(input.get_node()->get_instance_id())._inputs.at(input)->_tensor.get());
+            tensors.emplace_back(_converter._layers.at(input.get_node()->get_instance_id())._inputs.at(input)->Get());
         }
         return tensors;
     }
@@ -473,14 +597,14 @@ struct ConversionArg<std::vector<ngraph::Output<const ngraph::Node>>&> {
     operator std::vector<arm_compute::ITensorInfo*>() const {
         std::vector<arm_compute::ITensorInfo*> infos;
         for (auto&& output : _outputs) {
-            infos.emplace_back(_converter._layers.at(output.get_node()->get_instance_id())._outputs.at(output)._tensor->info());
+            infos.emplace_back(_converter._layers.at(output.get_node()->get_instance_id())._outputs.at(output).Get()->info());
         }
         return infos;
     }
     operator std::vector<arm_compute::ITensor*>() const {
         std::vector<arm_compute::ITensor*> tensors;
         for (auto&& output : _outputs) {
-            tensors.emplace_back(_converter._layers.at(output.get_node()->get_instance_id())._outputs.at(output)._tensor.get());
+            tensors.emplace_back(_converter._layers.at(output.get_node()->get_instance_id())._outputs.at(output).Get());
         }
         return tensors;
     }
@@ -541,4 +665,18 @@ constexpr static auto intTypes = std::tuple<std::int8_t, std::uint8_t, std::int1
 constexpr static auto indexTypes = std::tuple<std::int32_t, std::int64_t>{};
 constexpr static auto floatTypes = std::tuple<ngraph::float16, float>{};
 constexpr static auto allTypes = merge(intTypes, floatTypes);
+// The precisions that occur in practice at cross-product dispatch sites;
+// only their pairs get fully specialized kernels, rare pairs take a generic
+// path instead of instantiating the whole allTypes x allTypes product
+// (see blobCopy) - the difference is megabytes of .so and icache on A55
+constexpr static auto commonTypes = std::tuple<std::uint8_t, std::int32_t, std::int64_t, ngraph::float16, float>{};
+
+// Runtime membership test for a type tuple, used to pick between the fully
+// specialized and the generic dispatch path
+template<typename ... T>
+static bool TypeIn(const ngraph::element::Type& type, std::tuple<T...>) {
+    bool match = false;
+    (void)std::initializer_list<int>{(match |= (ngraph::element::from<T>() == type), 0)...};
+    return match;
+}
 }  //  namespace ArmPlugin
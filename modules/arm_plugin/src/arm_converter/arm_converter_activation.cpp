@@ -10,7 +10,11 @@
 #include <ngraph/runtime/reference/hard_sigmoid.hpp>
 #include <ngraph/runtime/reference/selu.hpp>
 #include <ngraph/runtime/reference/gelu.hpp>
+#include <ngraph/runtime/reference/swish.hpp>
+#include <ngraph/runtime/reference/mish.hpp>
+#include "arm_activation_lut.hpp"
 #include "arm_converter/arm_converter.hpp"
+#include "arm_neon_math.hpp"
 
 namespace ArmPlugin {
 template<typename Activation>
@@ -18,12 +22,32 @@ static auto ConvertActivation(const Activation& node, const arm_compute::Activat
     return converter->MakeConversion<arm_compute::NEActivationLayer>(node.input(0), node.output(0), info);
 }
 
+// f16 transcendentals go through the exhaustive lookup table (see
+// ActivationLut): exact to the output rounding and one L2 load per element
+// instead of a polynomial chain per lane; null for other precisions so the
+// caller falls through to its usual path
+static Converter::Conversion::Ptr LutConversion(Converter* converter, const ngraph::Node& node,
+                                                const std::string& key, const std::function<float(float)>& fn) {
+    if (node.get_input_element_type(0) != ngraph::element::f16) {
+        return nullptr;
+    }
+    return converter->MakeNativeConversion(&lut_activation, node.input(0), node.output(0),
+                                           ActivationLut::Get(key, fn),
+                                           ngraph::shape_size(node.get_output_shape(0)));
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Sigmoid& node) {
+    if (auto conversion = LutConversion(this, node, "sigmoid", &lut::sigmoid)) {
+        return conversion;
+    }
     arm_compute::ActivationLayerInfo info(arm_compute::ActivationLayerInfo::ActivationFunction::LOGISTIC);
     return ConvertActivation(node, info, this);
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Tanh& node) {
+    if (auto conversion = LutConversion(this, node, "tanh", [] (float x) { return std::tanh(x); })) {
+        return conversion;
+    }
     // TanH(x, a, b) = a * std::tanh(b * x);
     arm_compute::ActivationLayerInfo info(arm_compute::ActivationLayerInfo::ActivationFunction::TANH, 1.0f, 1.0f);
     return ConvertActivation(node, info, this);
@@ -54,6 +78,11 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Sqrt& node
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Elu& node) {
+    const auto alpha = static_cast<float>(node.get_alpha());
+    if (auto conversion = LutConversion(this, node, "elu:" + std::to_string(alpha),
+                                        [alpha] (float x) { return x < 0.0f ? alpha * std::expm1(x) : x; })) {
+        return conversion;
+    }
     arm_compute::ActivationLayerInfo info(arm_compute::ActivationLayerInfo::ActivationFunction::ELU, node.get_alpha());
     return ConvertActivation(node, info, this);
 }
@@ -63,6 +92,9 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Negative&
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Exp& node) {
+    if (auto conversion = LutConversion(this, node, "exp", [] (float x) { return std::exp(x); })) {
+        return conversion;
+    }
     return MakeConversion<arm_compute::NEExpLayer>(node.input(0), node.output(0));
 }
 
@@ -76,11 +108,17 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::HSwish& no
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::SoftPlus& node) {
+    if (auto conversion = LutConversion(this, node, "softplus", &lut::softplus)) {
+        return conversion;
+    }
     arm_compute::ActivationLayerInfo info(arm_compute::ActivationLayerInfo::ActivationFunction::SOFT_RELU);
     return ConvertActivation(node, info, this);
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Log& node) {
+    if (auto conversion = LutConversion(this, node, "log", [] (float x) { return std::log(x); })) {
+        return conversion;
+    }
     return MakeConversion<arm_compute::NELogLayer>(node.input(0), node.output(0));
 }
 
@@ -94,6 +132,17 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::HSigmoid&
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Gelu& node) {
+    if (node.get_approximation_mode() == ngraph::op::GeluApproximationMode::ERF) {
+        if (auto conversion = LutConversion(this, node, "gelu-erf",
+                                            [] (float x) { return 0.5f * x * (1.0f + std::erf(x * 0.70710678118654752f)); })) {
+            return conversion;
+        }
+    } else {
+        if (auto conversion = LutConversion(this, node, "gelu-tanh",
+                                            [] (float x) { return 0.5f * x * (1.0f + std::tanh(0.79788456080286536f * (x + 0.044715f * x * x * x))); })) {
+            return conversion;
+        }
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction, node.input(0), node.output(0), node.get_approximation_mode(), ngraph::shape_size(node.get_output_shape(0)));
     };
@@ -125,6 +174,58 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::HardSigmoi
     }
 }
 
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::Swish& node) {
+    // Single fused pass instead of the multiply/sigmoid/multiply chain the
+    // decomposition emitted (two intermediate tensors per activation site);
+    // the decomposition still runs when FAST_MATH is off
+    {
+        float beta = 1.0f;
+        bool constantBeta = true;
+        if (node.get_input_size() > 1) {
+            if (auto betaNode = ngraph::as_type_ptr<opset::Constant>(node.input_value(1).get_node_shared_ptr())) {
+                beta = betaNode->cast_vector<float>()[0];
+            } else {
+                constantBeta = false;
+            }
+        }
+        if (constantBeta) {
+            if (auto conversion = LutConversion(this, node, "swish:" + std::to_string(beta),
+                                                [beta] (float x) { return x * lut::sigmoid(beta * x); })) {
+                return conversion;
+            }
+            if (_cfg._fastMath && (node.get_input_element_type(0) == ngraph::element::f32)) {
+                return MakeNativeConversion(&neon::swish, node.input(0), beta, node.output(0), ngraph::shape_size(node.get_output_shape(0)));
+            }
+        }
+    }
+    auto make = [&] (auto refFunction) {
+        return node.get_input_size() > 1
+            ? this->MakeConversion(refFunction, node.input(0), node.input(1), node.output(0), ngraph::shape_size(node.get_output_shape(0)))
+            : this->MakeConversion(refFunction, node.input(0), nullptr, node.output(0), ngraph::shape_size(node.get_output_shape(0)));
+    };
+    return CallSwitch(
+        AP_WRAP(make, ngraph::runtime::reference::swish),
+        node.input(0), floatTypes);
+}
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::Mish& node) {
+    if (auto conversion = LutConversion(this, node, "mish",
+                                        [] (float x) { return x * std::tanh(lut::softplus(x)); })) {
+        return conversion;
+    }
+    // Fuses the exp/add/log/tanh/multiply decomposition chain (four
+    // intermediate tensors) into one register-resident pass
+    if (_cfg._fastMath && (node.get_input_element_type(0) == ngraph::element::f32)) {
+        return MakeNativeConversion(&neon::mish, node.input(0), node.output(0), ngraph::shape_size(node.get_output_shape(0)));
+    }
+    auto make = [&] (auto refFunction) {
+        return this->MakeConversion(refFunction, node.input(0), node.output(0), ngraph::shape_size(node.get_output_shape(0)));
+    };
+    return CallSwitch(
+        AP_WRAP(make, ngraph::runtime::reference::mish),
+        node.input(0), floatTypes);
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Selu& node) {
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
@@ -2,37 +2,217 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
-#include <ngraph/runtime/reference/adaptive_avg_pool.hpp>
-#include <ngraph/runtime/reference/adaptive_max_pool.hpp>
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+namespace {
+template <typename T>
+float sum_span(const T* data, std::size_t count) {
+    float sum = 0.f;
+    for (std::size_t i = 0; i < count; ++i) {
+        sum += static_cast<float>(data[i]);
+    }
+    return sum;
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+float sum_span(const float* data, std::size_t count) {
+    std::size_t i = 0;
+    float32x4_t vsum = vdupq_n_f32(0.f);
+    for (; i + 4 <= count; i += 4) {
+        vsum = vaddq_f32(vsum, vld1q_f32(data + i));
+    }
+    auto pair = vpadd_f32(vget_low_f32(vsum), vget_high_f32(vsum));
+    pair = vpadd_f32(pair, pair);
+    float sum = vget_lane_f32(pair, 0);
+    for (; i < count; ++i) {
+        sum += data[i];
+    }
+    return sum;
+}
+#endif
+
+// Scans a contiguous span and keeps the running maximum together with the
+// offset of its first occurrence, so the caller can rebuild the flat index
+template <typename T>
+void max_span(const T* data, std::size_t count, T& best, std::size_t& best_offset) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (data[i] > best) {
+            best = data[i];
+            best_offset = i;
+        }
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+void max_span(const float* data, std::size_t count, float& best, std::size_t& best_offset) {
+    std::size_t i = 0;
+    if (count >= 4) {
+        float32x4_t vbest = vdupq_n_f32(best);
+        uint32x4_t vbest_index = vdupq_n_u32(0xFFFFFFFFu);
+        uint32x4_t vindex = {0u, 1u, 2u, 3u};
+        const uint32x4_t vstep = vdupq_n_u32(4u);
+        for (; i + 4 <= count; i += 4) {
+            const auto values = vld1q_f32(data + i);
+            const auto greater = vcgtq_f32(values, vbest);
+            vbest = vbslq_f32(greater, values, vbest);
+            vbest_index = vbslq_u32(greater, vindex, vbest_index);
+            vindex = vaddq_u32(vindex, vstep);
+        }
+        float lanes[4];
+        std::uint32_t indices[4];
+        vst1q_f32(lanes, vbest);
+        vst1q_u32(indices, vbest_index);
+        // A lane that kept the sentinel index never beat the incoming best;
+        // among the rest pick the largest value, breaking ties on lower offset
+        bool won = false;
+        for (unsigned lane = 0; lane < 4; ++lane) {
+            if (indices[lane] == 0xFFFFFFFFu) {
+                continue;
+            }
+            if (!won || lanes[lane] > best || (lanes[lane] == best && indices[lane] < best_offset)) {
+                best = lanes[lane];
+                best_offset = indices[lane];
+                won = true;
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        if (data[i] > best) {
+            best = data[i];
+            best_offset = i;
+        }
+    }
+}
+#endif
+
+// Pads the 1-3 spatial dims of a pooling shape up to [D, H, W]
+void spatial_dims(const ngraph::Shape& shape, std::size_t (&dims)[3]) {
+    dims[0] = dims[1] = dims[2] = 1;
+    const auto spatial = shape.size() - 2;
+    for (std::size_t i = 0; i < spatial; ++i) {
+        dims[3 - spatial + i] = shape[2 + i];
+    }
+}
+
+std::size_t bin_start(std::size_t bin, std::size_t in_dim, std::size_t out_dim) {
+    return bin * in_dim / out_dim;
+}
+
+std::size_t bin_end(std::size_t bin, std::size_t in_dim, std::size_t out_dim) {
+    return ((bin + 1) * in_dim + out_dim - 1) / out_dim;
+}
+
+// Adaptive pooling visits each input element exactly once per output bin, so
+// the planes are independent: parallelize over N * C and reduce each window
+// with vectorized passes over its contiguous innermost rows
+template <typename T>
+void adaptive_avg_pool_native(const T* input,
+                              T* output,
+                              const ngraph::Shape& in_shape,
+                              const ngraph::Shape& out_shape) {
+    std::size_t in[3], out[3];
+    spatial_dims(in_shape, in);
+    spatial_dims(out_shape, out);
+    const auto in_plane = in[0] * in[1] * in[2];
+    const auto out_plane = out[0] * out[1] * out[2];
+    InferenceEngine::parallel_for(in_shape[0] * in_shape[1], [&] (std::size_t channel) {
+        const T* src = input + channel * in_plane;
+        T* dst = output + channel * out_plane;
+        for (std::size_t od = 0; od < out[0]; ++od) {
+            const auto ds = bin_start(od, in[0], out[0]), de = bin_end(od, in[0], out[0]);
+            for (std::size_t oh = 0; oh < out[1]; ++oh) {
+                const auto hs = bin_start(oh, in[1], out[1]), he = bin_end(oh, in[1], out[1]);
+                for (std::size_t ow = 0; ow < out[2]; ++ow) {
+                    const auto ws = bin_start(ow, in[2], out[2]), we = bin_end(ow, in[2], out[2]);
+                    float sum = 0.f;
+                    for (auto d = ds; d < de; ++d) {
+                        for (auto h = hs; h < he; ++h) {
+                            sum += sum_span(src + (d * in[1] + h) * in[2] + ws, we - ws);
+                        }
+                    }
+                    const auto count = (de - ds) * (he - hs) * (we - ws);
+                    *dst++ = static_cast<T>(sum / static_cast<float>(count));
+                }
+            }
+        }
+    });
+}
+
+template <typename T, typename U>
+void adaptive_max_pool_native(const T* input,
+                              T* output,
+                              U* indices,
+                              const ngraph::Shape& in_shape,
+                              const ngraph::Shape& out_shape) {
+    std::size_t in[3], out[3];
+    spatial_dims(in_shape, in);
+    spatial_dims(out_shape, out);
+    const auto in_plane = in[0] * in[1] * in[2];
+    const auto out_plane = out[0] * out[1] * out[2];
+    InferenceEngine::parallel_for(in_shape[0] * in_shape[1], [&] (std::size_t channel) {
+        const T* src = input + channel * in_plane;
+        T* dst = output + channel * out_plane;
+        U* idx = indices + channel * out_plane;
+        for (std::size_t od = 0; od < out[0]; ++od) {
+            const auto ds = bin_start(od, in[0], out[0]), de = bin_end(od, in[0], out[0]);
+            for (std::size_t oh = 0; oh < out[1]; ++oh) {
+                const auto hs = bin_start(oh, in[1], out[1]), he = bin_end(oh, in[1], out[1]);
+                for (std::size_t ow = 0; ow < out[2]; ++ow) {
+                    const auto ws = bin_start(ow, in[2], out[2]), we = bin_end(ow, in[2], out[2]);
+                    auto best_flat = (ds * in[1] + hs) * in[2] + ws;
+                    T best = src[best_flat];
+                    for (auto d = ds; d < de; ++d) {
+                        for (auto h = hs; h < he; ++h) {
+                            const auto row = (d * in[1] + h) * in[2] + ws;
+                            std::size_t best_offset = SIZE_MAX;
+                            max_span(src + row, we - ws, best, best_offset);
+                            if (best_offset != SIZE_MAX) {
+                                best_flat = row + best_offset;
+                            }
+                        }
+                    }
+                    *dst++ = best;
+                    *idx++ = static_cast<U>(best_flat);
+                }
+            }
+        }
+    });
+}
+}  // namespace
+
 template<> Converter::Conversion::Ptr Converter::Convert(const ngraph::op::v8::AdaptiveAvgPool& node) {
-    auto make = [&] (auto refFunction) {
-    return this->MakeConversion(refFunction,
-                                node.input(0),
-                                node.output(0),
-                                node.get_input_shape(0),
-                                node.get_output_shape(0));
+    auto make = [&] (auto nativeFunction) {
+    return this->MakeNativeConversion(nativeFunction,
+                                      node.input(0),
+                                      node.output(0),
+                                      node.get_input_shape(0),
+                                      node.get_output_shape(0));
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::adaptive_avg_pool),
+        AP_WRAP(make, adaptive_avg_pool_native),
         node.input(0), floatTypes);
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const ngraph::op::v8::AdaptiveMaxPool& node) {
-    auto make = [&] (auto refFunction) {
-    return this->MakeConversion(refFunction,
-                                node.input(0),
-                                node.output(0),
-                                node.output(1),
-                                node.get_input_shape(0),
-                                node.get_output_shape(0));
+    auto make = [&] (auto nativeFunction) {
+    return this->MakeNativeConversion(nativeFunction,
+                                      node.input(0),
+                                      node.output(0),
+                                      node.output(1),
+                                      node.get_input_shape(0),
+                                      node.get_output_shape(0));
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::adaptive_max_pool),
+        AP_WRAP(make, adaptive_max_pool_native),
         node.input(0), floatTypes,
         node.output(1), indexTypes);
 }
 
-} // namespace ArmPlugin
\ No newline at end of file
+} // namespace ArmPlugin
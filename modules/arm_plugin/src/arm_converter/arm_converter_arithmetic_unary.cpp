@@ -16,6 +16,7 @@
 #include <ngraph/runtime/reference/tan.hpp>
 #include <ngraph/runtime/reference/tanh.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_neon_math.hpp"
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Acos& node) {
@@ -64,6 +65,9 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Atan& node
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Atanh& node) {
+    if (_cfg._fastMath && (node.get_input_element_type(0) == ngraph::element::f32)) {
+        return MakeNativeConversion(&neon::atanh, node.input(0), node.output(0), ngraph::shape_size(node.get_output_shape(0)));
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction, node.input(0), node.output(0), ngraph::shape_size(node.get_output_shape(0)));
     };
@@ -73,6 +77,9 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Atanh& nod
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Cos& node) {
+    if (_cfg._fastMath && (node.get_input_element_type(0) == ngraph::element::f32)) {
+        return MakeNativeConversion(&neon::cos, node.input(0), node.output(0), ngraph::shape_size(node.get_output_shape(0)));
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction, node.input(0), node.output(0), ngraph::shape_size(node.get_output_shape(0)));
     };
@@ -113,6 +120,11 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Tan& node)
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Erf& node) {
+    // GELU decomposes to Erf, so this single op dominates transformer
+    // activation time; the NEON path replaces the per-element libm call
+    if (_cfg._fastMath && (node.get_input_element_type(0) == ngraph::element::f32)) {
+        return MakeNativeConversion(&neon::erf, node.input(0), node.output(0), ngraph::shape_size(node.get_output_shape(0)));
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction, node.input(0), node.output(0), ngraph::shape_size(node.get_output_shape(0)));
     };
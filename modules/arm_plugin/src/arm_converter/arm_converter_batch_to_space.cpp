@@ -2,33 +2,100 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cstring>
+#include <vector>
+
 #include <arm_compute/runtime/NEON/functions/NEBatchToSpaceLayer.h>
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+// Blocked-copy BatchToSpace for the shapes NEBatchToSpaceLayer rejects
+// (crops, rank != 4, block on N/C): output rows are produced in parallel,
+// and when the innermost axis is not blocked each row is one contiguous
+// memcpy; a blocked innermost axis decomposes into block_size interleaved
+// runs that are each contiguous on the input side.
+template <typename T>
+void batch_to_space_native(const T* input,
+                           T* output,
+                           const ngraph::Shape& in_shape,
+                           const ngraph::Shape& out_shape,
+                           const std::vector<std::size_t>& block,
+                           const std::vector<std::size_t>& crops_begin) {
+    const auto rank = in_shape.size();
+    const auto out_batch = out_shape[0];
+    std::vector<std::size_t> in_strides(rank), out_strides(rank);
+    std::size_t in_stride = 1, out_stride = 1;
+    for (auto i = rank; i-- > 0;) {
+        in_strides[i] = in_stride;
+        out_strides[i] = out_stride;
+        in_stride *= in_shape[i];
+        out_stride *= out_shape[i];
+    }
+    const auto row_elems = out_shape[rank - 1];
+    const auto rows = ngraph::shape_size(out_shape) / row_elems;
+    InferenceEngine::parallel_for(rows, [&] (std::size_t row) {
+        // Decompose the output row into batch and leading coordinates; each
+        // dim contributes its input coordinate and its block residue, the
+        // residues forming the block-flat part of the source batch index
+        auto remainder = row;
+        std::vector<std::size_t> coords(rank - 1);
+        for (auto i = rank - 1; i-- > 0;) {
+            coords[i] = remainder % out_shape[i];
+            remainder /= out_shape[i];
+        }
+        std::size_t src = 0;
+        std::size_t block_flat = 0;
+        for (std::size_t i = 1; i + 1 < rank; ++i) {
+            const auto cropped = coords[i] + crops_begin[i];
+            src += (cropped / block[i]) * in_strides[i];
+            block_flat = block_flat * block[i] + cropped % block[i];
+        }
+        block_flat *= block[rank - 1];
+        src += (block_flat * out_batch + coords[0]) * in_strides[0];
+        T* dst = output + row * row_elems;
+        if (block[rank - 1] == 1) {
+            std::memcpy(dst, input + src + crops_begin[rank - 1], row_elems * sizeof(T));
+            return;
+        }
+        for (std::size_t o = 0; o < row_elems; ++o) {
+            const auto cropped = o + crops_begin[rank - 1];
+            dst[o] = input[src + (cropped % block[rank - 1]) * out_batch * in_strides[0] + cropped / block[rank - 1]];
+        }
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::BatchToSpace& node) {
     auto block_shape = safe_cast<opset::Constant>(node.input_value(1).get_node_shared_ptr());
     auto crops_begin = safe_cast<opset::Constant>(node.input_value(2).get_node_shared_ptr());
     auto crops_end   = safe_cast<opset::Constant>(node.input_value(3).get_node_shared_ptr());
 
-    if (node.get_input_shape(0).size() != 4) {
-        IE_THROW() << "Unsupported BatchToSpace with num dimensions != 4";
-    }
-
     auto begin  = crops_begin->cast_vector<int>();
     auto end    = crops_end->cast_vector<int>();
     auto shapes = block_shape->cast_vector<int32_t>();
 
-    if (!std::all_of(begin.begin(), begin.end(), [] (int i) {return i == 0;}) ||
-        !std::all_of(end.begin(), end.end(), [] (int i) {return i == 0;})) {
-        IE_THROW() << "Unsupported BatchToSpace op with crop > 0";
+    const bool acl_supported = (node.get_input_shape(0).size() == 4) &&
+        std::all_of(begin.begin(), begin.end(), [] (int i) {return i == 0;}) &&
+        std::all_of(end.begin(), end.end(), [] (int i) {return i == 0;}) &&
+        (shapes[0] == 1) && (shapes[1] == 1);
+    if (acl_supported) {
+        int32_t block_shape_y = shapes[2];
+        int32_t block_shape_x = shapes[3];
+        return MakeConversion<arm_compute::NEBatchToSpaceLayer>(node.input(0), block_shape_x, block_shape_y, node.output(0));
     }
 
-    if (shapes[0] != 1 || shapes[1] != 1) {
-        IE_THROW() << "Unsupported BatchToSpace op with block_shape != 1 for N, C";
-    }
-    int32_t block_shape_y = shapes[2];
-    int32_t block_shape_x = shapes[3];
-    return MakeConversion<arm_compute::NEBatchToSpaceLayer>(node.input(0), block_shape_x, block_shape_y, node.output(0));
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_output_shape(0),
+                                          std::vector<std::size_t>{shapes.begin(), shapes.end()},
+                                          std::vector<std::size_t>{begin.begin(), begin.end()});
+    };
+    return CallSwitch(
+        AP_WRAP(make, batch_to_space_native),
+        node.get_input_element_type(0), allTypes);
 }
 } //  namespace ArmPlugin
@@ -2,26 +2,76 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
-#include <ngraph/runtime/reference/bucketize.hpp>
+#include <algorithm>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+// Parallel Bucketize: the sorted boundaries are converted once into the
+// promoted comparison domain so the per-element search touches one small
+// cache-resident array. Small boundary sets use a branchless counting pass
+// the compiler can vectorize (the bucket index is just the number of
+// boundaries below the value); larger sets fall back to binary search. The
+// input is chunked across the IE thread pool.
+template <typename T, typename B, typename P>
+void bucketize_native(const T* data,
+                      const B* buckets,
+                      P* out,
+                      const ngraph::Shape& data_shape,
+                      const ngraph::Shape& buckets_shape,
+                      bool with_right_bound) {
+    using C = decltype(T{} + B{});
+    const auto size = ngraph::shape_size(data_shape);
+    const auto num_buckets = ngraph::shape_size(buckets_shape);
+    std::vector<C> bounds(num_buckets);
+    for (std::size_t i = 0; i < num_buckets; ++i) {
+        bounds[i] = static_cast<C>(buckets[i]);
+    }
+
+    const std::size_t chunk = 4096;
+    const auto chunks = (size + chunk - 1) / chunk;
+    InferenceEngine::parallel_for(chunks, [&] (std::size_t c) {
+        const auto begin = c * chunk;
+        const auto end = std::min(begin + chunk, size);
+        if (num_buckets <= 16) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto value = static_cast<C>(data[i]);
+                std::size_t bucket = 0;
+                for (std::size_t b = 0; b < num_buckets; ++b) {
+                    bucket += with_right_bound ? (bounds[b] < value) : (bounds[b] <= value);
+                }
+                out[i] = static_cast<P>(bucket);
+            }
+        } else {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto value = static_cast<C>(data[i]);
+                auto it = with_right_bound ? std::lower_bound(bounds.begin(), bounds.end(), value)
+                                           : std::upper_bound(bounds.begin(), bounds.end(), value);
+                out[i] = static_cast<P>(it - bounds.begin());
+            }
+        }
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Bucketize& node) {
-    auto make = [&] (auto refFunction) {
-    return this->MakeConversion(refFunction,
-                                node.input(0),
-                                node.input(1),
-                                node.output(0),
-                                node.get_input_shape(0),
-                                node.get_input_shape(1),
-                                node.get_with_right_bound());
+    auto make = [&] (auto nativeFunction) {
+    return this->MakeNativeConversion(nativeFunction,
+                                      node.input(0),
+                                      node.input(1),
+                                      node.output(0),
+                                      node.get_input_shape(0),
+                                      node.get_input_shape(1),
+                                      node.get_with_right_bound());
     };
     auto numericTypes = std::tuple<std::int32_t, std::int64_t, ngraph::float16, float>{};
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::bucketize),
+        AP_WRAP(make, bucketize_native),
         node.get_input_element_type(0), numericTypes,
         node.get_input_element_type(1), numericTypes,
         node.get_output_type(), indexTypes);
 }
 
-} // namespace ArmPlugin
\ No newline at end of file
+} // namespace ArmPlugin
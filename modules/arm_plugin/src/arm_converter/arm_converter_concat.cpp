@@ -29,6 +29,11 @@ static void wrap_concat(const std::vector<Argument<Tensor*>>& inputs,
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Concat& node) {
+    if (_mergedConcats.count(&node) != 0) {
+        // Producers write into sub-region views of this tensor (see the concat
+        // placement pass in the Converter constructor); nothing runs here
+        return {};
+    }
     auto make = [&] (auto refFunction) {
         std::vector<ngraph::Shape> in_shapes;
         for (const auto& input : node.inputs()) {
@@ -49,6 +54,9 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Concat& no
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmConcat& node) {
+    if (_mergedConcats.count(&node) != 0) {
+        return {};
+    }
     if (node.get_input_size() == 1) {
         return MakeConversion<arm_compute::NECopy>(node.input(0), node.output(0));
     }
@@ -3,11 +3,21 @@
 //
 
 
+#include <chrono>
+#include <sstream>
+
 #include <src/cpu/kernels/CpuConvertQuantizedSignednessKernel.h>
 #include <arm_compute/runtime/NEON/NEScheduler.h>
 #include <arm_compute/runtime/NEON/functions/NEConvolutionLayer.h>
 #include <arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h>
+#include <ie_parallel.hpp>
+#include "arm_conv_tuner.hpp"
 #include "arm_converter/arm_converter.hpp"
+#include "arm_cost_model.hpp"
+#include "arm_sparse_gemm.hpp"
 
 namespace ArmPlugin {
 
@@ -35,6 +45,44 @@ static arm_compute::ActivationLayerInfo GetActivationInfo(const ngraph::Node& no
     }
 }
 
+// CONV_METHOD: "AUTO" autotunes every convolution, "name:WINOGRAD;name2:GEMM"
+// pins individual layers; anything else (including an unmatched name) keeps
+// the NEConvolutionLayer heuristic
+static std::string ConvMethodFor(const std::string& config, const std::string& nodeName) {
+    if ("AUTO" == config) {
+        return config;
+    }
+    std::istringstream entries{config};
+    std::string entry;
+    while (std::getline(entries, entry, ';')) {
+        const auto colon = entry.find(':');
+        if ((colon != std::string::npos) && (entry.compare(0, colon, nodeName) == 0)) {
+            return entry.substr(colon + 1);
+        }
+    }
+    return {};
+}
+
+// Conv signature the autotuned winner is recorded under: shapes, strides,
+// dilation and data type pin the method choice, the layer name does not
+static std::string ConvTuneKey(const arm_compute::ITensorInfo* input, const arm_compute::ITensorInfo* weights,
+                               const arm_compute::PadStrideInfo& conv_info, const arm_compute::Size2D& dilation) {
+    auto dims = [] (const arm_compute::TensorShape& shape) {
+        std::string text;
+        for (std::size_t i = 0; i < shape.num_dimensions(); ++i) {
+            if (!text.empty()) {
+                text += 'x';
+            }
+            text += std::to_string(shape[i]);
+        }
+        return text;
+    };
+    return dims(input->tensor_shape()) + '|' + dims(weights->tensor_shape()) + '|' +
+           std::to_string(conv_info.stride().first) + 'x' + std::to_string(conv_info.stride().second) + '|' +
+           std::to_string(dilation.x()) + 'x' + std::to_string(dilation.y()) + '|' +
+           std::to_string(static_cast<int>(input->data_type()));
+}
+
 struct NEConvolutionLayerQI final: public arm_compute::IFunction {
 public:
     NEConvolutionLayerQI(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
@@ -51,10 +99,11 @@ public:
     void configure(arm_compute::ITensor *input, const arm_compute::ITensor *weights, const arm_compute::ITensor *biases, arm_compute::ITensor *output,
                    const arm_compute::PadStrideInfo &conv_info, const arm_compute::WeightsInfo &weights_info, const arm_compute::Size2D &dilation,
                    const arm_compute::ActivationLayerInfo &act_info,
-                   const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo *wp, const arm_compute::QuantizationInfo *qi) {
+                   const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo *wp, const arm_compute::QuantizationInfo *qi,
+                   const std::string &method) {
         ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
         ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayerQI::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr),
-                                                                  output->info(), conv_info, weights_info, dilation, act_info, ip, wp, qi));
+                                                                  output->info(), conv_info, weights_info, dilation, act_info, ip, wp, qi, method));
 
         _input = input;
         arm_compute::ITensor *conv_input = input;
@@ -89,7 +138,6 @@ public:
         } else if (output->info()->data_type() == arm_compute::DataType::QASYMM8_SIGNED && _weights->info()->data_type() == arm_compute::DataType::QASYMM8 ||
                    output->info()->data_type() == arm_compute::DataType::QASYMM8 && _weights->info()->data_type() == arm_compute::DataType::QASYMM8_SIGNED) {
             _w_sgn = std::make_unique<arm_compute::cpu::kernels::CpuConvertQuantizedSignednessKernel>();
-            _memory_group->manage(&_weightsqi);
             _weightsqi.allocator()->init(*(_weights->info()));
             _weightsqi.info()->set_data_type(output->info()->data_type()).set_quantization_info(arm_compute::QuantizationInfo(1.f,
                                                                 output->info()->data_type() == arm_compute::DataType::QASYMM8 ? 128 : -128));
@@ -104,8 +152,39 @@ public:
             _outputqi.info()->set_quantization_info(*qi);
         }
 
-        _conv = std::make_unique<arm_compute::NEConvolutionLayer>(_memory_manager);
-        _conv->configure(conv_input, conv_weights, biases, _qi ? &_outputqi : _output, conv_info, weights_info, dilation, act_info);
+        auto* conv_output = _qi ? &_outputqi : _output;
+        std::string chosen = method;
+        if ("AUTO" == chosen) {
+            _tuneKey = ConvTuneKey(conv_input->info(), conv_weights->info(), conv_info, dilation);
+            const auto winner = ConvMethodTuner::get().Winner(_tuneKey);
+            if (!winner.empty() &&
+                bool(ValidateMethod(winner, conv_input->info(), conv_weights->info(), ((biases != nullptr) ? biases->info() : nullptr),
+                                    conv_output->info(), conv_info, weights_info, dilation, act_info))) {
+                chosen = winner;
+            } else {
+                // No recorded winner for this signature: configure every method
+                // that validates and let run() benchmark them during warm-up
+                chosen.clear();
+                for (auto&& candidate : {"GEMM", "WINOGRAD", "DIRECT"}) {
+                    if (bool(ValidateMethod(candidate, conv_input->info(), conv_weights->info(),
+                                            ((biases != nullptr) ? biases->info() : nullptr),
+                                            conv_output->info(), conv_info, weights_info, dilation, act_info))) {
+                        _candidates.emplace_back(candidate, MakeConv(candidate, conv_input, conv_weights, biases, conv_output,
+                                                                     conv_info, weights_info, dilation, act_info));
+                    }
+                }
+                if (_candidates.size() < 2) {
+                    // Nothing to compare, the heuristic is as good as it gets
+                    _candidates.clear();
+                } else {
+                    _candidateAccum.assign(_candidates.size(), 0.0f);
+                }
+            }
+        }
+        if (_candidates.empty()) {
+            _conv = MakeConv(chosen, conv_input, conv_weights, biases, conv_output,
+                             conv_info, weights_info, dilation, act_info);
+        }
 
         if (_i_sgn) {
             _inputqi.allocator()->allocate();
@@ -114,18 +193,66 @@ public:
             _input->info()->extend_padding(_inputqi.info()->padding());
         }
         if (_w_sgn) {
+            //Weights are constant: convert their signedness once here, at network load,
+            //so every request shares the converted copy instead of re-converting per run
             _weightsqi.allocator()->allocate();
+            arm_compute::ITensorPack pack = {
+                { arm_compute::TensorType::ACL_SRC, _weights },
+                { arm_compute::TensorType::ACL_DST, &_weightsqi }
+            };
+            arm_compute::NEScheduler::get().schedule_op(_w_sgn.get(), arm_compute::Window::DimY, _w_sgn->window(), pack);
+            _w_sgn.reset();
         } else if (_wp && _weightsqi.info()->padding() != _weights->info()->padding()) {
             //Backpropagate possible weights padding change
             _weights->info()->extend_padding(_weightsqi.info()->padding());
         }
     }
+    // Builds the convolution function for one method; an empty method keeps
+    // the NEConvolutionLayer heuristic choice
+    std::unique_ptr<arm_compute::IFunction> MakeConv(const std::string &method,
+                                                     arm_compute::ITensor *input, const arm_compute::ITensor *weights,
+                                                     const arm_compute::ITensor *biases, arm_compute::ITensor *output,
+                                                     const arm_compute::PadStrideInfo &conv_info, const arm_compute::WeightsInfo &weights_info,
+                                                     const arm_compute::Size2D &dilation, const arm_compute::ActivationLayerInfo &act_info) {
+        if ("GEMM" == method) {
+            auto conv = std::make_unique<arm_compute::NEGEMMConvolutionLayer>(_memory_manager);
+            conv->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info);
+            return conv;
+        } else if ("WINOGRAD" == method) {
+            auto conv = std::make_unique<arm_compute::NEWinogradConvolutionLayer>(_memory_manager);
+            conv->configure(input, weights, biases, output, conv_info, act_info);
+            return conv;
+        } else if ("DIRECT" == method) {
+            auto conv = std::make_unique<arm_compute::NEDirectConvolutionLayer>(_memory_manager);
+            conv->configure(input, weights, biases, output, conv_info, act_info);
+            return conv;
+        }
+        auto conv = std::make_unique<arm_compute::NEConvolutionLayer>(_memory_manager);
+        conv->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info);
+        return conv;
+    }
+    static arm_compute::Status ValidateMethod(const std::string &method,
+                                              const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *weights,
+                                              const arm_compute::ITensorInfo *biases, const arm_compute::ITensorInfo *output,
+                                              const arm_compute::PadStrideInfo &conv_info, const arm_compute::WeightsInfo &weights_info,
+                                              const arm_compute::Size2D &dilation, const arm_compute::ActivationLayerInfo &act_info) {
+        if ("GEMM" == method) {
+            return arm_compute::NEGEMMConvolutionLayer::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info);
+        } else if ("WINOGRAD" == method) {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(dilation != arm_compute::Size2D(1U, 1U), "WINOGRAD does not support dilation");
+            return arm_compute::NEWinogradConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info);
+        } else if ("DIRECT" == method) {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(dilation != arm_compute::Size2D(1U, 1U), "DIRECT does not support dilation");
+            return arm_compute::NEDirectConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info);
+        }
+        return arm_compute::NEConvolutionLayer::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info);
+    }
     static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *weights,
                                         const arm_compute::ITensorInfo *biases, const arm_compute::ITensorInfo *output,
                                         const arm_compute::PadStrideInfo &conv_info, const arm_compute::WeightsInfo &weights_info,
                                         const arm_compute::Size2D &dilation, const arm_compute::ActivationLayerInfo &act_info,
                                         const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo *wp,
-                                        const arm_compute::QuantizationInfo *qi) {
+                                        const arm_compute::QuantizationInfo *qi, const std::string &method = {}) {
         ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
         arm_compute::TensorInfo vld_input(*input);
         if (output->data_type() == arm_compute::DataType::QASYMM8_SIGNED && input->data_type() == arm_compute::DataType::QASYMM8 ||
@@ -154,11 +281,15 @@ public:
         arm_compute::TensorInfo vld_output(*output);
         if (qi) vld_output.set_quantization_info(*qi);
 
-        return arm_compute::NEConvolutionLayer::validate(&vld_input, &vld_weights, biases, &vld_output, conv_info, weights_info, dilation, act_info);
+        // AUTO validates as the heuristic: the heuristic fallback is always
+        // among the autotune candidates, so the layer is loadable iff it is
+        return NEConvolutionLayerQI::ValidateMethod(("AUTO" == method) ? std::string{} : method,
+                                                    &vld_input, &vld_weights, biases, &vld_output,
+                                                    conv_info, weights_info, dilation, act_info);
     }
     void run() override {
-        ARM_COMPUTE_ERROR_ON_MSG(!_conv.get(), "Kernel didn't configured");
-        std::unique_ptr<arm_compute::MemoryGroupResourceScope> _sgn_scope = _i_sgn || _w_sgn ?
+        ARM_COMPUTE_ERROR_ON_MSG(!_conv.get() && _candidates.empty(), "Kernel didn't configured");
+        std::unique_ptr<arm_compute::MemoryGroupResourceScope> _sgn_scope = _i_sgn ?
                                                                 std::make_unique<arm_compute::MemoryGroupResourceScope>(*_memory_group) : nullptr;
         if (_i_sgn) {
             arm_compute::ITensorPack pack = {
@@ -170,13 +301,7 @@ public:
             if (_inputqi.info()->padding() != _input->info()->padding()) _inputqi.info()->extend_padding(_input->info()->padding());
             _inputqi.allocator()->import_memory(_input->buffer());
         }
-        if (_w_sgn) {
-            arm_compute::ITensorPack pack = {
-                { arm_compute::TensorType::ACL_SRC, _weights },
-                { arm_compute::TensorType::ACL_DST, &_weightsqi }
-            };
-            arm_compute::NEScheduler::get().schedule_op(_w_sgn.get(), arm_compute::Window::DimY, _w_sgn->window(), pack);
-        } else if (_wp) {
+        if (_wp) {
             if (_weightsqi.info()->padding() != _weights->info()->padding()) _weightsqi.info()->extend_padding(_weights->info()->padding());
             _weightsqi.allocator()->import_memory(_weights->buffer());
         }
@@ -184,13 +309,44 @@ public:
             if (_outputqi.info()->padding() != _output->info()->padding()) _outputqi.info()->extend_padding(_output->info()->padding());
             _outputqi.allocator()->import_memory(_output->buffer());
         }
-        _conv->run();
+        if (!_candidates.empty()) {
+            RunTuning();
+        } else {
+            _conv->run();
+        }
         if (!_i_sgn && _ip) _inputqi.allocator()->free();
         if (_wp) _weightsqi.allocator()->free();
         if (_qi) _outputqi.allocator()->free();
     }
 
 protected:
+    // One timed run of the next autotune candidate; requests execute under the
+    // network graph lock, so the sample bookkeeping needs no synchronization.
+    // Once every candidate has its samples the fastest becomes _conv, the
+    // losers are destroyed (freeing their packed weights) and the winner is
+    // recorded in the process-wide tuner for later loads to reuse.
+    void RunTuning() {
+        constexpr static int samplesPerCandidate = 3;
+        const auto start = std::chrono::steady_clock::now();
+        _candidates[_candidate].second->run();
+        _candidateAccum[_candidate] += std::chrono::duration<float>{std::chrono::steady_clock::now() - start}.count();
+        if (++_candidateSamples == samplesPerCandidate) {
+            _candidateSamples = 0;
+            ++_candidate;
+        }
+        if (_candidate == _candidates.size()) {
+            std::size_t best = 0;
+            for (std::size_t index = 1; index < _candidates.size(); ++index) {
+                if (_candidateAccum[index] < _candidateAccum[best]) {
+                    best = index;
+                }
+            }
+            ConvMethodTuner::get().SetWinner(_tuneKey, _candidates[best].first);
+            _conv = std::move(_candidates[best].second);
+            _candidates.clear();
+            _candidateAccum.clear();
+        }
+    }
     std::shared_ptr<arm_compute::IMemoryManager> _memory_manager;
     std::unique_ptr<arm_compute::MemoryGroup> _memory_group;
     const arm_compute::QuantizationInfo *_ip;
@@ -203,13 +359,162 @@ protected:
     arm_compute::ITensor *_output;
     arm_compute::Tensor _outputqi;
     std::unique_ptr<arm_compute::cpu::kernels::CpuConvertQuantizedSignednessKernel> _i_sgn, _w_sgn;
-    std::unique_ptr<arm_compute::NEConvolutionLayer> _conv;
+    std::unique_ptr<arm_compute::IFunction> _conv;
+    // Autotune state (CONV_METHOD(AUTO) without a recorded winner): candidate
+    // functions with their method names, accumulated run time per candidate
+    // and the signature key the winner is recorded under
+    std::vector<std::pair<std::string, std::unique_ptr<arm_compute::IFunction>>> _candidates;
+    std::vector<float> _candidateAccum;
+    std::size_t _candidate = 0;
+    int _candidateSamples = 0;
+    std::string _tuneKey;
+};
+// Per-output-channel compressed pointwise convolution for structurally
+// pruned f32 1x1 convolutions (SPARSE_KERNELS). A 1x1 conv is a GEMM over
+// input channels per pixel; channel pruning leaves most weights zero, so
+// each output channel keeps only its surviving (input channel, weight)
+// pairs and the run loop accumulates those planes alone, skipping the
+// im2col and the pruned channels' traffic entirely
+struct NESparseConvolution final: public arm_compute::IFunction {
+public:
+    // No scratch tensors: the compressed weights live in the function, so the
+    // memory manager is accepted for conversion-machinery uniformity only
+    NESparseConvolution(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
+        _input(nullptr), _biases(nullptr), _output(nullptr),
+        _batches(0), _outChannels(0), _rows(0), _rowElems(0) { (void)memory_manager; }
+    NESparseConvolution(const NESparseConvolution &) = delete;
+    NESparseConvolution &operator=(const NESparseConvolution &) = delete;
+    NESparseConvolution(NESparseConvolution &&) = delete;
+    NESparseConvolution &operator=(NESparseConvolution &&) = delete;
+    ~NESparseConvolution() = default;
+    void configure(const arm_compute::ITensor *input, const arm_compute::ITensor *weights, const arm_compute::ITensor *biases,
+                   arm_compute::ITensor *output) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+        ARM_COMPUTE_ERROR_THROW_ON(NESparseConvolution::validate(input->info(), weights->info(),
+                                                                 ((biases != nullptr) ? biases->info() : nullptr), output->info()));
+        _input = input;
+        _biases = biases;
+        _output = output;
+        _rowElems = input->info()->dimension(0);
+        _rows = input->info()->dimension(1);
+        const auto inChannels = input->info()->dimension(2);
+        _outChannels = output->info()->dimension(2);
+        _batches = input->info()->num_dimensions() > 3 ? input->info()->dimension(3) : 1;
+        // Weights are constant: compress them once here, at network load.
+        // NCHW [Cout, Cin, 1, 1] maps onto ACL dim3 = Cout, dim2 = Cin
+        const auto* wBase = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+        const auto& wStrides = weights->info()->strides_in_bytes();
+        _entryStart.reserve(_outChannels + 1);
+        _entryStart.push_back(0);
+        for (std::size_t co = 0; co < _outChannels; ++co) {
+            for (std::size_t ci = 0; ci < inChannels; ++ci) {
+                const auto w = *reinterpret_cast<const float*>(wBase + co * wStrides[3] + ci * wStrides[2]);
+                if (w != 0.0f) {
+                    _entryChannel.push_back(static_cast<std::uint32_t>(ci));
+                    _entryWeight.push_back(w);
+                }
+            }
+            _entryStart.push_back(static_cast<std::uint32_t>(_entryChannel.size()));
+        }
+    }
+    static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *weights,
+                                        const arm_compute::ITensorInfo *biases, const arm_compute::ITensorInfo *output) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != arm_compute::DataType::F32 ||
+                                    weights->data_type() != arm_compute::DataType::F32 ||
+                                    output->data_type() != arm_compute::DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() != 4 ||
+                                    weights->dimension(0) != 1 || weights->dimension(1) != 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(2) != input->dimension(2) ||
+                                    weights->dimension(3) != output->dimension(2));
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != input->dimension(0) ||
+                                    output->dimension(1) != input->dimension(1));
+        if (biases != nullptr) {
+            ARM_COMPUTE_RETURN_ERROR_ON(biases->data_type() != arm_compute::DataType::F32 ||
+                                        biases->num_dimensions() > 1 || biases->dimension(0) != output->dimension(2));
+        }
+        return arm_compute::Status{};
+    }
+    void run() override {
+        const auto* iBase = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+        const auto& iStrides = _input->info()->strides_in_bytes();
+        auto* oBase = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+        const auto& oStrides = _output->info()->strides_in_bytes();
+        const float* bias = (_biases != nullptr) ?
+            reinterpret_cast<const float*>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+        // Parallel over output planes: every worker owns one (batch, output
+        // channel) plane, so writes never overlap. Rows are walked through
+        // the strides so a neighbouring kernel's padding stays harmless
+        InferenceEngine::parallel_for(_batches * _outChannels, [&] (std::size_t job) {
+            const auto b = job / _outChannels;
+            const auto co = job % _outChannels;
+            for (std::size_t row = 0; row < _rows; ++row) {
+                auto* out = reinterpret_cast<float*>(oBase + b * oStrides[3] + co * oStrides[2] + row * oStrides[1]);
+                sparse::Fill(out, (bias != nullptr) ? bias[co] : 0.0f, _rowElems);
+                for (auto entry = _entryStart[co]; entry != _entryStart[co + 1]; ++entry) {
+                    sparse::Saxpy(reinterpret_cast<const float*>(iBase + b * iStrides[3] + _entryChannel[entry] * iStrides[2] + row * iStrides[1]),
+                                  _entryWeight[entry], out, _rowElems);
+                }
+            }
+        });
+    }
+
+protected:
+    const arm_compute::ITensor *_input;
+    const arm_compute::ITensor *_biases;
+    arm_compute::ITensor *_output;
+    // Per output channel, the surviving (input channel, weight) pairs held
+    // as a CSR over [_entryStart[co], _entryStart[co + 1])
+    std::vector<std::uint32_t> _entryStart;
+    std::vector<std::uint32_t> _entryChannel;
+    std::vector<float> _entryWeight;
+    std::size_t _batches, _outChannels, _rows, _rowElems;
 };
+static bool useSparseConvolution(const Configuration& cfg, const ngraph::Node& node,
+                                 const arm_compute::PadStrideInfo& conv_info, const arm_compute::Size2D& dilation) {
+    if (!(cfg._sparseKernels &&
+          node.get_input_element_type(Features) == ngraph::element::f32 &&
+          node.get_input_element_type(Weights) == ngraph::element::f32 &&
+          node.get_input_shape(Features).size() == 4 &&
+          node.get_input_shape(Weights).size() == 4 &&
+          ngraph::is_type<opset::Constant>(node.input_value(Weights).get_node()) &&
+          node.get_rt_info().count("InputPrescaleInfo") == 0 &&
+          node.get_rt_info().count("WeightsPrescaleInfo") == 0 &&
+          node.get_rt_info().count("QuantizationInfo") == 0 &&
+          node.get_rt_info().count("ActivationLayerInfo") == 0)) {
+        return false;
+    }
+    const auto& wShape = node.get_input_shape(Weights);
+    // Pointwise only: a 1x1 stride-1 undilated unpadded conv is a pure
+    // channel mix, so output planes are weighted sums of input planes
+    if ((wShape[2] != 1) || (wShape[3] != 1) ||
+        (conv_info.stride() != std::make_pair(1u, 1u)) ||
+        (conv_info.pad_left() != 0) || (conv_info.pad_right() != 0) ||
+        (conv_info.pad_top() != 0) || (conv_info.pad_bottom() != 0) ||
+        (dilation.x() != 1) || (dilation.y() != 1)) {
+        return false;
+    }
+    auto constant = ngraph::as_type<opset::Constant>(node.input_value(Weights).get_node());
+    const auto elements = ngraph::shape_size(wShape);
+    const auto density = sparse::ElementDensity(static_cast<const float*>(constant->get_data_ptr()), elements);
+    return CostModel{cfg._costModelPath}.Wins("sparse-conv1x1", elements, density <= sparse::DensityThreshold);
+}
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmConvolution& node) {
     arm_compute::PadStrideInfo conv_info;
     arm_compute::Size2D dilation;
     std::tie(conv_info, dilation) = ConvParameters(node);
 
+    // Structurally pruned pointwise convolutions skip the pruned channels on
+    // the compressed path instead of running the dense GEMM over the zeros
+    if (useSparseConvolution(_cfg, node, conv_info, dilation)) {
+        if ((node.get_input_size() == 3) &&
+            (node.get_input_element_type(Bias) == ngraph::element::f32) && (node.get_input_shape(Bias).size() == 1)) {
+            return MakeConversion<NESparseConvolution>(node.input(Features), node.input(Weights), node.input(Bias), node.output(0));
+        } else if (node.get_input_size() == 2) {
+            return MakeConversion<NESparseConvolution>(node.input(Features), node.input(Weights), nullptr, node.output(0));
+        }
+    }
+
     auto iInfoIt = node.get_rt_info().find("InputPrescaleInfo");
     const arm_compute::QuantizationInfo* iInfo = iInfoIt == node.get_rt_info().end() ? nullptr :
                                                &(iInfoIt->second.as<arm_compute::QuantizationInfo>());
@@ -220,14 +525,15 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmConvolu
     const arm_compute::QuantizationInfo* qInfo = qInfoIt == node.get_rt_info().end() ? nullptr :
                                                &(qInfoIt->second.as<arm_compute::QuantizationInfo>());
 
+    const auto method = ConvMethodFor(_cfg._convMethod, node.get_friendly_name());
     if (node.get_input_size() == 3) {
         return MakeConversion<NEConvolutionLayerQI>(
             node.input(Features), node.input(Weights), node.input(Bias), node.output(0),
-            conv_info, arm_compute::WeightsInfo{}, dilation, GetActivationInfo(node), iInfo, wInfo, qInfo);
+            conv_info, arm_compute::WeightsInfo{}, dilation, GetActivationInfo(node), iInfo, wInfo, qInfo, method);
     } else {
         return MakeConversion<NEConvolutionLayerQI>(
             node.input(Features), node.input(Weights), nullptr, node.output(0),
-            conv_info, arm_compute::WeightsInfo{}, dilation, GetActivationInfo(node), iInfo, wInfo, qInfo);
+            conv_info, arm_compute::WeightsInfo{}, dilation, GetActivationInfo(node), iInfo, wInfo, qInfo, method);
     }
 }
 
@@ -285,7 +591,6 @@ public:
         } else if (output->info()->data_type() == arm_compute::DataType::QASYMM8_SIGNED && _weights->info()->data_type() == arm_compute::DataType::QASYMM8 ||
                    output->info()->data_type() == arm_compute::DataType::QASYMM8 && _weights->info()->data_type() == arm_compute::DataType::QASYMM8_SIGNED) {
             _w_sgn = std::make_unique<arm_compute::cpu::kernels::CpuConvertQuantizedSignednessKernel>();
-            _memory_group->manage(&_weightsqi);
             _weightsqi.allocator()->init(*(_weights->info()));
             _weightsqi.info()->set_data_type(output->info()->data_type()).set_quantization_info(arm_compute::QuantizationInfo(1.f,
                                                                 output->info()->data_type() == arm_compute::DataType::QASYMM8 ? 128 : -128));
@@ -310,7 +615,15 @@ public:
             _input->info()->extend_padding(_inputqi.info()->padding());
         }
         if (_w_sgn) {
+            //Weights are constant: convert their signedness once here, at network load,
+            //so every request shares the converted copy instead of re-converting per run
             _weightsqi.allocator()->allocate();
+            arm_compute::ITensorPack pack = {
+                { arm_compute::TensorType::ACL_SRC, _weights },
+                { arm_compute::TensorType::ACL_DST, &_weightsqi }
+            };
+            arm_compute::NEScheduler::get().schedule_op(_w_sgn.get(), arm_compute::Window::DimY, _w_sgn->window(), pack);
+            _w_sgn.reset();
         } else if (_wp && _weightsqi.info()->padding() != _weights->info()->padding()) {
             //Backpropagate possible weights padding change
             _weights->info()->extend_padding(_weightsqi.info()->padding());
@@ -355,7 +668,7 @@ public:
     }
     void run() override {
         ARM_COMPUTE_ERROR_ON_MSG(!_conv.get(), "Kernel didn't configured");
-        std::unique_ptr<arm_compute::MemoryGroupResourceScope> _sgn_scope = _i_sgn || _w_sgn ?
+        std::unique_ptr<arm_compute::MemoryGroupResourceScope> _sgn_scope = _i_sgn ?
                                                                 std::make_unique<arm_compute::MemoryGroupResourceScope>(*_memory_group) : nullptr;
         if (_i_sgn) {
             arm_compute::ITensorPack pack = {
@@ -367,13 +680,7 @@ public:
             if (_inputqi.info()->padding() != _input->info()->padding()) _inputqi.info()->extend_padding(_input->info()->padding());
             _inputqi.allocator()->import_memory(_input->buffer());
         }
-        if (_w_sgn) {
-            arm_compute::ITensorPack pack = {
-                { arm_compute::TensorType::ACL_SRC, _weights },
-                { arm_compute::TensorType::ACL_DST, &_weightsqi }
-            };
-            arm_compute::NEScheduler::get().schedule_op(_w_sgn.get(), arm_compute::Window::DimY, _w_sgn->window(), pack);
-        } else if (_wp) {
+        if (_wp) {
             if (_weightsqi.info()->padding() != _weights->info()->padding()) _weightsqi.info()->extend_padding(_weights->info()->padding());
             _weightsqi.allocator()->import_memory(_weights->buffer());
         }
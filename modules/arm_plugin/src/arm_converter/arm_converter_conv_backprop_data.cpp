@@ -3,10 +3,30 @@
 
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_deconv.hpp"
+#include "opset/utils.hpp"
 #include <ngraph/runtime/reference/convolution.hpp>
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ConvolutionBackpropData& node) {
+    // 2D f32 deconvolutions take the parallel native kernel (GAN upscalers
+    // spend most of their time here and the reference loop is single-core);
+    // other ranks, f16 and REF pins stay on the reference
+    if (!ForcedToReference(&node) && (node.get_input_element_type(0) == ngraph::element::f32) &&
+        (node.get_input_shape(0).size() == 4)) {
+        const auto& weightsShape = node.get_input_shape(1);
+        return MakeNativeConversion(deconvolution_native,
+                                    node.input(0),
+                                    node.input(1),
+                                    node.output(0),
+                                    node.get_input_shape(0),
+                                    node.get_shape(),
+                                    ngraph::Shape{weightsShape[2], weightsShape[3]},
+                                    node.get_strides(),
+                                    node.get_dilations(),
+                                    node.get_pads_begin(),
+                                    static_cast<std::size_t>(1));
+    }
     auto make = [&] (auto refFunction) {
         auto out_shape = node.get_shape();
         ngraph::Strides in_dilation(std::vector<size_t>(node.get_input_shape(0).size() - 2));
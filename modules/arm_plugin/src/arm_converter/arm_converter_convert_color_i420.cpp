@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
-#include <ngraph/runtime/reference/convert_color_nv12.hpp>
+#include <openvino/op/i420_to_bgr.hpp>
+#include <openvino/op/i420_to_rgb.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_color_convert.hpp"
 
 namespace ArmPlugin {
 template <typename T>
@@ -24,16 +26,12 @@ void wrap_color_convert_i420(const T* arg_y,
         image_h = image_h * 2 / 3;
         stride_uv = stride_uv * 4;
     }
-    ngraph::runtime::reference::color_convert_i420<T>(arg_y,
-                                                      single_plane ? arg_u + image_w * image_h : arg_u,
-                                                      single_plane ? arg_v + 5 * image_w * image_h / 4 : arg_v,
-                                                      out_ptr,
-                                                      batch_size,
-                                                      image_h,
-                                                      image_w,
-                                                      stride_y,
-                                                      stride_uv,
-                                                      color_format);
+    yuv::ConvertYUV(arg_y,
+                    single_plane ? arg_u + image_w * image_h : arg_u,
+                    single_plane ? arg_v + 5 * image_w * image_h / 4 : arg_v,
+                    1,
+                    out_ptr, batch_size, image_h, image_w, stride_y, stride_uv,
+                    color_format == ov::op::util::ConvertColorI420Base::ColorConversion::I420_TO_BGR);
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const ngraph::op::v8::I420toBGR& node) {
@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
-#include <ngraph/runtime/reference/convert_color_nv12.hpp>
+#include <openvino/op/nv12_to_bgr.hpp>
+#include <openvino/op/nv12_to_rgb.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_color_convert.hpp"
 
 namespace ArmPlugin {
 template <typename T>
@@ -23,15 +25,10 @@ void wrap_color_convert_nv12(const T* arg_y,
         image_h = image_h * 2 / 3;
         stride_uv = stride_uv * 2;
     }
-    ngraph::runtime::reference::color_convert_nv12<T>(arg_y,
-                                                      single_plane ? arg_uv + image_w * image_h : arg_uv,
-                                                      out_ptr,
-                                                      batch_size,
-                                                      image_h,
-                                                      image_w,
-                                                      stride_y,
-                                                      stride_uv,
-                                                      color_format);
+    const T* uv = single_plane ? arg_uv + image_w * image_h : arg_uv;
+    yuv::ConvertYUV(arg_y, uv, uv + 1, 2,
+                    out_ptr, batch_size, image_h, image_w, stride_y, stride_uv,
+                    color_format == ov::op::util::ConvertColorNV12Base::ColorConversion::NV12_TO_BGR);
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const ngraph::op::v8::NV12toBGR& node) {
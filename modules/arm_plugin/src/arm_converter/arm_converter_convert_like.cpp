@@ -5,6 +5,7 @@
 #include <arm_compute/runtime/NEON/functions/NEDepthConvertLayer.h>
 #include <arm_compute/runtime/NEON/functions/NECopy.h>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_convert_kernel.hpp"
 #include <ngraph/runtime/reference/convert.hpp>
 
 using type = ngraph::element::Type_t;
@@ -17,6 +18,12 @@ template <> Converter::Conversion::Ptr Converter::Convert(const opset::ConvertLi
                                     node.output(0),
                                     ngraph::shape_size(node.get_input_shape(0)));
     };
+    auto make_native = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(0),
+                                          ngraph::shape_size(node.get_input_shape(0)));
+    };
 
     auto src = node.get_input_element_type(0);
     auto dst = node.get_input_element_type(1);
@@ -69,6 +76,8 @@ template <> Converter::Conversion::Ptr Converter::Convert(const opset::ConvertLi
                     return make(ngraph::runtime::reference::convert<std::int32_t, std::int16_t>);
                 case ngraph::element::Type_t::u32 :
                     return make(ngraph::runtime::reference::convert<std::int32_t, std::uint32_t>);
+                case ngraph::element::Type_t::i64 :
+                    return make_native(cast::Convert<std::int32_t, std::int64_t>);
                 case ngraph::element::Type_t::f16 :
                     return make(ngraph::runtime::reference::convert<std::int32_t, ngraph::float16>);
                 case ngraph::element::Type_t::f32 :
@@ -82,6 +91,8 @@ template <> Converter::Conversion::Ptr Converter::Convert(const opset::ConvertLi
                     return make(ngraph::runtime::reference::convert<std::uint32_t, std::uint8_t>);
                 case ngraph::element::Type_t::i32 :
                     return make(ngraph::runtime::reference::convert<std::uint32_t, std::int32_t>);
+                case ngraph::element::Type_t::i64 :
+                    return make_native(cast::Convert<std::uint32_t, std::int64_t>);
                 case ngraph::element::Type_t::f16 :
                     return make(ngraph::runtime::reference::convert<std::uint32_t, ngraph::float16>);
                 case ngraph::element::Type_t::f32 :
@@ -97,6 +108,8 @@ template <> Converter::Conversion::Ptr Converter::Convert(const opset::ConvertLi
                     return make(ngraph::runtime::reference::convert<ngraph::float16, std::int16_t>);
                 case ngraph::element::Type_t::i32 :
                     return make(ngraph::runtime::reference::convert<ngraph::float16, std::int32_t>);
+                case ngraph::element::Type_t::i64 :
+                    return make_native(cast::Convert<ngraph::float16, std::int64_t>);
             default:
                 IE_THROW() << "Unsupported convertion from " << src << " to " << dst; return {};
             }
@@ -108,6 +121,28 @@ template <> Converter::Conversion::Ptr Converter::Convert(const opset::ConvertLi
                     return make(ngraph::runtime::reference::convert<float, std::int16_t>);
                 case ngraph::element::Type_t::i32 :
                     return make(ngraph::runtime::reference::convert<float, std::int32_t>);
+                case ngraph::element::Type_t::i64 :
+                    return make_native(cast::Convert<float, std::int64_t>);
+            default:
+                IE_THROW() << "Unsupported convertion from " << src << " to " << dst; return {};
+            }
+        case ngraph::element::Type_t::i64 :
+            switch (dst) {
+                case ngraph::element::Type_t::i32 :
+                    return make_native(cast::Convert<std::int64_t, std::int32_t>);
+                case ngraph::element::Type_t::f16 :
+                    return make_native(cast::Convert<std::int64_t, ngraph::float16>);
+                case ngraph::element::Type_t::f32 :
+                    return make_native(cast::Convert<std::int64_t, float>);
+            default:
+                IE_THROW() << "Unsupported convertion from " << src << " to " << dst; return {};
+            }
+        case ngraph::element::Type_t::u64 :
+            switch (dst) {
+                case ngraph::element::Type_t::i32 :
+                    return make_native(cast::Convert<std::uint64_t, std::int32_t>);
+                case ngraph::element::Type_t::f32 :
+                    return make_native(cast::Convert<std::uint64_t, float>);
             default:
                 IE_THROW() << "Unsupported convertion from " << src << " to " << dst; return {};
             }
@@ -2,25 +2,125 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/ctc_greedy_decoder_seq_len.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 namespace ArmPlugin {
+namespace {
+template <typename T>
+std::size_t argmax_row(const T* row, std::size_t classes) {
+    std::size_t best = 0;
+    for (std::size_t c = 1; c < classes; ++c) {
+        if (row[c] > row[best]) {
+            best = c;
+        }
+    }
+    return best;
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+// Four class lanes at a time; ties resolve to the lowest index like
+// std::max_element, so the strict compare per lane and the index tie-break
+// in the final reduction both keep the earliest maximum.
+std::size_t argmax_row(const float* row, std::size_t classes) {
+    std::size_t c = 0;
+    float best_value = row[0];
+    std::size_t best = 0;
+    if (classes >= 4) {
+        const uint32x4_t vstep = vdupq_n_u32(4);
+        uint32x4_t vindex = {0u, 1u, 2u, 3u};
+        uint32x4_t vbest_index = vindex;
+        float32x4_t vbest = vld1q_f32(row);
+        vindex = vaddq_u32(vindex, vstep);
+        for (c = 4; c + 4 <= classes; c += 4) {
+            const float32x4_t value = vld1q_f32(row + c);
+            const uint32x4_t greater = vcgtq_f32(value, vbest);
+            vbest = vbslq_f32(greater, value, vbest);
+            vbest_index = vbslq_u32(greater, vindex, vbest_index);
+            vindex = vaddq_u32(vindex, vstep);
+        }
+        float lane_values[4];
+        std::uint32_t lane_indices[4];
+        vst1q_f32(lane_values, vbest);
+        vst1q_u32(lane_indices, vbest_index);
+        best_value = lane_values[0];
+        best = lane_indices[0];
+        for (int lane = 1; lane < 4; ++lane) {
+            if ((lane_values[lane] > best_value) ||
+                ((lane_values[lane] == best_value) && (lane_indices[lane] < best))) {
+                best_value = lane_values[lane];
+                best = lane_indices[lane];
+            }
+        }
+    }
+    for (; c < classes; ++c) {
+        if (row[c] > best_value) {
+            best_value = row[c];
+            best = c;
+        }
+    }
+    return best;
+}
+#endif  // defined(__ARM_NEON) || defined(__ARM_NEON__)
+}  // namespace
+
+// Batch-parallel CTCGreedyDecoderSeqLen: every sequence decodes on its own
+// IE thread-pool worker, the per-step class argmax is NEON for f32 rows, and
+// blank/merged-repeat removal happens in the same pass that emits the
+// decoded classes.
+template <typename T, typename U, typename C, typename S>
+void ctc_greedy_decoder_seq_len_native(const T* data,
+                                       const U* sequence_lengths,
+                                       const U* blank_indices,
+                                       C* out_classes,
+                                       S* out_lengths,
+                                       const ngraph::Shape& data_shape,
+                                       const ngraph::Shape& out_shape,
+                                       bool merge_repeated) {
+    const auto batches = data_shape[0];
+    const auto steps = data_shape[1];
+    const auto classes = data_shape[2];
+    const auto blank = (blank_indices != nullptr) ? static_cast<std::size_t>(blank_indices[0]) : classes - 1;
+    InferenceEngine::parallel_for(batches, [&] (std::size_t batch) {
+        const T* input = data + batch * steps * classes;
+        C* output = out_classes + batch * out_shape[1];
+        const auto length = static_cast<std::size_t>(sequence_lengths[batch]);
+        std::size_t decoded = 0;
+        std::size_t previous = classes;
+        for (std::size_t t = 0; t < length; ++t) {
+            const auto top = argmax_row(input + t * classes, classes);
+            if ((top != blank) && !(merge_repeated && (top == previous))) {
+                output[decoded++] = static_cast<C>(top);
+            }
+            previous = top;
+        }
+        for (std::size_t t = decoded; t < out_shape[1]; ++t) {
+            output[t] = C(-1);
+        }
+        out_lengths[batch] = static_cast<S>(decoded);
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::CTCGreedyDecoderSeqLen& node) {
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.input(1),
-                                    node.input(2),
-                                    node.output(0),
-                                    node.output(1),
-                                    node.get_input_shape(0),
-                                    node.get_output_shape(0),
-                                    node.get_merge_repeated());
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.input(1),
+                                          node.input(2),
+                                          node.output(0),
+                                          node.output(1),
+                                          node.get_input_shape(0),
+                                          node.get_output_shape(0),
+                                          node.get_merge_repeated());
     };
 
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::ctc_greedy_decoder_seq_len),
+        AP_WRAP(make, ctc_greedy_decoder_seq_len_native),
         node.get_input_element_type(0),  floatTypes,
         node.get_input_element_type(1),  indexTypes,
         node.get_classes_index_type(),   indexTypes,
@@ -2,30 +2,180 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/ctc_loss.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 namespace ArmPlugin {
+namespace {
+template <typename T>
+T row_max(const T* row, std::size_t size) {
+    T best = row[0];
+    for (std::size_t i = 1; i < size; ++i) {
+        best = std::max(best, row[i]);
+    }
+    return best;
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+float row_max(const float* row, std::size_t size) {
+    std::size_t i = 0;
+    float best = row[0];
+    if (size >= 4) {
+        float32x4_t vbest = vld1q_f32(row);
+        for (i = 4; i + 4 <= size; i += 4) {
+            vbest = vmaxq_f32(vbest, vld1q_f32(row + i));
+        }
+        const float32x2_t folded = vmax_f32(vget_low_f32(vbest), vget_high_f32(vbest));
+        best = std::max(vget_lane_f32(folded, 0), vget_lane_f32(folded, 1));
+    }
+    for (; i < size; ++i) {
+        best = std::max(best, row[i]);
+    }
+    return best;
+}
+#endif  // defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+template <typename T>
+T log_add(T lhs, T rhs) {
+    if (std::isinf(lhs) && (lhs < T{0})) return rhs;
+    if (std::isinf(rhs) && (rhs < T{0})) return lhs;
+    return std::max(lhs, rhs) + std::log1p(std::exp(-std::abs(lhs - rhs)));
+}
+}  // namespace
+
+// Batch-parallel CTCLoss: every batch runs the log-domain forward algorithm
+// on its own IE thread-pool worker. The per-step softmax denominator is one
+// max-shifted log-sum-exp over the class row (row max is NEON for f32) and
+// the alpha recursion then only touches the blank and target classes, so the
+// O(T*C) normalization pass dominates instead of the O(T*S) recursion.
+template <typename T, typename U>
+void ctc_loss_native(const T* logits,
+                     const ngraph::Shape& logits_shape,
+                     const U* logits_lengths,
+                     const U* labels,
+                     const U* labels_lengths,
+                     const U* blank_indices,
+                     bool preprocess_collapse_repeated,
+                     bool ctc_merge_repeated,
+                     bool unique,
+                     T* output) {
+    const auto batches = logits_shape[0];
+    const auto max_time = logits_shape[1];
+    const auto classes = logits_shape[2];
+    const auto blank = (blank_indices != nullptr) ? static_cast<std::size_t>(blank_indices[0]) : classes - 1;
+    const T neg_inf = -std::numeric_limits<T>::infinity();
+    InferenceEngine::parallel_for(batches, [&] (std::size_t batch) {
+        const T* input = logits + batch * max_time * classes;
+        const auto time = static_cast<std::size_t>(logits_lengths[batch]);
+        const auto label_len = static_cast<std::size_t>(labels_lengths[batch]);
+
+        // Target preprocessing mirrors the reference: unique keeps the first
+        // occurrence of every label, collapse drops consecutive repeats
+        std::vector<std::size_t> target;
+        target.reserve(label_len);
+        if (unique) {
+            std::unordered_set<std::size_t> seen;
+            for (std::size_t i = 0; i < label_len; ++i) {
+                const auto label = static_cast<std::size_t>(labels[batch * max_time + i]);
+                if (seen.insert(label).second) {
+                    target.push_back(label);
+                }
+            }
+        } else if (preprocess_collapse_repeated) {
+            for (std::size_t i = 0; i < label_len; ++i) {
+                const auto label = static_cast<std::size_t>(labels[batch * max_time + i]);
+                if (target.empty() || (target.back() != label)) {
+                    target.push_back(label);
+                }
+            }
+        } else {
+            for (std::size_t i = 0; i < label_len; ++i) {
+                target.push_back(static_cast<std::size_t>(labels[batch * max_time + i]));
+            }
+        }
+
+        // log softmax denominator per step, max-shifted for stability
+        std::vector<T> denom(time);
+        for (std::size_t t = 0; t < time; ++t) {
+            const T* row = input + t * classes;
+            const T shift = row_max(row, classes);
+            T sum = T{0};
+            for (std::size_t c = 0; c < classes; ++c) {
+                sum += std::exp(row[c] - shift);
+            }
+            denom[t] = shift + std::log(sum);
+        }
+        auto log_prob = [&] (std::size_t t, std::size_t cls) {
+            return input[t * classes + cls] - denom[t];
+        };
+
+        // Extended target with blanks between and around labels; with
+        // ctc_merge_repeated a non-blank state may repeat across steps and
+        // the skip transition needs distinct neighbors, without it every
+        // label occupies exactly one step and the skip is unconditional
+        const auto states = 2 * target.size() + 1;
+        auto extended = [&] (std::size_t s) {
+            return (s % 2 == 0) ? blank : target[s / 2];
+        };
+        std::vector<T> alpha(states, neg_inf);
+        std::vector<T> previous(states);
+        alpha[0] = log_prob(0, blank);
+        if (states > 1) {
+            alpha[1] = log_prob(0, extended(1));
+        }
+        for (std::size_t t = 1; t < time; ++t) {
+            previous.swap(alpha);
+            for (std::size_t s = 0; s < states; ++s) {
+                const auto cls = extended(s);
+                T sum = ((cls == blank) || ctc_merge_repeated) ? previous[s] : neg_inf;
+                if (s > 0) {
+                    sum = log_add(sum, previous[s - 1]);
+                }
+                if ((s > 1) && (cls != blank) &&
+                    (!ctc_merge_repeated || (cls != extended(s - 2)))) {
+                    sum = log_add(sum, previous[s - 2]);
+                }
+                alpha[s] = (sum == neg_inf) ? neg_inf : sum + log_prob(t, cls);
+            }
+        }
+        T likelihood = alpha[states - 1];
+        if (states > 1) {
+            likelihood = log_add(likelihood, alpha[states - 2]);
+        }
+        output[batch] = -likelihood;
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::CTCLoss& node) {
     if (node.get_input_size() < 4) {
         IE_THROW() << "Unsupported CTCLoss op with num inputs = " << node.get_input_size();
     }
 
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.get_input_shape(0),
-                                    node.input(1),
-                                    node.input(2),
-                                    node.input(3),
-                                    node.input(4),
-                                    node.get_preprocess_collapse_repeated(),
-                                    node.get_ctc_merge_repeated(),
-                                    node.get_unique(),
-                                    node.output(0));
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.get_input_shape(0),
+                                          node.input(1),
+                                          node.input(2),
+                                          node.input(3),
+                                          node.input(4),
+                                          node.get_preprocess_collapse_repeated(),
+                                          node.get_ctc_merge_repeated(),
+                                          node.get_unique(),
+                                          node.output(0));
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::CTCLoss),
+        AP_WRAP(make, ctc_loss_native),
         node.input(0), floatTypes,
         node.input(1), indexTypes);
 }
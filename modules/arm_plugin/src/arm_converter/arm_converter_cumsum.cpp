@@ -2,17 +2,108 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <algorithm>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/cum_sum.hpp>
 
 namespace ArmPlugin {
+// Parallel CumSum. Tensors with enough independent slices along the
+// non-scanned axes simply fan the slices out over the IE thread pool. A long
+// scan with few slices (the 1-D audio-window case) runs the classic two-pass
+// scheme instead: per-chunk local scans in parallel, a sequential carry
+// prefix over the chunk totals, then a parallel carry add-back. Exclusive
+// and reverse variants map onto the same passes - the carry is additive
+// either way and reverse only changes the position mapping.
+template <typename T, typename P>
+void cumsum_native(const T* input,
+                   const P* axis_tensor,
+                   T* out,
+                   const ngraph::Shape& shape,
+                   bool exclusive,
+                   bool reverse) {
+    auto axis = static_cast<std::int64_t>(axis_tensor[0]);
+    if (axis < 0) {
+        axis += static_cast<std::int64_t>(shape.size());
+    }
+    std::size_t outer = 1;
+    for (std::int64_t dim = 0; dim < axis; ++dim) {
+        outer *= shape[dim];
+    }
+    const auto axis_dim = shape[axis];
+    std::size_t inner = 1;
+    for (std::size_t dim = axis + 1; dim < shape.size(); ++dim) {
+        inner *= shape[dim];
+    }
+    auto pos = [axis_dim, reverse] (std::size_t j) {
+        return reverse ? (axis_dim - 1 - j) : j;
+    };
+    // Scans [begin, end) of one slice starting from carry, returns the sum of
+    // the scanned inputs
+    auto scan = [&] (const T* src, T* dst, std::size_t begin, std::size_t end, T carry) {
+        T acc = carry;
+        for (std::size_t j = begin; j < end; ++j) {
+            const auto at = pos(j) * inner;
+            if (exclusive) {
+                dst[at] = acc;
+                acc += src[at];
+            } else {
+                acc += src[at];
+                dst[at] = acc;
+            }
+        }
+        return acc;
+    };
+
+    const auto slices = outer * inner;
+    const auto threads = static_cast<std::size_t>(std::max(InferenceEngine::parallel_get_max_threads(), 1));
+    if ((slices >= threads) || (axis_dim < (1 << 14))) {
+        InferenceEngine::parallel_for2d(outer, inner, [&] (std::size_t o, std::size_t i) {
+            scan(input + o * axis_dim * inner + i, out + o * axis_dim * inner + i, 0, axis_dim, T(0));
+        });
+    } else {
+        const auto chunks = threads;
+        const auto chunk_len = (axis_dim + chunks - 1) / chunks;
+        std::vector<T> sums(chunks);
+        for (std::size_t o = 0; o < outer; ++o) {
+            for (std::size_t i = 0; i < inner; ++i) {
+                const T* src = input + o * axis_dim * inner + i;
+                T* dst = out + o * axis_dim * inner + i;
+                InferenceEngine::parallel_for(chunks, [&] (std::size_t chunk) {
+                    const auto begin = chunk * chunk_len;
+                    const auto end = std::min(begin + chunk_len, axis_dim);
+                    sums[chunk] = (begin < end) ? scan(src, dst, begin, end, T(0)) : T(0);
+                });
+                std::vector<T> carries(chunks, T(0));
+                T running = T(0);
+                for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                    carries[chunk] = running;
+                    running += sums[chunk];
+                }
+                InferenceEngine::parallel_for(chunks, [&] (std::size_t chunk) {
+                    if (carries[chunk] == T(0)) {
+                        return;
+                    }
+                    const auto begin = chunk * chunk_len;
+                    const auto end = std::min(begin + chunk_len, axis_dim);
+                    for (std::size_t j = begin; j < end; ++j) {
+                        dst[pos(j) * inner] += carries[chunk];
+                    }
+                });
+            }
+        }
+    }
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::CumSum& node) {
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction, node.input(0), node.input(1), node.output(0),
-                                    node.get_input_shape(0), node.is_exclusive(), node.is_reverse());
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction, node.input(0), node.input(1), node.output(0),
+                                          node.get_input_shape(0), node.is_exclusive(), node.is_reverse());
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::cumsum),
+        AP_WRAP(make, cumsum_native),
         node.input(0), allTypes,
         node.input(1), intTypes);
 }
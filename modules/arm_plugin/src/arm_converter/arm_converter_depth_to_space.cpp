@@ -2,19 +2,132 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <vector>
+
 #include <arm_compute/runtime/NEON/functions/NEDepthToSpaceLayer.h>
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace ArmPlugin {
-template<> Converter::Conversion::Ptr Converter::Convert(const opset::DepthToSpace& node) {
-    if (node.get_input_shape(0).size() > 4) {
-        IE_THROW() << "Unsupported DepthToSpace with num dimensions > 4";
+namespace {
+// Interleaves block_size contiguous source runs into one output row
+// (dst[i * block_size + r] = run_r[i]); f32 block 2 and 4 move whole NEON
+// registers through vst2q/vst4q, everything else takes the scalar loop
+template <typename T>
+void interleave_runs(const T* const* runs, T* dst, std::size_t count, std::size_t block_size) {
+    for (std::size_t r = 0; r < block_size; ++r) {
+        const T* src = runs[r];
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i * block_size + r] = src[i];
+        }
     }
-    if (node.get_mode() != opset::DepthToSpace::DepthToSpaceMode::BLOCKS_FIRST) {
-        IE_THROW() << "Unsupported DepthToSpace mode";
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+void interleave_runs(const float* const* runs, float* dst, std::size_t count, std::size_t block_size) {
+    std::size_t i = 0;
+    if (block_size == 2) {
+        for (; i + 4 <= count; i += 4) {
+            float32x4x2_t lanes;
+            lanes.val[0] = vld1q_f32(runs[0] + i);
+            lanes.val[1] = vld1q_f32(runs[1] + i);
+            vst2q_f32(dst + i * 2, lanes);
+        }
+    } else if (block_size == 4) {
+        for (; i + 4 <= count; i += 4) {
+            float32x4x4_t lanes;
+            lanes.val[0] = vld1q_f32(runs[0] + i);
+            lanes.val[1] = vld1q_f32(runs[1] + i);
+            lanes.val[2] = vld1q_f32(runs[2] + i);
+            lanes.val[3] = vld1q_f32(runs[3] + i);
+            vst4q_f32(dst + i * 4, lanes);
+        }
     }
+    for (std::size_t r = 0; r < block_size; ++r) {
+        for (std::size_t j = i; j < count; ++j) {
+            dst[j * block_size + r] = runs[r][j];
+        }
+    }
+}
+#endif  // defined(__ARM_NEON) || defined(__ARM_NEON__)
+}  // namespace
 
-    int32_t block_shape = node.get_block_size();
-    return MakeConversion<arm_compute::NEDepthToSpaceLayer>(node.input(0), node.output(0), block_shape);
+// Native DepthToSpace for the DEPTH_FIRST mode NEDepthToSpaceLayer lacks
+// (and 5D inputs): every output row is the interleave of block_size
+// contiguous input runs, one per innermost block residue, coming from
+// channels picked by the mode's channel decomposition. Rows go parallel
+// over the IE thread pool and the interleave moves NEON registers for f32.
+template <typename T>
+void depth_to_space_native(const T* input,
+                           T* output,
+                           const ngraph::Shape& in_shape,
+                           const ngraph::Shape& out_shape,
+                           std::size_t block_size,
+                           bool depth_first) {
+    const auto rank = in_shape.size();
+    const auto spatial_dims = rank - 2;
+    const auto out_channels = out_shape[1];
+    std::size_t block_flat_size = 1;
+    for (std::size_t i = 0; i < spatial_dims; ++i) {
+        block_flat_size *= block_size;
+    }
+    std::vector<std::size_t> in_strides(rank);
+    std::size_t stride = 1;
+    for (auto i = rank; i-- > 0;) {
+        in_strides[i] = stride;
+        stride *= in_shape[i];
+    }
+    const auto row_elems = out_shape[rank - 1];
+    const auto rows = ngraph::shape_size(out_shape) / row_elems;
+    InferenceEngine::parallel_for(rows, [&] (std::size_t row) {
+        auto remainder = row;
+        std::vector<std::size_t> coords(rank - 1);
+        for (auto i = rank - 1; i-- > 0;) {
+            coords[i] = remainder % out_shape[i];
+            remainder /= out_shape[i];
+        }
+        std::size_t spatial_offset = 0;
+        std::size_t leading_flat = 0;
+        for (std::size_t i = 2; i < rank - 1; ++i) {
+            spatial_offset += (coords[i] / block_size) * in_strides[i];
+            leading_flat = leading_flat * block_size + coords[i] % block_size;
+        }
+        std::vector<const T*> runs(block_size);
+        for (std::size_t r = 0; r < block_size; ++r) {
+            const auto flat = leading_flat * block_size + r;
+            const auto channel = depth_first ? coords[1] * block_flat_size + flat
+                                             : flat * out_channels + coords[1];
+            runs[r] = input + coords[0] * in_strides[0] + channel * in_strides[1] + spatial_offset;
+        }
+        interleave_runs(runs.data(), output + row * row_elems, in_shape[rank - 1], block_size);
+    });
+}
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::DepthToSpace& node) {
+    if ((node.get_input_shape(0).size() <= 4) &&
+        (node.get_mode() == opset::DepthToSpace::DepthToSpaceMode::BLOCKS_FIRST)) {
+        int32_t block_shape = node.get_block_size();
+        return MakeConversion<arm_compute::NEDepthToSpaceLayer>(node.input(0), node.output(0), block_shape);
+    }
+    if (node.get_input_shape(0).size() > 5) {
+        IE_THROW() << "Unsupported DepthToSpace with num dimensions > 5";
+    }
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_output_shape(0),
+                                          static_cast<std::size_t>(node.get_block_size()),
+                                          node.get_mode() == opset::DepthToSpace::DepthToSpaceMode::DEPTH_FIRST);
+    };
+    return CallSwitch(
+        AP_WRAP(make, depth_to_space_native),
+        node.get_input_element_type(0), allTypes);
 }
 } //  namespace ArmPlugin
@@ -3,7 +3,13 @@
 //
 
 
+#include <algorithm>
+#include <cmath>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
+#include "arm_nms_core.hpp"
 #include <ngraph/runtime/reference/detection_output.hpp>
 
 namespace ArmPlugin {
@@ -49,7 +55,220 @@ template<> void detection_output<float>(const float* _location,
     refDet.run(_location, _confidence, _priors, _armConfidence, _armLocation, result);
 }
 
+static void decode_box(const float* prior, const float* variance, const float* loc,
+                       bool center_size, bool variance_encoded, float* decoded) {
+    if (center_size) {
+        float prior_width = prior[2] - prior[0];
+        float prior_height = prior[3] - prior[1];
+        float prior_center_x = (prior[0] + prior[2]) * 0.5f;
+        float prior_center_y = (prior[1] + prior[3]) * 0.5f;
+        float center_x, center_y, width, height;
+        if (variance_encoded) {
+            center_x = loc[0] * prior_width + prior_center_x;
+            center_y = loc[1] * prior_height + prior_center_y;
+            width = std::exp(loc[2]) * prior_width;
+            height = std::exp(loc[3]) * prior_height;
+        } else {
+            center_x = variance[0] * loc[0] * prior_width + prior_center_x;
+            center_y = variance[1] * loc[1] * prior_height + prior_center_y;
+            width = std::exp(variance[2] * loc[2]) * prior_width;
+            height = std::exp(variance[3] * loc[3]) * prior_height;
+        }
+        decoded[0] = center_x - width * 0.5f;
+        decoded[1] = center_y - height * 0.5f;
+        decoded[2] = center_x + width * 0.5f;
+        decoded[3] = center_y + height * 0.5f;
+    } else {
+        for (int i = 0; i < 4; ++i) {
+            decoded[i] = variance_encoded ? (prior[i] + loc[i]) : (prior[i] + variance[i] * loc[i]);
+        }
+    }
+}
+
+// Caffe-mode SSD postprocessing without the sequential reference: confidences
+// are pruned against the threshold before anything is decoded, only priors
+// that survived for some class get decoded, and the per-class NMS runs in
+// parallel on the NEON suppression core from arm_nms_core.hpp
+static void detection_output_native(const float* location,
+                                    const float* confidence,
+                                    const float* priors,
+                                    float* result,
+                                    const ngraph::op::DetectionOutputAttrs& attrs,
+                                    const ngraph::Shape& locShape,
+                                    const ngraph::Shape& priorsShape,
+                                    const ngraph::Shape& outShape) {
+    const auto batches = locShape[0];
+    const auto num_classes = static_cast<std::size_t>(attrs.num_classes);
+    const auto num_priors = priorsShape[2] / 4;
+    const auto num_loc_classes = attrs.share_location ? std::size_t{1} : num_classes;
+    const bool center_size = (attrs.code_type == "caffe.PriorBoxParameter.CENTER_SIZE");
+    const bool variance_encoded = attrs.variance_encoded_in_target;
+    const auto priors_per_batch = priorsShape[1] * priorsShape[2];
+
+    const auto capacity = ngraph::shape_size(outShape) / 7;
+    std::size_t count = 0;
+
+    struct ClassDetections {
+        std::vector<nms::Candidate> _detections;
+    };
+    std::vector<ClassDetections> detections(num_classes);
+    std::vector<float> decoded(num_loc_classes * num_priors * 4);
+    std::vector<char> needed(num_loc_classes * num_priors);
+
+    for (std::size_t batch = 0; batch < batches; ++batch) {
+        const float* batch_location = location + batch * locShape[1];
+        const float* batch_confidence = confidence + batch * num_priors * num_classes;
+        // Broadcast a single prior batch over all images
+        const float* batch_priors = priors + (priorsShape[0] == 1 ? 0 : batch * priors_per_batch);
+        const float* batch_variances = (priorsShape[1] == 2) ? batch_priors + num_priors * 4 : nullptr;
+
+        // Confidence pruning first: only scores above the threshold compete,
+        // truncated to top_k per class before any box is touched
+        std::fill(needed.begin(), needed.end(), char{0});
+        InferenceEngine::parallel_for(num_classes, [&] (std::size_t cls) {
+            auto& candidates = detections[cls]._detections;
+            candidates.clear();
+            if (static_cast<int>(cls) == attrs.background_label_id) {
+                return;
+            }
+            for (std::size_t prior = 0; prior < num_priors; ++prior) {
+                auto score = batch_confidence[prior * num_classes + cls];
+                if (score > attrs.confidence_threshold) {
+                    candidates.push_back(nms::Candidate{score, static_cast<int>(prior)});
+                }
+            }
+            std::stable_sort(candidates.begin(), candidates.end(), [] (const nms::Candidate& lhs, const nms::Candidate& rhs) {
+                return lhs.score > rhs.score;
+            });
+            if ((attrs.top_k > -1) && (candidates.size() > static_cast<std::size_t>(attrs.top_k))) {
+                candidates.resize(attrs.top_k);
+            }
+        });
+        // Marked sequentially: with share_location several classes share slot 0
+        for (std::size_t cls = 0; cls < num_classes; ++cls) {
+            auto loc_class = attrs.share_location ? std::size_t{0} : cls;
+            for (auto&& candidate : detections[cls]._detections) {
+                needed[loc_class * num_priors + candidate.box] = 1;
+            }
+        }
+
+        // Decode only the priors some class still needs
+        InferenceEngine::parallel_for2d(num_loc_classes, num_priors, [&] (std::size_t loc_class, std::size_t prior) {
+            if (!needed[loc_class * num_priors + prior]) {
+                return;
+            }
+            auto* box = &decoded[(loc_class * num_priors + prior) * 4];
+            decode_box(batch_priors + prior * 4,
+                       (batch_variances != nullptr) ? batch_variances + prior * 4 : nullptr,
+                       batch_location + (prior * num_loc_classes + loc_class) * 4,
+                       center_size,
+                       variance_encoded,
+                       box);
+            if (attrs.clip_before_nms) {
+                for (int i = 0; i < 4; ++i) {
+                    box[i] = std::min(std::max(box[i], 0.0f), 1.0f);
+                }
+            }
+        });
+
+        // Per-class greedy NMS, classes fanned out over the IE thread pool
+        InferenceEngine::parallel_for(num_classes, [&] (std::size_t cls) {
+            auto& candidates = detections[cls]._detections;
+            if (candidates.empty()) {
+                return;
+            }
+            auto loc_class = attrs.share_location ? std::size_t{0} : cls;
+            const float* boxes = &decoded[loc_class * num_priors * 4];
+            std::vector<nms::Candidate> survivors;
+            nms::KeptBoxes kept;
+            kept.Reserve(candidates.size());
+            for (auto&& candidate : candidates) {
+                const float* box = boxes + 4 * candidate.box;
+                if (!nms::SuppressedByAny(box, kept, attrs.nms_threshold)) {
+                    kept.Push(box);
+                    survivors.push_back(candidate);
+                }
+            }
+            candidates = std::move(survivors);
+        });
+
+        // Cross-class keep_top_k pruning by score
+        auto keep_top_k = attrs.keep_top_k.empty() ? -1 : attrs.keep_top_k[0];
+        std::size_t total = 0;
+        for (auto&& perClass : detections) {
+            total += perClass._detections.size();
+        }
+        if ((keep_top_k > -1) && (total > static_cast<std::size_t>(keep_top_k))) {
+            struct Ranked {
+                float       _score;
+                std::size_t _cls;
+                std::size_t _index;
+            };
+            std::vector<Ranked> ranked;
+            ranked.reserve(total);
+            for (std::size_t cls = 0; cls < num_classes; ++cls) {
+                auto& perClass = detections[cls]._detections;
+                for (std::size_t index = 0; index < perClass.size(); ++index) {
+                    ranked.push_back(Ranked{perClass[index].score, cls, index});
+                }
+            }
+            std::stable_sort(ranked.begin(), ranked.end(), [] (const Ranked& lhs, const Ranked& rhs) {
+                return lhs._score > rhs._score;
+            });
+            ranked.resize(keep_top_k);
+            std::vector<std::vector<nms::Candidate>> pruned(num_classes);
+            for (auto&& entry : ranked) {
+                pruned[entry._cls].push_back(detections[entry._cls]._detections[entry._index]);
+            }
+            for (std::size_t cls = 0; cls < num_classes; ++cls) {
+                detections[cls]._detections = std::move(pruned[cls]);
+            }
+        }
+
+        // Emit [image_id, label, score, xmin, ymin, xmax, ymax] rows grouped
+        // by ascending label, score-descending inside each label
+        for (std::size_t cls = 0; cls < num_classes; ++cls) {
+            auto loc_class = attrs.share_location ? std::size_t{0} : cls;
+            for (auto&& detection : detections[cls]._detections) {
+                if (count >= capacity) {
+                    break;
+                }
+                float* row = result + count * 7;
+                const float* box = &decoded[(loc_class * num_priors + detection.box) * 4];
+                row[0] = static_cast<float>(batch);
+                row[1] = static_cast<float>(cls);
+                row[2] = detection.score;
+                for (int i = 0; i < 4; ++i) {
+                    row[3 + i] = attrs.clip_after_nms ? std::min(std::max(box[i], 0.0f), 1.0f) : box[i];
+                }
+                ++count;
+            }
+        }
+    }
+    if (count < capacity) {
+        // Terminator row, same convention as the ngraph reference
+        result[count * 7] = -1;
+    }
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::DetectionOutput& node) {
+    // The common SSD configuration (Caffe label order, normalized priors, no
+    // ARM refinement inputs) takes the parallel native path; MXNet-mode,
+    // non-normalized and ARM-refined variants keep the ngraph reference
+    if ((node.get_input_size() == 3) &&
+        (node.get_input_element_type(0) == ngraph::element::f32) &&
+        node.get_attrs().normalized &&
+        !node.get_attrs().decrease_label_id) {
+        return MakeNativeConversion(detection_output_native,
+                              node.input(0),
+                              node.input(1),
+                              node.input(2),
+                              node.output(0),
+                              node.get_attrs(),
+                              node.get_input_shape(0),
+                              node.get_input_shape(2),
+                              node.get_output_shape(0));
+    }
     auto make = [&] (auto refFunction) {
         if (node.get_input_size() == 3) {
             return this->MakeConversion(refFunction,
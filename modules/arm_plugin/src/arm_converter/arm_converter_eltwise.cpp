@@ -11,19 +11,160 @@
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+static arm_compute::ActivationLayerInfo GetActivationInfo(const ngraph::Node& node) {
+    auto itInfo = node.get_rt_info().find("ActivationLayerInfo");
+    if (itInfo != node.get_rt_info().end()) {
+        return itInfo->second.as<arm_compute::ActivationLayerInfo>();
+    } else {
+        return {};
+    }
+}
+
+static const arm_compute::QuantizationInfo* GetQuantizationInfo(const ngraph::Node& node, const char* name) {
+    auto itInfo = node.get_rt_info().find(name);
+    if (itInfo != node.get_rt_info().end()) {
+        return &(itInfo->second.as<arm_compute::QuantizationInfo>());
+    } else {
+        return nullptr;
+    }
+}
+
+// Wraps a quantized arithmetic function: the graph tensors carry the neutral
+// {1, 0} QuantizationInfo, so the real per-tensor scales fused from the
+// surrounding dequantize/FakeQuantize ops (see EltwiseQuantizeFusion) are
+// applied through imported aliases and the kernel rescales internally
+template<typename Function>
+struct NEEltwiseQI final: public arm_compute::IFunction {
+public:
+    NEEltwiseQI() : _function(nullptr),
+        _input0(nullptr), _qi0(nullptr), _input0qi(),
+        _input1(nullptr), _qi1(nullptr), _input1qi(),
+        _output(nullptr), _qo(nullptr), _outputqi() {}
+    NEEltwiseQI(const NEEltwiseQI &) = delete;
+    NEEltwiseQI &operator=(const NEEltwiseQI &) = delete;
+    NEEltwiseQI(NEEltwiseQI &&) = delete;
+    NEEltwiseQI &operator=(NEEltwiseQI &&) = delete;
+    ~NEEltwiseQI() = default;
+    template<typename... Args>
+    void configure(arm_compute::ITensor *input0, arm_compute::ITensor *input1, arm_compute::ITensor *output,
+                   const arm_compute::QuantizationInfo *qi0, const arm_compute::QuantizationInfo *qi1,
+                   const arm_compute::QuantizationInfo *qo, Args&&... args) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input0, input1, output);
+        _input0 = input0;
+        _qi0 = qi0;
+        if (_qi0) {
+            _input0qi.allocator()->init(*(_input0->info()));
+            _input0qi.info()->set_quantization_info(*qi0);
+        }
+        _input1 = input1;
+        _qi1 = qi1;
+        if (_qi1) {
+            _input1qi.allocator()->init(*(_input1->info()));
+            _input1qi.info()->set_quantization_info(*qi1);
+        }
+        _output = output;
+        _qo = qo;
+        if (_qo) {
+            _outputqi.allocator()->init(*(_output->info()));
+            _outputqi.info()->set_quantization_info(*qo);
+        }
+        _function = std::make_unique<Function>();
+        _function->configure(_qi0 ? &_input0qi : _input0, _qi1 ? &_input1qi : _input1, _qo ? &_outputqi : _output,
+                             std::forward<Args>(args)...);
+        if (_qi0 && _input0qi.info()->padding() != _input0->info()->padding()) {
+            //Backpropagate possible input padding change
+            _input0->info()->extend_padding(_input0qi.info()->padding());
+        }
+        if (_qi1 && _input1qi.info()->padding() != _input1->info()->padding()) {
+            //Backpropagate possible input padding change
+            _input1->info()->extend_padding(_input1qi.info()->padding());
+        }
+    }
+    template<typename... Args>
+    static arm_compute::Status validate(const arm_compute::ITensorInfo *input0, const arm_compute::ITensorInfo *input1,
+                                        const arm_compute::ITensorInfo *output,
+                                        const arm_compute::QuantizationInfo *qi0, const arm_compute::QuantizationInfo *qi1,
+                                        const arm_compute::QuantizationInfo *qo, Args&&... args) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input0, input1, output);
+        arm_compute::TensorInfo vld_input0(*input0);
+        if (qi0) vld_input0.set_quantization_info(*qi0);
+        arm_compute::TensorInfo vld_input1(*input1);
+        if (qi1) vld_input1.set_quantization_info(*qi1);
+        arm_compute::TensorInfo vld_output(*output);
+        if (qo) vld_output.set_quantization_info(*qo);
+        return Function::validate(&vld_input0, &vld_input1, &vld_output, std::forward<Args>(args)...);
+    }
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(!_function.get(), "Kernel didn't configured");
+        if (_qi0) {
+            if (_input0qi.info()->padding() != _input0->info()->padding()) _input0qi.info()->extend_padding(_input0->info()->padding());
+            _input0qi.allocator()->import_memory(_input0->buffer());
+        }
+        if (_qi1) {
+            if (_input1qi.info()->padding() != _input1->info()->padding()) _input1qi.info()->extend_padding(_input1->info()->padding());
+            _input1qi.allocator()->import_memory(_input1->buffer());
+        }
+        if (_qo) {
+            if (_outputqi.info()->padding() != _output->info()->padding()) _outputqi.info()->extend_padding(_output->info()->padding());
+            _outputqi.allocator()->import_memory(_output->buffer());
+        }
+        _function->run();
+        if (_qi0) _input0qi.allocator()->free();
+        if (_qi1) _input1qi.allocator()->free();
+        if (_qo) _outputqi.allocator()->free();
+    }
+
+protected:
+    const arm_compute::QuantizationInfo *_qi0;
+    arm_compute::ITensor *_input0;
+    arm_compute::Tensor _input0qi;
+    const arm_compute::QuantizationInfo *_qi1;
+    arm_compute::ITensor *_input1;
+    arm_compute::Tensor _input1qi;
+    const arm_compute::QuantizationInfo *_qo;
+    arm_compute::ITensor *_output;
+    arm_compute::Tensor _outputqi;
+    std::unique_ptr<Function> _function;
+};
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Add& node) {
-    return MakeConversion<arm_compute::NEArithmeticAddition>(node.input(0), node.input(1), node.output(0), arm_compute::ConvertPolicy::SATURATE);
+    if (node.get_output_element_type(0).is_quantized()) {
+        return MakeConversion<NEEltwiseQI<arm_compute::NEArithmeticAddition>>(
+            node.input(0), node.input(1), node.output(0),
+            GetQuantizationInfo(node, "InputPrescaleInfo"),
+            GetQuantizationInfo(node, "SecondInputPrescaleInfo"),
+            GetQuantizationInfo(node, "QuantizationInfo"),
+            arm_compute::ConvertPolicy::SATURATE,
+            GetActivationInfo(node));
+    }
+    return MakeConversion<arm_compute::NEArithmeticAddition>(node.input(0), node.input(1), node.output(0),
+        arm_compute::ConvertPolicy::SATURATE,
+        GetActivationInfo(node));
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Subtract& node) {
-    return MakeConversion<arm_compute::NEArithmeticSubtraction>(node.input(0), node.input(1), node.output(0), arm_compute::ConvertPolicy::SATURATE);
+    return MakeConversion<arm_compute::NEArithmeticSubtraction>(node.input(0), node.input(1), node.output(0),
+        arm_compute::ConvertPolicy::SATURATE,
+        GetActivationInfo(node));
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Multiply& node) {
+    if (node.get_output_element_type(0).is_quantized()) {
+        return MakeConversion<NEEltwiseQI<arm_compute::NEPixelWiseMultiplication>>(
+            node.input(0), node.input(1), node.output(0),
+            GetQuantizationInfo(node, "InputPrescaleInfo"),
+            GetQuantizationInfo(node, "SecondInputPrescaleInfo"),
+            GetQuantizationInfo(node, "QuantizationInfo"),
+            1.0f,
+            arm_compute::ConvertPolicy::SATURATE,
+            arm_compute::RoundingPolicy::TO_ZERO,
+            GetActivationInfo(node));
+    }
     return MakeConversion<arm_compute::NEPixelWiseMultiplication>(node.input(0), node.input(1), node.output(0),
         1.0f,
         arm_compute::ConvertPolicy::SATURATE,
-        arm_compute::RoundingPolicy::TO_ZERO);
+        arm_compute::RoundingPolicy::TO_ZERO,
+        GetActivationInfo(node));
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Minimum& node) {
@@ -2,46 +2,90 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/embedding_bag_offsets_sum.hpp>
+#include "arm_embedding_sum.hpp"
 
 namespace ArmPlugin {
+// Bag-parallel EmbeddingBagOffsetsSum on the shared segment-reduction engine:
+// each bag is an independent workload over the IE thread pool, rows are
+// accumulated with the NEON engine and upcoming rows software-prefetched
+// (distance set by the EMB_PREFETCH_DISTANCE config key)
+template <typename T, typename U>
+void embedding_bag_offsets_sum_native(const T* table,
+                                      const U* indices,
+                                      const U* offsets,
+                                      const U* default_index,
+                                      const T* weights,
+                                      T* out,
+                                      std::size_t indices_count,
+                                      const ngraph::Shape& out_shape,
+                                      int prefetch) {
+    const auto bags = out_shape[0];
+    const auto row_elems = ngraph::shape_size(out_shape) / bags;
+    InferenceEngine::parallel_for(bags, [&] (std::size_t bag) {
+        const auto begin = static_cast<std::size_t>(offsets[bag]);
+        const auto end = (bag + 1 < bags) ? static_cast<std::size_t>(offsets[bag + 1]) : indices_count;
+        T* dst = out + bag * row_elems;
+        if (begin == end) {
+            // An empty bag yields the default row when given, zeros otherwise
+            if ((default_index != nullptr) && (static_cast<std::int64_t>(default_index[0]) >= 0)) {
+                embedding::SumRows(table, row_elems, default_index, static_cast<const T*>(nullptr),
+                                   std::size_t{1}, std::size_t{0}, dst);
+            } else {
+                for (std::size_t i = 0; i < row_elems; ++i) {
+                    dst[i] = T(0);
+                }
+            }
+            return;
+        }
+        embedding::SumRows(table, row_elems, indices + begin,
+                           (weights != nullptr) ? weights + begin : nullptr,
+                           end - begin, static_cast<std::size_t>(prefetch), dst);
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::EmbeddingBagOffsetsSum& node) {
-    auto make = [&] (auto refFunction) {
+    const auto prefetch = _cfg._embPrefetchDistance;
+    auto make = [&] (auto nativeFunction) {
         if (node.get_input_size() > 4) {
-            return this->MakeConversion(refFunction,
-                                        node.input(0),
-                                        node.input(1),
-                                        node.input(2),
-                                        node.input(3),
-                                        node.input(4),
-                                        node.output(0),
-                                        ngraph::shape_size(node.get_input_shape(1)),
-                                        node.get_shape());
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.input(1),
+                                              node.input(2),
+                                              node.input(3),
+                                              node.input(4),
+                                              node.output(0),
+                                              ngraph::shape_size(node.get_input_shape(1)),
+                                              node.get_shape(),
+                                              prefetch);
         } else if (node.get_input_size() > 3) {
-            return this->MakeConversion(refFunction,
-                                        node.input(0),
-                                        node.input(1),
-                                        node.input(2),
-                                        node.input(3),
-                                        nullptr,
-                                        node.output(0),
-                                        ngraph::shape_size(node.get_input_shape(1)),
-                                        node.get_shape());
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.input(1),
+                                              node.input(2),
+                                              node.input(3),
+                                              nullptr,
+                                              node.output(0),
+                                              ngraph::shape_size(node.get_input_shape(1)),
+                                              node.get_shape(),
+                                              prefetch);
         } else {
-            return this->MakeConversion(refFunction,
-                                        node.input(0),
-                                        node.input(1),
-                                        node.input(2),
-                                        nullptr,
-                                        nullptr,
-                                        node.output(0),
-                                        ngraph::shape_size(node.get_input_shape(1)),
-                                        node.get_shape());
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.input(1),
+                                              node.input(2),
+                                              nullptr,
+                                              nullptr,
+                                              node.output(0),
+                                              ngraph::shape_size(node.get_input_shape(1)),
+                                              node.get_shape(),
+                                              prefetch);
         }
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::embeddingBagOffsetsSum),
+        AP_WRAP(make, embedding_bag_offsets_sum_native),
         node.get_input_element_type(0), allTypes,
         node.get_input_element_type(1), indexTypes);
 }
@@ -2,34 +2,61 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/embedding_bag_packed_sum.hpp>
+#include "arm_embedding_sum.hpp"
 
 namespace ArmPlugin {
+// Bag-parallel EmbeddingBagPackedSum on the shared reduction engine: the
+// indices tensor is already [bags, indices_per_bag], so every bag reduces a
+// fixed-size contiguous slice on its own IE thread-pool worker.
+template <typename T, typename U>
+void embedding_bag_packed_sum_native(const T* table,
+                                     const U* indices,
+                                     const T* weights,
+                                     T* out,
+                                     const ngraph::Shape& indices_shape,
+                                     const ngraph::Shape& out_shape,
+                                     int prefetch) {
+    const auto bags = out_shape[0];
+    const auto row_elems = ngraph::shape_size(out_shape) / bags;
+    const auto indices_per_bag = indices_shape[1];
+    InferenceEngine::parallel_for(bags, [&] (std::size_t bag) {
+        embedding::SumRows(table, row_elems, indices + bag * indices_per_bag,
+                           (weights != nullptr) ? weights + bag * indices_per_bag : nullptr,
+                           indices_per_bag, static_cast<std::size_t>(prefetch),
+                           out + bag * row_elems);
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::EmbeddingBagPackedSum& node) {
-    auto make = [&] (auto refFunction) {
+    const auto prefetch = _cfg._embPrefetchDistance;
+    auto make = [&] (auto nativeFunction) {
         if (node.get_input_size() > 2) {
-            return this->MakeConversion(refFunction,
-                                        node.input(0),
-                                        node.input(1),
-                                        node.input(2),
-                                        node.output(0),
-                                        node.get_input_shape(1),
-                                        node.get_shape());
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.input(1),
+                                              node.input(2),
+                                              node.output(0),
+                                              node.get_input_shape(1),
+                                              node.get_shape(),
+                                              prefetch);
         } else {
-            return this->MakeConversion(refFunction,
-                                        node.input(0),
-                                        node.input(1),
-                                        nullptr,
-                                        node.output(0),
-                                        node.get_input_shape(1),
-                                        node.get_shape());
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.input(1),
+                                              nullptr,
+                                              node.output(0),
+                                              node.get_input_shape(1),
+                                              node.get_shape(),
+                                              prefetch);
         }
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::embeddingBagPackedSum),
-        node.input(0), allTypes,
-        node.input(1), indexTypes);
+        AP_WRAP(make, embedding_bag_packed_sum_native),
+        node.get_input_element_type(0), allTypes,
+        node.get_input_element_type(1), indexTypes);
 }
 
 }  //  namespace ArmPlugin
@@ -2,51 +2,99 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <algorithm>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/embedding_segments_sum.hpp>
+#include "arm_embedding_sum.hpp"
 
 namespace ArmPlugin {
+// Segment-parallel EmbeddingSegmentsSum on the shared reduction engine:
+// segment_ids are sorted ascending, so each output segment owns a contiguous
+// range of the indices tensor located with a binary search, and the segments
+// then reduce independently across the IE thread pool.
+template <typename T, typename U>
+void embedding_segments_sum_native(const T* table,
+                                   const U* indices,
+                                   const U* segment_ids,
+                                   const U* default_index,
+                                   const T* weights,
+                                   T* out,
+                                   const ngraph::Shape& table_shape,
+                                   const ngraph::Shape& indices_shape,
+                                   const ngraph::Shape& out_shape,
+                                   int prefetch) {
+    const auto segments = out_shape[0];
+    const auto row_elems = ngraph::shape_size(out_shape) / segments;
+    const auto indices_count = ngraph::shape_size(indices_shape);
+    InferenceEngine::parallel_for(segments, [&] (std::size_t segment) {
+        const auto id = static_cast<U>(segment);
+        const auto begin = std::lower_bound(segment_ids, segment_ids + indices_count, id) - segment_ids;
+        const auto end = std::upper_bound(segment_ids, segment_ids + indices_count, id) - segment_ids;
+        T* dst = out + segment * row_elems;
+        if (begin == end) {
+            if ((default_index != nullptr) && (static_cast<std::int64_t>(default_index[0]) >= 0)) {
+                embedding::SumRows(table, row_elems, default_index, static_cast<const T*>(nullptr),
+                                   std::size_t{1}, std::size_t{0}, dst);
+            } else {
+                for (std::size_t i = 0; i < row_elems; ++i) {
+                    dst[i] = T(0);
+                }
+            }
+            return;
+        }
+        embedding::SumRows(table, row_elems, indices + begin,
+                           (weights != nullptr) ? weights + begin : nullptr,
+                           static_cast<std::size_t>(end - begin), static_cast<std::size_t>(prefetch), dst);
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::EmbeddingSegmentsSum& node) {
-    auto make = [&] (auto refFunction) {
+    const auto prefetch = _cfg._embPrefetchDistance;
+    auto make = [&] (auto nativeFunction) {
         if (node.get_input_size() > 5) {
-            return this->MakeConversion(refFunction,
-                                        node.input(0),
-                                        node.input(1),
-                                        node.input(2),
-                                        node.input(4),
-                                        node.input(5),
-                                        node.output(0),
-                                        node.get_input_shape(0),
-                                        node.get_input_shape(1),
-                                        node.get_output_shape(0));
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.input(1),
+                                              node.input(2),
+                                              node.input(4),
+                                              node.input(5),
+                                              node.output(0),
+                                              node.get_input_shape(0),
+                                              node.get_input_shape(1),
+                                              node.get_output_shape(0),
+                                              prefetch);
         } else if (node.get_input_size() > 4) {
-            return this->MakeConversion(refFunction,
-                                        node.input(0),
-                                        node.input(1),
-                                        node.input(2),
-                                        node.input(4),
-                                        nullptr,
-                                        node.output(0),
-                                        node.get_input_shape(0),
-                                        node.get_input_shape(1),
-                                        node.get_output_shape(0));
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.input(1),
+                                              node.input(2),
+                                              node.input(4),
+                                              nullptr,
+                                              node.output(0),
+                                              node.get_input_shape(0),
+                                              node.get_input_shape(1),
+                                              node.get_output_shape(0),
+                                              prefetch);
         } else {
-            return this->MakeConversion(refFunction,
-                                        node.input(0),
-                                        node.input(1),
-                                        node.input(2),
-                                        nullptr,
-                                        nullptr,
-                                        node.output(0),
-                                        node.get_input_shape(0),
-                                        node.get_input_shape(1),
-                                        node.get_output_shape(0));
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.input(1),
+                                              node.input(2),
+                                              nullptr,
+                                              nullptr,
+                                              node.output(0),
+                                              node.get_input_shape(0),
+                                              node.get_input_shape(1),
+                                              node.get_output_shape(0),
+                                              prefetch);
         }
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::embeddingSegmentsSum),
-        node.input(0), allTypes,
-        node.input(1), indexTypes);
+        AP_WRAP(make, embedding_segments_sum_native),
+        node.get_input_element_type(0), allTypes,
+        node.get_input_element_type(1), indexTypes);
 }
 
 }  //  namespace ArmPlugin
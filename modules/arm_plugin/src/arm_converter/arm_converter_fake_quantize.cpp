@@ -8,8 +8,124 @@
 #include <ngraph/op/fake_quantize.hpp>
 #include <ngraph/runtime/reference/fake_quantize.hpp>
 
+#include <arm_compute/core/CPP/ICPPKernel.h>
+#include <arm_compute/core/Helpers.h>
+#include <arm_compute/runtime/NEON/NEScheduler.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace ArmPlugin {
+//Standalone FakeQuantize with per-tensor ranges reduces to a branchless
+//clamp+scale+round per element; the kernel below runs it vectorized and split
+//across the scheduler workers instead of the scalar reference pass
+struct NEFakeQuantizeKernel final: public arm_compute::ICPPKernel {
+    const char* name() const override {
+        return "NEFakeQuantizeKernel";
+    }
+    void configure(const arm_compute::ITensor* input, arm_compute::ITensor* output,
+                   float inLow, float inHigh, float outLow, float outHigh, std::size_t levels) {
+        _input = input;
+        _output = output;
+        _inLow = inLow;
+        _inScale = (levels - 1) / (inHigh - inLow);
+        _outLow = outLow;
+        _outScale = (outHigh - outLow) / (levels - 1);
+        _qMax = static_cast<float>(levels - 1);
+        arm_compute::Window win = arm_compute::calculate_max_window(*(input->info()), arm_compute::Steps());
+        ICPPKernel::configure(win);
+    }
+    void run(const arm_compute::Window& window, const arm_compute::ThreadInfo&) override {
+        arm_compute::Window win{window};
+        win.set(arm_compute::Window::DimX, arm_compute::Window::Dimension(0, 1, 1));
+        const std::size_t rowLength = _input->info()->dimension(0);
+        arm_compute::Iterator inIt(_input, win);
+        arm_compute::Iterator outIt(_output, win);
+        arm_compute::execute_window_loop(win, [&] (const arm_compute::Coordinates&) {
+            const auto* src = reinterpret_cast<const float*>(inIt.ptr());
+            auto* dst = reinterpret_cast<float*>(outIt.ptr());
+            std::size_t i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+            const float32x4_t vInLow = vdupq_n_f32(_inLow);
+            const float32x4_t vInScale = vdupq_n_f32(_inScale);
+            const float32x4_t vOutLow = vdupq_n_f32(_outLow);
+            const float32x4_t vOutScale = vdupq_n_f32(_outScale);
+            const float32x4_t vZero = vdupq_n_f32(0.f);
+            const float32x4_t vQMax = vdupq_n_f32(_qMax);
+            for (; i + 4 <= rowLength; i += 4) {
+                float32x4_t q = vmulq_f32(vsubq_f32(vld1q_f32(src + i), vInLow), vInScale);
+                q = vrndnq_f32(vminq_f32(vmaxq_f32(q, vZero), vQMax));
+                vst1q_f32(dst + i, vaddq_f32(vmulq_f32(q, vOutScale), vOutLow));
+            }
+#endif
+            for (; i < rowLength; ++i) {
+                float q = (src[i] - _inLow) * _inScale;
+                q = std::nearbyint(std::max(0.f, std::min(_qMax, q)));
+                dst[i] = q * _outScale + _outLow;
+            }
+        }, inIt, outIt);
+    }
+
+private:
+    const arm_compute::ITensor* _input = nullptr;
+    arm_compute::ITensor* _output = nullptr;
+    float _inLow = 0.f;
+    float _inScale = 1.f;
+    float _outLow = 0.f;
+    float _outScale = 1.f;
+    float _qMax = 255.f;
+};
+struct NEFakeQuantizeLayer final: public arm_compute::IFunction {
+public:
+    NEFakeQuantizeLayer(std::shared_ptr<arm_compute::IMemoryManager> = nullptr): _kernel(nullptr) {}
+    NEFakeQuantizeLayer(const NEFakeQuantizeLayer &) = delete;
+    NEFakeQuantizeLayer &operator=(const NEFakeQuantizeLayer &) = delete;
+    NEFakeQuantizeLayer(NEFakeQuantizeLayer &&) = delete;
+    NEFakeQuantizeLayer &operator=(NEFakeQuantizeLayer &&) = delete;
+    ~NEFakeQuantizeLayer() = default;
+    void configure(const arm_compute::ITensor* input, arm_compute::ITensor* output,
+                   float inLow, float inHigh, float outLow, float outHigh, std::size_t levels) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+        ARM_COMPUTE_ERROR_THROW_ON(NEFakeQuantizeLayer::validate(input->info(), output->info(), inLow, inHigh, outLow, outHigh, levels));
+        _kernel = std::make_unique<NEFakeQuantizeKernel>();
+        _kernel->configure(input, output, inLow, inHigh, outLow, outHigh, levels);
+    }
+    static arm_compute::Status validate(const arm_compute::ITensorInfo* input, const arm_compute::ITensorInfo* output,
+                                        float inLow, float inHigh, float, float, std::size_t levels) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != arm_compute::DataType::F32 ||
+                                    output->data_type() != arm_compute::DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape() != output->tensor_shape());
+        ARM_COMPUTE_RETURN_ERROR_ON(levels < 2 || !(inHigh > inLow));
+        return arm_compute::Status{};
+    }
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(!_kernel.get(), "Kernel didn't configured");
+        arm_compute::NEScheduler::get().schedule(_kernel.get(), arm_compute::Window::DimY);
+    }
+
+private:
+    std::unique_ptr<NEFakeQuantizeKernel> _kernel;
+};
+static bool isScalarConstant(const ngraph::Node& node, std::size_t index) {
+    return ngraph::is_type<opset::Constant>(node.input_value(index).get_node()) &&
+           ngraph::shape_size(node.get_input_shape(index)) == 1;
+}
+static float scalarValue(const ngraph::Node& node, std::size_t index) {
+    return safe_cast<opset::Constant>(node.input_value(index).get_node())->cast_vector<float>()[0];
+}
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::FakeQuantize& node) {
+    if (node.input(0).get_element_type() == ngraph::element::f32 && node.get_levels() >= 2 &&
+        isScalarConstant(node, 1) && isScalarConstant(node, 2) && isScalarConstant(node, 3) && isScalarConstant(node, 4)) {
+        auto inLow = scalarValue(node, 1);
+        auto inHigh = scalarValue(node, 2);
+        if (inHigh > inLow) {
+            return MakeConversion<NEFakeQuantizeLayer>(node.input(0), node.output(0),
+                                                       inLow, inHigh, scalarValue(node, 3), scalarValue(node, 4),
+                                                       static_cast<std::size_t>(node.get_levels()));
+        }
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0), node.input(1), node.input(2), node.input(3), node.input(4),
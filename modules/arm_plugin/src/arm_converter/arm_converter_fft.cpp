@@ -2,9 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <memory>
+
+#include <ie_parallel.hpp>
+
 #include <arm_compute/runtime/NEON/functions/NEFFT1D.h>
 #include <ngraph/runtime/reference/fft.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_fft_kernels.hpp"
+#include "opset/utils.hpp"
 
 namespace ArmPlugin {
 
@@ -69,11 +75,65 @@ static void verify_fft_args(const ngraph::op::util::FFTBase& node, std::vector<i
     //node.get_output_shape(0) = output_shape;
 }
 
+// Native batched FFT over the innermost signal axis: the twiddle tables and
+// the bit-reversal permutation live in one plan precomputed at conversion
+// time, and the frames (a spectrogram's hops) are independent, so they spread
+// over the IE thread pool instead of running the transform frame by frame
+static void fft_native_batched(const float* input,
+                               float* output,
+                               const std::shared_ptr<neon::FftPlan>& plan,
+                               const std::size_t frames) {
+    const auto frameElements = plan->Length() * 2;
+    InferenceEngine::parallel_for(frames, [&] (std::size_t frame) {
+        plan->Execute(input + frame * frameElements, output + frame * frameElements);
+    });
+}
+
+// The native kernel takes the single-axis power-of-two transforms over the
+// innermost signal axis that the reference path would otherwise get: nodes
+// carrying a signal_sizes input bypass the ArmFFT substitution even when the
+// sizes match the input (the common torch.stft export), and REF pins stay
+// on the reference implementation
+static bool fits_native_fft(const ngraph::op::util::FFTBase& node,
+                            const std::vector<std::int64_t>& axes_vals,
+                            const ngraph::Shape& output_shape) {
+    if (ForcedToReference(&node)) {
+        return false;
+    }
+    if (node.get_input_element_type(0) != ngraph::element::f32) {
+        return false;
+    }
+    const auto& shape = node.get_input_shape(0);
+    if (output_shape != shape) {  // signal sizes that pad or trim stay on reference
+        return false;
+    }
+    if (axes_vals.size() != 1) {
+        return false;
+    }
+    auto axis = axes_vals[0];
+    if (axis < 0) {
+        axis += static_cast<std::int64_t>(shape.size()) - 1;
+    }
+    if (axis != static_cast<std::int64_t>(shape.size()) - 2) {
+        return false;
+    }
+    return neon::FftPlan::Supported(shape[axis]);
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::DFT& node) {
+    std::vector<std::int64_t> axes_vals;
+    ngraph::Shape output_shape;
+    verify_fft_args(node, axes_vals, output_shape);
+    if (fits_native_fft(node, axes_vals, output_shape)) {
+        const auto& shape = node.get_input_shape(0);
+        auto plan = std::make_shared<neon::FftPlan>(shape[shape.size() - 2], false);
+        return MakeNativeConversion(fft_native_batched,
+                                    node.input(0),
+                                    node.output(0),
+                                    plan,
+                                    ngraph::shape_size(shape) / (2 * plan->Length()));
+    }
     auto make = [&] (auto refFunction) {
-        std::vector<std::int64_t> axes_vals;
-        ngraph::Shape output_shape;
-        verify_fft_args(node, axes_vals, output_shape);
         return this->MakeConversion(refFunction,
                                     node.input(0),
                                     node.get_input_shape(0),
@@ -89,10 +149,19 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::DFT& node)
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::IDFT& node) {
+    std::vector<std::int64_t> axes_vals;
+    ngraph::Shape output_shape;
+    verify_fft_args(node, axes_vals, output_shape);
+    if (fits_native_fft(node, axes_vals, output_shape)) {
+        const auto& shape = node.get_input_shape(0);
+        auto plan = std::make_shared<neon::FftPlan>(shape[shape.size() - 2], true);
+        return MakeNativeConversion(fft_native_batched,
+                                    node.input(0),
+                                    node.output(0),
+                                    plan,
+                                    ngraph::shape_size(shape) / (2 * plan->Length()));
+    }
     auto make = [&] (auto refFunction) {
-        std::vector<std::int64_t> axes_vals;
-        ngraph::Shape output_shape;
-        verify_fft_args(node, axes_vals, output_shape);
         return this->MakeConversion(refFunction,
                                     node.input(0),
                                     node.get_input_shape(0),
@@ -0,0 +1,136 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <ie_parallel.hpp>
+#include "arm_converter/arm_converter.hpp"
+
+namespace ArmPlugin {
+namespace {
+using Predicate = opset::ArmFusedSelect::Predicate;
+using Combine = opset::ArmFusedSelect::Combine;
+
+template<typename C>
+bool evaluate_predicate(const Predicate predicate, const C a, const C b) {
+    switch (predicate) {
+        case Predicate::Equal        : return a == b;
+        case Predicate::NotEqual     : return a != b;
+        case Predicate::Greater      : return a > b;
+        case Predicate::GreaterEqual : return a >= b;
+        case Predicate::Less         : return a < b;
+        case Predicate::LessEqual    : return a <= b;
+    }
+    return false;
+}
+
+// Whole compare -> [logical] -> select chain in one pass: the masks live in
+// registers instead of round-tripping through boolean tensors. Chunks run on
+// the IE thread pool; b0/b1 are null for single-predicate chains.
+template<typename C, typename V>
+void fused_select_native(const C* a0, const C* a1,
+                         const C* b0, const C* b1,
+                         const V* thenVals, const V* elseVals, V* out,
+                         const Predicate predicateA, const Predicate predicateB,
+                         const Combine combine, const bool invert,
+                         const std::size_t size) {
+    constexpr std::size_t chunkSize = 8192;
+    const std::size_t chunks = (size + chunkSize - 1) / chunkSize;
+    InferenceEngine::parallel_for(chunks, [&] (std::size_t chunk) {
+        const std::size_t begin = chunk * chunkSize;
+        const std::size_t end = std::min(size, begin + chunkSize);
+        for (std::size_t i = begin; i < end; ++i) {
+            bool mask = evaluate_predicate(predicateA, a0[i], a1[i]);
+            switch (combine) {
+                case Combine::None : break;
+                case Combine::And  : mask = mask && evaluate_predicate(predicateB, b0[i], b1[i]); break;
+                case Combine::Or   : mask = mask || evaluate_predicate(predicateB, b0[i], b1[i]); break;
+                case Combine::Xor  : mask = mask != evaluate_predicate(predicateB, b0[i], b1[i]); break;
+            }
+            out[i] = (mask != invert) ? thenVals[i] : elseVals[i];
+        }
+    });
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+uint32x4_t evaluate_predicate_vec(const Predicate predicate, const float32x4_t a, const float32x4_t b) {
+    switch (predicate) {
+        case Predicate::Equal        : return vceqq_f32(a, b);
+        case Predicate::NotEqual     : return vmvnq_u32(vceqq_f32(a, b));
+        case Predicate::Greater      : return vcgtq_f32(a, b);
+        case Predicate::GreaterEqual : return vcgeq_f32(a, b);
+        case Predicate::Less         : return vcltq_f32(a, b);
+        case Predicate::LessEqual    : return vcleq_f32(a, b);
+    }
+    return vdupq_n_u32(0);
+}
+
+// f32 chains (the common postprocessing case) blend four lanes per step
+template<>
+void fused_select_native<float, float>(const float* a0, const float* a1,
+                                       const float* b0, const float* b1,
+                                       const float* thenVals, const float* elseVals, float* out,
+                                       const Predicate predicateA, const Predicate predicateB,
+                                       const Combine combine, const bool invert,
+                                       const std::size_t size) {
+    constexpr std::size_t chunkSize = 8192;
+    const std::size_t chunks = (size + chunkSize - 1) / chunkSize;
+    InferenceEngine::parallel_for(chunks, [&] (std::size_t chunk) {
+        const std::size_t begin = chunk * chunkSize;
+        const std::size_t end = std::min(size, begin + chunkSize);
+        std::size_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            uint32x4_t mask = evaluate_predicate_vec(predicateA, vld1q_f32(a0 + i), vld1q_f32(a1 + i));
+            switch (combine) {
+                case Combine::None : break;
+                case Combine::And  : mask = vandq_u32(mask, evaluate_predicate_vec(predicateB, vld1q_f32(b0 + i), vld1q_f32(b1 + i))); break;
+                case Combine::Or   : mask = vorrq_u32(mask, evaluate_predicate_vec(predicateB, vld1q_f32(b0 + i), vld1q_f32(b1 + i))); break;
+                case Combine::Xor  : mask = veorq_u32(mask, evaluate_predicate_vec(predicateB, vld1q_f32(b0 + i), vld1q_f32(b1 + i))); break;
+            }
+            if (invert) {
+                mask = vmvnq_u32(mask);
+            }
+            vst1q_f32(out + i, vbslq_f32(mask, vld1q_f32(thenVals + i), vld1q_f32(elseVals + i)));
+        }
+        for (; i < end; ++i) {
+            bool mask = evaluate_predicate(predicateA, a0[i], a1[i]);
+            switch (combine) {
+                case Combine::None : break;
+                case Combine::And  : mask = mask && evaluate_predicate(predicateB, b0[i], b1[i]); break;
+                case Combine::Or   : mask = mask || evaluate_predicate(predicateB, b0[i], b1[i]); break;
+                case Combine::Xor  : mask = mask != evaluate_predicate(predicateB, b0[i], b1[i]); break;
+            }
+            out[i] = (mask != invert) ? thenVals[i] : elseVals[i];
+        }
+    });
+}
+#endif
+}  // namespace
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmFusedSelect& node) {
+    const bool combined = node.get_combine() != Combine::None;
+    const auto thenIndex = combined ? 4 : 2;
+    auto make = [&] (auto nativeFunction) {
+        return combined
+            ? this->MakeNativeConversion(nativeFunction,
+                                         node.input(0), node.input(1), node.input(2), node.input(3),
+                                         node.input(thenIndex), node.input(thenIndex + 1), node.output(0),
+                                         node.get_predicate_a(), node.get_predicate_b(),
+                                         node.get_combine(), node.get_invert(),
+                                         ngraph::shape_size(node.get_output_shape(0)))
+            : this->MakeNativeConversion(nativeFunction,
+                                         node.input(0), node.input(1), nullptr, nullptr,
+                                         node.input(thenIndex), node.input(thenIndex + 1), node.output(0),
+                                         node.get_predicate_a(), node.get_predicate_b(),
+                                         node.get_combine(), node.get_invert(),
+                                         ngraph::shape_size(node.get_output_shape(0)));
+    };
+    return CallSwitch(
+        AP_WRAP(make, fused_select_native),
+        node.get_input_element_type(0), merge(indexTypes, floatTypes),
+        node.get_input_element_type(thenIndex), commonTypes);
+}
+}  //  namespace ArmPlugin
@@ -3,12 +3,112 @@
 
 
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
 #include <arm_compute/runtime/NEON/functions/NEGather.h>
 #include <ngraph/runtime/reference/gather.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "opset/utils.hpp"
 
 namespace ArmPlugin {
+namespace {
+// Native Gather viewing the data as [batch, outer, axis, inner]: every
+// gathered slice is one contiguous run of inner bytes, so a row gather is a
+// block memcpy, and the (batch, outer) planes run parallel over the IE pool.
+// Works on raw bytes, so one instantiation per index type covers every data
+// type. Constant indices arrive pre-normalized as byte offsets computed at
+// conversion time; runtime indices are normalized (negative values wrap,
+// out-of-range values clamp) per batch on the fly.
+template <typename I>
+void gather_native(const std::uint8_t* data,
+                   const I* indices,
+                   std::uint8_t* output,
+                   const std::size_t batches,
+                   const std::size_t outer,
+                   const std::size_t axisSize,
+                   const std::size_t indicesPerBatch,
+                   const std::size_t innerBytes,
+                   const std::shared_ptr<std::vector<std::size_t>>& offsets) {
+    InferenceEngine::parallel_for2d(batches, outer, [&] (std::size_t batch, std::size_t o) {
+        const std::uint8_t* src = data + (batch * outer + o) * axisSize * innerBytes;
+        std::uint8_t* dst = output + (batch * outer + o) * indicesPerBatch * innerBytes;
+        if (offsets != nullptr) {
+            const std::size_t* offset = offsets->data() + batch * indicesPerBatch;
+            for (std::size_t i = 0; i < indicesPerBatch; ++i) {
+                std::memcpy(dst + i * innerBytes, src + offset[i], innerBytes);
+            }
+        } else {
+            const I* batchIndices = indices + batch * indicesPerBatch;
+            for (std::size_t i = 0; i < indicesPerBatch; ++i) {
+                auto index = static_cast<std::int64_t>(batchIndices[i]);
+                if (index < 0) {
+                    index += static_cast<std::int64_t>(axisSize);
+                }
+                index = std::max<std::int64_t>(0, std::min<std::int64_t>(index, axisSize - 1));
+                std::memcpy(dst + i * innerBytes, src + static_cast<std::size_t>(index) * innerBytes, innerBytes);
+            }
+        }
+    });
+}
+}  // namespace
+
+template <typename Node>
+static Converter::Conversion::Ptr ConvertGatherNative(Converter* converter, const Node& node,
+                                                      const std::size_t axis, const std::size_t batchDims) {
+    const auto& dataShape = node.get_input_shape(0);
+    std::size_t batches = 1;
+    for (std::size_t dim = 0; dim < batchDims; ++dim) {
+        batches *= dataShape[dim];
+    }
+    std::size_t outer = 1;
+    for (std::size_t dim = batchDims; dim < axis; ++dim) {
+        outer *= dataShape[dim];
+    }
+    const std::size_t axisSize = dataShape[axis];
+    std::size_t innerBytes = node.get_input_element_type(0).size();
+    for (std::size_t dim = axis + 1; dim < dataShape.size(); ++dim) {
+        innerBytes *= dataShape[dim];
+    }
+    const std::size_t indicesPerBatch = ngraph::shape_size(node.get_input_shape(1)) / batches;
+    std::shared_ptr<std::vector<std::size_t>> offsets;
+    auto constIndices = std::dynamic_pointer_cast<opset::Constant>(node.input_value(1).get_node_shared_ptr());
+    if (constIndices != nullptr) {
+        auto values = constIndices->template cast_vector<std::int64_t>();
+        offsets = std::make_shared<std::vector<std::size_t>>(values.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            auto index = values[i] < 0 ? values[i] + static_cast<std::int64_t>(axisSize) : values[i];
+            index = std::max<std::int64_t>(0, std::min<std::int64_t>(index, axisSize - 1));
+            (*offsets)[i] = static_cast<std::size_t>(index) * innerBytes;
+        }
+    }
+    auto make = [&] (auto nativeFunction) {
+        return converter->MakeNativeConversion(nativeFunction,
+                                               node.input(0),
+                                               node.input(1),
+                                               node.output(0),
+                                               batches,
+                                               outer,
+                                               axisSize,
+                                               indicesPerBatch,
+                                               innerBytes,
+                                               offsets);
+    };
+    return CallSwitch(
+        AP_WRAP(make, gather_native),
+        node.input(1), indexTypes);
+}
+
 template <> Converter::Conversion::Ptr Converter::Convert(const opset::Gather& node) {
+    if (!ForcedToReference(&node)) {
+        return ConvertGatherNative(this, node,
+                                   static_cast<std::size_t>(node.get_axis()),
+                                   static_cast<std::size_t>(node.get_batch_dims()));
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -28,6 +128,9 @@ template <> Converter::Conversion::Ptr Converter::Convert(const opset::Gather& n
 }
 
 template <> Converter::Conversion::Ptr Converter::Convert(const ngraph::op::v1::Gather& node) {
+    if (!ForcedToReference(&node)) {
+        return ConvertGatherNative(this, node, static_cast<std::size_t>(node.get_axis()), 0);
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -1,13 +1,126 @@
 // Copyright (C) 2020-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+
 #include <details/ie_exception.hpp>
 
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 #include "arm_converter/arm_converter.hpp"
 #include <ngraph/runtime/reference/gather_elements.hpp>
+#include "opset/utils.hpp"
 
 namespace ArmPlugin {
+namespace {
+// One gathered row along the innermost axis: normalizes (negative wrap) and
+// clamps the indices, then picks the elements. NEON has no gather
+// instruction, so the i32 overload emulates one - four indices are
+// normalized per iteration in vector registers and the data moves through
+// lane loads; other index types take the scalar loop.
+template <typename T, typename I>
+void row_gather(const T* src, const I* idx, T* dst, const std::size_t count, const std::int64_t axisSize) {
+    for (std::size_t i = 0; i < count; ++i) {
+        auto index = static_cast<std::int64_t>(idx[i]);
+        if (index < 0) {
+            index += axisSize;
+        }
+        dst[i] = src[std::max<std::int64_t>(0, std::min<std::int64_t>(index, axisSize - 1))];
+    }
+}
+
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+template <typename T>
+void row_gather(const T* src, const std::int32_t* idx, T* dst, const std::size_t count, const std::int64_t axisSize) {
+    const int32x4_t vaxis = vdupq_n_s32(static_cast<std::int32_t>(axisSize));
+    const int32x4_t vlast = vdupq_n_s32(static_cast<std::int32_t>(axisSize) - 1);
+    const int32x4_t vzero = vdupq_n_s32(0);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        int32x4_t v = vld1q_s32(idx + i);
+        v = vbslq_s32(vcltq_s32(v, vzero), vaddq_s32(v, vaxis), v);
+        v = vmaxq_s32(vminq_s32(v, vlast), vzero);
+        dst[i + 0] = src[vgetq_lane_s32(v, 0)];
+        dst[i + 1] = src[vgetq_lane_s32(v, 1)];
+        dst[i + 2] = src[vgetq_lane_s32(v, 2)];
+        dst[i + 3] = src[vgetq_lane_s32(v, 3)];
+    }
+    for (; i < count; ++i) {
+        auto index = idx[i] < 0 ? idx[i] + static_cast<std::int32_t>(axisSize) : idx[i];
+        dst[i] = src[std::max(0, std::min(index, static_cast<std::int32_t>(axisSize) - 1))];
+    }
+}
+#endif
+
+// Native GatherElements over the [outer, axis, inner] view precomputed at
+// conversion time: the innermost-axis case gathers whole rows, any other
+// axis walks the inner stride per picked element. Outer planes are
+// independent and spread over the IE thread pool.
+template <typename T, typename I>
+void gather_elements_native(const T* data,
+                            const I* indices,
+                            T* output,
+                            const std::size_t outer,
+                            const std::size_t dataAxis,
+                            const std::size_t idxAxis,
+                            const std::size_t inner) {
+    InferenceEngine::parallel_for(outer, [&] (std::size_t o) {
+        const T* src = data + o * dataAxis * inner;
+        const I* idx = indices + o * idxAxis * inner;
+        T* dst = output + o * idxAxis * inner;
+        if (inner == 1) {
+            row_gather(src, idx, dst, idxAxis, static_cast<std::int64_t>(dataAxis));
+        } else {
+            for (std::size_t a = 0; a < idxAxis; ++a) {
+                for (std::size_t p = 0; p < inner; ++p) {
+                    auto index = static_cast<std::int64_t>(idx[a * inner + p]);
+                    if (index < 0) {
+                        index += static_cast<std::int64_t>(dataAxis);
+                    }
+                    index = std::max<std::int64_t>(0, std::min<std::int64_t>(index, dataAxis - 1));
+                    dst[a * inner + p] = src[static_cast<std::size_t>(index) * inner + p];
+                }
+            }
+        }
+    });
+}
+}  // namespace
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::GatherElements& node) {
+    if (!ForcedToReference(&node)) {
+        const auto& dataShape = node.get_input_shape(0);
+        const auto& idxShape = node.get_input_shape(1);
+        auto axis = node.get_axis();
+        if (axis < 0) {
+            axis += static_cast<std::int64_t>(dataShape.size());
+        }
+        std::size_t outer = 1;
+        for (std::int64_t dim = 0; dim < axis; ++dim) {
+            outer *= dataShape[dim];
+        }
+        std::size_t inner = 1;
+        for (std::size_t dim = axis + 1; dim < dataShape.size(); ++dim) {
+            inner *= dataShape[dim];
+        }
+        auto make = [&] (auto nativeFunction) {
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.input(1),
+                                              node.output(0),
+                                              outer,
+                                              dataShape[axis],
+                                              idxShape[axis],
+                                              inner);
+        };
+        return CallSwitch(
+            AP_WRAP(make, gather_elements_native),
+            node.input(0), allTypes,
+            node.input(1), indexTypes);
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
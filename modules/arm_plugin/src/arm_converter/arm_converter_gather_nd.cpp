@@ -2,23 +2,77 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cstring>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/gather_nd.hpp>
 
 namespace ArmPlugin {
+// Blocked GatherND: each index tuple resolves to one flat source offset and
+// the trailing dimensions move as a single contiguous block copy, with the
+// (batch, slice) space fanned out over the IE thread pool - instead of the
+// reference's element-by-element gather
+template <typename T, typename U>
+void gather_nd_native(const T* data,
+                      const U* indices,
+                      T* out,
+                      const ngraph::Shape& data_shape,
+                      const ngraph::Shape& indices_shape,
+                      const ngraph::Shape& out_shape,
+                      int batch_dims) {
+    const auto depth = indices_shape.back();
+    std::size_t batches = 1;
+    for (int dim = 0; dim < batch_dims; ++dim) {
+        batches *= data_shape[dim];
+    }
+    std::size_t data_batch_elems = 1;
+    for (std::size_t dim = batch_dims; dim < data_shape.size(); ++dim) {
+        data_batch_elems *= data_shape[dim];
+    }
+    std::size_t slice_elems = 1;
+    for (std::size_t dim = batch_dims + depth; dim < data_shape.size(); ++dim) {
+        slice_elems *= data_shape[dim];
+    }
+    const auto slices_per_batch = ngraph::shape_size(indices_shape) / depth / batches;
+
+    // Element strides of the indexed dimensions inside one data batch
+    std::vector<std::size_t> strides(depth);
+    std::size_t stride = slice_elems;
+    for (std::size_t dim = depth; dim > 0; --dim) {
+        strides[dim - 1] = stride;
+        stride *= data_shape[batch_dims + dim - 1];
+    }
+
+    InferenceEngine::parallel_for2d(batches, slices_per_batch, [&] (std::size_t batch, std::size_t slice) {
+        const U* tuple = indices + (batch * slices_per_batch + slice) * depth;
+        std::size_t offset = batch * data_batch_elems;
+        for (std::size_t dim = 0; dim < depth; ++dim) {
+            auto index = static_cast<std::int64_t>(tuple[dim]);
+            if (index < 0) {
+                index += static_cast<std::int64_t>(data_shape[batch_dims + dim]);
+            }
+            offset += static_cast<std::size_t>(index) * strides[dim];
+        }
+        std::memcpy(out + (batch * slices_per_batch + slice) * slice_elems,
+                    data + offset,
+                    slice_elems * sizeof(T));
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::GatherND& node) {
     if (node.get_output_shape(0).size() > 5) {
         IE_THROW() << "GatherND node doesn't support " << node.get_output_shape(0) << " output shape.";
     }
 
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0), node.input(1), node.output(0),
-                                    node.get_input_shape(0), node.get_input_shape(1), node.get_output_shape(0),
-                                    static_cast<int>(node.get_batch_dims()));
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0), node.input(1), node.output(0),
+                                          node.get_input_shape(0), node.get_input_shape(1), node.get_output_shape(0),
+                                          static_cast<int>(node.get_batch_dims()));
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::gather_nd),
+        AP_WRAP(make, gather_nd_native),
         node.input(0), allTypes,
         node.input(1), indexTypes);
 }
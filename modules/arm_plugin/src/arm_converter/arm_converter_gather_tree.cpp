@@ -2,49 +2,69 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <algorithm>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/gather_tree.hpp>
 
 namespace ArmPlugin {
+// Beam-parallel GatherTree: every (batch, beam) pair chases its parent chain
+// on its own IE thread-pool worker. The chase itself carries no branches —
+// each step is one gather plus the next parent load — and the end-token
+// cut-off is applied with a running flag instead of a per-element branch.
 template <typename T>
-void wrap_gather_tree(const T* step_ids,
-                      const T* parent_ids,
-                      const T* max_seq_len,
-                      const T* end_token,
-                      T* out,
-                      const ngraph::Shape& step_ids_shape,
-                      const ngraph::Shape& parent_ids_shape,
-                      const ngraph::Shape& max_seq_len_shape,
-                      const ngraph::Shape& end_token_shape,
-                      const ngraph::element::Type& type) {
-    ngraph::runtime::reference::gather_tree(reinterpret_cast<const char*>(step_ids),
-                                            reinterpret_cast<const char*>(parent_ids),
-                                            reinterpret_cast<const char*>(max_seq_len),
-                                            reinterpret_cast<const char*>(end_token),
-                                            reinterpret_cast<char*>(out),
-                                            step_ids_shape,
-                                            parent_ids_shape,
-                                            max_seq_len_shape,
-                                            end_token_shape,
-                                            type);
+void gather_tree_native(const T* step_ids,
+                        const T* parent_ids,
+                        const T* max_seq_len,
+                        const T* end_token,
+                        T* out,
+                        const ngraph::Shape& step_ids_shape,
+                        const ngraph::Shape& parent_ids_shape,
+                        const ngraph::Shape& max_seq_len_shape,
+                        const ngraph::Shape& end_token_shape) {
+    const auto max_time = step_ids_shape[0];
+    const auto batches = step_ids_shape[1];
+    const auto beams = step_ids_shape[2];
+    const T end = end_token[0];
+    InferenceEngine::parallel_for2d(batches, beams, [&] (std::size_t batch, std::size_t beam) {
+        const auto length = std::min(max_time, static_cast<std::size_t>(max_seq_len[batch]));
+        T* output = out + batch * beams + beam;
+        for (std::size_t time = length; time < max_time; ++time) {
+            output[time * batches * beams] = end;
+        }
+        if (length == 0) {
+            return;
+        }
+        auto parent = beam;
+        for (auto time = length; time-- > 0;) {
+            output[time * batches * beams] = step_ids[(time * batches + batch) * beams + parent];
+            parent = static_cast<std::size_t>(parent_ids[(time * batches + batch) * beams + parent]);
+        }
+        bool finished = false;
+        for (std::size_t time = 0; time < length; ++time) {
+            const T value = output[time * batches * beams];
+            output[time * batches * beams] = finished ? end : value;
+            finished |= (value == end);
+        }
+    });
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::GatherTree& node) {
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.input(1),
-                                    node.input(2),
-                                    node.input(3),
-                                    node.output(0),
-                                    node.get_input_shape(0),
-                                    node.get_input_shape(1),
-                                    node.get_input_shape(2),
-                                    node.get_input_shape(3),
-                                    node.get_input_element_type(1));
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.input(1),
+                                          node.input(2),
+                                          node.input(3),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_input_shape(1),
+                                          node.get_input_shape(2),
+                                          node.get_input_shape(3));
     };
     return CallSwitch(
-        AP_WRAP(make, wrap_gather_tree),
+        AP_WRAP(make, gather_tree_native),
         node.input(0), allTypes);
 }
 
@@ -4,11 +4,31 @@
 #include <details/ie_exception.hpp>
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_deconv.hpp"
+#include "opset/utils.hpp"
 #include <ngraph/runtime/reference/group_convolution.hpp>
 #include <ngraph/runtime/reference/group_convolution_backprop_data.hpp>
 
 namespace ArmPlugin {
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::GroupConvolutionBackpropData& node) {
+    // Grouped 2D f32 deconvolutions take the same parallel native kernel as
+    // the plain ones (groups just restrict the channel window per output),
+    // so grouped transposed convs scale with cores instead of pinning one
+    if (!ForcedToReference(&node) && (node.get_input_element_type(0) == ngraph::element::f32) &&
+        (node.get_input_shape(0).size() == 4)) {
+        const auto& weightsShape = node.get_input_shape(1);  // [G, Cin/G, Cout/G, Kh, Kw]
+        return MakeNativeConversion(deconvolution_native,
+                                    node.input(0),
+                                    node.input(1),
+                                    node.output(0),
+                                    node.get_input_shape(0),
+                                    node.get_shape(),
+                                    ngraph::Shape{weightsShape[3], weightsShape[4]},
+                                    node.get_strides(),
+                                    node.get_dilations(),
+                                    node.get_pads_begin(),
+                                    weightsShape[0]);
+    }
     auto make = [&] (auto refFunction) {
         auto out_shape = node.get_shape();
         ngraph::Strides in_dilation(std::vector<size_t>(node.get_input_shape(0).size() - 2));
@@ -2,14 +2,205 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <cmath>
+
 #include <arm_compute/runtime/NEON/functions/NEScale.h>
 #include <ngraph/runtime/reference/interpolate.hpp>
+#include <ie_parallel.hpp>
 #include "arm_converter/arm_converter.hpp"
 
 
 using Transform_mode  = ngraph::op::v4::Interpolate::CoordinateTransformMode;
 
 namespace ArmPlugin {
+namespace {
+// Per-axis sampling table: for every output coordinate the first source tap
+// and the filter weights, both fixed once the scale is known at convert time
+struct AxisTable {
+    std::vector<int> _offsets;
+    std::vector<float> _weights;
+    int _taps;
+};
+
+float source_coord(Transform_mode mode, std::size_t x, float scale, std::size_t in_dim, std::size_t out_dim) {
+    switch (mode) {
+        case Transform_mode::HALF_PIXEL:
+            return (x + 0.5f) / scale - 0.5f;
+        case Transform_mode::PYTORCH_HALF_PIXEL:
+            return out_dim > 1 ? (x + 0.5f) / scale - 0.5f : 0.f;
+        case Transform_mode::ASYMMETRIC:
+            return x / scale;
+        case Transform_mode::TF_HALF_PIXEL_FOR_NN:
+            return (x + 0.5f) / scale;
+        case Transform_mode::ALIGN_CORNERS:
+            return out_dim == 1 ? 0.f : x * (in_dim - 1.f) / (out_dim - 1.f);
+        default:
+            IE_THROW() << "Unsupported interpolate coordinate transformation mode";
+    }
+}
+
+int round_index(ngraph::op::v4::Interpolate::NearestMode mode, float coord) {
+    using Nearest_mode = ngraph::op::v4::Interpolate::NearestMode;
+    switch (mode) {
+        case Nearest_mode::ROUND_PREFER_FLOOR:
+            return static_cast<int>(std::ceil(coord - 0.5f));
+        case Nearest_mode::ROUND_PREFER_CEIL:
+            return static_cast<int>(std::floor(coord + 0.5f));
+        case Nearest_mode::FLOOR:
+            return static_cast<int>(std::floor(coord));
+        case Nearest_mode::CEIL:
+            return static_cast<int>(std::ceil(coord));
+        case Nearest_mode::SIMPLE:
+            return static_cast<int>(coord);
+        default:
+            IE_THROW() << "Unsupported interpolate nearest mode";
+    }
+}
+
+// Keys cubic convolution weights for the 4 taps around the sample point
+void cubic_weights(float frac, float a, float* weights) {
+    const float d0 = 1.f + frac;
+    const float d3 = 2.f - frac;
+    weights[0] = ((a * d0 - 5.f * a) * d0 + 8.f * a) * d0 - 4.f * a;
+    weights[1] = ((a + 2.f) * frac - (a + 3.f)) * frac * frac + 1.f;
+    weights[2] = ((a + 2.f) * (1.f - frac) - (a + 3.f)) * (1.f - frac) * (1.f - frac) + 1.f;
+    weights[3] = ((a * d3 - 5.f * a) * d3 + 8.f * a) * d3 - 4.f * a;
+}
+
+AxisTable build_axis_table(const ngraph::op::v4::Interpolate::InterpolateAttrs& attrs,
+                           std::size_t in_dim, std::size_t out_dim, float scale) {
+    using Mode = opset::Interpolate::InterpolateMode;
+    AxisTable table;
+    table._taps = attrs.mode == Mode::NEAREST ? 1 : attrs.mode == Mode::CUBIC ? 4 : 2;
+    table._offsets.resize(out_dim);
+    table._weights.resize(out_dim * table._taps);
+    for (std::size_t x = 0; x < out_dim; ++x) {
+        const auto coord = source_coord(attrs.coordinate_transformation_mode, x, scale, in_dim, out_dim);
+        if (table._taps == 1) {
+            const auto index = round_index(attrs.nearest_mode, coord);
+            table._offsets[x] = std::max(0, std::min(index, static_cast<int>(in_dim) - 1));
+            table._weights[x] = 1.f;
+        } else {
+            const auto x0 = static_cast<int>(std::floor(coord));
+            const auto frac = coord - x0;
+            const auto first = table._taps == 2 ? x0 : x0 - 1;
+            table._offsets[x] = std::max(-table._taps, std::min(first, static_cast<int>(in_dim) - 1));
+            if (table._taps == 2) {
+                table._weights[x * 2]     = 1.f - frac;
+                table._weights[x * 2 + 1] = frac;
+            } else {
+                cubic_weights(frac, attrs.cube_coeff, &table._weights[x * 4]);
+            }
+        }
+    }
+    return table;
+}
+
+// dst[x] (+)= weight * src[x] over a full row; the vertical blend of the
+// separable filter runs through this before the horizontal taps are applied
+template <typename T>
+void axpy_row(const T* src, float weight, float* dst, std::size_t count, bool first) {
+    if (first) {
+        for (std::size_t x = 0; x < count; ++x) {
+            dst[x] = weight * static_cast<float>(src[x]);
+        }
+    } else {
+        for (std::size_t x = 0; x < count; ++x) {
+            dst[x] += weight * static_cast<float>(src[x]);
+        }
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+void axpy_row(const float* src, float weight, float* dst, std::size_t count, bool first) {
+    std::size_t x = 0;
+    if (first) {
+        for (; x + 4 <= count; x += 4) {
+            vst1q_f32(dst + x, vmulq_n_f32(vld1q_f32(src + x), weight));
+        }
+        for (; x < count; ++x) {
+            dst[x] = weight * src[x];
+        }
+    } else {
+        for (; x + 4 <= count; x += 4) {
+            vst1q_f32(dst + x, vmlaq_n_f32(vld1q_f32(dst + x), vld1q_f32(src + x), weight));
+        }
+        for (; x < count; ++x) {
+            dst[x] += weight * src[x];
+        }
+    }
+}
+#endif
+
+inline float dot_taps(const float* values, const float* weights, int taps) {
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    if (taps == 4) {
+        const auto prod = vmulq_f32(vld1q_f32(values), vld1q_f32(weights));
+        auto pair = vpadd_f32(vget_low_f32(prod), vget_high_f32(prod));
+        pair = vpadd_f32(pair, pair);
+        return vget_lane_f32(pair, 0);
+    }
+#endif
+    float sum = 0.f;
+    for (int j = 0; j < taps; ++j) {
+        sum += values[j] * weights[j];
+    }
+    return sum;
+}
+
+// Separable interpolation over the two innermost dims: every output row
+// blends its source rows into an edge-replicated scratch line, then takes
+// the horizontal taps as contiguous dot products. Rows are independent, so
+// scheduling is plane x output-row parallel
+template <typename T>
+void interpolate_native(const T* input,
+                        T* output,
+                        const ngraph::Shape& in_shape,
+                        const ngraph::Shape& out_shape,
+                        const AxisTable& ytab,
+                        const AxisTable& xtab) {
+    const auto rank = in_shape.size();
+    const auto in_h = in_shape[rank - 2], in_w = in_shape[rank - 1];
+    const auto out_h = out_shape[rank - 2], out_w = out_shape[rank - 1];
+    std::size_t planes = 1;
+    for (std::size_t i = 0; i + 2 < rank; ++i) {
+        planes *= in_shape[i];
+    }
+    if (xtab._taps == 1) {
+        InferenceEngine::parallel_for2d(planes, out_h, [&] (std::size_t plane, std::size_t oy) {
+            const T* row = input + (plane * in_h + ytab._offsets[oy]) * in_w;
+            T* dst = output + (plane * out_h + oy) * out_w;
+            for (std::size_t x = 0; x < out_w; ++x) {
+                dst[x] = row[xtab._offsets[x]];
+            }
+        });
+        return;
+    }
+    const auto pad = xtab._taps;
+    const auto padded = in_w + 2 * pad;
+    std::vector<float> scratch(static_cast<std::size_t>(InferenceEngine::parallel_get_max_threads()) * padded);
+    InferenceEngine::parallel_for2d(planes, out_h, [&] (std::size_t plane, std::size_t oy) {
+        float* tmp = scratch.data() + InferenceEngine::parallel_get_thread_num() * padded;
+        for (int i = 0; i < ytab._taps; ++i) {
+            const auto y = std::max(0, std::min(ytab._offsets[oy] + i, static_cast<int>(in_h) - 1));
+            axpy_row(input + (plane * in_h + y) * in_w, ytab._weights[oy * ytab._taps + i], tmp + pad, in_w, i == 0);
+        }
+        for (int i = 0; i < pad; ++i) {
+            tmp[i] = tmp[pad];
+            tmp[pad + in_w + i] = tmp[pad + in_w - 1];
+        }
+        T* dst = output + (plane * out_h + oy) * out_w;
+        for (std::size_t x = 0; x < out_w; ++x) {
+            dst[x] = static_cast<T>(dot_taps(tmp + pad + xtab._offsets[x], &xtab._weights[x * xtab._taps], xtab._taps));
+        }
+    });
+}
+}  // namespace
+
 static void pad_input_data(const uint8_t* data_ptr,
                            uint8_t* padded_data_ptr,
                            size_t type_size,
@@ -79,6 +270,56 @@ void wrap_interpolate(const T* input_data,
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Interpolate& node) {
+    using Mode = opset::Interpolate::InterpolateMode;
+    const auto& attrs = node.get_attrs();
+    const auto& in_shape = node.get_input_shape(0);
+    const auto& out_shape = node.get_output_shape(0);
+    const auto rank = in_shape.size();
+
+    auto zero = [] (const std::vector<std::size_t>& pads) {
+        return std::all_of(pads.begin(), pads.end(), [] (std::size_t pad) { return pad == 0; });
+    };
+    bool native = rank >= 2 && !attrs.antialias && zero(attrs.pads_begin) && zero(attrs.pads_end) &&
+        (attrs.mode == Mode::NEAREST || attrs.mode == Mode::LINEAR ||
+         attrs.mode == Mode::LINEAR_ONNX || attrs.mode == Mode::CUBIC);
+    float scale_h = 1.f, scale_w = 1.f;
+    if (native) {
+        auto axes_node = std::dynamic_pointer_cast<opset::Constant>(node.input_value(3).get_node_shared_ptr());
+        auto scales_node = std::dynamic_pointer_cast<opset::Constant>(node.input_value(2).get_node_shared_ptr());
+        const bool sizes_mode = attrs.shape_calculation_mode == opset::Interpolate::ShapeCalcMode::SIZES;
+        if (!axes_node || (!sizes_mode && !scales_node)) {
+            native = false;
+        } else {
+            const auto axes = axes_node->cast_vector<std::int64_t>();
+            const auto scales = scales_node ? scales_node->cast_vector<float>() : std::vector<float>{};
+            for (std::size_t i = 0; i < axes.size(); ++i) {
+                const auto axis = static_cast<std::size_t>(axes[i]);
+                const auto scale = sizes_mode ? static_cast<float>(out_shape[axis]) / in_shape[axis] : scales[i];
+                if (axis == rank - 2) {
+                    scale_h = scale;
+                } else if (axis == rank - 1) {
+                    scale_w = scale;
+                } else if (in_shape[axis] != out_shape[axis]) {
+                    native = false;
+                }
+            }
+        }
+    }
+    if (native) {
+        auto make = [&] (auto nativeFunction) {
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.output(0),
+                                              in_shape,
+                                              out_shape,
+                                              build_axis_table(attrs, in_shape[rank - 2], out_shape[rank - 2], scale_h),
+                                              build_axis_table(attrs, in_shape[rank - 1], out_shape[rank - 1], scale_w));
+        };
+        return CallSwitch(
+            AP_WRAP(make, interpolate_native),
+            node.get_input_element_type(0), floatTypes);
+    }
+
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
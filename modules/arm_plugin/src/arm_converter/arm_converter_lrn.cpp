@@ -2,10 +2,109 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cmath>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 #include <arm_compute/runtime/NEON/functions/NENormalizationLayer.h>
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+namespace {
+// Native across-channel LRN as a sliding-window square-accumulate: one
+// running sum-of-squares vector over the spatial positions is updated
+// incrementally as the window slides along the channel axis (add the
+// entering channel, subtract the leaving one), so the cost per channel is
+// two vectorized sweeps regardless of the window size and even window sizes
+// work (ACL's normalization requires odd ones). Batches spread over the IE
+// thread pool; the normalization itself stays scalar - there is no vector
+// pow - but it reads the data exactly once.
+void lrn_native_channels(const float* input,
+                         float* output,
+                         const std::size_t batches,
+                         const std::size_t channels,
+                         const std::size_t inner,
+                         const std::size_t size,
+                         const float alpha,
+                         const float beta,
+                         const float bias) {
+    const float scaleAlpha = alpha / static_cast<float>(size);
+    const std::size_t lo = (size - 1) / 2;
+    const std::size_t hi = size / 2;
+    InferenceEngine::parallel_for(batches, [&] (std::size_t batch) {
+        const float* src = input + batch * channels * inner;
+        float* dst = output + batch * channels * inner;
+        std::vector<float> sumSq(inner, 0.f);
+        auto accumulate = [&] (const std::size_t channel, const float sign) {
+            const float* row = src + channel * inner;
+            std::size_t p = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+            float32x4_t vsign = vdupq_n_f32(sign);
+            for (; p + 4 <= inner; p += 4) {
+                float32x4_t v = vld1q_f32(row + p);
+                vst1q_f32(&sumSq[p], vfmaq_f32(vld1q_f32(&sumSq[p]), vmulq_f32(v, v), vsign));
+            }
+#endif
+            for (; p < inner; ++p) {
+                sumSq[p] += sign * row[p] * row[p];
+            }
+        };
+        for (std::size_t channel = 0; channel <= std::min(hi, channels - 1); ++channel) {
+            accumulate(channel, 1.f);
+        }
+        for (std::size_t channel = 0; channel < channels; ++channel) {
+            for (std::size_t p = 0; p < inner; ++p) {
+                dst[channel * inner + p] =
+                    src[channel * inner + p] / std::pow(bias + scaleAlpha * sumSq[p], beta);
+            }
+            if (channel + hi + 1 < channels) {
+                accumulate(channel + hi + 1, 1.f);
+            }
+            if (channel >= lo) {
+                accumulate(channel - lo, -1.f);
+            }
+        }
+    });
+}
+
+// Native LRN along the contiguous innermost axis with the same incremental
+// window; rows are independent and run parallel
+void lrn_native_rows(const float* input,
+                     float* output,
+                     const std::size_t rows,
+                     const std::size_t width,
+                     const std::size_t size,
+                     const float alpha,
+                     const float beta,
+                     const float bias) {
+    const float scaleAlpha = alpha / static_cast<float>(size);
+    const std::size_t lo = (size - 1) / 2;
+    const std::size_t hi = size / 2;
+    InferenceEngine::parallel_for(rows, [&] (std::size_t row) {
+        const float* src = input + row * width;
+        float* dst = output + row * width;
+        float sumSq = 0.f;
+        for (std::size_t x = 0; x <= std::min(hi, width - 1); ++x) {
+            sumSq += src[x] * src[x];
+        }
+        for (std::size_t x = 0; x < width; ++x) {
+            dst[x] = src[x] / std::pow(bias + scaleAlpha * sumSq, beta);
+            if (x + hi + 1 < width) {
+                sumSq += src[x + hi + 1] * src[x + hi + 1];
+            }
+            if (x >= lo) {
+                sumSq -= src[x - lo] * src[x - lo];
+            }
+        }
+    });
+}
+}  // namespace
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::LRN& node) {
     auto&& axes = node.get_reduction_axes().to_vector();
     uint32_t norm_size = node.get_nsize();
@@ -13,9 +112,42 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::LRN& node)
     float beta         = node.get_beta();
     float kappa        = node.get_bias();
 
+    const auto& shape = node.get_input_shape(0);
+    const auto rank = shape.size();
+    const bool f32 = node.get_input_element_type(0) == ngraph::element::f32;
+
     arm_compute::NormType norm_type;
     if (axes.size() == 1 && axes[0] == 1) {
-       norm_type = arm_compute::NormType::CROSS_MAP;
+        // ACL's CROSS_MAP path wants an odd window and the 4D layout; the
+        // remaining across-channel variants go through the native kernel
+        if (f32 && ((norm_size % 2 == 0) || (rank != 4))) {
+            std::size_t inner = 1;
+            for (std::size_t dim = 2; dim < rank; ++dim) {
+                inner *= shape[dim];
+            }
+            return MakeNativeConversion(lrn_native_channels,
+                                        node.input(0),
+                                        node.output(0),
+                                        shape[0],
+                                        shape[1],
+                                        inner,
+                                        static_cast<std::size_t>(norm_size),
+                                        alpha,
+                                        beta,
+                                        kappa);
+        }
+        norm_type = arm_compute::NormType::CROSS_MAP;
+    } else if (f32 && (axes.size() == 1) && (axes[0] == rank - 1)) {
+        // Innermost-axis normalization has no ACL mapping at all
+        return MakeNativeConversion(lrn_native_rows,
+                                    node.input(0),
+                                    node.output(0),
+                                    ngraph::shape_size(shape) / shape[rank - 1],
+                                    shape[rank - 1],
+                                    static_cast<std::size_t>(norm_size),
+                                    alpha,
+                                    beta,
+                                    kappa);
     } else {
         for (size_t i = 0; i < axes.size(); i++) {
             if (axes[i] != i + 2) {
@@ -6,10 +6,24 @@
 #include <src/cpu/kernels/CpuConvertQuantizedSignednessKernel.h>
 #include <arm_compute/runtime/NEON/NEScheduler.h>
 #include <arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h>
+#include <arm_compute/runtime/NEON/functions/NEGEMM.h>
+#include <arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h>
+#include <ie_parallel.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "arm_cost_model.hpp"
+#include "arm_dynamic_quant.hpp"
+#include "arm_sparse_gemm.hpp"
 
 namespace ArmPlugin {
 enum InputArg {Features, Weights, Bias};
+static arm_compute::ActivationLayerInfo GetActivationInfo(const ngraph::Node& node) {
+    auto itInfo = node.get_rt_info().find("ActivationLayerInfo");
+    if (itInfo != node.get_rt_info().end()) {
+        return itInfo->second.as<arm_compute::ActivationLayerInfo>();
+    } else {
+        return {};
+    }
+}
 struct NEFullyConnectedLayerQI final: public arm_compute::IFunction {
 public:
     NEFullyConnectedLayerQI(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
@@ -24,10 +38,11 @@ public:
     NEFullyConnectedLayerQI &operator=(NEFullyConnectedLayerQI &&) = delete;
     ~NEFullyConnectedLayerQI() = default;
     void configure(arm_compute::ITensor *input, const arm_compute::ITensor *weights, const arm_compute::ITensor *biases, arm_compute::ITensor *output,
-                   const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo *wp, const arm_compute::QuantizationInfo *qi) {
+                   const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo *wp, const arm_compute::QuantizationInfo *qi,
+                   const arm_compute::ActivationLayerInfo& actInfo) {
         ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
         ARM_COMPUTE_ERROR_THROW_ON(NEFullyConnectedLayerQI::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr),
-                                                                     output->info(), ip, wp, qi));
+                                                                     output->info(), ip, wp, qi, actInfo));
 
         _input = input;
         arm_compute::ITensor *conv_input = input;
@@ -62,7 +77,6 @@ public:
         } else if (output->info()->data_type() == arm_compute::DataType::QASYMM8_SIGNED && _weights->info()->data_type() == arm_compute::DataType::QASYMM8 ||
                    output->info()->data_type() == arm_compute::DataType::QASYMM8 && _weights->info()->data_type() == arm_compute::DataType::QASYMM8_SIGNED) {
             _w_sgn = std::make_unique<arm_compute::cpu::kernels::CpuConvertQuantizedSignednessKernel>();
-            _memory_group->manage(&_weightsqi);
             _weightsqi.allocator()->init(*(_weights->info()));
             _weightsqi.info()->set_data_type(output->info()->data_type()).set_quantization_info(arm_compute::QuantizationInfo(1.f,
                                                                 output->info()->data_type() == arm_compute::DataType::QASYMM8 ? 128 : -128));
@@ -77,8 +91,10 @@ public:
             _outputqi.info()->set_quantization_info(*qi);
         }
 
+        arm_compute::FullyConnectedLayerInfo fcInfo;
+        fcInfo.activation_info = actInfo;
         _fconn = std::make_unique<arm_compute::NEFullyConnectedLayer>(_memory_manager);
-        _fconn->configure(conv_input, conv_weights, biases, _qi ? &_outputqi : _output);
+        _fconn->configure(conv_input, conv_weights, biases, _qi ? &_outputqi : _output, fcInfo);
 
         if (_i_sgn) {
             _inputqi.allocator()->allocate();
@@ -87,7 +103,15 @@ public:
             _input->info()->extend_padding(_inputqi.info()->padding());
         }
         if (_w_sgn) {
+            //Weights are constant: convert their signedness once here, at network load,
+            //so every request shares the converted copy instead of re-converting per run
             _weightsqi.allocator()->allocate();
+            arm_compute::ITensorPack pack = {
+                { arm_compute::TensorType::ACL_SRC, _weights },
+                { arm_compute::TensorType::ACL_DST, &_weightsqi }
+            };
+            arm_compute::NEScheduler::get().schedule_op(_w_sgn.get(), arm_compute::Window::DimY, _w_sgn->window(), pack);
+            _w_sgn.reset();
         } else if (_wp && _weightsqi.info()->padding() != _weights->info()->padding()) {
             //Backpropagate possible weights padding change
             _weights->info()->extend_padding(_weightsqi.info()->padding());
@@ -96,7 +120,8 @@ public:
     static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *weights,
                                         const arm_compute::ITensorInfo *biases, const arm_compute::ITensorInfo *output,
                                         const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo *wp,
-                                        const arm_compute::QuantizationInfo *qi) {
+                                        const arm_compute::QuantizationInfo *qi,
+                                        const arm_compute::ActivationLayerInfo& actInfo = {}) {
         ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
         arm_compute::TensorInfo vld_input(*input);
         if (output->data_type() == arm_compute::DataType::QASYMM8_SIGNED && input->data_type() == arm_compute::DataType::QASYMM8 ||
@@ -125,11 +150,13 @@ public:
         arm_compute::TensorInfo vld_output(*output);
         if (qi) vld_output.set_quantization_info(*qi);
 
-        return arm_compute::NEFullyConnectedLayer::validate(&vld_input, &vld_weights, biases, &vld_output);
+        arm_compute::FullyConnectedLayerInfo fcInfo;
+        fcInfo.activation_info = actInfo;
+        return arm_compute::NEFullyConnectedLayer::validate(&vld_input, &vld_weights, biases, &vld_output, fcInfo);
     }
     void run() override {
         ARM_COMPUTE_ERROR_ON_MSG(!_fconn.get(), "Kernel didn't configured");
-        std::unique_ptr<arm_compute::MemoryGroupResourceScope> _sgn_scope = _i_sgn || _w_sgn ?
+        std::unique_ptr<arm_compute::MemoryGroupResourceScope> _sgn_scope = _i_sgn ?
                                                                 std::make_unique<arm_compute::MemoryGroupResourceScope>(*_memory_group) : nullptr;
         if (_i_sgn) {
             arm_compute::ITensorPack pack = {
@@ -141,13 +168,7 @@ public:
             if (_inputqi.info()->padding() != _input->info()->padding()) _inputqi.info()->extend_padding(_input->info()->padding());
             _inputqi.allocator()->import_memory(_input->buffer());
         }
-        if (_w_sgn) {
-            arm_compute::ITensorPack pack = {
-                { arm_compute::TensorType::ACL_SRC, _weights },
-                { arm_compute::TensorType::ACL_DST, &_weightsqi }
-            };
-            arm_compute::NEScheduler::get().schedule_op(_w_sgn.get(), arm_compute::Window::DimY, _w_sgn->window(), pack);
-        } else if (_wp) {
+        if (_wp) {
             if (_weightsqi.info()->padding() != _weights->info()->padding()) _weightsqi.info()->extend_padding(_weights->info()->padding());
             _weightsqi.allocator()->import_memory(_weights->buffer());
         }
@@ -176,10 +197,303 @@ protected:
     std::unique_ptr<arm_compute::cpu::kernels::CpuConvertQuantizedSignednessKernel> _i_sgn, _w_sgn;
     std::unique_ptr<arm_compute::NEFullyConnectedLayer> _fconn;
 };
+struct NEDynamicQuantizedMatMul final: public arm_compute::IFunction {
+public:
+    NEDynamicQuantizedMatMul(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
+        _memory_manager(memory_manager), _memory_group{std::make_unique<arm_compute::MemoryGroup>(memory_manager)},
+        _gemm(nullptr), _input(nullptr), _biases(nullptr), _output(nullptr),
+        _inputQ(), _weightsQ(), _acc(), _M(0), _N(0), _K(0) {}
+    NEDynamicQuantizedMatMul(const NEDynamicQuantizedMatMul &) = delete;
+    NEDynamicQuantizedMatMul &operator=(const NEDynamicQuantizedMatMul &) = delete;
+    NEDynamicQuantizedMatMul(NEDynamicQuantizedMatMul &&) = delete;
+    NEDynamicQuantizedMatMul &operator=(NEDynamicQuantizedMatMul &&) = delete;
+    ~NEDynamicQuantizedMatMul() = default;
+    void configure(const arm_compute::ITensor *input, const arm_compute::ITensor *weights, const arm_compute::ITensor *biases,
+                   arm_compute::ITensor *output, bool transposeB) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+        ARM_COMPUTE_ERROR_THROW_ON(NEDynamicQuantizedMatMul::validate(input->info(), weights->info(),
+                                                                      ((biases != nullptr) ? biases->info() : nullptr), output->info(), transposeB));
+        _input = input;
+        _biases = biases;
+        _output = output;
+        _K = input->info()->dimension(0);
+        _M = input->info()->num_dimensions() > 1 ? input->info()->dimension(1) : 1;
+        _N = transposeB ? weights->info()->dimension(1) : weights->info()->dimension(0);
+
+        //Weights are constant: quantize them once here, at network load. Symmetric
+        //(zero offset) quantization keeps the raw s32 accumulators independent of
+        //the scales, so the per-inference activation scale needs no reconfigure
+        _weightsQ.allocator()->init({arm_compute::TensorShape{_N, _K}, 1, arm_compute::DataType::QASYMM8_SIGNED, arm_compute::QuantizationInfo{1.f, 0}});
+        _weightsQ.allocator()->allocate();
+        const auto* wBase = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+        const auto wStrideX = weights->info()->strides_in_bytes().x();
+        const auto wStrideY = weights->info()->strides_in_bytes().y();
+        auto* qBase = _weightsQ.buffer() + _weightsQ.info()->offset_first_element_in_bytes();
+        const auto qStrideY = _weightsQ.info()->strides_in_bytes().y();
+        auto weightAt = [&] (std::size_t n, std::size_t k) {
+            return *reinterpret_cast<const float*>(wBase + (transposeB ? k * wStrideX + n * wStrideY
+                                                                       : n * wStrideX + k * wStrideY));
+        };
+        _weightScales.resize(_N);
+        for (std::size_t n = 0; n < _N; ++n) {
+            float amax = 0.f;
+            for (std::size_t k = 0; k < _K; ++k) {
+                amax = std::max(amax, std::fabs(weightAt(n, k)));
+            }
+            const float scale = amax > 0.f ? amax / 127.f : 1.f;
+            _weightScales[n] = scale;
+            const float invScale = 1.f / scale;
+            for (std::size_t k = 0; k < _K; ++k) {
+                auto q = std::lround(weightAt(n, k) * invScale);
+                *reinterpret_cast<std::int8_t*>(qBase + n + k * qStrideY) =
+                    static_cast<std::int8_t>(std::max<long>(-128, std::min<long>(127, q)));
+            }
+        }
+        _combinedScales.resize(_N);
+
+        _inputQ.allocator()->init({input->info()->tensor_shape(), 1, arm_compute::DataType::QASYMM8_SIGNED, arm_compute::QuantizationInfo{1.f, 0}});
+        _acc.allocator()->init({output->info()->tensor_shape(), 1, arm_compute::DataType::S32});
+        _memory_group->manage(&_inputQ);
+        _memory_group->manage(&_acc);
+        _gemm = std::make_unique<arm_compute::NEGEMMLowpMatrixMultiplyCore>(_memory_manager);
+        _gemm->configure(&_inputQ, &_weightsQ, nullptr, &_acc);
+        _inputQ.allocator()->allocate();
+        _acc.allocator()->allocate();
+    }
+    static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *weights,
+                                        const arm_compute::ITensorInfo *biases, const arm_compute::ITensorInfo *output,
+                                        bool transposeB) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != arm_compute::DataType::F32 ||
+                                    weights->data_type() != arm_compute::DataType::F32 ||
+                                    output->data_type() != arm_compute::DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 2 || weights->num_dimensions() != 2);
+        const auto K = input->dimension(0);
+        const auto M = input->num_dimensions() > 1 ? input->dimension(1) : 1;
+        const auto N = transposeB ? weights->dimension(1) : weights->dimension(0);
+        ARM_COMPUTE_RETURN_ERROR_ON((transposeB ? weights->dimension(0) : weights->dimension(1)) != K);
+        if (biases != nullptr) {
+            ARM_COMPUTE_RETURN_ERROR_ON(biases->data_type() != arm_compute::DataType::F32 ||
+                                        biases->num_dimensions() > 1 || biases->dimension(0) != N);
+        }
+        arm_compute::TensorInfo vld_input{arm_compute::TensorShape{K, M}, 1, arm_compute::DataType::QASYMM8_SIGNED, arm_compute::QuantizationInfo{1.f, 0}};
+        arm_compute::TensorInfo vld_weights{arm_compute::TensorShape{N, K}, 1, arm_compute::DataType::QASYMM8_SIGNED, arm_compute::QuantizationInfo{1.f, 0}};
+        arm_compute::TensorInfo vld_acc{arm_compute::TensorShape{N, M}, 1, arm_compute::DataType::S32};
+        return arm_compute::NEGEMMLowpMatrixMultiplyCore::validate(&vld_input, &vld_weights, nullptr, &vld_acc);
+    }
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(!_gemm.get(), "Kernel didn't configured");
+        arm_compute::MemoryGroupResourceScope scope(*_memory_group);
+        const auto* iBase = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+        const auto iStrideY = _input->info()->strides_in_bytes().y();
+        float amax = 0.f;
+        for (std::size_t m = 0; m < _M; ++m) {
+            amax = std::max(amax, neon::absolute_max(reinterpret_cast<const float*>(iBase + m * iStrideY), _K));
+        }
+        const float inputScale = amax > 0.f ? amax / 127.f : 1.f;
+        auto* qBase = _inputQ.buffer() + _inputQ.info()->offset_first_element_in_bytes();
+        const auto qStrideY = _inputQ.info()->strides_in_bytes().y();
+        for (std::size_t m = 0; m < _M; ++m) {
+            neon::quantize_symmetric(reinterpret_cast<const float*>(iBase + m * iStrideY),
+                                     reinterpret_cast<std::int8_t*>(qBase + m * qStrideY), _K, 1.f / inputScale);
+        }
+        _gemm->run();
+        for (std::size_t n = 0; n < _N; ++n) {
+            _combinedScales[n] = inputScale * _weightScales[n];
+        }
+        const float* bias = (_biases != nullptr) ?
+            reinterpret_cast<const float*>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+        const auto* aBase = _acc.buffer() + _acc.info()->offset_first_element_in_bytes();
+        const auto aStrideY = _acc.info()->strides_in_bytes().y();
+        auto* oBase = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+        const auto oStrideY = _output->info()->strides_in_bytes().y();
+        for (std::size_t m = 0; m < _M; ++m) {
+            neon::dequantize_accumulators(reinterpret_cast<const std::int32_t*>(aBase + m * aStrideY),
+                                          _combinedScales.data(), bias,
+                                          reinterpret_cast<float*>(oBase + m * oStrideY), _N);
+        }
+    }
+
+protected:
+    std::shared_ptr<arm_compute::IMemoryManager> _memory_manager;
+    std::unique_ptr<arm_compute::MemoryGroup> _memory_group;
+    const arm_compute::ITensor *_input;
+    const arm_compute::ITensor *_biases;
+    arm_compute::ITensor *_output;
+    arm_compute::Tensor _inputQ;
+    arm_compute::Tensor _weightsQ;
+    arm_compute::Tensor _acc;
+    std::vector<float> _weightScales;
+    std::vector<float> _combinedScales;
+    std::size_t _M, _N, _K;
+    std::unique_ptr<arm_compute::NEGEMMLowpMatrixMultiplyCore> _gemm;
+};
+// Batched GEMM for MatMuls with batch dimensions (attention scores/context in
+// transformers, [batch, heads, seq, dim]). The fully-connected path only
+// accepts 2D weights, so these used to fall back to the serial reference
+// loop; one NEGEMM over the batched tensors instead keeps every head*batch
+// GEMM inside a single dispatch, with the scheduler window spanning the batch
+// dimensions, so the small per-head GEMMs fan out across the cores
+struct NEBatchedMatMul final: public arm_compute::IFunction {
+public:
+    NEBatchedMatMul(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
+        _memory_manager(memory_manager), _gemm(nullptr) {}
+    NEBatchedMatMul(const NEBatchedMatMul &) = delete;
+    NEBatchedMatMul &operator=(const NEBatchedMatMul &) = delete;
+    NEBatchedMatMul(NEBatchedMatMul &&) = delete;
+    NEBatchedMatMul &operator=(NEBatchedMatMul &&) = delete;
+    ~NEBatchedMatMul() = default;
+    void configure(const arm_compute::ITensor *a, const arm_compute::ITensor *b, arm_compute::ITensor *output) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, output);
+        ARM_COMPUTE_ERROR_THROW_ON(NEBatchedMatMul::validate(a->info(), b->info(), output->info()));
+        _gemm = std::make_unique<arm_compute::NEGEMM>(_memory_manager);
+        // The second input is an activation, not packed-once weights: it must
+        // be reshaped on every run, not only the first
+        const arm_compute::GEMMInfo gemmInfo{false, false, false};
+        _gemm->configure(a, b, nullptr, output, 1.0f, 0.0f, gemmInfo);
+    }
+    static arm_compute::Status validate(const arm_compute::ITensorInfo *a, const arm_compute::ITensorInfo *b,
+                                        const arm_compute::ITensorInfo *output) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, output);
+        // Plain 2D MatMuls stay on the fully-connected path with its packed weights
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->num_dimensions() < 3, "not a batched MatMul");
+        for (std::size_t dim = 2; dim < b->num_dimensions(); ++dim) {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->dimension(dim) != a->dimension(dim), "batch dimensions must match");
+        }
+        return arm_compute::NEGEMM::validate(a, b, nullptr, output, 1.0f, 0.0f, arm_compute::GEMMInfo{false, false, false});
+    }
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(!_gemm.get(), "Kernel didn't configured");
+        _gemm->run();
+    }
+
+protected:
+    std::shared_ptr<arm_compute::IMemoryManager> _memory_manager;
+    std::unique_ptr<arm_compute::NEGEMM> _gemm;
+};
+// Block-CSR GEMM for structurally pruned f32 MatMuls (SPARSE_KERNELS). The
+// weights are recompressed once here, at network load, into the block-CSR
+// form of arm_sparse_gemm.hpp; run() then touches stored 1x4 blocks only,
+// so an 80%-pruned projection moves a fifth of the weight bytes and FLOPs
+// the packed dense GEMM would
+struct NESparseMatMul final: public arm_compute::IFunction {
+public:
+    // No scratch tensors: the compressed weights live in the function, so the
+    // memory manager is accepted for conversion-machinery uniformity only
+    NESparseMatMul(std::shared_ptr<arm_compute::IMemoryManager> memory_manager = nullptr):
+        _input(nullptr), _biases(nullptr), _output(nullptr), _csr(), _M(0), _N(0), _K(0) { (void)memory_manager; }
+    NESparseMatMul(const NESparseMatMul &) = delete;
+    NESparseMatMul &operator=(const NESparseMatMul &) = delete;
+    NESparseMatMul(NESparseMatMul &&) = delete;
+    NESparseMatMul &operator=(NESparseMatMul &&) = delete;
+    ~NESparseMatMul() = default;
+    void configure(const arm_compute::ITensor *input, const arm_compute::ITensor *weights, const arm_compute::ITensor *biases,
+                   arm_compute::ITensor *output, bool transposeB) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+        ARM_COMPUTE_ERROR_THROW_ON(NESparseMatMul::validate(input->info(), weights->info(),
+                                                            ((biases != nullptr) ? biases->info() : nullptr), output->info(), transposeB));
+        _input = input;
+        _biases = biases;
+        _output = output;
+        _K = input->info()->dimension(0);
+        _M = input->info()->num_dimensions() > 1 ? input->info()->dimension(1) : 1;
+        _N = transposeB ? weights->info()->dimension(1) : weights->info()->dimension(0);
+        const auto* wBase = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+        const auto wStrideX = weights->info()->strides_in_bytes().x();
+        const auto wStrideY = weights->info()->strides_in_bytes().y();
+        _csr = sparse::BuildBlockCsr([&] (std::size_t n, std::size_t k) {
+            return *reinterpret_cast<const float*>(wBase + (transposeB ? k * wStrideX + n * wStrideY
+                                                                       : n * wStrideX + k * wStrideY));
+        }, _K, _N);
+    }
+    static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *weights,
+                                        const arm_compute::ITensorInfo *biases, const arm_compute::ITensorInfo *output,
+                                        bool transposeB) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != arm_compute::DataType::F32 ||
+                                    weights->data_type() != arm_compute::DataType::F32 ||
+                                    output->data_type() != arm_compute::DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 2 || weights->num_dimensions() != 2);
+        const auto K = input->dimension(0);
+        const auto N = transposeB ? weights->dimension(1) : weights->dimension(0);
+        ARM_COMPUTE_RETURN_ERROR_ON((transposeB ? weights->dimension(0) : weights->dimension(1)) != K);
+        if (biases != nullptr) {
+            ARM_COMPUTE_RETURN_ERROR_ON(biases->data_type() != arm_compute::DataType::F32 ||
+                                        biases->num_dimensions() > 1 || biases->dimension(0) != N);
+        }
+        return arm_compute::Status{};
+    }
+    void run() override {
+        const auto* iBase = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+        const auto iStrideY = _input->info()->strides_in_bytes().y();
+        auto* oBase = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+        const auto oStrideY = _output->info()->strides_in_bytes().y();
+        const float* bias = (_biases != nullptr) ?
+            reinterpret_cast<const float*>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+        // Parallel over n-blocks: every worker owns its 4 output columns, so
+        // rows of the same block reuse the cached weight entries and no two
+        // workers write the same cache line
+        InferenceEngine::parallel_for(_csr._nblocks, [&] (std::size_t nb) {
+            for (std::size_t m = 0; m < _M; ++m) {
+                sparse::BlockCsrRow(_csr, nb, reinterpret_cast<const float*>(iBase + m * iStrideY), bias,
+                                    reinterpret_cast<float*>(oBase + m * oStrideY), _N);
+            }
+        });
+    }
+
+protected:
+    const arm_compute::ITensor *_input;
+    const arm_compute::ITensor *_biases;
+    arm_compute::ITensor *_output;
+    sparse::BlockCsr _csr;
+    std::size_t _M, _N, _K;
+};
+static bool useSparseKernel(const Configuration& cfg, const ngraph::Node& node, bool transposeB) {
+    if (!(cfg._sparseKernels &&
+          node.get_input_element_type(Features) == ngraph::element::f32 &&
+          node.get_input_element_type(Weights) == ngraph::element::f32 &&
+          node.get_input_shape(Features).size() <= 2 &&
+          node.get_input_shape(Weights).size() == 2 &&
+          ngraph::is_type<opset::Constant>(node.input_value(Weights).get_node()) &&
+          node.get_rt_info().count("InputPrescaleInfo") == 0 &&
+          node.get_rt_info().count("QuantizationInfo") == 0 &&
+          node.get_rt_info().count("ActivationLayerInfo") == 0)) {
+        return false;
+    }
+    auto constant = ngraph::as_type<opset::Constant>(node.input_value(Weights).get_node());
+    const auto& wShape = node.get_input_shape(Weights);
+    const auto K = transposeB ? wShape[1] : wShape[0];
+    const auto N = transposeB ? wShape[0] : wShape[1];
+    const auto density = sparse::MatMulBlockDensity(static_cast<const float*>(constant->get_data_ptr()), K, N, transposeB);
+    return CostModel{cfg._costModelPath}.Wins("sparse-matmul", K * N, density <= sparse::DensityThreshold);
+}
+static bool useDynamicQuantization(const Configuration& cfg, const ngraph::Node& node) {
+    return cfg._dynamicQuantization &&
+           node.get_input_element_type(Features) == ngraph::element::f32 &&
+           node.get_input_element_type(Weights) == ngraph::element::f32 &&
+           node.get_input_shape(Features).size() <= 2 &&
+           node.get_input_shape(Weights).size() == 2 &&
+           ngraph::is_type<opset::Constant>(node.input_value(Weights).get_node()) &&
+           node.get_rt_info().count("QuantizationInfo") == 0 &&
+           node.get_rt_info().count("ActivationLayerInfo") == 0;
+}
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::MatMul& node) {
     if (node.get_transpose_a()) {
         IE_THROW() << "Can not create MatMul layer with transpose first input";
     }
+    // MatMuls with batch dimensions go through the batched GEMM; the ngraph
+    // [.., K, N] layout maps onto the ACL GEMM directly only untransposed
+    if ((node.get_input_partial_shape(Features).rank().get_length() > 2) && !node.get_transpose_b()) {
+        return MakeConversion<NEBatchedMatMul>(node.input(Features), node.input(Weights), node.output(0));
+    }
+    // Structurally pruned weights: recompress once and skip the zero blocks
+    // instead of multiplying them on the dense packed path
+    if (useSparseKernel(_cfg, node, node.get_transpose_b())) {
+        return MakeConversion<NESparseMatMul>(node.input(Features), node.input(Weights), nullptr, node.output(0), node.get_transpose_b());
+    }
+    if (useDynamicQuantization(_cfg, node)) {
+        return MakeConversion<NEDynamicQuantizedMatMul>(node.input(Features), node.input(Weights), nullptr, node.output(0), node.get_transpose_b());
+    }
     auto iInfoIt = node.get_rt_info().find("InputPrescaleInfo");
     const arm_compute::QuantizationInfo* iInfo = iInfoIt == node.get_rt_info().end() ? nullptr :
                                                &(iInfoIt->second.as<arm_compute::QuantizationInfo>());
@@ -189,12 +503,23 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::MatMul& no
     auto qInfoIt = node.get_rt_info().find("QuantizationInfo");
     const arm_compute::QuantizationInfo* qInfo = qInfoIt == node.get_rt_info().end() ? nullptr :
                                                &(qInfoIt->second.as<arm_compute::QuantizationInfo>());
-    return MakeConversion<NEFullyConnectedLayerQI>(node.input(Features), node.input(Weights), nullptr, node.output(0), iInfo, wInfo, qInfo);
+    return MakeConversion<NEFullyConnectedLayerQI>(node.input(Features), node.input(Weights), nullptr, node.output(0), iInfo, wInfo, qInfo,
+                                                   GetActivationInfo(node));
 }
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmMatMulBias& node) {
     if (node.get_transpose_a()) {
         IE_THROW() << "Can not create MatMul layer with transpose first input";
     }
+    if (useSparseKernel(_cfg, node, node.get_transpose_b()) &&
+        node.get_input_element_type(Bias) == ngraph::element::f32 && node.get_input_shape(Bias).size() == 1) {
+        return MakeConversion<NESparseMatMul>(node.input(Features), node.input(Weights), node.input(Bias), node.output(0),
+                                              node.get_transpose_b());
+    }
+    if (useDynamicQuantization(_cfg, node) &&
+        node.get_input_element_type(Bias) == ngraph::element::f32 && node.get_input_shape(Bias).size() == 1) {
+        return MakeConversion<NEDynamicQuantizedMatMul>(node.input(Features), node.input(Weights), node.input(Bias), node.output(0),
+                                                        node.get_transpose_b());
+    }
     auto iInfoIt = node.get_rt_info().find("InputPrescaleInfo");
     const arm_compute::QuantizationInfo* iInfo = iInfoIt == node.get_rt_info().end() ? nullptr :
                                                &(iInfoIt->second.as<arm_compute::QuantizationInfo>());
@@ -204,6 +529,7 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmMatMulB
     auto qInfoIt = node.get_rt_info().find("QuantizationInfo");
     const arm_compute::QuantizationInfo* qInfo = qInfoIt == node.get_rt_info().end() ? nullptr :
                                                &(qInfoIt->second.as<arm_compute::QuantizationInfo>());
-    return MakeConversion<NEFullyConnectedLayerQI>(node.input(Features), node.input(Weights), node.input(Bias), node.output(0), iInfo, wInfo, qInfo);
+    return MakeConversion<NEFullyConnectedLayerQI>(node.input(Features), node.input(Weights), node.input(Bias), node.output(0), iInfo, wInfo, qInfo,
+                                                   GetActivationInfo(node));
 }
 }  //  namespace ArmPlugin
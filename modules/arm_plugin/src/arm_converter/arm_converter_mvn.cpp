@@ -3,11 +3,77 @@
 
 
 
+#include <cmath>
+#include <set>
+
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 #include <arm_compute/runtime/NEON/functions/NEMeanStdDevNormalizationLayer.h>
 #include <ngraph/runtime/reference/mvn.hpp>
 #include "arm_converter/arm_converter.hpp"
+#include "opset/utils.hpp"
 
 namespace ArmPlugin {
+// Fused native MVN over contiguous normalized groups (the layouts where the
+// reduction axes form the trailing block of the shape, which covers both
+// instance norm over [N,C]:[H,W] and across-channel MVN over [N]:[C,H,W]):
+// one vectorized pass accumulates sum and sum of squares per group, and one
+// fused pass writes (x - mean) * scale, instead of the separate mean,
+// subtract and variance sweeps of the reference. Groups are independent and
+// spread over the IE thread pool.
+static void mvn_native(const float* input,
+                       float* output,
+                       const std::size_t groups,
+                       const std::size_t groupSize,
+                       const bool normalizeVariance,
+                       const float eps,
+                       const bool insideSqrt) {
+    InferenceEngine::parallel_for(groups, [&] (std::size_t group) {
+        const float* src = input + group * groupSize;
+        float* dst = output + group * groupSize;
+        float sum = 0.f;
+        float sumSq = 0.f;
+        std::size_t i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+        float32x4_t vsum = vdupq_n_f32(0.f);
+        float32x4_t vsumSq = vdupq_n_f32(0.f);
+        for (; i + 4 <= groupSize; i += 4) {
+            float32x4_t v = vld1q_f32(src + i);
+            vsum = vaddq_f32(vsum, v);
+            vsumSq = vfmaq_f32(vsumSq, v, v);
+        }
+        sum = vaddvq_f32(vsum);
+        sumSq = vaddvq_f32(vsumSq);
+#endif
+        for (; i < groupSize; ++i) {
+            sum += src[i];
+            sumSq += src[i] * src[i];
+        }
+        const float mean = sum / groupSize;
+        float scale = 1.f;
+        if (normalizeVariance) {
+            const float variance = std::max(sumSq / groupSize - mean * mean, 0.f);
+            scale = 1.f / (insideSqrt ? std::sqrt(variance + eps) : (std::sqrt(variance) + eps));
+        }
+        // (x - mean) * scale folded into one multiply-add per element
+        const float shift = -mean * scale;
+        i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+        float32x4_t vscale = vdupq_n_f32(scale);
+        float32x4_t vshift = vdupq_n_f32(shift);
+        for (; i + 4 <= groupSize; i += 4) {
+            vst1q_f32(dst + i, vfmaq_f32(vshift, vld1q_f32(src + i), vscale));
+        }
+#endif
+        for (; i < groupSize; ++i) {
+            dst[i] = src[i] * scale + shift;
+        }
+    });
+}
 template <typename U>
 ngraph::AxisSet mvn_6_reduction_axes(const U* axes, const ngraph::Shape& axes_shape) {
     auto rank = axes_shape.size();
@@ -46,6 +112,38 @@ void wrap_mvn_6(const T* arg,
 }
 
 template <> Converter::Conversion::Ptr Converter::Convert(const opset::MVN& node) {
+    // Configurations the ArmMVN substitution rejects (across-channel axes,
+    // INSIDE_SQRT, no variance normalization, rank != 2) take the fused
+    // native kernel when the reduction axes are the trailing block of the
+    // shape; everything else (and REF pins) stays on the reference
+    if (!ForcedToReference(&node) && (node.get_input_element_type(0) == ngraph::element::f32)) {
+        auto axesConst = std::dynamic_pointer_cast<opset::Constant>(node.input_value(1).get_node_shared_ptr());
+        if (axesConst != nullptr) {
+            const auto& shape = node.get_input_shape(0);
+            const auto rank = static_cast<std::int64_t>(shape.size());
+            std::set<std::int64_t> axes;
+            for (auto axis : axesConst->cast_vector<std::int64_t>()) {
+                axes.emplace(axis < 0 ? rank + axis : axis);
+            }
+            const bool trailing = !axes.empty() &&
+                                  (*axes.begin() == rank - static_cast<std::int64_t>(axes.size())) &&
+                                  (*axes.rbegin() == rank - 1);
+            if (trailing) {
+                std::size_t groupSize = 1;
+                for (auto axis : axes) {
+                    groupSize *= shape[axis];
+                }
+                return MakeNativeConversion(mvn_native,
+                                            node.input(0),
+                                            node.output(0),
+                                            ngraph::shape_size(shape) / groupSize,
+                                            groupSize,
+                                            node.get_normalize_variance(),
+                                            static_cast<float>(node.get_eps()),
+                                            node.get_eps_mode() == ngraph::op::MVNEpsMode::INSIDE_SQRT);
+            }
+        }
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -2,7 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <algorithm>
+#include <type_traits>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
+#include "arm_nms_core.hpp"
 #include <ngraph/runtime/reference/non_max_suppression.hpp>
 
 namespace ArmPlugin {
@@ -134,34 +140,143 @@ static void nms5(const float* boxes_data,
     }
 }
 
-template<> Converter::Conversion::Ptr Converter::Convert(const opset::NonMaxSuppression& node) {
-    auto make = [&] (auto refFunction) {
-        ngraph::HostTensorVector hosts;
-        for (auto output : node.outputs()) {
-            auto tensor = std::make_shared<ngraph::HostTensor>(output.get_element_type(),
-                                                               output.get_partial_shape().get_max_shape());
-            hosts.push_back(tensor);
-         }
-
-        ngraph::element::Type selected_scores_type = node.get_input_size() < 4 ?
-                                                     ngraph::element::f32 : node.get_input_element_type(3);
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.get_input_shape(0),
-                                    node.input(1),
-                                    node.get_input_shape(1),
-                                    static_cast<int64_t>(node.max_boxes_output_from_input()),
-                                    static_cast<float>(node.iou_threshold_from_input()),
-                                    static_cast<float>(node.score_threshold_from_input()),
-                                    static_cast<float>(node.soft_nms_sigma_from_input()),
-                                    node.get_output_partial_shape(0).get_max_shape(),
-                                    node.get_sort_result_descending(),
-                                    node.output(0).get_element_type(),
-                                    HostTensors{hosts, &node},
-                                    selected_scores_type,
-                                    node.get_box_encoding());
+// Native hard-NMS engine: every (batch, class) pair is an independent
+// suppression problem, so classes fan out over the IE thread pool and each
+// one runs the heap-pruned NEON core from arm_nms_core.hpp instead of the
+// single-threaded scalar reference
+static void nms5_native(const float* boxes_data,
+                 const ngraph::Shape& boxes_data_shape,
+                 const float* scores_data,
+                 const ngraph::Shape& scores_data_shape,
+                 int64_t max_output_boxes_per_class,
+                 float iou_threshold,
+                 float score_threshold,
+                 const ngraph::Shape& out_shape,
+                 const bool sort_result_descending,
+                 const ngraph::element::Type out_type,
+                 const ngraph::HostTensorVector& outputs,
+                 const ngraph::element::Type selected_scores_type,
+                 const opset::NonMaxSuppression::BoxEncodingType box_encoding) {
+    auto batches = scores_data_shape[0];
+    auto classes = scores_data_shape[1];
+    auto boxes_per_batch = scores_data_shape[2];
+    std::vector<float> normalized_boxes = prepare_boxes_data(boxes_data, boxes_data_shape, box_encoding);
+    auto max_output = std::min<std::size_t>(std::max<int64_t>(max_output_boxes_per_class, 0), boxes_per_batch);
+
+    std::vector<std::vector<nms::Candidate>> per_class(batches * classes);
+    InferenceEngine::parallel_for2d(batches, classes, [&] (std::size_t batch, std::size_t cls) {
+        per_class[batch * classes + cls] = nms::RunClassNms(normalized_boxes.data() + batch * boxes_per_batch * 4,
+                                                            scores_data + (batch * classes + cls) * boxes_per_batch,
+                                                            boxes_per_batch,
+                                                            score_threshold,
+                                                            iou_threshold,
+                                                            max_output);
+    });
+
+    struct Selection {
+        float score;
+        int   batch;
+        int   cls;
+        int   box;
     };
-    return make(nms5);
+    std::vector<Selection> selections;
+    for (std::size_t batch = 0; batch < batches; ++batch) {
+        for (std::size_t cls = 0; cls < classes; ++cls) {
+            for (auto&& candidate : per_class[batch * classes + cls]) {
+                selections.push_back(Selection{candidate.score,
+                                               static_cast<int>(batch),
+                                               static_cast<int>(cls),
+                                               candidate.box});
+            }
+        }
+    }
+    if (sort_result_descending) {
+        std::stable_sort(selections.begin(), selections.end(), [] (const Selection& lhs, const Selection& rhs) {
+            return lhs.score > rhs.score;
+        });
+    }
+    auto valid_outputs = std::min<std::size_t>(selections.size(), out_shape[0]);
+
+    auto fill_indices = [&] (auto* indices_ptr, auto* valid_outputs_ptr) {
+        using index_type = typename std::remove_reference<decltype(indices_ptr[0])>::type;
+        *valid_outputs_ptr = static_cast<index_type>(valid_outputs);
+        for (std::size_t i = 0; i < valid_outputs; ++i) {
+            indices_ptr[3 * i + 0] = static_cast<index_type>(selections[i].batch);
+            indices_ptr[3 * i + 1] = static_cast<index_type>(selections[i].cls);
+            indices_ptr[3 * i + 2] = static_cast<index_type>(selections[i].box);
+        }
+        for (std::size_t i = 3 * valid_outputs; i < ngraph::shape_size(out_shape); ++i) {
+            indices_ptr[i] = static_cast<index_type>(-1);
+        }
+    };
+    if (out_type == ngraph::element::i64) {
+        fill_indices(outputs[0]->get_data_ptr<int64_t>(), outputs[2]->get_data_ptr<int64_t>());
+    } else {
+        fill_indices(outputs[0]->get_data_ptr<int32_t>(), outputs[2]->get_data_ptr<int32_t>());
+    }
+
+    auto fill_scores = [&] (auto* scores_ptr) {
+        using score_type = typename std::remove_reference<decltype(scores_ptr[0])>::type;
+        for (std::size_t i = 0; i < valid_outputs; ++i) {
+            scores_ptr[3 * i + 0] = score_type(static_cast<float>(selections[i].batch));
+            scores_ptr[3 * i + 1] = score_type(static_cast<float>(selections[i].cls));
+            scores_ptr[3 * i + 2] = score_type(selections[i].score);
+        }
+        for (std::size_t i = 3 * valid_outputs; i < ngraph::shape_size(out_shape); ++i) {
+            scores_ptr[i] = score_type(-1);
+        }
+    };
+    if (selected_scores_type == ngraph::element::f16) {
+        fill_scores(outputs[1]->get_data_ptr<ngraph::float16>());
+    } else {
+        fill_scores(outputs[1]->get_data_ptr<float>());
+    }
+}
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::NonMaxSuppression& node) {
+    ngraph::HostTensorVector hosts;
+    for (auto output : node.outputs()) {
+        auto tensor = std::make_shared<ngraph::HostTensor>(output.get_element_type(),
+                                                           output.get_partial_shape().get_max_shape());
+        hosts.push_back(tensor);
+    }
+
+    ngraph::element::Type selected_scores_type = node.get_input_size() < 4 ?
+                                                 ngraph::element::f32 : node.get_input_element_type(3);
+    // Zero soft-NMS sigma means plain hard suppression, which the parallel
+    // native engine handles; the score-decaying soft-NMS path stays on the
+    // sequential ngraph reference
+    if (static_cast<float>(node.soft_nms_sigma_from_input()) == 0.0f) {
+        return MakeNativeConversion(nms5_native,
+                              node.input(0),
+                              node.get_input_shape(0),
+                              node.input(1),
+                              node.get_input_shape(1),
+                              static_cast<int64_t>(node.max_boxes_output_from_input()),
+                              static_cast<float>(node.iou_threshold_from_input()),
+                              static_cast<float>(node.score_threshold_from_input()),
+                              node.get_output_partial_shape(0).get_max_shape(),
+                              node.get_sort_result_descending(),
+                              node.output(0).get_element_type(),
+                              HostTensors{hosts, &node},
+                              selected_scores_type,
+                              node.get_box_encoding());
+    }
+    return MakeConversion(nms5,
+                          node.input(0),
+                          node.get_input_shape(0),
+                          node.input(1),
+                          node.get_input_shape(1),
+                          static_cast<int64_t>(node.max_boxes_output_from_input()),
+                          static_cast<float>(node.iou_threshold_from_input()),
+                          static_cast<float>(node.score_threshold_from_input()),
+                          static_cast<float>(node.soft_nms_sigma_from_input()),
+                          node.get_output_partial_shape(0).get_max_shape(),
+                          node.get_sort_result_descending(),
+                          node.output(0).get_element_type(),
+                          HostTensors{hosts, &node},
+                          selected_scores_type,
+                          node.get_box_encoding());
 }
 }  //  namespace ArmPlugin
 
@@ -1,62 +1,83 @@
 // Copyright (C) 2020-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+
 #include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/one_hot.hpp>
 
+namespace ArmPlugin {
+// Parallel OneHot as fill-plus-scatter: the output is blanketed with the
+// off value in parallel chunks, then every index element scatters one on
+// value at an offset computed from its prefix/suffix decomposition around
+// the one-hot axis. Scatter targets are disjoint, so both passes go wide
+// over the IE thread pool; out-of-range indices keep their off-filled row.
 template <typename InputType, typename DepthType, typename OutputType>
-void wrap_one_hot(const InputType* indices,
-                  const ngraph::Shape& indices_shape,
-                  OutputType* out,
-                  const ngraph::Shape& out_shape,
-                  const size_t out_elem_size,
-                  const DepthType* depth,
-                  const std::int64_t one_hot_axis,
-                  const OutputType* on_value,
-                  const OutputType* off_value) {
-    const size_t depth_val = static_cast<size_t>(depth[0]);
+void one_hot_native(const InputType* indices,
+                    const ngraph::Shape& indices_shape,
+                    OutputType* out,
+                    const ngraph::Shape& out_shape,
+                    const DepthType* depth,
+                    const std::int64_t one_hot_axis,
+                    const OutputType* on_value,
+                    const OutputType* off_value) {
+    const auto depth_val = static_cast<std::size_t>(depth[0]);
     if (ngraph::shape_size(indices_shape) * depth_val != ngraph::shape_size(out_shape))
         IE_THROW() << "Incompatible I/O shapes or wrong depth value.";
     if (depth_val != out_shape[one_hot_axis])
         IE_THROW() << "Incompatible depth and axis values.";
-    ngraph::runtime::reference::one_hot<InputType>(indices,
-                                                   indices_shape,
-                                                   reinterpret_cast<char*>(out),
-                                                   out_elem_size,
-                                                   depth_val,
-                                                   one_hot_axis,
-                                                   reinterpret_cast<const char*>(on_value),
-                                                   reinterpret_cast<const char*>(off_value));
-}
+    const auto out_size = ngraph::shape_size(out_shape);
+    const OutputType off = off_value[0];
+    const OutputType on = on_value[0];
 
-namespace ArmPlugin {
-    template<> Converter::Conversion::Ptr Converter::Convert(const opset::OneHot& node) {
-        const auto& ind_shape = node.get_input_shape(0);
-        const auto& out_shape = node.get_output_shape(0);
-        std::int64_t axis = node.get_axis();
-        const std::int64_t out_rank = out_shape.size();
-        if (axis < -out_rank || axis >= out_rank)
-            IE_THROW() << "Invalid axis value. Expected in [" << -out_rank
-                               << ", " << out_rank-1 << "]. Got " << axis;
-        if (axis < 0)
-            axis += out_rank;
-        auto make = [&] (auto refFunction) {
-            return this->MakeConversion(refFunction,
-                                        node.input(0),
-                                        ind_shape,
-                                        node.output(0),
-                                        out_shape,
-                                        node.get_output_element_type(0).size(),
-                                        node.input(1),
-                                        axis,
-                                        node.input(2),
-                                        node.input(3));
-        };
-        return CallSwitch(
-            AP_WRAP(make, wrap_one_hot),
-            node.input(0),  indexTypes,
-            node.input(1),  intTypes,
-            node.output(0), allTypes);
+    const std::size_t chunk = 1 << 16;
+    const auto chunks = (out_size + chunk - 1) / chunk;
+    InferenceEngine::parallel_for(chunks, [&] (std::size_t c) {
+        const auto begin = c * chunk;
+        std::fill(out + begin, out + std::min(begin + chunk, out_size), off);
+    });
+
+    std::size_t suffix = 1;
+    for (auto i = static_cast<std::size_t>(one_hot_axis); i < indices_shape.size(); ++i) {
+        suffix *= indices_shape[i];
     }
+    InferenceEngine::parallel_for(ngraph::shape_size(indices_shape), [&] (std::size_t i) {
+        const auto index = static_cast<std::int64_t>(indices[i]);
+        if ((index < 0) || (static_cast<std::size_t>(index) >= depth_val)) {
+            return;
+        }
+        const auto prefix = i / suffix;
+        out[(prefix * depth_val + static_cast<std::size_t>(index)) * suffix + i % suffix] = on;
+    });
+}
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::OneHot& node) {
+    const auto& ind_shape = node.get_input_shape(0);
+    const auto& out_shape = node.get_output_shape(0);
+    std::int64_t axis = node.get_axis();
+    const std::int64_t out_rank = out_shape.size();
+    if (axis < -out_rank || axis >= out_rank)
+        IE_THROW() << "Invalid axis value. Expected in [" << -out_rank
+                           << ", " << out_rank-1 << "]. Got " << axis;
+    if (axis < 0)
+        axis += out_rank;
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          ind_shape,
+                                          node.output(0),
+                                          out_shape,
+                                          node.input(1),
+                                          axis,
+                                          node.input(2),
+                                          node.input(3));
+    };
+    return CallSwitch(
+        AP_WRAP(make, one_hot_native),
+        node.input(0),  indexTypes,
+        node.input(1),  intTypes,
+        node.output(0), allTypes);
+}
 }  //  namespace ArmPlugin
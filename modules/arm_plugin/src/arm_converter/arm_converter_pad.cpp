@@ -3,13 +3,127 @@
 
 
 
+#include <algorithm>
+#include <cstring>
+
 #include <arm_compute/runtime/NEON/functions/NEPadLayer.h>
+#include <ie_parallel.hpp>
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+namespace {
+// Maps an output coordinate (already shifted by pads_begin) onto the source
+// dim, or -1 when a constant fill is required. Pads never exceed the source
+// dim per the op spec, so one reflection is always enough
+std::int64_t map_index(std::int64_t index, std::int64_t dim, ngraph::op::PadMode mode) {
+    switch (mode) {
+        case ngraph::op::PadMode::CONSTANT:
+            return (index >= 0 && index < dim) ? index : -1;
+        case ngraph::op::PadMode::EDGE:
+            return std::max<std::int64_t>(0, std::min(index, dim - 1));
+        case ngraph::op::PadMode::REFLECT:
+            return index < 0 ? -index : index >= dim ? 2 * dim - 2 - index : index;
+        case ngraph::op::PadMode::SYMMETRIC:
+            return index < 0 ? -index - 1 : index >= dim ? 2 * dim - 1 - index : index;
+        default:
+            IE_THROW() << "Unsupported pad mode: " << mode;
+    }
+}
+
+// Row-parallel padding: every output row resolves its outer coordinates to a
+// source row once, then splits the innermost dim into a left fill, one body
+// memcpy and a right fill; only the fills touch single elements
+template <typename T>
+void pad_native(const T* input,
+                T* output,
+                const ngraph::Shape& in_shape,
+                const ngraph::Shape& out_shape,
+                const ngraph::CoordinateDiff& pads_begin,
+                ngraph::op::PadMode mode,
+                float pad_value) {
+    const auto rank = in_shape.size();
+    const auto value = static_cast<T>(pad_value);
+    const auto inner_in = static_cast<std::int64_t>(in_shape[rank - 1]);
+    const auto inner_out = out_shape[rank - 1];
+    const auto inner_pad = pads_begin[rank - 1];
+    std::vector<std::size_t> in_strides(rank, 1);
+    for (auto d = rank - 1; d > 0; --d) {
+        in_strides[d - 1] = in_strides[d] * in_shape[d];
+    }
+    const auto rows = ngraph::shape_size(out_shape) / inner_out;
+    InferenceEngine::parallel_for(rows, [&] (std::size_t row) {
+        T* dst = output + row * inner_out;
+        auto remainder = row;
+        std::size_t src_base = 0;
+        bool outside = false;
+        for (auto d = rank - 1; d-- > 0;) {
+            const auto coord = static_cast<std::int64_t>(remainder % out_shape[d]);
+            remainder /= out_shape[d];
+            const auto src = map_index(coord - pads_begin[d], in_shape[d], mode);
+            if (src < 0) {
+                outside = true;
+                break;
+            }
+            src_base += src * in_strides[d];
+        }
+        if (outside) {
+            std::fill_n(dst, inner_out, value);
+            return;
+        }
+        const T* src_row = input + src_base;
+        const auto body_start = static_cast<std::size_t>(std::max<std::int64_t>(0, inner_pad));
+        const auto body_end = static_cast<std::size_t>(
+            std::max<std::int64_t>(0, std::min<std::int64_t>(inner_out, inner_pad + inner_in)));
+        for (std::size_t x = 0; x < body_start; ++x) {
+            const auto src = map_index(static_cast<std::int64_t>(x) - inner_pad, inner_in, mode);
+            dst[x] = src < 0 ? value : src_row[src];
+        }
+        if (body_end > body_start) {
+            std::memcpy(dst + body_start, src_row + (static_cast<std::int64_t>(body_start) - inner_pad),
+                        (body_end - body_start) * sizeof(T));
+        }
+        for (auto x = body_end; x < inner_out; ++x) {
+            const auto src = map_index(static_cast<std::int64_t>(x) - inner_pad, inner_in, mode);
+            dst[x] = src < 0 ? value : src_row[src];
+        }
+    });
+}
+}  // namespace
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Pad& node) {
     auto pads_begin = node.get_pads_begin();
     auto pads_end   = node.get_pads_end();
+    const auto pad_mode = node.get_pad_mode();
+
+    float value = 0.f;
+    if (pad_mode == ngraph::op::PadMode::CONSTANT && node.get_input_size() > 3) {
+        value = safe_cast<opset::Constant>(node.input_value(3).get_node())->cast_vector<float>()[0];
+    }
+
+    auto non_negative = [] (const ngraph::CoordinateDiff& pads) {
+        return std::all_of(pads.begin(), pads.end(), [] (std::ptrdiff_t pad) { return pad >= 0; });
+    };
+    const bool acl_supported = non_negative(pads_begin) && non_negative(pads_end) &&
+        (pad_mode == ngraph::op::PadMode::CONSTANT ||
+         pad_mode == ngraph::op::PadMode::REFLECT ||
+         (pad_mode == ngraph::op::PadMode::SYMMETRIC &&
+          std::all_of(pads_end.begin(), pads_end.end(), [] (std::ptrdiff_t pad) { return pad == 0; })));
+    if (!acl_supported) {
+        auto make = [&] (auto nativeFunction) {
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.output(0),
+                                              node.get_input_shape(0),
+                                              node.get_output_shape(0),
+                                              pads_begin,
+                                              pad_mode,
+                                              value);
+        };
+        return CallSwitch(
+            AP_WRAP(make, pad_native),
+            node.get_input_element_type(0), allTypes);
+    }
+
     arm_compute::PaddingList padding;
     for (size_t i = 0; i < pads_begin.size(); i++) {
         auto dim = AxisCast(i, pads_begin.size());
@@ -17,7 +131,7 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Pad& node)
     }
 
     arm_compute::PaddingMode mode;
-    switch (node.get_pad_mode()) {
+    switch (pad_mode) {
         case ngraph::op::PadMode::CONSTANT:
             mode = arm_compute::PaddingMode::CONSTANT;
             break;
@@ -28,18 +142,13 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Pad& node)
             mode = arm_compute::PaddingMode::SYMMETRIC;
             break;
         default:
-            IE_THROW() << "Unsupported pad mode: " << node.get_pad_mode();
-    }
-
-    if (mode == arm_compute::PaddingMode::SYMMETRIC && !std::all_of(pads_end.begin(), pads_end.end(), [](int i){return i == 0;})) {
-        IE_THROW() << "Unsupported SYMMETRIC pad mode with a non-zero pads end";
+            IE_THROW() << "Unsupported pad mode: " << pad_mode;
     }
 
-    float value = safe_cast<opset::Constant>(node.input_value(3).get_node())->cast_vector<float>()[0];
     auto constant_value = mode == arm_compute::PaddingMode::CONSTANT ?
                           arm_compute::PixelValue(value) :
                           arm_compute::PixelValue();
 
     return MakeConversion<arm_compute::NEPadLayer>(node.input(0), node.output(0), padding, constant_value, mode);
 }
-} // namespace ArmPlugin
\ No newline at end of file
+} // namespace ArmPlugin
@@ -1,13 +1,240 @@
 // Copyright (C) 2020-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 #include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
 
 #include "arm_converter/arm_converter.hpp"
+#include "arm_nms_core.hpp"
 #include <ngraph/runtime/reference/proposal.hpp>
 
 namespace ArmPlugin {
+// Classic py-faster-rcnn anchor enumeration (coordinate offset 1, rounded
+// widths); the tensorflow variant shifts and swaps and stays on the reference
+static void generate_caffe_anchors(const ngraph::op::ProposalAttrs& attrs, std::vector<float>& anchors) {
+    const float base_size = static_cast<float>(attrs.base_size);
+    const float center = 0.5f * (base_size - 1.0f);
+    const float base_area = base_size * base_size;
+    anchors.resize(attrs.ratio.size() * attrs.scale.size() * 4);
+    std::size_t anchor = 0;
+    for (auto ratio : attrs.ratio) {
+        const float ratio_w = std::round(std::sqrt(base_area / ratio));
+        const float ratio_h = std::round(ratio_w * ratio);
+        for (auto scale : attrs.scale) {
+            const float half_w = 0.5f * (ratio_w * scale - 1.0f);
+            const float half_h = 0.5f * (ratio_h * scale - 1.0f);
+            anchors[anchor * 4 + 0] = center - half_w;
+            anchors[anchor * 4 + 1] = center - half_h;
+            anchors[anchor * 4 + 2] = center + half_w;
+            anchors[anchor * 4 + 3] = center + half_h;
+            ++anchor;
+        }
+    }
+}
+
+// Native caffe-mode Proposal: the anchor/bbox transform runs in parallel over
+// spatial positions, the pre-NMS top-n is selected per thread chunk and
+// merged, and suppression reuses the NEON core from arm_nms_core.hpp. The +1
+// pixel IoU convention is reproduced by shifting box maxima by one before
+// they enter the shared core.
+static void proposal_native(const float* class_probs,
+                            const float* bbox_deltas,
+                            const float* image_shape,
+                            float* output,
+                            float* out_scores,
+                            const ngraph::Shape& probsShape,
+                            const ngraph::Shape& imageShapeShape,
+                            const ngraph::op::ProposalAttrs& attrs) {
+    const auto batches = probsShape[0];
+    const auto anchor_count = probsShape[1] / 2;
+    const auto bottom_H = probsShape[2];
+    const auto bottom_W = probsShape[3];
+    const auto num = bottom_H * bottom_W * anchor_count;
+
+    const float img_H = image_shape[0];
+    const float img_W = image_shape[1];
+    const float scale_h = image_shape[2];
+    const float scale_w = (ngraph::shape_size(imageShapeShape) == 4) ? image_shape[3] : image_shape[2];
+    const float min_box_H = attrs.min_size * scale_h;
+    const float min_box_W = attrs.min_size * scale_w;
+
+    std::vector<float> anchors;
+    generate_caffe_anchors(attrs, anchors);
+
+    std::vector<float> scores(num);
+    std::vector<float> boxes(num * 4);
+    const auto post_nms = static_cast<std::size_t>(attrs.post_nms_topn);
+
+    for (std::size_t batch = 0; batch < batches; ++batch) {
+        InferenceEngine::parallel_for2d(bottom_H, bottom_W, [&] (std::size_t h, std::size_t w) {
+            for (std::size_t k = 0; k < anchor_count; ++k) {
+                const float* anchor = &anchors[k * 4];
+                float x0 = anchor[0] + w * attrs.feat_stride;
+                float y0 = anchor[1] + h * attrs.feat_stride;
+                float x1 = anchor[2] + w * attrs.feat_stride;
+                float y1 = anchor[3] + h * attrs.feat_stride;
+
+                auto delta = [&] (std::size_t i) {
+                    return bbox_deltas[(((batch * anchor_count + k) * 4 + i) * bottom_H + h) * bottom_W + w];
+                };
+                const float dx = delta(0) / attrs.box_coordinate_scale;
+                const float dy = delta(1) / attrs.box_coordinate_scale;
+                const float d_log_w = delta(2) / attrs.box_size_scale;
+                const float d_log_h = delta(3) / attrs.box_size_scale;
+
+                const float ww = x1 - x0 + 1.0f;
+                const float hh = y1 - y0 + 1.0f;
+                const float ctr_x = x0 + 0.5f * (ww - 1.0f);
+                const float ctr_y = y0 + 0.5f * (hh - 1.0f);
+                const float pred_ctr_x = dx * ww + ctr_x;
+                const float pred_ctr_y = dy * hh + ctr_y;
+                const float pred_w = std::exp(d_log_w) * ww;
+                const float pred_h = std::exp(d_log_h) * hh;
+                x0 = pred_ctr_x - 0.5f * (pred_w - 1.0f);
+                y0 = pred_ctr_y - 0.5f * (pred_h - 1.0f);
+                x1 = pred_ctr_x + 0.5f * (pred_w - 1.0f);
+                y1 = pred_ctr_y + 0.5f * (pred_h - 1.0f);
+                if (attrs.clip_before_nms) {
+                    x0 = std::min(std::max(x0, 0.0f), img_W - 1.0f);
+                    y0 = std::min(std::max(y0, 0.0f), img_H - 1.0f);
+                    x1 = std::min(std::max(x1, 0.0f), img_W - 1.0f);
+                    y1 = std::min(std::max(y1, 0.0f), img_H - 1.0f);
+                }
+
+                const auto index = (h * bottom_W + w) * anchor_count + k;
+                boxes[index * 4 + 0] = x0;
+                boxes[index * 4 + 1] = y0;
+                boxes[index * 4 + 2] = x1;
+                boxes[index * 4 + 3] = y1;
+                const float box_w = x1 - x0 + 1.0f;
+                const float box_h = y1 - y0 + 1.0f;
+                // Undersized boxes keep a zero score instead of being removed,
+                // matching the reference ordering
+                const float score = class_probs[((batch * 2 * anchor_count + anchor_count + k) * bottom_H + h) * bottom_W + w];
+                scores[index] = ((box_w >= min_box_W) && (box_h >= min_box_H)) ? score : 0.0f;
+            }
+        });
+
+        // Partial top-n: each thread chunk selects its own top pre_nms, the
+        // merged survivors are ranked once more - only candidates that can
+        // actually reach the NMS stage get fully ordered
+        auto pre_nms = std::min<std::size_t>(num, (attrs.pre_nms_topn > 0) ? attrs.pre_nms_topn : num);
+        auto by_score = [&] (int lhs, int rhs) { return scores[lhs] > scores[rhs]; };
+        std::vector<int> order;
+        const std::size_t chunks = std::max(InferenceEngine::parallel_get_max_threads(), 1);
+        if ((chunks > 1) && (num > 4 * pre_nms * chunks)) {
+            const auto chunk_size = (num + chunks - 1) / chunks;
+            std::vector<std::vector<int>> chunk_top(chunks);
+            InferenceEngine::parallel_for(chunks, [&] (std::size_t chunk) {
+                auto begin = chunk * chunk_size;
+                auto end = std::min(begin + chunk_size, num);
+                if (begin >= end) {
+                    return;
+                }
+                auto& top = chunk_top[chunk];
+                top.resize(end - begin);
+                std::iota(top.begin(), top.end(), static_cast<int>(begin));
+                auto keep = std::min(pre_nms, top.size());
+                std::partial_sort(top.begin(), top.begin() + keep, top.end(), by_score);
+                top.resize(keep);
+            });
+            for (auto&& top : chunk_top) {
+                order.insert(order.end(), top.begin(), top.end());
+            }
+        } else {
+            order.resize(num);
+            std::iota(order.begin(), order.end(), 0);
+        }
+        pre_nms = std::min(pre_nms, order.size());
+        std::partial_sort(order.begin(), order.begin() + pre_nms, order.end(), by_score);
+
+        std::vector<int> rois;
+        nms::KeptBoxes kept;
+        kept.Reserve(std::min(post_nms, pre_nms));
+        for (std::size_t i = 0; (i < pre_nms) && (rois.size() < post_nms); ++i) {
+            const auto index = order[i];
+            const float box[4] = {boxes[index * 4 + 0], boxes[index * 4 + 1],
+                                  boxes[index * 4 + 2] + 1.0f, boxes[index * 4 + 3] + 1.0f};
+            if (!nms::SuppressedByAny(box, kept, attrs.nms_thresh)) {
+                kept.Push(box);
+                rois.push_back(index);
+            }
+        }
+
+        float* batch_rois = output + batch * post_nms * 5;
+        float* batch_scores = (out_scores != nullptr) ? out_scores + batch * post_nms : nullptr;
+        for (std::size_t i = 0; i < rois.size(); ++i) {
+            const auto index = rois[i];
+            float x0 = boxes[index * 4 + 0];
+            float y0 = boxes[index * 4 + 1];
+            float x1 = boxes[index * 4 + 2];
+            float y1 = boxes[index * 4 + 3];
+            if (attrs.clip_after_nms) {
+                x0 = std::min(std::max(x0, 0.0f), img_W - 1.0f);
+                y0 = std::min(std::max(y0, 0.0f), img_H - 1.0f);
+                x1 = std::min(std::max(x1, 0.0f), img_W - 1.0f);
+                y1 = std::min(std::max(y1, 0.0f), img_H - 1.0f);
+            }
+            if (attrs.normalize) {
+                x0 /= img_W;
+                y0 /= img_H;
+                x1 /= img_W;
+                y1 /= img_H;
+            }
+            batch_rois[i * 5 + 0] = static_cast<float>(batch);
+            batch_rois[i * 5 + 1] = x0;
+            batch_rois[i * 5 + 2] = y0;
+            batch_rois[i * 5 + 3] = x1;
+            batch_rois[i * 5 + 4] = y1;
+            if (batch_scores != nullptr) {
+                batch_scores[i] = scores[index];
+            }
+        }
+        // Zero-fill the tail like the reference when fewer rois survive
+        std::fill(batch_rois + rois.size() * 5, batch_rois + post_nms * 5, 0.0f);
+        if (batch_scores != nullptr) {
+            std::fill(batch_scores + rois.size(), batch_scores + post_nms, 0.0f);
+        }
+    }
+}
+
+static void proposal_v4_native(const float* class_probs,
+                               const float* bbox_deltas,
+                               const float* image_shape,
+                               float* output,
+                               float* out_scores,
+                               const ngraph::Shape& probsShape,
+                               const ngraph::Shape& imageShapeShape,
+                               const ngraph::op::ProposalAttrs& attrs) {
+    proposal_native(class_probs, bbox_deltas, image_shape, output, out_scores, probsShape, imageShapeShape, attrs);
+}
+
+static void proposal_v0_native(const float* class_probs,
+                               const float* bbox_deltas,
+                               const float* image_shape,
+                               float* output,
+                               const ngraph::Shape& probsShape,
+                               const ngraph::Shape& imageShapeShape,
+                               const ngraph::op::ProposalAttrs& attrs) {
+    proposal_native(class_probs, bbox_deltas, image_shape, output, nullptr, probsShape, imageShapeShape, attrs);
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Proposal& node) {
+    if ((node.get_input_element_type(0) == ngraph::element::f32) && (node.get_attrs().framework != "tensorflow")) {
+        return MakeNativeConversion(proposal_v4_native,
+                              node.input(0),
+                              node.input(1),
+                              node.input(2),
+                              node.output(0),
+                              node.output(1),
+                              node.get_input_shape(0),
+                              node.get_input_shape(2),
+                              node.get_attrs());
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -28,6 +255,16 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Proposal&
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const ngraph::op::v0::Proposal& node) {
+    if ((node.get_input_element_type(0) == ngraph::element::f32) && (node.get_attrs().framework != "tensorflow")) {
+        return MakeNativeConversion(proposal_v0_native,
+                              node.input(0),
+                              node.input(1),
+                              node.input(2),
+                              node.output(0),
+                              node.get_input_shape(0),
+                              node.get_input_shape(2),
+                              node.get_attrs());
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -2,11 +2,82 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <algorithm>
+#include <cmath>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
 #include <ngraph/runtime/reference/psroi_pooling.hpp>
 
 namespace ArmPlugin {
+// Native average-mode PSROIPooling (the R-FCN configuration): every
+// (roi, output channel) pair is an independent workload over the IE thread
+// pool, and each bin accumulates row-contiguous spans of the position-
+// sensitive input plane
+static void psroi_pooling_average_native(const float* input,
+                                         const ngraph::Shape& input_shape,
+                                         const float* rois,
+                                         const ngraph::Shape& rois_shape,
+                                         float* output,
+                                         const ngraph::Shape& output_shape,
+                                         const float spatial_scale) {
+    const auto C = input_shape[1];
+    const auto H = input_shape[2];
+    const auto W = input_shape[3];
+    const auto plane = H * W;
+    const auto num_rois = rois_shape[0];
+    const auto output_dim = output_shape[1];
+    const auto pooled_h = output_shape[2];
+    const auto pooled_w = output_shape[3];
+
+    InferenceEngine::parallel_for2d(num_rois, output_dim, [&] (std::size_t roi, std::size_t c_out) {
+        const float* box = rois + roi * 5;
+        const auto batch = static_cast<std::size_t>(box[0]);
+        // Caffe R-FCN roi rounding: the end coordinate is inclusive
+        const float start_w = std::round(box[1]) * spatial_scale;
+        const float start_h = std::round(box[2]) * spatial_scale;
+        const float end_w = (std::round(box[3]) + 1.0f) * spatial_scale;
+        const float end_h = (std::round(box[4]) + 1.0f) * spatial_scale;
+        const float bin_w = std::max(end_w - start_w, 0.1f) / pooled_w;
+        const float bin_h = std::max(end_h - start_h, 0.1f) / pooled_h;
+
+        for (std::size_t ph = 0; ph < pooled_h; ++ph) {
+            for (std::size_t pw = 0; pw < pooled_w; ++pw) {
+                auto hstart = std::min<int>(std::max<int>(std::floor(ph * bin_h + start_h), 0), H);
+                auto hend = std::min<int>(std::max<int>(std::ceil((ph + 1) * bin_h + start_h), 0), H);
+                auto wstart = std::min<int>(std::max<int>(std::floor(pw * bin_w + start_w), 0), W);
+                auto wend = std::min<int>(std::max<int>(std::ceil((pw + 1) * bin_w + start_w), 0), W);
+                const auto c_in = (c_out * pooled_h + ph) * pooled_w + pw;
+                const float* fm = input + (batch * C + c_in) * plane;
+                float sum = 0.0f;
+                for (int h = hstart; h < hend; ++h) {
+                    const float* row = fm + h * W;
+                    for (int w = wstart; w < wend; ++w) {
+                        sum += row[w];
+                    }
+                }
+                const auto area = (hend - hstart) * (wend - wstart);
+                output[((roi * output_dim + c_out) * pooled_h + ph) * pooled_w + pw] =
+                    (area > 0) ? sum / area : 0.0f;
+            }
+        }
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::PSROIPooling& node) {
+    // Average mode in f32 takes the roi x channel parallel native kernel;
+    // bilinear mode and f16 keep the ngraph reference
+    if ((node.get_input_element_type(0) == ngraph::element::f32) && (node.get_mode() == "average")) {
+        return MakeNativeConversion(psroi_pooling_average_native,
+                                    node.input(0),
+                                    node.get_input_shape(0),
+                                    node.input(1),
+                                    node.get_input_shape(1),
+                                    node.output(0),
+                                    node.get_output_shape(0),
+                                    node.get_spatial_scale());
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
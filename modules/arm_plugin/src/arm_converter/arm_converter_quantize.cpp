@@ -12,36 +12,57 @@ namespace ArmPlugin {
 struct NEQuantizationLayerQI final: public arm_compute::IFunction {
 public:
     NEQuantizationLayerQI():
-        _quant(), _output(nullptr), _outputqi() {}
+        _quant(), _input(nullptr), _ip(nullptr), _inputqi(), _output(nullptr), _outputqi() {}
     NEQuantizationLayerQI(const NEQuantizationLayerQI &) = delete;
     NEQuantizationLayerQI &operator=(const NEQuantizationLayerQI &) = delete;
     NEQuantizationLayerQI(NEQuantizationLayerQI &&) = delete;
     NEQuantizationLayerQI &operator=(NEQuantizationLayerQI &&) = delete;
     ~NEQuantizationLayerQI() = default;
-    void configure(const arm_compute::ITensor *input, arm_compute::ITensor *output, const arm_compute::QuantizationInfo &qi) {
+    void configure(const arm_compute::ITensor *input, arm_compute::ITensor *output,
+                   const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo &qi) {
         ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-        ARM_COMPUTE_ERROR_THROW_ON(NEQuantizationLayerQI::validate(input->info(), output->info(), qi));
+        ARM_COMPUTE_ERROR_THROW_ON(NEQuantizationLayerQI::validate(input->info(), output->info(), ip, qi));
+        _input = input;
+        const arm_compute::ITensor *quant_input = input;
+        _ip = ip;
+        if (_ip) {
+            //Folded requantize: the quantized input carries a neutral graph info,
+            //its real scale arrives here and is applied through an imported alias
+            _inputqi.allocator()->init(*(_input->info()));
+            _inputqi.info()->set_quantization_info(*ip);
+            quant_input = &_inputqi;
+        }
         _output = output;
         _outputqi.allocator()->init(*(_output->info()));
         _outputqi.info()->set_quantization_info(qi);
         _quant = std::make_unique<arm_compute::NEQuantizationLayer>();
-        _quant->configure(input, &_outputqi);
+        _quant->configure(quant_input, &_outputqi);
     }
     static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *output,
-                                        const arm_compute::QuantizationInfo &qi) {
+                                        const arm_compute::QuantizationInfo *ip, const arm_compute::QuantizationInfo &qi) {
         ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
+        arm_compute::TensorInfo vld_input(*input);
+        if (ip) vld_input.set_quantization_info(*ip);
         //At the moment quantization info isn't checked actually, but just in case
-        return arm_compute::NEQuantizationLayer::validate(input, &arm_compute::TensorInfo(*output).set_quantization_info(qi));
+        return arm_compute::NEQuantizationLayer::validate(&vld_input, &arm_compute::TensorInfo(*output).set_quantization_info(qi));
     }
     void run() override {
         ARM_COMPUTE_ERROR_ON_MSG(!_quant.get(), "Kernel didn't configured");
+        if (_ip) {
+            if (_inputqi.info()->padding() != _input->info()->padding()) _inputqi.info()->extend_padding(_input->info()->padding());
+            _inputqi.allocator()->import_memory(_input->buffer());
+        }
         if (_outputqi.info()->padding() != _output->info()->padding()) _outputqi.info()->extend_padding(_output->info()->padding());
         _outputqi.allocator()->import_memory(_output->buffer());
         _quant->run();
+        if (_ip) _inputqi.allocator()->free();
         _outputqi.allocator()->free();
     }
 
 protected:
+    const arm_compute::ITensor *_input;
+    const arm_compute::QuantizationInfo *_ip;
+    arm_compute::Tensor _inputqi;
     const arm_compute::ITensor *_output;
     arm_compute::Tensor _outputqi;
     std::unique_ptr<arm_compute::NEQuantizationLayer> _quant;
@@ -51,8 +72,11 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmQuantiz
     if (qInfoIt == node.get_rt_info().end()) {
         IE_THROW() << "No quantization info available for ArmQuantize";
     }
+    auto iInfoIt = node.get_rt_info().find("InputPrescaleInfo");
+    const arm_compute::QuantizationInfo* iInfo = iInfoIt == node.get_rt_info().end() ? nullptr :
+                                               &(iInfoIt->second.as<arm_compute::QuantizationInfo>());
     auto qInfo = qInfoIt->second.as<arm_compute::QuantizationInfo>();
-    return MakeConversion<NEQuantizationLayerQI>(node.input(0), node.output(0), qInfo);
+    return MakeConversion<NEQuantizationLayerQI>(node.input(0), node.output(0), iInfo, qInfo);
 }
 
 struct NEDequantizationLayerQI final: public arm_compute::IFunction {
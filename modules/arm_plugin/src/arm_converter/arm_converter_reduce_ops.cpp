@@ -3,6 +3,17 @@
 
 
 
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 #include <arm_compute/runtime/NEON/functions/NEReductionOperation.h>
 #include <src/cpu/kernels/CpuConvertQuantizedSignednessKernel.h>
 #include <arm_compute/runtime/NEON/NEScheduler.h>
@@ -12,10 +23,148 @@
 #include "opset/utils.hpp"
 
 namespace ArmPlugin {
+enum class NativeReduceOp { Sum, Prod, Min, Max, Mean };
+
+static float reduce_range(const float* src, const std::size_t size, const NativeReduceOp op) {
+    float result = (op == NativeReduceOp::Prod) ? 1.f : (op == NativeReduceOp::Sum || op == NativeReduceOp::Mean) ? 0.f : src[0];
+    std::size_t i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    if (size >= 4) {
+        switch (op) {
+        case NativeReduceOp::Sum:
+        case NativeReduceOp::Mean: {
+            float32x4_t acc = vdupq_n_f32(0.f);
+            for (; i + 4 <= size; i += 4) {
+                acc = vaddq_f32(acc, vld1q_f32(src + i));
+            }
+            result = vaddvq_f32(acc);
+        } break;
+        case NativeReduceOp::Prod: {
+            float32x4_t acc = vdupq_n_f32(1.f);
+            for (; i + 4 <= size; i += 4) {
+                acc = vmulq_f32(acc, vld1q_f32(src + i));
+            }
+            result = vgetq_lane_f32(acc, 0) * vgetq_lane_f32(acc, 1) * vgetq_lane_f32(acc, 2) * vgetq_lane_f32(acc, 3);
+        } break;
+        case NativeReduceOp::Min: {
+            float32x4_t acc = vld1q_f32(src);
+            for (i = 4; i + 4 <= size; i += 4) {
+                acc = vminq_f32(acc, vld1q_f32(src + i));
+            }
+            result = vminvq_f32(acc);
+        } break;
+        case NativeReduceOp::Max: {
+            float32x4_t acc = vld1q_f32(src);
+            for (i = 4; i + 4 <= size; i += 4) {
+                acc = vmaxq_f32(acc, vld1q_f32(src + i));
+            }
+            result = vmaxvq_f32(acc);
+        } break;
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        switch (op) {
+        case NativeReduceOp::Sum:
+        case NativeReduceOp::Mean: result += src[i]; break;
+        case NativeReduceOp::Prod: result *= src[i]; break;
+        case NativeReduceOp::Min:  result = std::min(result, src[i]); break;
+        case NativeReduceOp::Max:  result = std::max(result, src[i]); break;
+        }
+    }
+    return result;
+}
+
+static float reduce_combine(const float* partials, const std::size_t count, const NativeReduceOp op) {
+    float result = partials[0];
+    for (std::size_t i = 1; i < count; ++i) {
+        switch (op) {
+        case NativeReduceOp::Sum:
+        case NativeReduceOp::Mean: result += partials[i]; break;
+        case NativeReduceOp::Prod: result *= partials[i]; break;
+        case NativeReduceOp::Min:  result = std::min(result, partials[i]); break;
+        case NativeReduceOp::Max:  result = std::max(result, partials[i]); break;
+        }
+    }
+    return result;
+}
+
+// Single-pass native reduction for constant trailing reduction axes: every
+// output element reduces one contiguous run of the input (global average
+// pool [N,C,H,W] -> [N,C] is the [N*C]:[H*W] case), so the final result comes
+// out of one vectorized sweep with no intermediate tensors. Many small
+// groups spread over the IE thread pool one group per task; a few large
+// groups (down to the full-tensor reduction) are instead chunked across the
+// pool and the per-chunk partials are combined at the end.
+static void reduce_native(const float* input,
+                          float* output,
+                          const std::size_t groups,
+                          const std::size_t groupSize,
+                          const NativeReduceOp op) {
+    const float scale = (op == NativeReduceOp::Mean) ? 1.f / static_cast<float>(groupSize) : 1.f;
+    constexpr std::size_t chunkSize = 1 << 15;
+    if ((groups >= static_cast<std::size_t>(InferenceEngine::parallel_get_max_threads())) || (groupSize <= chunkSize)) {
+        InferenceEngine::parallel_for(groups, [&] (std::size_t group) {
+            output[group] = reduce_range(input + group * groupSize, groupSize, op) * scale;
+        });
+    } else {
+        const std::size_t chunks = (groupSize + chunkSize - 1) / chunkSize;
+        std::vector<float> partials(groups * chunks);
+        InferenceEngine::parallel_for2d(groups, chunks, [&] (std::size_t group, std::size_t chunk) {
+            const std::size_t offset = chunk * chunkSize;
+            partials[group * chunks + chunk] =
+                reduce_range(input + group * groupSize + offset, std::min(chunkSize, groupSize - offset), op);
+        });
+        for (std::size_t group = 0; group < groups; ++group) {
+            output[group] = reduce_combine(partials.data() + group * chunks, chunks, op) * scale;
+        }
+    }
+}
+
+// Trailing contiguous reduction axes make every reduced group one contiguous
+// run; groups/groupSize come out when it holds
+static bool fits_native_reduce(const ngraph::Node& node, const std::vector<std::int64_t>& axesVals,
+                               std::size_t& groups, std::size_t& groupSize) {
+    if (ForcedToReference(&node) || (node.get_input_element_type(0) != ngraph::element::f32)) {
+        return false;
+    }
+    const auto& shape = node.get_input_shape(0);
+    const auto rank = static_cast<std::int64_t>(shape.size());
+    std::set<std::int64_t> axes;
+    for (auto axis : axesVals) {
+        axes.emplace(axis < 0 ? rank + axis : axis);
+    }
+    if (axes.empty() ||
+        (*axes.begin() != rank - static_cast<std::int64_t>(axes.size())) ||
+        (*axes.rbegin() != rank - 1)) {
+        return false;
+    }
+    groupSize = 1;
+    for (auto axis : axes) {
+        groupSize *= shape[axis];
+    }
+    groups = ngraph::shape_size(shape) / groupSize;
+    return true;
+}
+
 template<typename Reduce>
 static auto ConvertReduce(const Reduce& node, const arm_compute::ReductionOperation& op, Converter* converter) {
     auto axes = safe_cast<opset::Constant>(node.input_value(1).get_node())->template cast_vector<std::int64_t>();
     if (axes.size() != 1) {
+        std::size_t groups, groupSize;
+        if (fits_native_reduce(node, axes, groups, groupSize)) {
+            static const std::map<arm_compute::ReductionOperation, NativeReduceOp> opMap {
+                {arm_compute::ReductionOperation::SUM,  NativeReduceOp::Sum},
+                {arm_compute::ReductionOperation::PROD, NativeReduceOp::Prod},
+                {arm_compute::ReductionOperation::MIN,  NativeReduceOp::Min},
+                {arm_compute::ReductionOperation::MAX,  NativeReduceOp::Max}};
+            return converter->MakeNativeConversion(reduce_native,
+                                                   node.input(0),
+                                                   node.output(0),
+                                                   groups,
+                                                   groupSize,
+                                                   opMap.at(op));
+        }
         IE_THROW() << "Arm Plugin: Multiple reduction axes aren't supported";
     }
     unsigned int axis = AxisCast(axes[0], node.get_input_shape(0).size());
@@ -154,6 +303,22 @@ protected:
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReduceMean& node) {
     arm_compute::Coordinates axes;
     auto reduction_axes = safe_cast<opset::Constant>(node.input_value(1).get_node())->cast_vector<std::int64_t>();
+    // Multi-axis means over trailing axes (global average pool) go out in one
+    // native pass instead of NEReduceMean's per-axis stages; the quantized
+    // variants keep the ACL path, which handles requantization
+    if ((reduction_axes.size() > 1) &&
+        (node.get_rt_info().count("InputPrescaleInfo") == 0) &&
+        (node.get_rt_info().count("QuantizationInfo") == 0)) {
+        std::size_t groups, groupSize;
+        if (fits_native_reduce(node, reduction_axes, groups, groupSize)) {
+            return MakeNativeConversion(reduce_native,
+                                        node.input(0),
+                                        node.output(0),
+                                        groups,
+                                        groupSize,
+                                        NativeReduceOp::Mean);
+        }
+    }
     for (size_t i = 0; i < reduction_axes.size(); ++i) {
         auto pos = AxisCast(i, reduction_axes.size());
         axes.set(pos, reduction_axes[i]);
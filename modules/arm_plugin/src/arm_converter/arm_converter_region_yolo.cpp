@@ -2,24 +2,181 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cmath>
+#include <cstring>
+
+#include <ie_parallel.hpp>
+
+#include "arm_activation_lut.hpp"
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/region_yolo.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 namespace ArmPlugin {
+namespace {
+template <typename T>
+void sigmoid_span(const T* src, T* dst, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] = T(1.0f / (1.0f + std::exp(-static_cast<float>(src[i]))));
+    }
+}
+
+// f16 rows go through the shared exhaustive sigmoid table (see
+// ActivationLut) instead of a per-element exp; the table is warmed at
+// network load by Convert(RegionYolo)
+void sigmoid_span(const ngraph::float16* src, ngraph::float16* dst, std::size_t size) {
+    static const std::shared_ptr<const ActivationLut> table = ActivationLut::Get("sigmoid", &lut::sigmoid);
+    table->Apply(reinterpret_cast<const std::uint16_t*>(src), reinterpret_cast<std::uint16_t*>(dst), size);
+}
+
+// Softmax across channels for count contiguous spatial positions; the
+// channel stride is the feature-map plane so lanes stay contiguous
+template <typename T>
+void softmax_spatial(const T* src, T* dst, std::size_t channels, std::size_t stride, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        float best = src[i];
+        for (std::size_t c = 1; c < channels; ++c) {
+            best = std::max(best, static_cast<float>(src[c * stride + i]));
+        }
+        float sum = 0.0f;
+        for (std::size_t c = 0; c < channels; ++c) {
+            const float e = std::exp(static_cast<float>(src[c * stride + i]) - best);
+            dst[c * stride + i] = T(e);
+            sum += e;
+        }
+        for (std::size_t c = 0; c < channels; ++c) {
+            dst[c * stride + i] = T(static_cast<float>(dst[c * stride + i]) / sum);
+        }
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+// Cephes-style polynomial exp; ~1 ulp over the clamped range, well inside
+// what sigmoid/softmax post-processing of detection heads can resolve
+float32x4_t vexp_f32(float32x4_t x) {
+    x = vminq_f32(x, vdupq_n_f32(88.3762626647949f));
+    x = vmaxq_f32(x, vdupq_n_f32(-88.3762626647949f));
+    const float32x4_t fx = vmlaq_f32(vdupq_n_f32(0.5f), x, vdupq_n_f32(1.44269504088896341f));
+    float32x4_t fn = vcvtq_f32_s32(vcvtq_s32_f32(fx));
+    fn = vsubq_f32(fn, vbslq_f32(vcgtq_f32(fn, fx), vdupq_n_f32(1.0f), vdupq_n_f32(0.0f)));
+    x = vmlsq_f32(x, fn, vdupq_n_f32(0.693359375f));
+    x = vmlsq_f32(x, fn, vdupq_n_f32(-2.12194440e-4f));
+    float32x4_t y = vdupq_n_f32(1.9875691500e-4f);
+    y = vmlaq_f32(vdupq_n_f32(1.3981999507e-3f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(8.3334519073e-3f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(4.1665795894e-2f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(1.6666665459e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(5.0000001201e-1f), y, x);
+    y = vmlaq_f32(x, y, vmulq_f32(x, x));
+    y = vaddq_f32(y, vdupq_n_f32(1.0f));
+    const int32x4_t pow2n = vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(fn), vdupq_n_s32(127)), 23);
+    return vmulq_f32(y, vreinterpretq_f32_s32(pow2n));
+}
+
+float32x4_t vrecip_f32(float32x4_t x) {
+    float32x4_t r = vrecpeq_f32(x);
+    r = vmulq_f32(r, vrecpsq_f32(x, r));
+    return vmulq_f32(r, vrecpsq_f32(x, r));
+}
+
+void sigmoid_span(const float* src, float* dst, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        const float32x4_t e = vexp_f32(vnegq_f32(vld1q_f32(src + i)));
+        vst1q_f32(dst + i, vrecip_f32(vaddq_f32(e, vdupq_n_f32(1.0f))));
+    }
+    for (; i < size; ++i) {
+        dst[i] = 1.0f / (1.0f + std::exp(-src[i]));
+    }
+}
+
+void softmax_spatial(const float* src, float* dst, std::size_t channels, std::size_t stride, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t best = vld1q_f32(src + i);
+        for (std::size_t c = 1; c < channels; ++c) {
+            best = vmaxq_f32(best, vld1q_f32(src + c * stride + i));
+        }
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for (std::size_t c = 0; c < channels; ++c) {
+            const float32x4_t e = vexp_f32(vsubq_f32(vld1q_f32(src + c * stride + i), best));
+            vst1q_f32(dst + c * stride + i, e);
+            sum = vaddq_f32(sum, e);
+        }
+        const float32x4_t scale = vrecip_f32(sum);
+        for (std::size_t c = 0; c < channels; ++c) {
+            vst1q_f32(dst + c * stride + i, vmulq_f32(vld1q_f32(dst + c * stride + i), scale));
+        }
+    }
+    if (i < count) {
+        softmax_spatial<float>(src + i, dst + i, channels, stride, count - i);
+    }
+}
+#endif  // defined(__ARM_NEON) || defined(__ARM_NEON__)
+}  // namespace
+
+// Native RegionYolo: one pass over the feature map writes each channel's
+// output directly (sigmoid, softmax or plain copy) instead of the reference
+// copy-then-transform, with NEON sigmoid/exp for f32. Work is split
+// row-parallel over batches, anchors and feature-map rows; the class softmax
+// vectorizes across spatial lanes since the channel stride is the plane.
+template <typename T>
+void region_yolo_native(const T* input,
+                        T* output,
+                        const ngraph::Shape& input_shape,
+                        int coords,
+                        int classes,
+                        int regions,
+                        bool do_softmax,
+                        const std::vector<std::int64_t>& mask) {
+    const auto batches = input_shape[0];
+    const auto height = input_shape[2];
+    const auto width = input_shape[3];
+    const auto plane = height * width;
+    const auto num_regions = do_softmax ? static_cast<std::size_t>(regions) : mask.size();
+    const auto region_channels = static_cast<std::size_t>(coords + classes + 1);
+    const auto region_size = region_channels * plane;
+    InferenceEngine::parallel_for3d(batches, num_regions, height, [&] (std::size_t batch, std::size_t region, std::size_t row) {
+        const T* src = input + (batch * num_regions + region) * region_size + row * width;
+        T* dst = output + (batch * num_regions + region) * region_size + row * width;
+        for (std::size_t c = 0; c < region_channels; ++c) {
+            const bool activated = (c < 2) ||
+                                   (c == static_cast<std::size_t>(coords)) ||
+                                   (!do_softmax && (c > static_cast<std::size_t>(coords)));
+            if (activated) {
+                sigmoid_span(src + c * plane, dst + c * plane, width);
+            } else if (c <= static_cast<std::size_t>(coords)) {
+                std::memcpy(dst + c * plane, src + c * plane, width * sizeof(T));
+            }
+        }
+        if (do_softmax) {
+            const auto class_offset = static_cast<std::size_t>(coords + 1) * plane;
+            softmax_spatial(src + class_offset, dst + class_offset, classes, plane, width);
+        }
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::RegionYolo& node) {
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.output(0),
-                                    node.get_input_shape(0),
-                                    static_cast<int>(node.get_num_coords()),
-                                    static_cast<int>(node.get_num_classes()),
-                                    static_cast<int>(node.get_num_regions()),
-                                    node.get_do_softmax(),
-                                    node.get_mask());
+    if (node.get_input_element_type(0) == ngraph::element::f16) {
+        // Build the shared sigmoid table now, at network load, so the first
+        // frame does not pay the 65536 evaluations
+        ActivationLut::Get("sigmoid", &lut::sigmoid);
+    }
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          static_cast<int>(node.get_num_coords()),
+                                          static_cast<int>(node.get_num_classes()),
+                                          static_cast<int>(node.get_num_regions()),
+                                          node.get_do_softmax(),
+                                          node.get_mask());
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::region_yolo),
+        AP_WRAP(make, region_yolo_native),
         node.input(0), floatTypes);
 }
 }  //  namespace ArmPlugin
@@ -1,7 +1,12 @@
 // Copyright (C) 2020-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
 
 #include "arm_converter/arm_converter.hpp"
 #include <ngraph/runtime/reference/roi_align.hpp>
@@ -41,7 +46,138 @@ static void wrapper_roi_align(const T* feature_maps,
                                           pooling_mode);
 }
 
+// Native ROIAlign: ROIs are independent workloads, so they fan out over the
+// IE thread pool; per ROI the 4-point bilinear indices and weights are
+// computed once and reused across every channel, leaving the channel loop as
+// a plain weighted gather over the feature-map plane
+template <typename U>
+static void roi_align_native(const float* feature_maps,
+                             const float* rois,
+                             const U* batch_indices,
+                             float* out,
+                             const ngraph::Shape& feature_maps_shape,
+                             const ngraph::Shape& rois_shape,
+                             const int pooled_height,
+                             const int pooled_width,
+                             const int sampling_ratio,
+                             const float spatial_scale,
+                             const opset::ROIAlign::PoolingMode& pooling_mode) {
+    const auto C = feature_maps_shape[1];
+    const auto H = feature_maps_shape[2];
+    const auto W = feature_maps_shape[3];
+    const auto plane = H * W;
+    const auto num_rois = rois_shape[0];
+    const auto cells = static_cast<std::size_t>(pooled_height) * pooled_width;
+    const bool max_mode = (pooling_mode == opset::ROIAlign::PoolingMode::MAX);
+
+    InferenceEngine::parallel_for(num_rois, [&] (std::size_t roi) {
+        const float x1 = rois[roi * 4 + 0] * spatial_scale;
+        const float y1 = rois[roi * 4 + 1] * spatial_scale;
+        const float x2 = rois[roi * 4 + 2] * spatial_scale;
+        const float y2 = rois[roi * 4 + 3] * spatial_scale;
+        const float bin_width = std::max(x2 - x1, 1.0f) / pooled_width;
+        const float bin_height = std::max(y2 - y1, 1.0f) / pooled_height;
+        const int samples_x = (sampling_ratio == 0) ? static_cast<int>(std::ceil(bin_width)) : sampling_ratio;
+        const int samples_y = (sampling_ratio == 0) ? static_cast<int>(std::ceil(bin_height)) : sampling_ratio;
+        const int samples = samples_x * samples_y;
+
+        struct SamplePoint {
+            int   _tl, _tr, _bl, _br;
+            float _w1, _w2, _w3, _w4;
+        };
+        std::vector<SamplePoint> points(cells * samples);
+        auto interpolate = [] (float sample, std::size_t extent, int& low, int& high, float& lerp) {
+            // Out-of-range samples keep zero weights, like the reference
+            if ((sample < -1.0f) || (sample > static_cast<float>(extent))) {
+                return false;
+            }
+            sample = std::max(sample, 0.0f);
+            low = static_cast<int>(sample);
+            if (low >= static_cast<int>(extent) - 1) {
+                low = high = static_cast<int>(extent) - 1;
+                lerp = 0.0f;
+            } else {
+                high = low + 1;
+                lerp = sample - low;
+            }
+            return true;
+        };
+        for (int py = 0; py < pooled_height; ++py) {
+            for (int px = 0; px < pooled_width; ++px) {
+                for (int sy = 0; sy < samples_y; ++sy) {
+                    for (int sx = 0; sx < samples_x; ++sx) {
+                        auto& point = points[((py * pooled_width + px) * samples_y + sy) * samples_x + sx];
+                        point = SamplePoint{0, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f};
+                        const float sample_y = y1 + py * bin_height + (sy + 0.5f) * bin_height / samples_y;
+                        const float sample_x = x1 + px * bin_width + (sx + 0.5f) * bin_width / samples_x;
+                        int y_low, y_high, x_low, x_high;
+                        float ly, lx;
+                        if (interpolate(sample_y, H, y_low, y_high, ly) &&
+                            interpolate(sample_x, W, x_low, x_high, lx)) {
+                            point._tl = y_low * W + x_low;
+                            point._tr = y_low * W + x_high;
+                            point._bl = y_high * W + x_low;
+                            point._br = y_high * W + x_high;
+                            point._w1 = (1.0f - ly) * (1.0f - lx);
+                            point._w2 = (1.0f - ly) * lx;
+                            point._w3 = ly * (1.0f - lx);
+                            point._w4 = ly * lx;
+                        }
+                    }
+                }
+            }
+        }
+
+        const auto batch = static_cast<std::size_t>(batch_indices[roi]);
+        for (std::size_t c = 0; c < C; ++c) {
+            const float* fm = feature_maps + (batch * C + c) * plane;
+            float* dst = out + (roi * C + c) * cells;
+            for (std::size_t cell = 0; cell < cells; ++cell) {
+                const SamplePoint* cellPoints = &points[cell * samples];
+                if (max_mode) {
+                    float best = std::numeric_limits<float>::lowest();
+                    for (int s = 0; s < samples; ++s) {
+                        const auto& p = cellPoints[s];
+                        best = std::max(best, p._w1 * fm[p._tl] + p._w2 * fm[p._tr] +
+                                              p._w3 * fm[p._bl] + p._w4 * fm[p._br]);
+                    }
+                    dst[cell] = best;
+                } else {
+                    float sum = 0.0f;
+                    for (int s = 0; s < samples; ++s) {
+                        const auto& p = cellPoints[s];
+                        sum += p._w1 * fm[p._tl] + p._w2 * fm[p._tr] +
+                               p._w3 * fm[p._bl] + p._w4 * fm[p._br];
+                    }
+                    dst[cell] = sum / samples;
+                }
+            }
+        }
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ROIAlign& node) {
+    // f32 feature maps take the ROI-parallel native kernel; f16 stays on the
+    // reference since the weights are computed in float anyway
+    if (node.get_input_element_type(0) == ngraph::element::f32) {
+        auto makeNative = [&] (auto nativeFunction) {
+            return this->MakeNativeConversion(nativeFunction,
+                                        node.input(0),
+                                        node.input(1),
+                                        node.input(2),
+                                        node.output(0),
+                                        node.get_input_shape(0),
+                                        node.get_input_shape(1),
+                                        node.get_pooled_h(),
+                                        node.get_pooled_w(),
+                                        node.get_sampling_ratio(),
+                                        node.get_spatial_scale(),
+                                        node.get_mode());
+        };
+        return CallSwitch(
+            AP_WRAP(makeNative, roi_align_native),
+            node.input(2), intTypes);
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
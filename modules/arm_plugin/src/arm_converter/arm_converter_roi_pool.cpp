@@ -2,11 +2,132 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 #include "arm_converter/arm_converter.hpp"
 #include <ngraph/runtime/reference/roi_pooling.hpp>
+#include "opset/utils.hpp"
 
 namespace ArmPlugin {
+namespace {
+// Native ROIPooling parallelized over (roi, channel) plane pairs - the
+// per-plane work is independent, so the whole detection head scales over the
+// pool instead of running one ROI at a time. Max mode reduces each pooling
+// window with vectorized row maxima; bilinear mode samples one interpolated
+// point per output pixel, matching the reference arithmetic bit for bit on
+// the bin boundary and clamping rules.
+void roi_pooling_native(const float* input,
+                        const float* rois,
+                        float* output,
+                        const std::size_t channels,
+                        const std::size_t height,
+                        const std::size_t width,
+                        const std::size_t numRois,
+                        const std::size_t pooledH,
+                        const std::size_t pooledW,
+                        const float spatialScale,
+                        const bool maxMode) {
+    InferenceEngine::parallel_for2d(numRois, channels, [&] (std::size_t roi, std::size_t channel) {
+        const float* box = rois + roi * 5;
+        const auto batch = static_cast<std::size_t>(box[0]);
+        const float* plane = input + (batch * channels + channel) * height * width;
+        float* out = output + (roi * channels + channel) * pooledH * pooledW;
+        if (maxMode) {
+            const int roiXmin = static_cast<int>(std::round(box[1] * spatialScale));
+            const int roiYmin = static_cast<int>(std::round(box[2] * spatialScale));
+            const int roiXmax = static_cast<int>(std::round(box[3] * spatialScale));
+            const int roiYmax = static_cast<int>(std::round(box[4] * spatialScale));
+            const int roiWidth = std::max(roiXmax - roiXmin + 1, 1);
+            const int roiHeight = std::max(roiYmax - roiYmin + 1, 1);
+            const float binH = static_cast<float>(roiHeight) / pooledH;
+            const float binW = static_cast<float>(roiWidth) / pooledW;
+            for (std::size_t ph = 0; ph < pooledH; ++ph) {
+                const int hStart = std::min<int>(std::max<int>(static_cast<int>(std::floor(ph * binH)) + roiYmin, 0), height);
+                const int hEnd = std::min<int>(std::max<int>(static_cast<int>(std::ceil((ph + 1) * binH)) + roiYmin, 0), height);
+                for (std::size_t pw = 0; pw < pooledW; ++pw) {
+                    const int wStart = std::min<int>(std::max<int>(static_cast<int>(std::floor(pw * binW)) + roiXmin, 0), width);
+                    const int wEnd = std::min<int>(std::max<int>(static_cast<int>(std::ceil((pw + 1) * binW)) + roiXmin, 0), width);
+                    if ((hStart >= hEnd) || (wStart >= wEnd)) {
+                        out[ph * pooledW + pw] = 0.f;
+                        continue;
+                    }
+                    float best = -std::numeric_limits<float>::max();
+                    for (int h = hStart; h < hEnd; ++h) {
+                        const float* row = plane + h * width;
+                        int w = wStart;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+                        if (wEnd - wStart >= 4) {
+                            float32x4_t vmax = vld1q_f32(row + w);
+                            for (w += 4; w + 4 <= wEnd; w += 4) {
+                                vmax = vmaxq_f32(vmax, vld1q_f32(row + w));
+                            }
+                            best = std::max(best, vmaxvq_f32(vmax));
+                        }
+#endif
+                        for (; w < wEnd; ++w) {
+                            best = std::max(best, row[w]);
+                        }
+                    }
+                    out[ph * pooledW + pw] = best;
+                }
+            }
+        } else {
+            // Bilinear mode: normalized coordinates over the (dim - 1) grid
+            const float roiXmin = box[1] * (width - 1);
+            const float roiYmin = box[2] * (height - 1);
+            const float roiXmax = box[3] * (width - 1);
+            const float roiYmax = box[4] * (height - 1);
+            for (std::size_t ph = 0; ph < pooledH; ++ph) {
+                const float inY = (pooledH > 1) ? ph * (roiYmax - roiYmin) / (pooledH - 1) + roiYmin
+                                                : 0.5f * (roiYmin + roiYmax);
+                for (std::size_t pw = 0; pw < pooledW; ++pw) {
+                    const float inX = (pooledW > 1) ? pw * (roiXmax - roiXmin) / (pooledW - 1) + roiXmin
+                                                   : 0.5f * (roiXmin + roiXmax);
+                    if ((inY < 0.f) || (inY > height - 1) || (inX < 0.f) || (inX > width - 1)) {
+                        out[ph * pooledW + pw] = 0.f;
+                        continue;
+                    }
+                    const auto top = static_cast<std::size_t>(inY);
+                    const auto left = static_cast<std::size_t>(inX);
+                    const auto bottom = std::min<std::size_t>(top + 1, height - 1);
+                    const auto right = std::min<std::size_t>(left + 1, width - 1);
+                    const float dy = inY - top;
+                    const float dx = inX - left;
+                    const float topVal = plane[top * width + left] * (1.f - dx) + plane[top * width + right] * dx;
+                    const float bottomVal = plane[bottom * width + left] * (1.f - dx) + plane[bottom * width + right] * dx;
+                    out[ph * pooledW + pw] = topVal * (1.f - dy) + bottomVal * dy;
+                }
+            }
+        }
+    });
+}
+}  // namespace
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ROIPooling& node) {
+    if (!ForcedToReference(&node) && (node.get_input_element_type(0) == ngraph::element::f32)) {
+        const auto& dataShape = node.get_input_shape(0);
+        const auto& outShape = node.get_output_shape(0);
+        return MakeNativeConversion(roi_pooling_native,
+                                    node.input(0),
+                                    node.input(1),
+                                    node.output(0),
+                                    dataShape[1],
+                                    dataShape[2],
+                                    dataShape[3],
+                                    node.get_input_shape(1)[0],
+                                    outShape[2],
+                                    outShape[3],
+                                    node.get_spatial_scale(),
+                                    node.get_method() == "max");
+    }
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction, node.input(0), node.input(1), node.output(0),
                                     node.get_input_shape(0), node.get_input_shape(1), node.get_output_shape(0),
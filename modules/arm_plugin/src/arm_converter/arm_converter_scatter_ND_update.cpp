@@ -2,23 +2,83 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/scatter_nd_update.hpp>
 
 namespace ArmPlugin {
+// Parallel ScatterNDUpdate: the index tuples are folded into flat destination
+// offsets up front, and each update is then one contiguous block copy of its
+// slice. Disjoint offsets fan out lock-free over the IE thread pool; if the
+// same slice is addressed twice the updates are applied in order on one
+// thread so the reference's last-write-wins result is preserved.
+template <typename T, typename U>
+void scatter_nd_update_native(const T* data,
+                              const U* indices,
+                              const T* updates,
+                              T* out,
+                              const ngraph::Shape& data_shape,
+                              const ngraph::Shape& indices_shape) {
+    const auto total = ngraph::shape_size(data_shape);
+    const auto depth = indices_shape.back();
+    const auto num_updates = ngraph::shape_size(indices_shape) / depth;
+    std::size_t slice_elems = 1;
+    for (std::size_t dim = depth; dim < data_shape.size(); ++dim) {
+        slice_elems *= data_shape[dim];
+    }
+
+    // The untouched part of the output is the input, copied in parallel chunks
+    const std::size_t chunk = (1 << 20) / sizeof(T);
+    const auto chunks = (total + chunk - 1) / chunk;
+    InferenceEngine::parallel_for(chunks, [&] (std::size_t c) {
+        const auto begin = c * chunk;
+        const auto end = std::min(begin + chunk, total);
+        std::memcpy(out + begin, data + begin, (end - begin) * sizeof(T));
+    });
+
+    std::vector<std::size_t> offsets(num_updates);
+    InferenceEngine::parallel_for(num_updates, [&] (std::size_t update) {
+        std::size_t flat = 0;
+        for (std::size_t dim = 0; dim < depth; ++dim) {
+            auto index = static_cast<std::int64_t>(indices[update * depth + dim]);
+            if (index < 0) {
+                index += static_cast<std::int64_t>(data_shape[dim]);
+            }
+            flat = flat * data_shape[dim] + static_cast<std::size_t>(index);
+        }
+        offsets[update] = flat * slice_elems;
+    });
+
+    auto sorted = offsets;
+    std::sort(sorted.begin(), sorted.end());
+    const bool disjoint = (std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+    if (disjoint) {
+        InferenceEngine::parallel_for(num_updates, [&] (std::size_t update) {
+            std::memcpy(out + offsets[update], updates + update * slice_elems, slice_elems * sizeof(T));
+        });
+    } else {
+        for (std::size_t update = 0; update < num_updates; ++update) {
+            std::memcpy(out + offsets[update], updates + update * slice_elems, slice_elems * sizeof(T));
+        }
+    }
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ScatterNDUpdate& node) {
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.input(1),
-                                    node.input(2),
-                                    node.output(0),
-                                    node.get_input_shape(0),
-                                    node.get_input_shape(1),
-                                    node.get_input_shape(2));
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.input(1),
+                                          node.input(2),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_input_shape(1));
     };
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::scatterNdUpdate),
+        AP_WRAP(make, scatter_nd_update_native),
         node.input(0), allTypes,
         node.input(1), indexTypes);
 }
@@ -2,45 +2,82 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cstring>
+
+#include <ie_parallel.hpp>
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/scatter_elements_update.hpp>
 
 namespace ArmPlugin {
+// Scatter with precomputed strides, parallel over the non-scattered
+// coordinates: each task owns one column of indices along the axis, and two
+// tasks always differ in some non-axis coordinate, so writes never collide.
+// With the axis innermost both the index reads and the scattered stores are
+// contiguous; the initial data copy runs as parallel memcpy blocks
 template <typename DataType, typename IndicesType>
-void wrap_scatter_elem_update(const DataType* input_data,
-                              const IndicesType* indices,
-                              const DataType* updates,
-                              const IndicesType* axes,
-                              DataType* out_buf,
-                              const ngraph::Shape& data_shape,
-                              const ngraph::Shape& indices_shape) {
-    std::int64_t axis_val = static_cast<std::int64_t>(axes[0]);
-    if (axis_val < 0) {
-        axis_val = static_cast<std::int64_t>(data_shape.size()) + axis_val;
+void scatter_elements_native(const DataType* input_data,
+                             const IndicesType* indices,
+                             const DataType* updates,
+                             const IndicesType* axes,
+                             DataType* out_buf,
+                             const ngraph::Shape& data_shape,
+                             const ngraph::Shape& indices_shape) {
+    auto axis = static_cast<std::int64_t>(axes[0]);
+    if (axis < 0) {
+        axis += static_cast<std::int64_t>(data_shape.size());
+    }
+    const auto total = ngraph::shape_size(data_shape);
+    constexpr std::size_t block = 1 << 15;
+    InferenceEngine::parallel_for((total + block - 1) / block, [&] (std::size_t b) {
+        const auto start = b * block;
+        std::memcpy(out_buf + start, input_data + start, std::min(block, total - start) * sizeof(DataType));
+    });
+
+    const auto rank = data_shape.size();
+    std::vector<std::size_t> out_strides(rank, 1), ind_strides(rank, 1);
+    for (auto d = rank - 1; d > 0; --d) {
+        out_strides[d - 1] = out_strides[d] * data_shape[d];
+        ind_strides[d - 1] = ind_strides[d] * indices_shape[d];
     }
-    ngraph::runtime::reference::scatter_elem_update<DataType, IndicesType>(input_data,
-                                                                           indices,
-                                                                           updates,
-                                                                           axis_val,
-                                                                           out_buf,
-                                                                           data_shape,
-                                                                           indices_shape);
+    const auto axis_dim = static_cast<std::int64_t>(data_shape[axis]);
+    const auto axis_count = indices_shape[axis];
+    const auto columns = ngraph::shape_size(indices_shape) / axis_count;
+    InferenceEngine::parallel_for(columns, [&] (std::size_t column) {
+        auto remainder = column;
+        std::size_t out_base = 0, ind_base = 0;
+        for (auto d = rank; d-- > 0;) {
+            if (static_cast<std::int64_t>(d) == axis) {
+                continue;
+            }
+            const auto coord = remainder % indices_shape[d];
+            remainder /= indices_shape[d];
+            out_base += coord * out_strides[d];
+            ind_base += coord * ind_strides[d];
+        }
+        for (std::size_t k = 0; k < axis_count; ++k) {
+            const auto at = ind_base + k * ind_strides[axis];
+            auto index = static_cast<std::int64_t>(indices[at]);
+            if (index < 0) {
+                index += axis_dim;
+            }
+            out_buf[out_base + index * out_strides[axis]] = updates[at];
+        }
+    });
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ScatterElementsUpdate& node) {
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.input(1),
-                                    node.input(2),
-                                    node.input(3),
-                                    node.output(0),
-                                    node.get_input_shape(0),
-                                    node.get_input_shape(1));
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.input(1),
+                                          node.input(2),
+                                          node.input(3),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_input_shape(1));
     };
 
     return CallSwitch(
-        AP_WRAP(make, wrap_scatter_elem_update),
+        AP_WRAP(make, scatter_elements_native),
         node.get_input_element_type(0), allTypes,
         node.get_input_element_type(1), indexTypes);
 }
@@ -2,55 +2,95 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/scatter_update.hpp>
 
 namespace ArmPlugin {
+// Parallel axis ScatterUpdate: every update is one contiguous inner-block
+// copy. Unique indices spread over outer x index workloads lock-free; with
+// duplicate indices the index loop stays sequential inside each outer slice
+// so the reference's in-order (last-write-wins) result is preserved while
+// outer slices still run in parallel.
 template <typename T, typename U>
-void wrap_scatter_update(const T* input_data,
-                         const U* indices,
-                         const T* updates,
-                         const U* axis,
-                         T* out,
-                         const size_t elem_size,
-                         const ngraph::Shape& data_shape,
-                         const ngraph::Shape& indices_shape,
-                         const ngraph::Shape& updates_shape) {
-    auto indices_size = ngraph::shape_size(indices_shape);
-    std::vector<std::int64_t> converted_indices(indices_size);
-    for (size_t i = 0; i < indices_size; i++) {
-        converted_indices[i] = static_cast<std::int64_t>(indices[i]);
+void scatter_update_native(const T* data,
+                           const U* indices,
+                           const T* updates,
+                           const U* axis_input,
+                           T* out,
+                           const ngraph::Shape& data_shape,
+                           const ngraph::Shape& indices_shape,
+                           const ngraph::Shape& updates_shape) {
+    auto axis = static_cast<std::int64_t>(axis_input[0]);
+    if (axis < 0) {
+        axis += static_cast<std::int64_t>(data_shape.size());
+    }
+    std::size_t outer = 1;
+    for (std::int64_t dim = 0; dim < axis; ++dim) {
+        outer *= data_shape[dim];
     }
-    std::int64_t axis_val = static_cast<std::int64_t>(axis[0]);
-    if (axis_val < 0) {
-        axis_val = static_cast<std::int64_t>(data_shape.size()) + axis_val;
+    const auto axis_dim = data_shape[axis];
+    std::size_t inner = 1;
+    for (std::size_t dim = axis + 1; dim < data_shape.size(); ++dim) {
+        inner *= data_shape[dim];
+    }
+    const auto num_indices = ngraph::shape_size(indices_shape);
+
+    const auto total = ngraph::shape_size(data_shape);
+    const std::size_t chunk = (1 << 20) / sizeof(T);
+    const auto chunks = (total + chunk - 1) / chunk;
+    InferenceEngine::parallel_for(chunks, [&] (std::size_t c) {
+        const auto begin = c * chunk;
+        const auto end = std::min(begin + chunk, total);
+        std::memcpy(out + begin, data + begin, (end - begin) * sizeof(T));
+    });
+
+    std::vector<std::size_t> targets(num_indices);
+    for (std::size_t i = 0; i < num_indices; ++i) {
+        auto index = static_cast<std::int64_t>(indices[i]);
+        if (index < 0) {
+            index += static_cast<std::int64_t>(axis_dim);
+        }
+        targets[i] = static_cast<std::size_t>(index);
+    }
+    auto sorted = targets;
+    std::sort(sorted.begin(), sorted.end());
+    const bool disjoint = (std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+    auto apply = [&] (std::size_t o, std::size_t i) {
+        std::memcpy(out + (o * axis_dim + targets[i]) * inner,
+                    updates + (o * num_indices + i) * inner,
+                    inner * sizeof(T));
+    };
+    if (disjoint) {
+        InferenceEngine::parallel_for2d(outer, num_indices, apply);
+    } else {
+        InferenceEngine::parallel_for(outer, [&] (std::size_t o) {
+            for (std::size_t i = 0; i < num_indices; ++i) {
+                apply(o, i);
+            }
+        });
     }
-    ngraph::runtime::reference::scatter_update(reinterpret_cast<const char*>(input_data),
-                                               converted_indices.data(),
-                                               reinterpret_cast<const char*>(updates),
-                                               axis_val,
-                                               reinterpret_cast<char*>(out),
-                                               elem_size,
-                                               data_shape,
-                                               indices_shape,
-                                               updates_shape);
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ScatterUpdate& node) {
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.input(1),
-                                    node.input(2),
-                                    node.input(3),
-                                    node.output(0),
-                                    node.get_input_element_type(0).size(),
-                                    node.get_input_shape(0),
-                                    node.get_input_shape(1),
-                                    node.get_input_shape(2));
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.input(1),
+                                          node.input(2),
+                                          node.input(3),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_input_shape(1),
+                                          node.get_input_shape(2));
     };
     return CallSwitch(
-        AP_WRAP(make, wrap_scatter_update),
+        AP_WRAP(make, scatter_update_native),
         node.input(0), allTypes,
         node.input(1), indexTypes);
 }
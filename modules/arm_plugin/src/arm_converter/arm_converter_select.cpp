@@ -3,14 +3,138 @@
 
 
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
 #include <arm_compute/runtime/NEON/functions/NESelect.h>
+#include <ie_parallel.hpp>
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+namespace {
+// One output row with a per-element condition; then/else strides are 1 for
+// a real row and 0 for a value broadcast along it
+template <typename T>
+void select_row(const std::uint8_t* cond,
+                const T* then_vals, std::size_t then_stride,
+                const T* else_vals, std::size_t else_stride,
+                T* dst, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] = cond[i] ? then_vals[i * then_stride] : else_vals[i * else_stride];
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+void select_row(const std::uint8_t* cond,
+                const float* then_vals, std::size_t then_stride,
+                const float* else_vals, std::size_t else_stride,
+                float* dst, std::size_t count) {
+    std::size_t i = 0;
+    const auto then_dup = vdupq_n_f32(then_vals[0]);
+    const auto else_dup = vdupq_n_f32(else_vals[0]);
+    for (; i + 8 <= count; i += 8) {
+        const auto flags = vmovl_u8(vld1_u8(cond + i));
+        const uint32x4_t masks[2] = {
+            vcgtq_u32(vmovl_u16(vget_low_u16(flags)), vdupq_n_u32(0)),
+            vcgtq_u32(vmovl_u16(vget_high_u16(flags)), vdupq_n_u32(0))
+        };
+        for (int half = 0; half < 2; ++half) {
+            const auto at = i + half * 4;
+            const auto then_vec = then_stride ? vld1q_f32(then_vals + at) : then_dup;
+            const auto else_vec = else_stride ? vld1q_f32(else_vals + at) : else_dup;
+            vst1q_f32(dst + at, vbslq_f32(masks[half], then_vec, else_vec));
+        }
+    }
+    for (; i < count; ++i) {
+        dst[i] = cond[i] ? then_vals[i * then_stride] : else_vals[i * else_stride];
+    }
+}
+#endif
+
+// Numpy-broadcast Select: inputs carry right-aligned strides with 0 on
+// broadcast dims, rows of the output run in parallel, and a row whose
+// condition is broadcast collapses to one memcpy or fill
+template <typename T>
+void select_native(const std::uint8_t* cond,
+                   const T* then_vals,
+                   const T* else_vals,
+                   T* out,
+                   const ngraph::Shape& out_shape,
+                   const std::vector<std::size_t>& cond_strides,
+                   const std::vector<std::size_t>& then_strides,
+                   const std::vector<std::size_t>& else_strides) {
+    if (out_shape.empty()) {
+        out[0] = cond[0] ? then_vals[0] : else_vals[0];
+        return;
+    }
+    const auto rank = out_shape.size();
+    const auto inner = out_shape[rank - 1];
+    const auto rows = ngraph::shape_size(out_shape) / inner;
+    InferenceEngine::parallel_for(rows, [&] (std::size_t row) {
+        auto remainder = row;
+        std::size_t cond_off = 0, then_off = 0, else_off = 0;
+        for (auto d = rank - 1; d-- > 0;) {
+            const auto coord = remainder % out_shape[d];
+            remainder /= out_shape[d];
+            cond_off += coord * cond_strides[d];
+            then_off += coord * then_strides[d];
+            else_off += coord * else_strides[d];
+        }
+        T* dst = out + row * inner;
+        if (cond_strides[rank - 1] == 0) {
+            const bool taken = cond[cond_off] != 0;
+            const T* src = taken ? then_vals + then_off : else_vals + else_off;
+            if ((taken ? then_strides : else_strides)[rank - 1] != 0) {
+                std::memcpy(dst, src, inner * sizeof(T));
+            } else {
+                std::fill_n(dst, inner, *src);
+            }
+        } else {
+            select_row(cond + cond_off,
+                       then_vals + then_off, then_strides[rank - 1],
+                       else_vals + else_off, else_strides[rank - 1],
+                       dst, inner);
+        }
+    });
+}
+
+std::vector<std::size_t> broadcast_strides(const ngraph::Shape& shape, const ngraph::Shape& out_shape) {
+    const auto rank = out_shape.size();
+    std::vector<std::size_t> strides(rank, 0);
+    const auto align = rank - shape.size();
+    std::size_t stride = 1;
+    for (auto d = shape.size(); d-- > 0;) {
+        strides[align + d] = (shape[d] == 1 && out_shape[align + d] != 1) ? 0 : stride;
+        stride *= shape[d];
+    }
+    return strides;
+}
+}  // namespace
+
 template <> Converter::Conversion::Ptr Converter::Convert(const opset::Select& node) {
-    if (node.get_input_shape(0) != node.get_input_shape(1) || node.get_input_shape(0) != node.get_input_shape(2)) {
-        IE_THROW() << "Select op doesn't support broadcast";
+    const auto& out_shape = node.get_output_shape(0);
+    if (node.get_input_shape(0) == out_shape &&
+        node.get_input_shape(1) == out_shape &&
+        node.get_input_shape(2) == out_shape) {
+        return MakeConversion<arm_compute::NESelect>(node.input(0), node.input(1), node.input(2), node.output(0));
     }
-    return MakeConversion<arm_compute::NESelect>(node.input(0), node.input(1), node.input(2), node.output(0));
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.input(1),
+                                          node.input(2),
+                                          node.output(0),
+                                          out_shape,
+                                          broadcast_strides(node.get_input_shape(0), out_shape),
+                                          broadcast_strides(node.get_input_shape(1), out_shape),
+                                          broadcast_strides(node.get_input_shape(2), out_shape));
+    };
+    return CallSwitch(
+        AP_WRAP(make, select_native),
+        node.get_input_element_type(1), allTypes);
 }
 }  //  namespace ArmPlugin
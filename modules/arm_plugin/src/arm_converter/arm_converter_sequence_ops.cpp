@@ -2,9 +2,18 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
 #include <ngraph/runtime/reference/reverse_sequence.hpp>
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/sequences.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 namespace ArmPlugin {
 
@@ -24,223 +33,400 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReverseSeq
         node.input(1), indexTypes);
 }
 
-template <typename T, typename U>
-void wrap_lstm_sequence(const T* X,
-                        const ngraph::Shape& X_shape,
-                        const T* H,
-                        const ngraph::Shape& H_shape,
-                        const T* C,
-                        const ngraph::Shape& C_shape,
-                        const U* seq_lengths,
-                        const ngraph::Shape& seq_lengths_shape,
-                        const T* W,
-                        const ngraph::Shape& W_shape,
-                        const T* R,
-                        const ngraph::Shape& R_shape,
-                        const T* B,
-                        const ngraph::Shape& B_shape,
-                        T* Y,
-                        T* Ho,
-                        T* Co,
-                        const std::string& activation_f,
-                        const std::string& activation_g,
-                        const std::string& activation_h,
-                        float clip,
-                        ngraph::op::RecurrentSequenceDirection direction) {
-     ngraph::runtime::reference::lstm_sequence<T, U>(reinterpret_cast<const char*>(X),
-                                                    X_shape,
-                                                    reinterpret_cast<const char*>(H),
-                                                    H_shape,
-                                                    reinterpret_cast<const char*>(C),
-                                                    C_shape,
-                                                    reinterpret_cast<const char*>(seq_lengths),
-                                                    seq_lengths_shape,
-                                                    reinterpret_cast<const char*>(W),
-                                                    W_shape,
-                                                    reinterpret_cast<const char*>(R),
-                                                    R_shape,
-                                                    reinterpret_cast<const char*>(B),
-                                                    B_shape,
-                                                    reinterpret_cast<char*>(Y),
-                                                    reinterpret_cast<char*>(Ho),
-                                                    reinterpret_cast<char*>(Co),
-                                                    activation_f,
-                                                    activation_g,
-                                                    activation_h,
-                                                    clip,
-                                                    direction);
+namespace {
+// C[M, N] = A[M, K] * B[N, K]^T (+ bias[N]); B rows are contiguous, which is
+// exactly how W and R store their per-gate weights, so the inner loop is a
+// straight dot product. Rows run parallel over the IE thread pool; the f32
+// overload carries four output columns per pass in NEON accumulators.
+template <typename T>
+void gemm_nt(const T* a, const T* b, const T* bias, T* c, std::size_t M, std::size_t N, std::size_t K) {
+    InferenceEngine::parallel_for(M, [&] (std::size_t m) {
+        const T* a_row = a + m * K;
+        for (std::size_t n = 0; n < N; ++n) {
+            const T* b_row = b + n * K;
+            float acc = (bias != nullptr) ? static_cast<float>(bias[n]) : 0.0f;
+            for (std::size_t k = 0; k < K; ++k) {
+                acc += static_cast<float>(a_row[k]) * static_cast<float>(b_row[k]);
+            }
+            c[m * N + n] = T(acc);
+        }
+    });
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+void gemm_nt(const float* a, const float* b, const float* bias, float* c, std::size_t M, std::size_t N, std::size_t K) {
+    InferenceEngine::parallel_for(M, [&] (std::size_t m) {
+        const float* a_row = a + m * K;
+        std::size_t n = 0;
+        for (; n + 4 <= N; n += 4) {
+            const float* b0 = b + n * K;
+            const float* b1 = b0 + K;
+            const float* b2 = b1 + K;
+            const float* b3 = b2 + K;
+            float32x4_t acc0 = vdupq_n_f32(0.0f);
+            float32x4_t acc1 = acc0, acc2 = acc0, acc3 = acc0;
+            std::size_t k = 0;
+            for (; k + 4 <= K; k += 4) {
+                const float32x4_t av = vld1q_f32(a_row + k);
+                acc0 = vmlaq_f32(acc0, av, vld1q_f32(b0 + k));
+                acc1 = vmlaq_f32(acc1, av, vld1q_f32(b1 + k));
+                acc2 = vmlaq_f32(acc2, av, vld1q_f32(b2 + k));
+                acc3 = vmlaq_f32(acc3, av, vld1q_f32(b3 + k));
+            }
+            const float32x2_t h0 = vpadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+            const float32x2_t h1 = vpadd_f32(vget_low_f32(acc1), vget_high_f32(acc1));
+            const float32x2_t h2 = vpadd_f32(vget_low_f32(acc2), vget_high_f32(acc2));
+            const float32x2_t h3 = vpadd_f32(vget_low_f32(acc3), vget_high_f32(acc3));
+            float32x4_t sums = vcombine_f32(vpadd_f32(h0, h1), vpadd_f32(h2, h3));
+            float tails[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (; k < K; ++k) {
+                tails[0] += a_row[k] * b0[k];
+                tails[1] += a_row[k] * b1[k];
+                tails[2] += a_row[k] * b2[k];
+                tails[3] += a_row[k] * b3[k];
+            }
+            sums = vaddq_f32(sums, vld1q_f32(tails));
+            if (bias != nullptr) {
+                sums = vaddq_f32(sums, vld1q_f32(bias + n));
+            }
+            vst1q_f32(c + m * N + n, sums);
+        }
+        for (; n < N; ++n) {
+            const float* b_row = b + n * K;
+            float acc = (bias != nullptr) ? bias[n] : 0.0f;
+            for (std::size_t k = 0; k < K; ++k) {
+                acc += a_row[k] * b_row[k];
+            }
+            c[m * N + n] = acc;
+        }
+    });
+}
+#endif  // defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+using ActFn = float (*)(float);
+
+ActFn pick_activation(const std::string& name) {
+    if (name == "sigmoid") {
+        return [] (float x) { return 1.0f / (1.0f + std::exp(-x)); };
+    } else if (name == "tanh") {
+        return [] (float x) { return std::tanh(x); };
+    } else if (name == "relu") {
+        return [] (float x) { return x > 0.0f ? x : 0.0f; };
+    }
+    IE_THROW() << "Unsupported sequence op activation: " << name;
 }
 
+float clip_value(float value, float clip) {
+    return (clip == 0.0f) ? value : std::max(-clip, std::min(clip, value));
+}
+}  // namespace
+
+// Time-batched LSTMSequence: the input projections X*W^T for every timestep
+// of a direction are one big GEMM up front, so only the H*R^T projection
+// and the elementwise gate math remain inside the recurrent loop. Hidden
+// and cell state live in persistent per-direction buffers, steps past a
+// batch's sequence length leave state untouched and Y zero-filled, and the
+// gate order is [f, i, c, o] as everywhere else in OpenVINO.
+template <typename T, typename U>
+void lstm_sequence_native(const T* X, const ngraph::Shape& X_shape,
+                          const T* H, const ngraph::Shape& H_shape,
+                          const T* C, const ngraph::Shape& C_shape,
+                          const U* seq_lengths, const ngraph::Shape& seq_lengths_shape,
+                          const T* W, const ngraph::Shape& W_shape,
+                          const T* R, const ngraph::Shape& R_shape,
+                          const T* B, const ngraph::Shape& B_shape,
+                          T* Y, T* Ho, T* Co,
+                          const std::string& activation_f,
+                          const std::string& activation_g,
+                          const std::string& activation_h,
+                          float clip,
+                          ngraph::op::RecurrentSequenceDirection direction) {
+    const auto batches = X_shape[0];
+    const auto time = X_shape[1];
+    const auto input_size = X_shape[2];
+    const auto dirs = W_shape[0];
+    const auto gates = W_shape[1];
+    const auto hidden = gates / 4;
+    const auto act_f = pick_activation(activation_f);
+    const auto act_g = pick_activation(activation_g);
+    const auto act_h = pick_activation(activation_h);
+    std::memset(Y, 0, batches * dirs * time * hidden * sizeof(T));
+    std::vector<T> xproj(batches * time * gates), hproj(batches * gates);
+    std::vector<T> hstate(batches * hidden), cstate(batches * hidden);
+    for (std::size_t d = 0; d < dirs; ++d) {
+        const bool reversed = (direction == ngraph::op::RecurrentSequenceDirection::REVERSE) || (d == 1);
+        gemm_nt(X, W + d * gates * input_size, B + d * gates, xproj.data(), batches * time, gates, input_size);
+        for (std::size_t b = 0; b < batches; ++b) {
+            std::memcpy(hstate.data() + b * hidden, H + (b * dirs + d) * hidden, hidden * sizeof(T));
+            std::memcpy(cstate.data() + b * hidden, C + (b * dirs + d) * hidden, hidden * sizeof(T));
+        }
+        for (std::size_t t = 0; t < time; ++t) {
+            gemm_nt(hstate.data(), R + d * gates * hidden, static_cast<const T*>(nullptr), hproj.data(), batches, gates, hidden);
+            InferenceEngine::parallel_for(batches, [&] (std::size_t b) {
+                if (t >= static_cast<std::size_t>(seq_lengths[b])) {
+                    return;
+                }
+                const auto step = reversed ? static_cast<std::size_t>(seq_lengths[b]) - 1 - t : t;
+                const T* xp = xproj.data() + (b * time + step) * gates;
+                const T* hp = hproj.data() + b * gates;
+                T* h = hstate.data() + b * hidden;
+                T* c = cstate.data() + b * hidden;
+                T* y = Y + ((b * dirs + d) * time + step) * hidden;
+                for (std::size_t i = 0; i < hidden; ++i) {
+                    const float fg = act_f(clip_value(static_cast<float>(xp[i]) + static_cast<float>(hp[i]), clip));
+                    const float ig = act_f(clip_value(static_cast<float>(xp[hidden + i]) + static_cast<float>(hp[hidden + i]), clip));
+                    const float cg = act_g(clip_value(static_cast<float>(xp[2 * hidden + i]) + static_cast<float>(hp[2 * hidden + i]), clip));
+                    const float og = act_f(clip_value(static_cast<float>(xp[3 * hidden + i]) + static_cast<float>(hp[3 * hidden + i]), clip));
+                    const float cell = fg * static_cast<float>(c[i]) + ig * cg;
+                    const float out = og * act_h(cell);
+                    c[i] = T(cell);
+                    h[i] = T(out);
+                    y[i] = T(out);
+                }
+            });
+        }
+        for (std::size_t b = 0; b < batches; ++b) {
+            std::memcpy(Ho + (b * dirs + d) * hidden, hstate.data() + b * hidden, hidden * sizeof(T));
+            std::memcpy(Co + (b * dirs + d) * hidden, cstate.data() + b * hidden, hidden * sizeof(T));
+        }
+    }
+}
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::LSTMSequence& node) {
-    auto make = [&] (auto refFunction) {
-    return this->MakeConversion(refFunction,
-                                node.input(0),
-                                node.get_input_shape(0),
-                                node.input(1),
-                                node.get_input_shape(1),
-                                node.input(2),
-                                node.get_input_shape(2),
-                                node.input(3),
-                                node.get_input_shape(3),
-                                node.input(4),
-                                node.get_input_shape(4),
-                                node.input(5),
-                                node.get_input_shape(5),
-                                node.input(6),
-                                node.get_input_shape(6),
-                                node.output(0),
-                                node.output(1),
-                                node.output(2),
-                                node.get_activations()[0],
-                                node.get_activations()[1],
-                                node.get_activations()[2],
-                                node.get_clip(),
-                                node.get_direction());
+    auto make = [&] (auto nativeFunction) {
+    return this->MakeNativeConversion(nativeFunction,
+                                      node.input(0),
+                                      node.get_input_shape(0),
+                                      node.input(1),
+                                      node.get_input_shape(1),
+                                      node.input(2),
+                                      node.get_input_shape(2),
+                                      node.input(3),
+                                      node.get_input_shape(3),
+                                      node.input(4),
+                                      node.get_input_shape(4),
+                                      node.input(5),
+                                      node.get_input_shape(5),
+                                      node.input(6),
+                                      node.get_input_shape(6),
+                                      node.output(0),
+                                      node.output(1),
+                                      node.output(2),
+                                      node.get_activations()[0],
+                                      node.get_activations()[1],
+                                      node.get_activations()[2],
+                                      node.get_clip(),
+                                      node.get_direction());
     };
 
     return CallSwitch(
-        AP_WRAP(make, wrap_lstm_sequence),
+        AP_WRAP(make, lstm_sequence_native),
         node.input(0), allTypes,
         node.input(3), indexTypes);
 }
 
+// Time-batched GRUSequence in [z, r, h] gate order. The z/r halves of the
+// recurrent projection are one GEMM per step; without linear_before_reset
+// the h half needs (r (.) H) * Rh^T, which is a second per-step GEMM after
+// r is known, with linear_before_reset the Rh projection folds into the
+// first GEMM and r multiplies it elementwise (plus the separate Rh bias).
 template <typename T, typename U>
-void wrap_gru_sequence(const T* X,
-                        const ngraph::Shape& X_shape,
-                        const T* H,
-                        const ngraph::Shape& H_shape,
-                        const U* seq_lengths,
-                        const ngraph::Shape& seq_lengths_shape,
-                        const T* W,
-                        const ngraph::Shape& W_shape,
-                        const T* R,
-                        const ngraph::Shape& R_shape,
-                        const T* B,
-                        const ngraph::Shape& B_shape,
-                        T* Y,
-                        T* Ho,
-                        const std::string& activation_f,
-                        const std::string& activation_g,
-                        const float clip,
-                        const ngraph::op::RecurrentSequenceDirection direction,
-                        const bool linear_before_reset) {
-     ngraph::runtime::reference::gru_sequence<T, U>(reinterpret_cast<const char*>(X),
-                                                    X_shape,
-                                                    reinterpret_cast<const char*>(H),
-                                                    H_shape,
-                                                    reinterpret_cast<const char*>(seq_lengths),
-                                                    seq_lengths_shape,
-                                                    reinterpret_cast<const char*>(W),
-                                                    W_shape,
-                                                    reinterpret_cast<const char*>(R),
-                                                    R_shape,
-                                                    reinterpret_cast<const char*>(B),
-                                                    B_shape,
-                                                    reinterpret_cast<char*>(Y),
-                                                    reinterpret_cast<char*>(Ho),
-                                                    activation_f,
-                                                    activation_g,
-                                                    clip,
-                                                    direction,
-                                                    linear_before_reset);
+void gru_sequence_native(const T* X, const ngraph::Shape& X_shape,
+                         const T* H, const ngraph::Shape& H_shape,
+                         const U* seq_lengths, const ngraph::Shape& seq_lengths_shape,
+                         const T* W, const ngraph::Shape& W_shape,
+                         const T* R, const ngraph::Shape& R_shape,
+                         const T* B, const ngraph::Shape& B_shape,
+                         T* Y, T* Ho,
+                         const std::string& activation_f,
+                         const std::string& activation_g,
+                         const float clip,
+                         const ngraph::op::RecurrentSequenceDirection direction,
+                         const bool linear_before_reset) {
+    const auto batches = X_shape[0];
+    const auto time = X_shape[1];
+    const auto input_size = X_shape[2];
+    const auto dirs = W_shape[0];
+    const auto gates = W_shape[1];
+    const auto hidden = gates / 3;
+    const auto bias_stride = B_shape[1];
+    const auto act_f = pick_activation(activation_f);
+    const auto act_g = pick_activation(activation_g);
+    std::memset(Y, 0, batches * dirs * time * hidden * sizeof(T));
+    std::vector<T> xproj(batches * time * gates), hproj(batches * gates);
+    std::vector<T> hstate(batches * hidden), reset_h(batches * hidden), hhproj(batches * hidden);
+    for (std::size_t d = 0; d < dirs; ++d) {
+        const bool reversed = (direction == ngraph::op::RecurrentSequenceDirection::REVERSE) || (d == 1);
+        gemm_nt(X, W + d * gates * input_size, B + d * bias_stride, xproj.data(), batches * time, gates, input_size);
+        for (std::size_t b = 0; b < batches; ++b) {
+            std::memcpy(hstate.data() + b * hidden, H + (b * dirs + d) * hidden, hidden * sizeof(T));
+        }
+        const T* recurrent_bias = linear_before_reset ? B + d * bias_stride + 3 * hidden : nullptr;
+        for (std::size_t t = 0; t < time; ++t) {
+            const auto projected = linear_before_reset ? gates : 2 * hidden;
+            gemm_nt(hstate.data(), R + d * gates * hidden, static_cast<const T*>(nullptr), hproj.data(), batches, projected, hidden);
+            InferenceEngine::parallel_for(batches, [&] (std::size_t b) {
+                if (t >= static_cast<std::size_t>(seq_lengths[b])) {
+                    return;
+                }
+                const auto step = reversed ? static_cast<std::size_t>(seq_lengths[b]) - 1 - t : t;
+                const T* xp = xproj.data() + (b * time + step) * gates;
+                const T* hp = hproj.data() + b * projected;
+                T* h = hstate.data() + b * hidden;
+                if (linear_before_reset) {
+                    T* y = Y + ((b * dirs + d) * time + step) * hidden;
+                    for (std::size_t i = 0; i < hidden; ++i) {
+                        const float z = act_f(clip_value(static_cast<float>(xp[i]) + static_cast<float>(hp[i]), clip));
+                        const float r = act_f(clip_value(static_cast<float>(xp[hidden + i]) + static_cast<float>(hp[hidden + i]), clip));
+                        const float hh = act_g(clip_value(static_cast<float>(xp[2 * hidden + i]) +
+                                r * (static_cast<float>(hp[2 * hidden + i]) + static_cast<float>(recurrent_bias[i])), clip));
+                        const float out = (1.0f - z) * hh + z * static_cast<float>(h[i]);
+                        h[i] = T(out);
+                        y[i] = T(out);
+                    }
+                } else {
+                    T* rh = reset_h.data() + b * hidden;
+                    for (std::size_t i = 0; i < hidden; ++i) {
+                        const float r = act_f(clip_value(static_cast<float>(xp[hidden + i]) + static_cast<float>(hp[hidden + i]), clip));
+                        rh[i] = T(r * static_cast<float>(h[i]));
+                    }
+                }
+            });
+            if (!linear_before_reset) {
+                gemm_nt(reset_h.data(), R + (d * gates + 2 * hidden) * hidden, static_cast<const T*>(nullptr), hhproj.data(), batches, hidden, hidden);
+                InferenceEngine::parallel_for(batches, [&] (std::size_t b) {
+                    if (t >= static_cast<std::size_t>(seq_lengths[b])) {
+                        return;
+                    }
+                    const auto step = reversed ? static_cast<std::size_t>(seq_lengths[b]) - 1 - t : t;
+                    const T* xp = xproj.data() + (b * time + step) * gates;
+                    const T* hp = hproj.data() + b * projected;
+                    const T* hhp = hhproj.data() + b * hidden;
+                    T* h = hstate.data() + b * hidden;
+                    T* y = Y + ((b * dirs + d) * time + step) * hidden;
+                    for (std::size_t i = 0; i < hidden; ++i) {
+                        const float z = act_f(clip_value(static_cast<float>(xp[i]) + static_cast<float>(hp[i]), clip));
+                        const float hh = act_g(clip_value(static_cast<float>(xp[2 * hidden + i]) + static_cast<float>(hhp[i]), clip));
+                        const float out = (1.0f - z) * hh + z * static_cast<float>(h[i]);
+                        h[i] = T(out);
+                        y[i] = T(out);
+                    }
+                });
+            }
+        }
+        for (std::size_t b = 0; b < batches; ++b) {
+            std::memcpy(Ho + (b * dirs + d) * hidden, hstate.data() + b * hidden, hidden * sizeof(T));
+        }
+    }
 }
 
-
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::GRUSequence& node) {
-    auto make = [&] (auto refFunction) {
-    return this->MakeConversion(refFunction,
-                                node.input(0),
-                                node.get_input_shape(0),
-                                node.input(1),
-                                node.get_input_shape(1),
-                                node.input(2),
-                                node.get_input_shape(2),
-                                node.input(3),
-                                node.get_input_shape(3),
-                                node.input(4),
-                                node.get_input_shape(4),
-                                node.input(5),
-                                node.get_input_shape(5),
-                                node.output(0),
-                                node.output(1),
-                                node.get_activations()[0],
-                                node.get_activations()[1],
-                                node.get_clip(),
-                                node.get_direction(),
-                                node.get_linear_before_reset());
+    auto make = [&] (auto nativeFunction) {
+    return this->MakeNativeConversion(nativeFunction,
+                                      node.input(0),
+                                      node.get_input_shape(0),
+                                      node.input(1),
+                                      node.get_input_shape(1),
+                                      node.input(2),
+                                      node.get_input_shape(2),
+                                      node.input(3),
+                                      node.get_input_shape(3),
+                                      node.input(4),
+                                      node.get_input_shape(4),
+                                      node.input(5),
+                                      node.get_input_shape(5),
+                                      node.output(0),
+                                      node.output(1),
+                                      node.get_activations()[0],
+                                      node.get_activations()[1],
+                                      node.get_clip(),
+                                      node.get_direction(),
+                                      node.get_linear_before_reset());
     };
 
     return CallSwitch(
-        AP_WRAP(make, wrap_gru_sequence),
+        AP_WRAP(make, gru_sequence_native),
         node.input(0), allTypes,
         node.input(2), indexTypes);
 }
 
+// Time-batched RNNSequence: one GEMM for every timestep's input projection,
+// one per-step recurrent GEMM, and the activation over the sum.
 template <typename T, typename U>
-void wrap_rnn_sequence(const T* X,
-                        const ngraph::Shape& X_shape,
-                        const T* H,
-                        const ngraph::Shape& H_shape,
-                        const U* seq_lengths,
-                        const ngraph::Shape& seq_lengths_shape,
-                        const T* W,
-                        const ngraph::Shape& W_shape,
-                        const T* R,
-                        const ngraph::Shape& R_shape,
-                        const T* B,
-                        const ngraph::Shape& B_shape,
-                        T* Y,
-                        T* Ho,
-                        const std::string& activation_f,
-                        float clip,
-                        const ngraph::op::RecurrentSequenceDirection direction) {
-     ngraph::runtime::reference::rnn_sequence<T, U>(reinterpret_cast<const char*>(X),
-                                                    X_shape,
-                                                    reinterpret_cast<const char*>(H),
-                                                    H_shape,
-                                                    reinterpret_cast<const char*>(seq_lengths),
-                                                    seq_lengths_shape,
-                                                    reinterpret_cast<const char*>(W),
-                                                    W_shape,
-                                                    reinterpret_cast<const char*>(R),
-                                                    R_shape,
-                                                    reinterpret_cast<const char*>(B),
-                                                    B_shape,
-                                                    reinterpret_cast<char*>(Y),
-                                                    reinterpret_cast<char*>(Ho),
-                                                    activation_f,
-                                                    clip,
-                                                    direction);
+void rnn_sequence_native(const T* X, const ngraph::Shape& X_shape,
+                         const T* H, const ngraph::Shape& H_shape,
+                         const U* seq_lengths, const ngraph::Shape& seq_lengths_shape,
+                         const T* W, const ngraph::Shape& W_shape,
+                         const T* R, const ngraph::Shape& R_shape,
+                         const T* B, const ngraph::Shape& B_shape,
+                         T* Y, T* Ho,
+                         const std::string& activation_f,
+                         float clip,
+                         const ngraph::op::RecurrentSequenceDirection direction) {
+    const auto batches = X_shape[0];
+    const auto time = X_shape[1];
+    const auto input_size = X_shape[2];
+    const auto dirs = W_shape[0];
+    const auto hidden = W_shape[1];
+    const auto act_f = pick_activation(activation_f);
+    std::memset(Y, 0, batches * dirs * time * hidden * sizeof(T));
+    std::vector<T> xproj(batches * time * hidden), hproj(batches * hidden), hstate(batches * hidden);
+    for (std::size_t d = 0; d < dirs; ++d) {
+        const bool reversed = (direction == ngraph::op::RecurrentSequenceDirection::REVERSE) || (d == 1);
+        gemm_nt(X, W + d * hidden * input_size, B + d * hidden, xproj.data(), batches * time, hidden, input_size);
+        for (std::size_t b = 0; b < batches; ++b) {
+            std::memcpy(hstate.data() + b * hidden, H + (b * dirs + d) * hidden, hidden * sizeof(T));
+        }
+        for (std::size_t t = 0; t < time; ++t) {
+            gemm_nt(hstate.data(), R + d * hidden * hidden, static_cast<const T*>(nullptr), hproj.data(), batches, hidden, hidden);
+            InferenceEngine::parallel_for(batches, [&] (std::size_t b) {
+                if (t >= static_cast<std::size_t>(seq_lengths[b])) {
+                    return;
+                }
+                const auto step = reversed ? static_cast<std::size_t>(seq_lengths[b]) - 1 - t : t;
+                const T* xp = xproj.data() + (b * time + step) * hidden;
+                const T* hp = hproj.data() + b * hidden;
+                T* h = hstate.data() + b * hidden;
+                T* y = Y + ((b * dirs + d) * time + step) * hidden;
+                for (std::size_t i = 0; i < hidden; ++i) {
+                    const float out = act_f(clip_value(static_cast<float>(xp[i]) + static_cast<float>(hp[i]), clip));
+                    h[i] = T(out);
+                    y[i] = T(out);
+                }
+            });
+        }
+        for (std::size_t b = 0; b < batches; ++b) {
+            std::memcpy(Ho + (b * dirs + d) * hidden, hstate.data() + b * hidden, hidden * sizeof(T));
+        }
+    }
 }
 
-
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::RNNSequence& node) {
-    auto make = [&] (auto refFunction) {
-    return this->MakeConversion(refFunction,
-                                node.input(0),
-                                node.get_input_shape(0),
-                                node.input(1),
-                                node.get_input_shape(1),
-                                node.input(2),
-                                node.get_input_shape(2),
-                                node.input(3),
-                                node.get_input_shape(3),
-                                node.input(4),
-                                node.get_input_shape(4),
-                                node.input(5),
-                                node.get_input_shape(5),
-                                node.output(0),
-                                node.output(1),
-                                node.get_activations()[0],
-                                node.get_clip(),
-                                node.get_direction());
+    auto make = [&] (auto nativeFunction) {
+    return this->MakeNativeConversion(nativeFunction,
+                                      node.input(0),
+                                      node.get_input_shape(0),
+                                      node.input(1),
+                                      node.get_input_shape(1),
+                                      node.input(2),
+                                      node.get_input_shape(2),
+                                      node.input(3),
+                                      node.get_input_shape(3),
+                                      node.input(4),
+                                      node.get_input_shape(4),
+                                      node.input(5),
+                                      node.get_input_shape(5),
+                                      node.output(0),
+                                      node.output(1),
+                                      node.get_activations()[0],
+                                      node.get_clip(),
+                                      node.get_direction());
     };
 
     return CallSwitch(
-        AP_WRAP(make, wrap_rnn_sequence),
+        AP_WRAP(make, rnn_sequence_native),
         node.input(0), allTypes,
         node.input(2), indexTypes);
 }
 
-} // namespace ArmPlugin
\ No newline at end of file
+} // namespace ArmPlugin
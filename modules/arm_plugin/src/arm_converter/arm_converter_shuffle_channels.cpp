@@ -4,9 +4,36 @@
 
 #include <arm_compute/runtime/NEON/functions/NEActivationLayer.h>
 #include <arm_compute/runtime/NEON/functions/NEChannelShuffleLayer.h>
+
 #include "arm_converter/arm_converter.hpp"
+#include "arm_strided_copy.hpp"
 
 namespace ArmPlugin {
+// ShuffleChannels on any axis is the [group, rows] -> [rows, group]
+// transpose of the shuffled dim, expressed as a strided-copy plan: output
+// loops [pre, rows, group, post] pulling from source strides
+// [dim * post, post, rows * post, 1]; the engine collapses what is
+// contiguous and runs block-parallel.
+template <typename T>
+void shuffle_channels_native(const T* input,
+                             T* output,
+                             const ngraph::Shape& in_shape,
+                             std::size_t axis,
+                             std::size_t group) {
+    std::size_t pre = 1, post = 1;
+    for (std::size_t i = 0; i < axis; ++i) {
+        pre *= in_shape[i];
+    }
+    for (auto i = axis + 1; i < in_shape.size(); ++i) {
+        post *= in_shape[i];
+    }
+    const auto dim = in_shape[axis];
+    const auto rows = dim / group;
+    const auto plan = strided::MakePlan({pre, rows, group, post},
+                                        {dim * post, post, rows * post, 1});
+    strided::Run(plan, input, output);
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ShuffleChannels& node) {
     int axis = node.get_axis();
     if (axis < 0) {
@@ -14,13 +41,23 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::ShuffleCha
     }
 
     unsigned int group = static_cast<unsigned int>(node.get_group());
-    if (axis != 1) {
-        IE_THROW() << "Unsupported axis: " << axis;
-    }
     if (group == 1) {
         arm_compute::ActivationLayerInfo info(arm_compute::ActivationLayerInfo::ActivationFunction::IDENTITY);
         return MakeConversion<arm_compute::NEActivationLayer>(node.input(0), node.output(0), info);
     }
-    return MakeConversion<arm_compute::NEChannelShuffleLayer>(node.input(0), node.output(0), group);
+    if (axis == 1) {
+        return MakeConversion<arm_compute::NEChannelShuffleLayer>(node.input(0), node.output(0), group);
+    }
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          static_cast<std::size_t>(axis),
+                                          static_cast<std::size_t>(group));
+    };
+    return CallSwitch(
+        AP_WRAP(make, shuffle_channels_native),
+        node.get_input_element_type(0), allTypes);
 }
 } //  namespace ArmPlugin
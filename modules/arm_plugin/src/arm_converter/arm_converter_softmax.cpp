@@ -1,24 +1,226 @@
 // Copyright (C) 2020-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cmath>
+
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 #include <arm_compute/runtime/NEON/functions/NESoftmaxLayer.h>
 #include <ngraph/runtime/reference/softmax.hpp>
+#include "arm_activation_lut.hpp"
 #include "arm_converter/arm_converter.hpp"
+#include "opset/utils.hpp"
 
 namespace ArmPlugin {
-template<> Converter::Conversion::Ptr Converter::Convert(const opset::Softmax& node) {
-    if (true) {
-        return MakeConversion<arm_compute::NESoftmaxLayer>(node.input(0),
-                                                        node.output(0),
-                                                        1.0f,
-                                                        static_cast<int32_t>(AxisCast(node.get_axis(), node.get_shape().size())));
+
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+// Vectorized exp via the usual range reduction: x = n*ln2 + r with r in
+// [-ln2/2, ln2/2], a degree-5 polynomial for e^r and the 2^n scale applied
+// through the float exponent bits. Inputs are softmax-shifted (x <= 0), so
+// only the underflow side needs clamping; ~1 ulp of error is well under the
+// reference exp/sum rounding noise.
+static inline float32x4_t vexpq_f32(float32x4_t x) {
+    const float32x4_t log2e = vdupq_n_f32(1.44269504088896341f);
+    const float32x4_t ln2hi = vdupq_n_f32(0.693145751953125f);
+    const float32x4_t ln2lo = vdupq_n_f32(1.42860682030941723e-6f);
+    x = vmaxq_f32(x, vdupq_n_f32(-87.f));  // exp underflows to 0 below this anyway
+    float32x4_t n = vrndnq_f32(vmulq_f32(x, log2e));
+    float32x4_t r = vfmsq_f32(x, n, ln2hi);
+    r = vfmsq_f32(r, n, ln2lo);
+    float32x4_t poly = vdupq_n_f32(1.9875691500e-4f);
+    poly = vfmaq_f32(vdupq_n_f32(1.3981999507e-3f), poly, r);
+    poly = vfmaq_f32(vdupq_n_f32(8.3334519073e-3f), poly, r);
+    poly = vfmaq_f32(vdupq_n_f32(4.1665795894e-2f), poly, r);
+    poly = vfmaq_f32(vdupq_n_f32(1.6666665459e-1f), poly, r);
+    poly = vfmaq_f32(vdupq_n_f32(5.0000001201e-1f), poly, r);
+    // e^r = 1 + r + r^2 * poly
+    poly = vfmaq_f32(vaddq_f32(vdupq_n_f32(1.f), r), vmulq_f32(r, r), poly);
+    // 2^n through the exponent field
+    int32x4_t pow2n = vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127)), 23);
+    return vmulq_f32(poly, vreinterpretq_f32_s32(pow2n));
+}
+#endif
+
+// Native softmax over an arbitrary axis without transposes. The tensor is
+// viewed as [outer, axis, inner]: inner == 1 is the contiguous-row case
+// (vectorized along the row), otherwise the kernel walks the axis with the
+// inner stride and vectorizes across four contiguous inner positions, so the
+// memory access stays sequential and no permute sandwich is needed. Rows are
+// independent and spread over the IE thread pool.
+static void softmax_native(const float* input,
+                           float* output,
+                           const std::size_t outer,
+                           const std::size_t axisSize,
+                           const std::size_t inner) {
+    if (inner == 1) {
+        InferenceEngine::parallel_for(outer, [&] (std::size_t row) {
+            const float* src = input + row * axisSize;
+            float* dst = output + row * axisSize;
+            float max = src[0];
+            std::size_t i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+            if (axisSize >= 4) {
+                float32x4_t vmax = vld1q_f32(src);
+                for (i = 4; i + 4 <= axisSize; i += 4) {
+                    vmax = vmaxq_f32(vmax, vld1q_f32(src + i));
+                }
+                max = vmaxvq_f32(vmax);
+            }
+#endif
+            for (; i < axisSize; ++i) {
+                max = std::max(max, src[i]);
+            }
+            float sum = 0.f;
+            i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+            float32x4_t vsum = vdupq_n_f32(0.f);
+            float32x4_t vshift = vdupq_n_f32(max);
+            for (; i + 4 <= axisSize; i += 4) {
+                float32x4_t e = vexpq_f32(vsubq_f32(vld1q_f32(src + i), vshift));
+                vst1q_f32(dst + i, e);
+                vsum = vaddq_f32(vsum, e);
+            }
+            sum = vaddvq_f32(vsum);
+#endif
+            for (; i < axisSize; ++i) {
+                dst[i] = std::exp(src[i] - max);
+                sum += dst[i];
+            }
+            const float scale = 1.f / sum;
+            i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+            float32x4_t vscale = vdupq_n_f32(scale);
+            for (; i + 4 <= axisSize; i += 4) {
+                vst1q_f32(dst + i, vmulq_f32(vld1q_f32(dst + i), vscale));
+            }
+#endif
+            for (; i < axisSize; ++i) {
+                dst[i] *= scale;
+            }
+        });
     } else {
+        InferenceEngine::parallel_for(outer, [&] (std::size_t out) {
+            const float* src = input + out * axisSize * inner;
+            float* dst = output + out * axisSize * inner;
+            std::size_t pos = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+            for (; pos + 4 <= inner; pos += 4) {
+                float32x4_t vmax = vld1q_f32(src + pos);
+                for (std::size_t a = 1; a < axisSize; ++a) {
+                    vmax = vmaxq_f32(vmax, vld1q_f32(src + a * inner + pos));
+                }
+                float32x4_t vsum = vdupq_n_f32(0.f);
+                for (std::size_t a = 0; a < axisSize; ++a) {
+                    float32x4_t e = vexpq_f32(vsubq_f32(vld1q_f32(src + a * inner + pos), vmax));
+                    vst1q_f32(dst + a * inner + pos, e);
+                    vsum = vaddq_f32(vsum, e);
+                }
+                float32x4_t vscale = vdivq_f32(vdupq_n_f32(1.f), vsum);
+                for (std::size_t a = 0; a < axisSize; ++a) {
+                    vst1q_f32(dst + a * inner + pos, vmulq_f32(vld1q_f32(dst + a * inner + pos), vscale));
+                }
+            }
+#endif
+            for (; pos < inner; ++pos) {
+                float max = src[pos];
+                for (std::size_t a = 1; a < axisSize; ++a) {
+                    max = std::max(max, src[a * inner + pos]);
+                }
+                float sum = 0.f;
+                for (std::size_t a = 0; a < axisSize; ++a) {
+                    dst[a * inner + pos] = std::exp(src[a * inner + pos] - max);
+                    sum += dst[a * inner + pos];
+                }
+                const float scale = 1.f / sum;
+                for (std::size_t a = 0; a < axisSize; ++a) {
+                    dst[a * inner + pos] *= scale;
+                }
+            }
+        });
+    }
+}
+
+// f16 softmax off the innermost axis: the same strided walk as the f32
+// kernel, with the exp taken from the shared exhaustive f16 table (see
+// ActivationLut) while the shift and the sum stay in f32. Like the f32 path
+// it avoids ACL's permute sandwich; the table replaces the per-element exp
+// the scalar fallback would otherwise evaluate
+static void softmax_lut_native(const ngraph::float16* input,
+                               ngraph::float16* output,
+                               const std::shared_ptr<const ActivationLut>& expLut,
+                               const std::size_t outer,
+                               const std::size_t axisSize,
+                               const std::size_t inner) {
+    const auto& exp = *expLut;
+    InferenceEngine::parallel_for(outer, [&] (std::size_t out) {
+        const ngraph::float16* src = input + out * axisSize * inner;
+        ngraph::float16* dst = output + out * axisSize * inner;
+        for (std::size_t pos = 0; pos < inner; ++pos) {
+            float max = src[pos];
+            for (std::size_t a = 1; a < axisSize; ++a) {
+                max = std::max(max, static_cast<float>(src[a * inner + pos]));
+            }
+            float sum = 0.f;
+            for (std::size_t a = 0; a < axisSize; ++a) {
+                const auto e = ngraph::float16::from_bits(exp[ngraph::float16{static_cast<float>(src[a * inner + pos]) - max}.to_bits()]);
+                dst[a * inner + pos] = e;
+                sum += static_cast<float>(e);
+            }
+            const float scale = 1.f / sum;
+            for (std::size_t a = 0; a < axisSize; ++a) {
+                dst[a * inner + pos] = ngraph::float16{static_cast<float>(dst[a * inner + pos]) * scale};
+            }
+        }
+    });
+}
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::Softmax& node) {
+    const auto& shape = node.get_shape();
+    const auto axis = node.get_axis();
+    if (ForcedToReference(&node)) {
         auto make = [&] (auto refFunction) {
-            return this->MakeConversion(refFunction, node.input(0), node.output(0), node.get_shape(), ngraph::AxisSet{node.get_axis()});
+            return this->MakeConversion(refFunction, node.input(0), node.output(0), shape, ngraph::AxisSet{axis});
         };
         return CallSwitch(
             AP_WRAP(make, ngraph::runtime::reference::softmax),
             node.input(0), floatTypes);
     }
+    // ACL's softmax is the fastest path for the innermost axis; any other
+    // axis would permute inside ACL, so it goes to the native strided kernels
+    if (axis != shape.size() - 1) {
+        std::size_t outer = 1;
+        for (std::size_t dim = 0; dim < axis; ++dim) {
+            outer *= shape[dim];
+        }
+        std::size_t inner = 1;
+        for (std::size_t dim = axis + 1; dim < shape.size(); ++dim) {
+            inner *= shape[dim];
+        }
+        if (node.get_input_element_type(0) == ngraph::element::f32) {
+            return MakeNativeConversion(softmax_native,
+                                        node.input(0),
+                                        node.output(0),
+                                        outer,
+                                        shape[axis],
+                                        inner);
+        }
+        if (node.get_input_element_type(0) == ngraph::element::f16) {
+            return MakeNativeConversion(softmax_lut_native,
+                                        node.input(0),
+                                        node.output(0),
+                                        ActivationLut::Get("exp", [] (float x) { return std::exp(x); }),
+                                        outer,
+                                        shape[axis],
+                                        inner);
+        }
+    }
+    return MakeConversion<arm_compute::NESoftmaxLayer>(node.input(0),
+                                                       node.output(0),
+                                                       1.0f,
+                                                       static_cast<int32_t>(AxisCast(node.get_axis(), node.get_shape().size())));
 }
 } // namespace ArmPlugin
@@ -2,35 +2,111 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <cstring>
+#include <vector>
+
 #include <arm_compute/runtime/NEON/functions/NESpaceToBatchLayer.h>
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+// Blocked-copy SpaceToBatch for the shapes NESpaceToBatchLayer rejects
+// (batch/channel padding, rank != 4, block on N/C): output rows are filled
+// in parallel, rows that fall entirely into the padding are one memset, and
+// an unblocked innermost axis is a memcpy between zeroed edges.
+template <typename T>
+void space_to_batch_native(const T* input,
+                           T* output,
+                           const ngraph::Shape& in_shape,
+                           const ngraph::Shape& out_shape,
+                           const std::vector<std::size_t>& block,
+                           const std::vector<std::size_t>& pads_begin) {
+    const auto rank = in_shape.size();
+    const auto in_batch = in_shape[0];
+    std::vector<std::size_t> in_strides(rank);
+    std::size_t in_stride = 1;
+    for (auto i = rank; i-- > 0;) {
+        in_strides[i] = in_stride;
+        in_stride *= in_shape[i];
+    }
+    const auto row_elems = out_shape[rank - 1];
+    const auto rows = ngraph::shape_size(out_shape) / row_elems;
+    InferenceEngine::parallel_for(rows, [&] (std::size_t row) {
+        auto remainder = row;
+        std::vector<std::size_t> coords(rank - 1);
+        for (auto i = rank - 1; i-- > 0;) {
+            coords[i] = remainder % out_shape[i];
+            remainder /= out_shape[i];
+        }
+        // The output batch folds the input batch with the block-flat index;
+        // unfold the per-dim block residues back out of it
+        auto block_flat = coords[0] / in_batch;
+        std::vector<std::size_t> residues(rank);
+        for (auto i = rank; i-- > 1;) {
+            residues[i] = block_flat % block[i];
+            block_flat /= block[i];
+        }
+        T* dst = output + row * row_elems;
+        std::size_t src = (coords[0] % in_batch) * in_strides[0];
+        bool outside = false;
+        for (std::size_t i = 1; i + 1 < rank; ++i) {
+            const auto spread = coords[i] * block[i] + residues[i];
+            outside |= (spread < pads_begin[i]) || (spread - pads_begin[i] >= in_shape[i]);
+            src += outside ? 0 : (spread - pads_begin[i]) * in_strides[i];
+        }
+        if (outside) {
+            std::memset(dst, 0, row_elems * sizeof(T));
+            return;
+        }
+        if (block[rank - 1] == 1) {
+            // One contiguous input run between zero-padded edges
+            const auto head_elems = std::min(pads_begin[rank - 1], row_elems);
+            std::memset(dst, 0, head_elems * sizeof(T));
+            const auto body_elems = std::min(row_elems - head_elems, in_shape[rank - 1]);
+            std::memcpy(dst + head_elems, input + src, body_elems * sizeof(T));
+            std::memset(dst + head_elems + body_elems, 0, (row_elems - head_elems - body_elems) * sizeof(T));
+            return;
+        }
+        for (std::size_t o = 0; o < row_elems; ++o) {
+            const auto spread = o * block[rank - 1] + residues[rank - 1];
+            const bool pad = (spread < pads_begin[rank - 1]) || (spread - pads_begin[rank - 1] >= in_shape[rank - 1]);
+            dst[o] = pad ? T(0) : input[src + spread - pads_begin[rank - 1]];
+        }
+    });
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::SpaceToBatch& node) {
     auto block_shape = safe_cast<opset::Constant>(node.input_value(1).get_node_shared_ptr());
     auto pads_begin = safe_cast<opset::Constant>(node.input_value(2).get_node_shared_ptr());
     auto pads_end   = safe_cast<opset::Constant>(node.input_value(3).get_node_shared_ptr());
 
-    if (node.get_input_shape(0).size() != 4) {
-        IE_THROW() << "Unsupported SpaceToBatch with num dimensions != 4";
-    }
-
     auto begin  = pads_begin->cast_vector<int>();
     auto end    = pads_end->cast_vector<int>();
     auto shapes = block_shape->cast_vector<int32_t>();
 
-    if (begin[0] != 0 || begin[1] != 0 || end[0] != 0 || end[1] != 0) {
-        IE_THROW() << "Unsupported SpaceToBatch op with non-zero paddings for batch or channels";
-    }
-
-    if (shapes[0] != 1 || shapes[1] != 1) {
-        IE_THROW() << "Unsupported SpaceToBatch op with shapes != 1 for batch or channels";
+    const bool acl_supported = (node.get_input_shape(0).size() == 4) &&
+        (begin[0] == 0) && (begin[1] == 0) && (end[0] == 0) && (end[1] == 0) &&
+        (shapes[0] == 1) && (shapes[1] == 1);
+    if (acl_supported) {
+        int32_t block_shape_y = shapes[2];
+        int32_t block_shape_x = shapes[3];
+        arm_compute::Size2D padding_left(begin[3], begin[2]);
+        arm_compute::Size2D padding_right(end[3], end[2]);
+        return MakeConversion<arm_compute::NESpaceToBatchLayer>(node.input(0), block_shape_x, block_shape_y, padding_left, padding_right, node.output(0));
     }
-    int32_t block_shape_y = shapes[2];
-    int32_t block_shape_x = shapes[3];
 
-    arm_compute::Size2D padding_left(begin[3], begin[2]);
-    arm_compute::Size2D padding_right(end[3], end[2]);
-    return MakeConversion<arm_compute::NESpaceToBatchLayer>(node.input(0), block_shape_x, block_shape_y, padding_left, padding_right, node.output(0));
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_output_shape(0),
+                                          std::vector<std::size_t>{shapes.begin(), shapes.end()},
+                                          std::vector<std::size_t>{begin.begin(), begin.end()});
+    };
+    return CallSwitch(
+        AP_WRAP(make, space_to_batch_native),
+        node.get_input_element_type(0), allTypes);
 }
 } //  namespace ArmPlugin
@@ -2,19 +2,131 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <vector>
+
 #include <arm_compute/runtime/NEON/functions/NESpaceToDepthLayer.h>
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace ArmPlugin {
-template<> Converter::Conversion::Ptr Converter::Convert(const opset::SpaceToDepth& node) {
-    if (node.get_input_shape(0).size() > 4) {
-        IE_THROW() << "Unsupported DepthToSpace with num dimensions > 4";
+namespace {
+// De-interleaves one input row into block_size output runs
+// (run_r[i] = src[i * block_size + r]); f32 block 2 and 4 move whole NEON
+// registers through vld2q/vld4q, everything else takes the scalar loop
+template <typename T>
+void deinterleave_runs(const T* src, T* const* runs, std::size_t count, std::size_t block_size) {
+    for (std::size_t r = 0; r < block_size; ++r) {
+        T* dst = runs[r];
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i] = src[i * block_size + r];
+        }
     }
-    if (node.get_mode() != opset::SpaceToDepth::SpaceToDepthMode::BLOCKS_FIRST) {
-        IE_THROW() << "Unsupported DepthToSpace mode";
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+void deinterleave_runs(const float* src, float* const* runs, std::size_t count, std::size_t block_size) {
+    std::size_t i = 0;
+    if (block_size == 2) {
+        for (; i + 4 <= count; i += 4) {
+            const float32x4x2_t lanes = vld2q_f32(src + i * 2);
+            vst1q_f32(runs[0] + i, lanes.val[0]);
+            vst1q_f32(runs[1] + i, lanes.val[1]);
+        }
+    } else if (block_size == 4) {
+        for (; i + 4 <= count; i += 4) {
+            const float32x4x4_t lanes = vld4q_f32(src + i * 4);
+            vst1q_f32(runs[0] + i, lanes.val[0]);
+            vst1q_f32(runs[1] + i, lanes.val[1]);
+            vst1q_f32(runs[2] + i, lanes.val[2]);
+            vst1q_f32(runs[3] + i, lanes.val[3]);
+        }
     }
+    for (std::size_t r = 0; r < block_size; ++r) {
+        for (std::size_t j = i; j < count; ++j) {
+            runs[r][j] = src[j * block_size + r];
+        }
+    }
+}
+#endif  // defined(__ARM_NEON) || defined(__ARM_NEON__)
+}  // namespace
 
-    int32_t block_shape = node.get_block_size();
-    return MakeConversion<arm_compute::NESpaceToDepthLayer>(node.input(0), node.output(0), block_shape);
+// Native SpaceToDepth for the DEPTH_FIRST mode NESpaceToDepthLayer lacks
+// (and 5D inputs): each input row de-interleaves into block_size output
+// rows, one per innermost block residue, landing in channels picked by the
+// mode's channel composition. Row groups go parallel over the IE thread
+// pool and the de-interleave moves NEON registers for f32.
+template <typename T>
+void space_to_depth_native(const T* input,
+                           T* output,
+                           const ngraph::Shape& in_shape,
+                           const ngraph::Shape& out_shape,
+                           std::size_t block_size,
+                           bool depth_first) {
+    const auto rank = in_shape.size();
+    const auto in_channels = in_shape[1];
+    std::size_t block_flat_size = 1;
+    for (std::size_t i = 2; i < rank; ++i) {
+        block_flat_size *= block_size;
+    }
+    std::vector<std::size_t> out_strides(rank);
+    std::size_t stride = 1;
+    for (auto i = rank; i-- > 0;) {
+        out_strides[i] = stride;
+        stride *= out_shape[i];
+    }
+    // One group per input row: everything is fixed but the innermost block
+    // residue, whose block_size output rows are produced together
+    const auto row_elems = in_shape[rank - 1];
+    const auto groups = ngraph::shape_size(in_shape) / row_elems;
+    InferenceEngine::parallel_for(groups, [&] (std::size_t group) {
+        auto remainder = group;
+        std::vector<std::size_t> coords(rank - 1);
+        for (auto i = rank - 1; i-- > 0;) {
+            coords[i] = remainder % in_shape[i];
+            remainder /= in_shape[i];
+        }
+        std::size_t spatial_offset = 0;
+        std::size_t leading_flat = 0;
+        for (std::size_t i = 2; i < rank - 1; ++i) {
+            spatial_offset += (coords[i] / block_size) * out_strides[i];
+            leading_flat = leading_flat * block_size + coords[i] % block_size;
+        }
+        std::vector<T*> runs(block_size);
+        for (std::size_t r = 0; r < block_size; ++r) {
+            const auto flat = leading_flat * block_size + r;
+            const auto channel = depth_first ? coords[1] * block_flat_size + flat
+                                             : flat * in_channels + coords[1];
+            runs[r] = output + coords[0] * out_strides[0] + channel * out_strides[1] + spatial_offset;
+        }
+        deinterleave_runs(input + group * row_elems, runs.data(), out_shape[rank - 1], block_size);
+    });
+}
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::SpaceToDepth& node) {
+    if ((node.get_input_shape(0).size() <= 4) &&
+        (node.get_mode() == opset::SpaceToDepth::SpaceToDepthMode::BLOCKS_FIRST)) {
+        int32_t block_shape = node.get_block_size();
+        return MakeConversion<arm_compute::NESpaceToDepthLayer>(node.input(0), node.output(0), block_shape);
+    }
+    if (node.get_input_shape(0).size() > 5) {
+        IE_THROW() << "Unsupported SpaceToDepth with num dimensions > 5";
+    }
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_output_shape(0),
+                                          static_cast<std::size_t>(node.get_block_size()),
+                                          node.get_mode() == opset::SpaceToDepth::SpaceToDepthMode::DEPTH_FIRST);
+    };
+    return CallSwitch(
+        AP_WRAP(make, space_to_depth_native),
+        node.get_input_element_type(0), allTypes);
 }
 } //  namespace ArmPlugin
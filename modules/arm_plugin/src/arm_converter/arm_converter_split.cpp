@@ -27,6 +27,11 @@ static void wrap_split(T* in,
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::Split& node) {
+    if (_mergedSplits.count(&node) != 0) {
+        // Consumers read sub-region views of the input tensor (see the split
+        // placement pass in the Converter constructor); nothing runs here
+        return {};
+    }
     auto make = [&] (auto refFunction) {
         auto axis = static_cast<std::int64_t>(safe_cast<opset::Constant>(node.input_value(1).get_node())->cast_vector<std::int32_t>()[0]);
         return this->MakeConversion(refFunction,
@@ -44,6 +49,9 @@ template<> Converter::Conversion::Ptr Converter::Convert(const opset::Split& nod
 }
 
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmSplit& node) {
+    if (_mergedSplits.count(&node) != 0) {
+        return {};
+    }
     size_t numDimensions = node.get_output_shape(0).size();
     int axis = safe_cast<opset::Constant>(
         node.input_value(1).get_node())->cast_vector<std::int32_t>()[0];
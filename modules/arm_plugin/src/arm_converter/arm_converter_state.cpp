@@ -0,0 +1,130 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <ie_ngraph_utils.hpp>
+
+#include "arm_converter/arm_converter.hpp"
+
+namespace ArmPlugin {
+// Reads the persistent state tensor of a variable. The output tensor is
+// excluded from the activation pool (see Converter::Configure), so it holds
+// the state across inferences and consumers read it with no extra copy; the
+// only work at run time is seeding it from the init input on the first
+// inference after a reset.
+struct NEReadValueLayer final: public arm_compute::IFunction {
+public:
+    NEReadValueLayer(): _input(nullptr), _output(nullptr), _state() {}
+    NEReadValueLayer(const NEReadValueLayer &) = delete;
+    NEReadValueLayer &operator=(const NEReadValueLayer &) = delete;
+    NEReadValueLayer(NEReadValueLayer &&) = delete;
+    NEReadValueLayer &operator=(NEReadValueLayer &&) = delete;
+    ~NEReadValueLayer() = default;
+    void configure(const arm_compute::ITensor *input, arm_compute::ITensor *output, const VariableState::Ptr &state) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+        ARM_COMPUTE_ERROR_THROW_ON(NEReadValueLayer::validate(input->info(), output->info(), state));
+        _input = input;
+        _output = output;
+        _state = state;
+        if (_state->_tensor != output) {
+            // A reconfiguration (e.g. Reshape) moved the state to a new
+            // tensor; the old value is gone, reseed on the next run
+            _state->_tensor = output;
+            _state->_initialized = false;
+        }
+    }
+    static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const arm_compute::ITensorInfo *output,
+                                        const VariableState::Ptr &state) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(state == nullptr);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() != output->data_type());
+        ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape() != output->tensor_shape());
+        return arm_compute::Status{};
+    }
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(!_state.get(), "Kernel didn't configured");
+        if (!_state->_initialized) {
+            _output->copy_from(*_input);
+            _state->_initialized = true;
+        }
+    }
+
+protected:
+    const arm_compute::ITensor *_input;
+    arm_compute::ITensor       *_output;
+    VariableState::Ptr          _state;
+};
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::ReadValue& node) {
+    if (_variableStates == nullptr) {
+        IE_THROW() << "Arm Plugin: stateful operation " << node.get_friendly_name()
+                   << " is not supported in this graph";
+    }
+    auto& state = (*_variableStates)[node.get_variable_id()];
+    if (state == nullptr) {
+        auto output = node.output(0);
+        state = std::make_shared<VariableState>();
+        state->_name = node.get_variable_id();
+        state->_desc = InferenceEngine::TensorDesc{
+            InferenceEngine::details::convertPrecision(output.get_element_type()),
+            output.get_shape(),
+            InferenceEngine::TensorDesc::getLayoutByDims(output.get_shape())};
+    }
+    return MakeConversion<NEReadValueLayer>(node.input(0), node.output(0), state);
+}
+
+// Writes the next value of a variable into its persistent state tensor. The
+// Converter orders this after every other reader of the matching ReadValue
+// output (control dependencies), so it is the single copy a state costs per
+// inference; when an optimization already produced the value in the state
+// tensor itself the copy is skipped.
+struct NEAssignLayer final: public arm_compute::IFunction {
+public:
+    NEAssignLayer(): _input(nullptr), _state() {}
+    NEAssignLayer(const NEAssignLayer &) = delete;
+    NEAssignLayer &operator=(const NEAssignLayer &) = delete;
+    NEAssignLayer(NEAssignLayer &&) = delete;
+    NEAssignLayer &operator=(NEAssignLayer &&) = delete;
+    ~NEAssignLayer() = default;
+    void configure(const arm_compute::ITensor *input, const VariableState::Ptr &state) {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+        ARM_COMPUTE_ERROR_THROW_ON(NEAssignLayer::validate(input->info(), state));
+        _input = input;
+        _state = state;
+    }
+    static arm_compute::Status validate(const arm_compute::ITensorInfo *input, const VariableState::Ptr &state) {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
+        ARM_COMPUTE_RETURN_ERROR_ON(state == nullptr);
+        return arm_compute::Status{};
+    }
+    void run() override {
+        ARM_COMPUTE_ERROR_ON_MSG(!_state.get(), "Kernel didn't configured");
+        ARM_COMPUTE_ERROR_ON_MSG(_state->_tensor == nullptr, "Variable state has no tensor");
+        if (_state->_tensor->buffer() != _input->buffer()) {
+            _state->_tensor->copy_from(*_input);
+        }
+        _state->_initialized = true;
+    }
+
+protected:
+    const arm_compute::ITensor *_input;
+    VariableState::Ptr          _state;
+};
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::Assign& node) {
+    if (_variableStates == nullptr) {
+        IE_THROW() << "Arm Plugin: stateful operation " << node.get_friendly_name()
+                   << " is not supported in this graph";
+    }
+    auto& state = (*_variableStates)[node.get_variable_id()];
+    if (state == nullptr) {
+        // The matching ReadValue was not converted yet; create the state from
+        // the assigned value, ReadValue only fills in its tensor
+        auto input = node.input_value(0);
+        state = std::make_shared<VariableState>();
+        state->_name = node.get_variable_id();
+        state->_desc = InferenceEngine::TensorDesc{
+            InferenceEngine::details::convertPrecision(input.get_element_type()),
+            input.get_shape(),
+            InferenceEngine::TensorDesc::getLayoutByDims(input.get_shape())};
+    }
+    return MakeConversion<NEAssignLayer>(node.input(0), state);
+}
+}  //  namespace ArmPlugin
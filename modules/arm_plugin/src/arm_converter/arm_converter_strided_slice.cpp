@@ -3,12 +3,69 @@
 
 
 
+#include <cstring>
+
 #include <arm_compute/runtime/NEON/functions/NEStridedSlice.h>
 #include <ngraph/runtime/reference/strided_slice.hpp>
+#include <ie_parallel.hpp>
 #include "ngraph/slice_plan.hpp"
 #include "arm_converter/arm_converter.hpp"
 
 namespace ArmPlugin {
+namespace {
+// Executes a precomputed slice plan as nested loops over the sliced dims
+// with a signed source stride per loop; negative strides come straight from
+// the plan's reversed axes. Trailing unit-stride dims collapse into one
+// memcpy block, and blocks run parallel over the IE pool
+template <typename T>
+void strided_slice_native(const T* input,
+                          T* output,
+                          std::int64_t offset,
+                          const std::vector<std::size_t>& out_dims,
+                          const std::vector<std::int64_t>& src_strides) {
+    auto dims = out_dims.size();
+    std::size_t inner = 1;
+    while ((dims > 0) && (src_strides[dims - 1] == static_cast<std::int64_t>(inner))) {
+        inner *= out_dims[dims - 1];
+        --dims;
+    }
+    if (dims == 0) {
+        std::memcpy(output, input + offset, inner * sizeof(T));
+        return;
+    }
+    std::size_t blocks = 1;
+    for (std::size_t d = 0; d < dims; ++d) {
+        blocks *= out_dims[d];
+    }
+    if ((inner == 1) && (dims > 1)) {
+        const auto inner_dim = out_dims[dims - 1];
+        const auto inner_stride = src_strides[dims - 1];
+        InferenceEngine::parallel_for(blocks / inner_dim, [&] (std::size_t block) {
+            auto remainder = block;
+            auto source = offset;
+            for (auto d = dims - 1; d-- > 0;) {
+                source += static_cast<std::int64_t>(remainder % out_dims[d]) * src_strides[d];
+                remainder /= out_dims[d];
+            }
+            T* dst = output + block * inner_dim;
+            for (std::size_t i = 0; i < inner_dim; ++i) {
+                dst[i] = input[source + static_cast<std::int64_t>(i) * inner_stride];
+            }
+        });
+        return;
+    }
+    InferenceEngine::parallel_for(blocks, [&] (std::size_t block) {
+        auto remainder = block;
+        auto source = offset;
+        for (auto d = dims; d-- > 0;) {
+            source += static_cast<std::int64_t>(remainder % out_dims[d]) * src_strides[d];
+            remainder /= out_dims[d];
+        }
+        std::memcpy(output + block * inner, input + source, inner * sizeof(T));
+    });
+}
+}  // namespace
+
 static ngraph::AxisSet convert_mask_to_axis_set(const std::vector<int64_t>& mask) {
     ngraph::AxisSet axis_set{};
     for (size_t i = 0; i < mask.size(); ++i) {
@@ -56,6 +113,57 @@ void wrap_strided_slice(const T* arg,
 }
 
 template <> Converter::Conversion::Ptr Converter::Convert(const opset::StridedSlice& node) {
+    auto begin_node  = std::dynamic_pointer_cast<opset::Constant>(node.input_value(1).get_node_shared_ptr());
+    auto end_node    = std::dynamic_pointer_cast<opset::Constant>(node.input_value(2).get_node_shared_ptr());
+    auto stride_node = std::dynamic_pointer_cast<opset::Constant>(node.input_value(3).get_node_shared_ptr());
+    auto no_mask = [] (const std::vector<int64_t>& mask) {
+        return std::all_of(mask.begin(), mask.end(), [] (int64_t bit) { return bit == 0; });
+    };
+    // Constant slices without rank-changing masks (the reshape after the
+    // slice is what the ConvertStridedSlice transform produces for those)
+    // get a plan resolved at convert time instead of the reference path
+    if (begin_node && end_node && stride_node &&
+        no_mask(node.get_new_axis_mask()) && no_mask(node.get_shrink_axis_mask()) && no_mask(node.get_ellipsis_mask())) {
+        const auto& in_shape = node.get_input_shape(0);
+        const auto plan = ngraph::make_slice_plan(in_shape,
+                                                  begin_node->cast_vector<int64_t>(),
+                                                  end_node->cast_vector<int64_t>(),
+                                                  stride_node->cast_vector<int64_t>(),
+                                                  convert_mask_to_axis_set(node.get_begin_mask()),
+                                                  convert_mask_to_axis_set(node.get_end_mask()),
+                                                  {}, {}, {});
+        const auto rank = in_shape.size();
+        std::vector<std::size_t> in_strides(rank, 1);
+        for (auto d = rank - 1; d > 0; --d) {
+            in_strides[d - 1] = in_strides[d] * in_shape[d];
+        }
+        std::vector<std::size_t> out_dims(plan.reshape_in_shape.begin(), plan.reshape_in_shape.end());
+        std::vector<std::int64_t> src_strides(rank);
+        std::int64_t offset = 0;
+        for (std::size_t d = 0; d < rank; ++d) {
+            const auto stride = plan.strides[d];
+            const auto in_stride = static_cast<std::int64_t>(in_strides[d]);
+            if (plan.reverse_axes.count(d)) {
+                offset += (plan.begins[d] + (static_cast<std::int64_t>(out_dims[d]) - 1) * stride) * in_stride;
+                src_strides[d] = -stride * in_stride;
+            } else {
+                offset += plan.begins[d] * in_stride;
+                src_strides[d] = stride * in_stride;
+            }
+        }
+        auto make = [&] (auto nativeFunction) {
+            return this->MakeNativeConversion(nativeFunction,
+                                              node.input(0),
+                                              node.output(0),
+                                              offset,
+                                              out_dims,
+                                              src_strides);
+        };
+        return CallSwitch(
+            AP_WRAP(make, strided_slice_native),
+            node.get_input_element_type(0), allTypes);
+    }
+
     auto make = [&] (auto refFunction) {
         return this->MakeConversion(refFunction,
                                     node.input(0),
@@ -0,0 +1,172 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <cstring>
+#include <vector>
+
+#include "arm_converter/arm_converter.hpp"
+
+namespace ArmPlugin {
+namespace {
+// Byte-level slice copy along one axis: moves part_size steps of the axis
+// between an outer tensor and a body tensor, in either direction
+void copy_axis_slice(const char* src, char* dst,
+                     std::size_t before, std::size_t axis_dim, std::size_t part_size,
+                     std::size_t offset, std::size_t block_bytes, bool to_body) {
+    for (std::size_t b = 0; b < before; ++b) {
+        const auto outer = (b * axis_dim + offset) * block_bytes;
+        const auto inner = b * part_size * block_bytes;
+        if (to_body) {
+            std::memcpy(dst + inner, src + outer, part_size * block_bytes);
+        } else {
+            std::memcpy(dst + outer, src + inner, part_size * block_bytes);
+        }
+    }
+}
+
+// Executes a TensorIterator that survived the sequence-op conversions. The
+// body function and every body-side HostTensor are set up once when the
+// node is converted; iterations reuse them with no allocation, back-edge
+// state stays in place by swapping the parameter and result tensors of a
+// merged pair, and only the per-iteration input/output slices are copied.
+struct TensorIteratorExecutor {
+    struct Slice {
+        std::size_t _port;
+        std::size_t _index;
+        std::int64_t _start;
+        std::int64_t _stride;
+        std::size_t _partSize;
+        std::size_t _before;
+        std::size_t _axisDim;
+        std::size_t _blockBytes;
+    };
+    struct Copy {
+        std::size_t _port;
+        std::size_t _index;
+        std::size_t _bytes;
+    };
+    struct Merged {
+        std::size_t _port;
+        std::size_t _param;
+        std::size_t _result;
+        std::size_t _bytes;
+    };
+
+    explicit TensorIteratorExecutor(const opset::TensorIterator& node) :
+        _body{node.get_function()},
+        _iterations{node.get_num_iterations()} {
+        for (auto&& parameter : _body->get_parameters()) {
+            _params.push_back(std::make_shared<ngraph::HostTensor>(parameter->get_element_type(), parameter->get_shape()));
+        }
+        for (auto&& result : _body->get_results()) {
+            _results.push_back(std::make_shared<ngraph::HostTensor>(result->get_element_type(), result->get_input_shape(0)));
+        }
+        for (auto&& description : node.get_input_descriptions()) {
+            if (auto slice = std::dynamic_pointer_cast<opset::TensorIterator::SliceInputDescription>(description)) {
+                _inputSlices.push_back(MakeSlice(slice->m_input_index, slice->m_body_parameter_index,
+                                                 node.get_input_shape(slice->m_input_index),
+                                                 slice->m_start, slice->m_stride, slice->m_part_size, slice->m_axis,
+                                                 node.get_input_element_type(slice->m_input_index).size()));
+            } else if (auto merged = std::dynamic_pointer_cast<opset::TensorIterator::MergedInputDescription>(description)) {
+                _merged.push_back({merged->m_input_index, merged->m_body_parameter_index, merged->m_body_value_index,
+                                   ngraph::shape_size(node.get_input_shape(merged->m_input_index)) *
+                                   node.get_input_element_type(merged->m_input_index).size()});
+            } else if (auto invariant = std::dynamic_pointer_cast<opset::TensorIterator::InvariantInputDescription>(description)) {
+                _invariants.push_back({invariant->m_input_index, invariant->m_body_parameter_index,
+                                       ngraph::shape_size(node.get_input_shape(invariant->m_input_index)) *
+                                       node.get_input_element_type(invariant->m_input_index).size()});
+            }
+        }
+        for (auto&& description : node.get_output_descriptions()) {
+            if (auto concat = std::dynamic_pointer_cast<opset::TensorIterator::ConcatOutputDescription>(description)) {
+                _outputSlices.push_back(MakeSlice(concat->m_output_index, concat->m_body_value_index,
+                                                  node.get_output_shape(concat->m_output_index),
+                                                  concat->m_start, concat->m_stride, concat->m_part_size, concat->m_axis,
+                                                  node.get_output_element_type(concat->m_output_index).size()));
+            } else if (auto body = std::dynamic_pointer_cast<opset::TensorIterator::BodyOutputDescription>(description)) {
+                _finals.push_back({body->m_output_index, body->m_body_value_index,
+                                   ngraph::shape_size(node.get_output_shape(body->m_output_index)) *
+                                   node.get_output_element_type(body->m_output_index).size()});
+            }
+        }
+    }
+
+    static Slice MakeSlice(std::size_t port, std::size_t index, const ngraph::Shape& outer_shape,
+                           std::int64_t start, std::int64_t stride, std::int64_t part_size, std::int64_t axis,
+                           std::size_t elem_size) {
+        Slice slice{port, index, start, stride, static_cast<std::size_t>(part_size), 1, outer_shape[axis], elem_size};
+        for (std::int64_t i = 0; i < axis; ++i) {
+            slice._before *= outer_shape[i];
+        }
+        for (auto i = static_cast<std::size_t>(axis) + 1; i < outer_shape.size(); ++i) {
+            slice._blockBytes *= outer_shape[i];
+        }
+        return slice;
+    }
+
+    std::size_t SliceOffset(const Slice& slice, std::int64_t iteration) const {
+        auto offset = slice._start + iteration * slice._stride;
+        if (offset < 0) {
+            offset += static_cast<std::int64_t>(slice._axisDim);
+        }
+        return static_cast<std::size_t>(offset);
+    }
+
+    void operator()(const std::vector<Argument<Tensor*>>& inputs,
+                    std::vector<Argument<Tensor*>>& outputs) {
+        for (auto&& invariant : _invariants) {
+            std::memcpy(_params[invariant._index]->get_data_ptr(),
+                        static_cast<const char*>(inputs[invariant._port]), invariant._bytes);
+        }
+        for (auto&& merged : _merged) {
+            std::memcpy(_params[merged._param]->get_data_ptr(),
+                        static_cast<const char*>(inputs[merged._port]), merged._bytes);
+        }
+        for (std::int64_t iteration = 0; iteration < _iterations; ++iteration) {
+            if (iteration != 0) {
+                // The last result becomes the next parameter without a copy
+                for (auto&& merged : _merged) {
+                    std::swap(_params[merged._param], _results[merged._result]);
+                }
+            }
+            for (auto&& slice : _inputSlices) {
+                copy_axis_slice(static_cast<const char*>(inputs[slice._port]),
+                                static_cast<char*>(_params[slice._index]->get_data_ptr()),
+                                slice._before, slice._axisDim, slice._partSize,
+                                SliceOffset(slice, iteration), slice._blockBytes, true);
+            }
+            _body->evaluate(_results, _params);
+            for (auto&& slice : _outputSlices) {
+                copy_axis_slice(static_cast<const char*>(_results[slice._index]->get_data_ptr()),
+                                static_cast<char*>(outputs[slice._port]),
+                                slice._before, slice._axisDim, slice._partSize,
+                                SliceOffset(slice, iteration), slice._blockBytes, false);
+            }
+        }
+        for (auto&& body_output : _finals) {
+            std::memcpy(static_cast<char*>(outputs[body_output._port]),
+                        _results[body_output._index]->get_data_ptr(), body_output._bytes);
+        }
+    }
+
+    std::shared_ptr<ngraph::Function> _body;
+    std::int64_t _iterations;
+    ngraph::HostTensorVector _params;
+    ngraph::HostTensorVector _results;
+    std::vector<Slice> _inputSlices;
+    std::vector<Slice> _outputSlices;
+    std::vector<Copy> _invariants;
+    std::vector<Merged> _merged;
+    std::vector<Copy> _finals;
+};
+}  // namespace
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::TensorIterator& node) {
+    if (node.get_num_iterations() < 0) {
+        IE_THROW() << "Unsupported TensorIterator with undefined iteration count";
+    }
+    return MakeNativeConversion(TensorIteratorExecutor{node}, node.inputs(), node.outputs());
+}
+
+}  //  namespace ArmPlugin
@@ -0,0 +1,62 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <cstring>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#include "arm_converter/arm_converter.hpp"
+
+namespace ArmPlugin {
+// Native Tile as parallel block copies: trailing axes with repeat 1 collapse
+// into one contiguous block shared by input and output, so every output tile
+// is a single memcpy whose source falls out of a modulo over the input dims.
+// Consecutive tile indices write consecutive output, keeping the store
+// stream sequential.
+template <typename T>
+void tile_native(const T* input, T* output, ngraph::Shape in_shape, const ngraph::Shape& out_shape) {
+    in_shape.insert(in_shape.begin(), out_shape.size() - in_shape.size(), 1);
+    std::size_t inner = 1;
+    auto dims = out_shape.size();
+    while ((dims > 0) && (in_shape[dims - 1] == out_shape[dims - 1])) {
+        inner *= in_shape[dims - 1];
+        --dims;
+    }
+    if (dims == 0) {
+        std::memcpy(output, input, inner * sizeof(T));
+        return;
+    }
+    std::vector<std::size_t> in_strides(dims);
+    std::size_t stride = 1;
+    for (auto i = dims; i-- > 0;) {
+        in_strides[i] = stride;
+        stride *= in_shape[i];
+    }
+    const auto tiles = ngraph::shape_size(out_shape) / inner;
+    InferenceEngine::parallel_for(tiles, [&] (std::size_t tile) {
+        auto remainder = tile;
+        std::size_t source = 0;
+        for (auto i = dims; i-- > 0;) {
+            source += (remainder % out_shape[i]) % in_shape[i] * in_strides[i];
+            remainder /= out_shape[i];
+        }
+        std::memcpy(output + tile * inner, input + source * inner, inner * sizeof(T));
+    });
+}
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::Tile& node) {
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_output_shape(0));
+    };
+    return CallSwitch(
+        AP_WRAP(make, tile_native),
+        node.get_input_element_type(0), allTypes);
+}
+
+}  //  namespace ArmPlugin
@@ -2,26 +2,217 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
 #include "arm_converter/arm_converter.hpp"
-#include <ngraph/runtime/reference/topk.hpp>
 
 namespace ArmPlugin {
+// Partial-selection TopK: the reference fully sorts the axis, this keeps only
+// k running winners per slice. Small k uses a sorted cache-resident insertion
+// buffer (one shift per beating candidate), large k a bounded heap with the
+// worst survivor at the front, so the cost is O(n log k) instead of
+// O(n log n). Slices along the non-topk axes are independent workloads over
+// the IE thread pool. Ties resolve to the lower index like the reference.
+template <typename T, typename U>
+void topk_native(const T* input,
+                 U* out_indices,
+                 T* out_values,
+                 const ngraph::Shape& input_shape,
+                 const ngraph::Shape& out_shape,
+                 size_t axis,
+                 size_t k,
+                 bool compute_max,
+                 ngraph::op::TopKSortType sort) {
+    const auto axis_dim = input_shape[axis];
+    std::size_t outer = 1;
+    for (std::size_t dim = 0; dim < axis; ++dim) {
+        outer *= input_shape[dim];
+    }
+    std::size_t inner = 1;
+    for (std::size_t dim = axis + 1; dim < input_shape.size(); ++dim) {
+        inner *= input_shape[dim];
+    }
+    struct Entry {
+        T value;
+        U index;
+    };
+    // True when lhs belongs before rhs in the result order
+    auto better = [compute_max] (const Entry& lhs, const Entry& rhs) {
+        if (lhs.value != rhs.value) {
+            return compute_max ? (rhs.value < lhs.value) : (lhs.value < rhs.value);
+        }
+        return lhs.index < rhs.index;
+    };
+    InferenceEngine::parallel_for2d(outer, inner, [&] (std::size_t o, std::size_t i) {
+        const T* src = input + o * axis_dim * inner + i;
+        std::vector<Entry> top;
+        top.reserve(k + 1);
+        if (k <= 16) {
+            for (std::size_t j = 0; j < axis_dim; ++j) {
+                Entry entry{src[j * inner], static_cast<U>(j)};
+                if ((top.size() == k) && !better(entry, top.back())) {
+                    continue;
+                }
+                top.insert(std::upper_bound(top.begin(), top.end(), entry, better), entry);
+                if (top.size() > k) {
+                    top.pop_back();
+                }
+            }
+        } else {
+            // Heap front is the worst survivor; a candidate only enters when
+            // it beats the front
+            for (std::size_t j = 0; j < axis_dim; ++j) {
+                Entry entry{src[j * inner], static_cast<U>(j)};
+                if (top.size() < k) {
+                    top.push_back(entry);
+                    std::push_heap(top.begin(), top.end(), better);
+                } else if (better(entry, top.front())) {
+                    std::pop_heap(top.begin(), top.end(), better);
+                    top.back() = entry;
+                    std::push_heap(top.begin(), top.end(), better);
+                }
+            }
+            std::sort(top.begin(), top.end(), better);
+        }
+        if (sort == ngraph::op::TopKSortType::SORT_INDICES) {
+            std::sort(top.begin(), top.end(), [] (const Entry& lhs, const Entry& rhs) {
+                return lhs.index < rhs.index;
+            });
+        }
+        U* dst_indices = out_indices + o * k * inner + i;
+        T* dst_values = out_values + o * k * inner + i;
+        for (std::size_t j = 0; j < top.size(); ++j) {
+            dst_values[j * inner] = top[j].value;
+            dst_indices[j * inner] = top[j].index;
+        }
+    });
+}
+
+// Fused Softmax -> TopK tail (ArmSoftmaxTopK): the winners are selected on
+// the raw logits with the same cache-resident insertion buffer as
+// topk_native - softmax is monotone, so the order carries over - and only
+// their k numerators are exponentiated. The denominator has to span the
+// whole axis (softmax normalizes over every class), but it folds into a
+// second streaming pass over the logits, so the full softmax tensor is
+// never written, re-read or sorted.
+template <typename T, typename U>
+void softmax_topk_native(const T* input,
+                         T* out_values,
+                         U* out_indices,
+                         const ngraph::Shape& input_shape,
+                         size_t axis,
+                         size_t k,
+                         ngraph::op::TopKSortType sort) {
+    const auto axis_dim = input_shape[axis];
+    std::size_t outer = 1;
+    for (std::size_t dim = 0; dim < axis; ++dim) {
+        outer *= input_shape[dim];
+    }
+    std::size_t inner = 1;
+    for (std::size_t dim = axis + 1; dim < input_shape.size(); ++dim) {
+        inner *= input_shape[dim];
+    }
+    struct Entry {
+        T value;
+        U index;
+    };
+    auto better = [] (const Entry& lhs, const Entry& rhs) {
+        if (lhs.value != rhs.value) {
+            return rhs.value < lhs.value;
+        }
+        return lhs.index < rhs.index;
+    };
+    InferenceEngine::parallel_for2d(outer, inner, [&] (std::size_t o, std::size_t i) {
+        const T* src = input + o * axis_dim * inner + i;
+        std::vector<Entry> top;
+        top.reserve(k + 1);
+        // Pass 1: running winners over the raw logits, exactly the
+        // partial-selection scheme of topk_native
+        if (k <= 16) {
+            for (std::size_t j = 0; j < axis_dim; ++j) {
+                Entry entry{src[j * inner], static_cast<U>(j)};
+                if ((top.size() == k) && !better(entry, top.back())) {
+                    continue;
+                }
+                top.insert(std::upper_bound(top.begin(), top.end(), entry, better), entry);
+                if (top.size() > k) {
+                    top.pop_back();
+                }
+            }
+        } else {
+            for (std::size_t j = 0; j < axis_dim; ++j) {
+                Entry entry{src[j * inner], static_cast<U>(j)};
+                if (top.size() < k) {
+                    top.push_back(entry);
+                    std::push_heap(top.begin(), top.end(), better);
+                } else if (better(entry, top.front())) {
+                    std::pop_heap(top.begin(), top.end(), better);
+                    top.back() = entry;
+                    std::push_heap(top.begin(), top.end(), better);
+                }
+            }
+            std::sort(top.begin(), top.end(), better);
+        }
+        // Pass 2: the softmax denominator, shifted by the best logit the
+        // selection already found
+        const float max = top.empty() ? 0.0f : static_cast<float>(top.front().value);
+        float sum = 0.0f;
+        for (std::size_t j = 0; j < axis_dim; ++j) {
+            sum += std::exp(static_cast<float>(src[j * inner]) - max);
+        }
+        const float scale = 1.0f / sum;
+        if (sort == ngraph::op::TopKSortType::SORT_INDICES) {
+            std::sort(top.begin(), top.end(), [] (const Entry& lhs, const Entry& rhs) {
+                return lhs.index < rhs.index;
+            });
+        }
+        U* dst_indices = out_indices + o * k * inner + i;
+        T* dst_values = out_values + o * k * inner + i;
+        for (std::size_t j = 0; j < top.size(); ++j) {
+            dst_values[j * inner] = T(std::exp(static_cast<float>(top[j].value) - max) * scale);
+            dst_indices[j * inner] = top[j].index;
+        }
+    });
+}
+
+template<> Converter::Conversion::Ptr Converter::Convert(const opset::ArmSoftmaxTopK& node) {
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(0),
+                                          node.output(1),
+                                          node.get_input_shape(0),
+                                          node.get_axis(),
+                                          node.get_k(),
+                                          node.get_sort_type());
+    };
+
+    return CallSwitch(
+        AP_WRAP(make, softmax_topk_native),
+        node.input(0), floatTypes,
+        node.get_index_element_type(), indexTypes);
+}
+
 template<> Converter::Conversion::Ptr Converter::Convert(const opset::TopK& node) {
-    auto make = [&] (auto refFunction) {
-        return this->MakeConversion(refFunction,
-                                    node.input(0),
-                                    node.output(1),
-                                    node.output(0),
-                                    node.get_input_shape(0),
-                                    node.get_output_shape(0),
-                                    static_cast<size_t>(node.get_axis()),
-                                    node.get_k(),
-                                    node.get_mode() == ngraph::op::TopKMode::MAX,
-                                    node.get_sort_type());
+    auto make = [&] (auto nativeFunction) {
+        return this->MakeNativeConversion(nativeFunction,
+                                          node.input(0),
+                                          node.output(1),
+                                          node.output(0),
+                                          node.get_input_shape(0),
+                                          node.get_output_shape(0),
+                                          static_cast<size_t>(node.get_axis()),
+                                          node.get_k(),
+                                          node.get_mode() == ngraph::op::TopKMode::MAX,
+                                          node.get_sort_type());
     };
 
     return CallSwitch(
-        AP_WRAP(make, ngraph::runtime::reference::topk),
+        AP_WRAP(make, topk_native),
         node.input(0), allTypes,
         node.get_index_element_type(),  indexTypes);
 }
@@ -0,0 +1,51 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_cost_model.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include <ie_common.h>
+
+using namespace ArmPlugin;
+
+CostModel::CostModel(const std::string& tablePath) {
+    if (tablePath.empty()) {
+        return;
+    }
+    std::ifstream file{tablePath};
+    if (!file) {
+        IE_THROW() << "Arm Plugin: Failed to open the cost model table " << tablePath;
+    }
+    // One "technique:shapeClass ratio" entry per line, '#' starts a comment
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.resize(comment);
+        }
+        std::istringstream entry{line};
+        std::string key;
+        float ratio;
+        if (entry >> key >> ratio) {
+            _table[key] = ratio;
+        }
+    }
+}
+
+const char* CostModel::ShapeClass(std::size_t elements) {
+    if (elements < (std::size_t{1} << 12)) {
+        return "small";
+    }
+    if (elements < (std::size_t{1} << 18)) {
+        return "medium";
+    }
+    return "large";
+}
+
+bool CostModel::Wins(const std::string& technique, std::size_t elements, bool heuristic) const {
+    auto it = _table.find(technique + ':' + ShapeClass(elements));
+    return (it != _table.end()) ? (it->second > 1.0f) : heuristic;
+}
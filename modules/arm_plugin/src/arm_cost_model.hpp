@@ -0,0 +1,34 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace ArmPlugin {
+
+// Per-SoC cost table consulted by shape-dependent transform decisions
+// (COST_MODEL_PATH). Decomposition passes used to fire on pattern match
+// alone, which is a loss on some targets - reduce-to-pooling, for one, can
+// run 2x slower than the straight reduction on little cores. The table maps
+// "technique:shapeClass" to the measured speedup of the transformed form
+// (original time over transformed, > 1 means the transform wins), typically
+// filled from armOpBenchmarks runs on the deployment SoC; techniques or
+// shape classes without an entry fall back to a built-in heuristic.
+struct CostModel {
+    explicit CostModel(const std::string& tablePath);
+    // True when `technique` should be applied to a workload of `elements`:
+    // the table answer when present, `heuristic` otherwise
+    bool Wins(const std::string& technique, std::size_t elements, bool heuristic) const;
+    // Log-bucketed workload class the table is keyed by:
+    // "small" (< 4K elements), "medium" (< 256K) or "large"
+    static const char* ShapeClass(std::size_t elements);
+
+private:
+    std::map<std::string, float> _table;
+};
+
+}  // namespace ArmPlugin
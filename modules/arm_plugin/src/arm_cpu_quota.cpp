@@ -0,0 +1,94 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "arm_cpu_quota.hpp"
+
+namespace ArmPlugin {
+namespace {
+// "0-3,5,8-9" -> 6; 0 when the file is absent or malformed
+int ParseCpuList(const std::string& path) {
+    std::ifstream file{path};
+    std::string list;
+    if (!file.is_open() || !std::getline(file, list) || list.empty()) {
+        return 0;
+    }
+    int cpus = 0;
+    std::istringstream ranges{list};
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        const auto dash = range.find('-');
+        try {
+            if (dash == std::string::npos) {
+                cpus += 1;
+            } else {
+                cpus += std::stoi(range.substr(dash + 1)) - std::stoi(range.substr(0, dash)) + 1;
+            }
+        } catch (...) {
+            return 0;
+        }
+    }
+    return cpus;
+}
+
+// Bandwidth quota as whole CPUs, rounded up ("2.5 CPUs" must still run 3
+// workers or the third core's worth of quota goes unused); 0 means unlimited
+int QuotaCpus(const long long quota, const long long period) {
+    if (quota <= 0 || period <= 0) {
+        return 0;
+    }
+    return static_cast<int>((quota + period - 1) / period);
+}
+
+int DetectLimit() {
+    int limit = 0;
+    auto tighten = [&] (int candidate) {
+        if (candidate > 0) {
+            limit = (limit == 0) ? candidate : std::min(limit, candidate);
+        }
+    };
+    // cgroup v2: one line "max 100000" or "<quota_us> <period_us>"
+    {
+        std::ifstream file{"/sys/fs/cgroup/cpu.max"};
+        std::string quota;
+        long long period = 0;
+        if (file.is_open() && (file >> quota >> period) && (quota != "max")) {
+            try {
+                tighten(QuotaCpus(std::stoll(quota), period));
+            } catch (...) {}
+        }
+    }
+    tighten(ParseCpuList("/sys/fs/cgroup/cpuset.cpus.effective"));
+    // cgroup v1
+    {
+        std::ifstream quotaFile{"/sys/fs/cgroup/cpu/cpu.cfs_quota_us"};
+        std::ifstream periodFile{"/sys/fs/cgroup/cpu/cpu.cfs_period_us"};
+        long long quota = 0;
+        long long period = 0;
+        if (quotaFile.is_open() && periodFile.is_open() && (quotaFile >> quota) && (periodFile >> period)) {
+            tighten(QuotaCpus(quota, period));
+        }
+    }
+    tighten(ParseCpuList("/sys/fs/cgroup/cpuset/cpuset.cpus"));
+    // An unconstrained cpuset lists every host CPU; only a limit actually
+    // below the host core count is a limit worth reporting
+    const auto hostCpus = static_cast<int>(std::thread::hardware_concurrency());
+    if (hostCpus > 0 && limit >= hostCpus) {
+        limit = 0;
+    }
+    return limit;
+}
+}  // namespace
+
+int CgroupLimitedCpus() {
+    static const int limit = DetectLimit();
+    return limit;
+}
+
+}  // namespace ArmPlugin
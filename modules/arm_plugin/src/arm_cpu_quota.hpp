@@ -0,0 +1,23 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace ArmPlugin {
+
+/**
+ * @brief Number of CPUs this process may actually use under the active cgroup
+ *        limits, or 0 when no limit below the host core count applies.
+ *
+ * Containers are routinely granted a CPU quota well below the host core count,
+ * but the standard affinity-based thread counts still report every host core
+ * and the resulting pools oversubscribe the quota. This reads the cgroup v2
+ * interface (cpu.max, cpuset.cpus.effective) with a v1 fallback
+ * (cpu/cpu.cfs_quota_us, cpuset/cpuset.cpus) and returns the tighter of the
+ * bandwidth and cpuset limits, rounded up to whole CPUs. Detection runs once;
+ * the result is cached for the process lifetime.
+ */
+int CgroupLimitedCpus();
+
+}  // namespace ArmPlugin
@@ -0,0 +1,94 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include <ie_parallel.hpp>
+
+#include <ngraph/shape.hpp>
+#include <ngraph/strides.hpp>
+#include <ngraph/coordinate_diff.hpp>
+
+namespace ArmPlugin {
+
+// Parallel 2D transposed convolution in the gather formulation shared by the
+// ConvolutionBackpropData and GroupConvolutionBackpropData converters: each
+// output pixel collects the input pixels that map onto it
+// (oh = ih * stride - pad_begin + kh * dilation), so output channels are
+// independent and spread over the IE thread pool without write conflicts.
+// The reference scatter loop this replaces runs the whole tensor on one core.
+// Weights keep the framework layout: [Cin, Cout, Kh, Kw], grouped
+// [G, Cin/G, Cout/G, Kh, Kw] (both index identically given groups).
+inline void deconvolution_native(const float* input,
+                                 const float* weights,
+                                 float* output,
+                                 const ngraph::Shape& inShape,
+                                 const ngraph::Shape& outShape,
+                                 const ngraph::Shape& kernelShape,
+                                 const ngraph::Strides& strides,
+                                 const ngraph::Strides& dilations,
+                                 const ngraph::CoordinateDiff& padsBegin,
+                                 const std::size_t groups) {
+    const std::size_t batches = inShape[0];
+    const std::size_t inChannels = inShape[1];
+    const std::size_t inHeight = inShape[2];
+    const std::size_t inWidth = inShape[3];
+    const std::size_t outChannels = outShape[1];
+    const std::size_t outHeight = outShape[2];
+    const std::size_t outWidth = outShape[3];
+    const std::size_t kernelHeight = kernelShape[0];
+    const std::size_t kernelWidth = kernelShape[1];
+    const std::size_t inPerGroup = inChannels / groups;
+    const std::size_t outPerGroup = outChannels / groups;
+    const std::ptrdiff_t padH = padsBegin[0];
+    const std::ptrdiff_t padW = padsBegin[1];
+    const std::ptrdiff_t strideH = strides[0];
+    const std::ptrdiff_t strideW = strides[1];
+    const std::ptrdiff_t dilationH = dilations[0];
+    const std::ptrdiff_t dilationW = dilations[1];
+
+    InferenceEngine::parallel_for(batches * outChannels, [&] (std::size_t job) {
+        const std::size_t batch = job / outChannels;
+        const std::size_t group = (job % outChannels) / outPerGroup;
+        const std::size_t outChannel = (job % outChannels) % outPerGroup;
+        float* dst = output + job * outHeight * outWidth;
+        const float* srcGroup = input + (batch * inChannels + group * inPerGroup) * inHeight * inWidth;
+        const float* weightsGroup = weights + group * inPerGroup * outPerGroup * kernelHeight * kernelWidth;
+        for (std::size_t oh = 0; oh < outHeight; ++oh) {
+            for (std::size_t ow = 0; ow < outWidth; ++ow) {
+                float accumulator = 0.0f;
+                for (std::size_t kh = 0; kh < kernelHeight; ++kh) {
+                    const std::ptrdiff_t mappedH = static_cast<std::ptrdiff_t>(oh) + padH - static_cast<std::ptrdiff_t>(kh) * dilationH;
+                    if ((mappedH < 0) || (mappedH % strideH != 0)) {
+                        continue;
+                    }
+                    const std::ptrdiff_t ih = mappedH / strideH;
+                    if (ih >= static_cast<std::ptrdiff_t>(inHeight)) {
+                        continue;
+                    }
+                    for (std::size_t kw = 0; kw < kernelWidth; ++kw) {
+                        const std::ptrdiff_t mappedW = static_cast<std::ptrdiff_t>(ow) + padW - static_cast<std::ptrdiff_t>(kw) * dilationW;
+                        if ((mappedW < 0) || (mappedW % strideW != 0)) {
+                            continue;
+                        }
+                        const std::ptrdiff_t iw = mappedW / strideW;
+                        if (iw >= static_cast<std::ptrdiff_t>(inWidth)) {
+                            continue;
+                        }
+                        const float* src = srcGroup + ih * inWidth + iw;
+                        const float* wgt = weightsGroup + (outChannel * kernelHeight + kh) * kernelWidth + kw;
+                        for (std::size_t inChannel = 0; inChannel < inPerGroup; ++inChannel) {
+                            accumulator += src[inChannel * inHeight * inWidth] *
+                                           wgt[inChannel * outPerGroup * kernelHeight * kernelWidth];
+                        }
+                    }
+                }
+                dst[oh * outWidth + ow] = accumulator;
+            }
+        }
+    });
+}
+}  // namespace ArmPlugin
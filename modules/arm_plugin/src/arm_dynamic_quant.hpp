@@ -0,0 +1,81 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+namespace neon {
+
+// Row-level primitives for the dynamic quantization path (see
+// NEDynamicQuantizedMatMul): per-inference activation range, symmetric int8
+// quantization and the int32 accumulator dequantization. Scalar fallbacks keep
+// the hosts without AArch64 NEON building; the hot loops are vectorized.
+
+inline float absolute_max(const float* src, std::size_t size) {
+    std::size_t i = 0;
+    float result = 0.f;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    float32x4_t vmax = vdupq_n_f32(0.f);
+    for (; i + 4 <= size; i += 4) {
+        vmax = vmaxq_f32(vmax, vabsq_f32(vld1q_f32(src + i)));
+    }
+    result = vmaxvq_f32(vmax);
+#endif
+    for (; i < size; ++i) {
+        result = std::max(result, std::fabs(src[i]));
+    }
+    return result;
+}
+
+inline void quantize_symmetric(const float* src, std::int8_t* dst, std::size_t size, float invScale) {
+    std::size_t i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    float32x4_t vinv = vdupq_n_f32(invScale);
+    for (; i + 16 <= size; i += 16) {
+        int32x4_t q0 = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(src + i +  0), vinv));
+        int32x4_t q1 = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(src + i +  4), vinv));
+        int32x4_t q2 = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(src + i +  8), vinv));
+        int32x4_t q3 = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(src + i + 12), vinv));
+        int16x8_t lo = vcombine_s16(vqmovn_s32(q0), vqmovn_s32(q1));
+        int16x8_t hi = vcombine_s16(vqmovn_s32(q2), vqmovn_s32(q3));
+        vst1q_s8(dst + i, vcombine_s8(vqmovn_s16(lo), vqmovn_s16(hi)));
+    }
+#endif
+    for (; i < size; ++i) {
+        auto q = std::lround(src[i] * invScale);
+        dst[i] = static_cast<std::int8_t>(std::max<long>(-128, std::min<long>(127, q)));
+    }
+}
+
+inline void dequantize_accumulators(const std::int32_t* src, const float* scales, const float* bias,
+                                    float* dst, std::size_t size) {
+    std::size_t i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    if (bias != nullptr) {
+        for (; i + 4 <= size; i += 4) {
+            float32x4_t v = vmulq_f32(vcvtq_f32_s32(vld1q_s32(src + i)), vld1q_f32(scales + i));
+            vst1q_f32(dst + i, vaddq_f32(v, vld1q_f32(bias + i)));
+        }
+    } else {
+        for (; i + 4 <= size; i += 4) {
+            vst1q_f32(dst + i, vmulq_f32(vcvtq_f32_s32(vld1q_s32(src + i)), vld1q_f32(scales + i)));
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        dst[i] = static_cast<float>(src[i]) * scales[i] + (bias != nullptr ? bias[i] : 0.f);
+    }
+}
+
+}  // namespace neon
+}  // namespace ArmPlugin
@@ -0,0 +1,88 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+namespace embedding {
+
+// Segment-reduction engine shared by the EmbeddingBag*/EmbeddingSegmentsSum
+// conversions: a bag is a weighted sum of table rows, and the variants only
+// differ in how they enumerate the rows per bag. The float row accumulators
+// are NEON, everything else takes the scalar loop.
+
+template<typename T>
+inline void AccumulateRow(const T* src, T* dst, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] += src[i];
+    }
+}
+
+template<typename T>
+inline void AccumulateRowWeighted(const T* src, T weight, T* dst, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] += weight * src[i];
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+inline void AccumulateRow(const float* src, float* dst, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        vst1q_f32(dst + i, vaddq_f32(vld1q_f32(dst + i), vld1q_f32(src + i)));
+    }
+    for (; i < size; ++i) {
+        dst[i] += src[i];
+    }
+}
+
+inline void AccumulateRowWeighted(const float* src, float weight, float* dst, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        vst1q_f32(dst + i, vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(src + i), weight));
+    }
+    for (; i < size; ++i) {
+        dst[i] += weight * src[i];
+    }
+}
+
+#endif  // defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+// Sums count table rows selected by indices into dst (which is zeroed first),
+// optionally scaled by per-row weights. The row prefetch entries ahead is
+// software-prefetched so the random table access overlaps the accumulation
+// of the current row.
+template<typename T, typename U>
+inline void SumRows(const T* table,
+                    std::size_t row_elems,
+                    const U* indices,
+                    const T* weights,
+                    std::size_t count,
+                    std::size_t prefetch,
+                    T* dst) {
+    for (std::size_t i = 0; i < row_elems; ++i) {
+        dst[i] = T(0);
+    }
+    for (std::size_t row = 0; row < count; ++row) {
+        if ((prefetch != 0) && (row + prefetch < count)) {
+            __builtin_prefetch(table + static_cast<std::size_t>(indices[row + prefetch]) * row_elems);
+        }
+        const T* src = table + static_cast<std::size_t>(indices[row]) * row_elems;
+        if (weights != nullptr) {
+            AccumulateRowWeighted(src, weights[row], dst, row_elems);
+        } else {
+            AccumulateRow(src, dst, row_elems);
+        }
+    }
+}
+
+}  //  namespace embedding
+}  //  namespace ArmPlugin
@@ -2,7 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
 #include <set>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+#include <sstream>
+#include <thread>
 #include <utility>
 #include <algorithm>
 #include <memory>
@@ -14,16 +20,85 @@
 #include <ie_ngraph_utils.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/serialize.hpp>
 #include <ie_icore.hpp>
 
+#include <arm_compute/runtime/Scheduler.h>
+
 #include "arm_plugin.hpp"
 #include "arm_executable_network.hpp"
+#include "arm_async_infer_request.hpp"
+#include "arm_conv_tuner.hpp"
 #include "arm_converter/arm_converter.hpp"
+#include "arm_cpu_quota.hpp"
+#include "arm_ie_scheduler.hpp"
+#include "arm_load_profile.hpp"
+#include "arm_metrics.hpp"
+#include "arm_shared_executor.hpp"
+#include "arm_trace.hpp"
+#include "arm_weight_codec.hpp"
 
 using namespace InferenceEngine;
 using namespace ArmPlugin;
 using namespace InferenceEngine::PluginConfigParams;
 
+void* ArmPlugin::FirstTouchAllocator::allocate(std::size_t size, std::size_t alignment) {
+#ifdef __linux__
+    constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+    if (_hugePages && (size >= hugePageSize)) {
+        auto mappedSize = (size + hugePageSize - 1) & ~(hugePageSize - 1);
+        auto mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mapped == MAP_FAILED) {
+            // No reserved hugetlb pages - take regular pages and ask the
+            // kernel to back them transparently
+            mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapped != MAP_FAILED) {
+                madvise(mapped, mappedSize, MADV_HUGEPAGE);
+            }
+        }
+        if (mapped != MAP_FAILED) {
+            std::memset(mapped, 0, size);
+            _allocatedBytes += size;
+            std::lock_guard<std::mutex> lock{_mappingsMutex};
+            _mappings.emplace(mapped, std::make_pair(mappedSize, size));
+            return mapped;
+        }
+    }
+#endif
+    auto ptr = Allocator::allocate(size, alignment);
+    if (ptr != nullptr) {
+        std::memset(ptr, 0, size);
+        _allocatedBytes += size;
+        std::lock_guard<std::mutex> lock{_mappingsMutex};
+        _heapSizes.emplace(ptr, size);
+    }
+    return ptr;
+}
+
+void ArmPlugin::FirstTouchAllocator::free(void* ptr) {
+    {
+        std::lock_guard<std::mutex> lock{_mappingsMutex};
+#ifdef __linux__
+        auto itMapping = _mappings.find(ptr);
+        if (itMapping != _mappings.end()) {
+            munmap(itMapping->first, itMapping->second.first);
+            _allocatedBytes -= itMapping->second.second;
+            _mappings.erase(itMapping);
+            return;
+        }
+#endif
+        auto itHeap = _heapSizes.find(ptr);
+        if (itHeap != _heapSizes.end()) {
+            _allocatedBytes -= itHeap->second;
+            _heapSizes.erase(itHeap);
+        }
+    }
+    Allocator::free(ptr);
+}
+
 ArmPlugin::ExecutableNetwork::ExecutableNetwork(const std::shared_ptr<const ngraph::Function>&  function,
                                                 const Configuration&                            cfg,
                                                 const ArmPlugin::Plugin::Ptr&                   plugin):
@@ -31,21 +106,691 @@ ArmPlugin::ExecutableNetwork::ExecutableNetwork(const std::shared_ptr<const ngra
     _function{function},
     _cfg{cfg},
     _plugin{plugin} {
+    _allocator._hugePages = _cfg._hugePages;
     InitExecutor();
+    // Recorded convolution method winners must be visible before the ACL
+    // functions are configured in InitGraph
+    if (!_cfg._convTuningPath.empty()) {
+        ConvMethodTuner::get().Load(_cfg._convTuningPath);
+    }
+    InitGraph();
+    if (_cfg._autoBatch > 1) {
+        InitBatchedGraph();
+    }
+    if (!_cfg._shapeBuckets.empty()) {
+        if (_cfg._autoBatch > 1) {
+            IE_THROW() << "SHAPE_BUCKETS is not supported together with AUTO_BATCH_SIZE";
+        }
+        InitShapeBuckets();
+    }
+    if (_cfg._modelBudgetMb > 0) {
+        // Constants below the streaming threshold are not worth paging out,
+        // so the budget does not account them either
+        for (auto&& node : _function->get_ordered_ops()) {
+            if (ngraph::op::is_constant(node)) {
+                const auto bytes = std::static_pointer_cast<ngraph::op::Constant>(node)->get_byte_size();
+                if (bytes >= WeightStreamer::MinStreamedBytes) {
+                    _weightBytes += bytes;
+                }
+            }
+        }
+        _plugin->_modelLifecycle.Register(this);
+    }
+}
+
+ArmPlugin::ExecutableNetwork::~ExecutableNetwork() {
+    if (_cfg._modelBudgetMb > 0) {
+        _plugin->_modelLifecycle.Unregister(this);
+    }
+    if (auto scheduler = dynamic_cast<IEScheduler*>(&arm_compute::Scheduler::get())) {
+        if (!_cfg._schedTuningPath.empty()) {
+            scheduler->StoreTuning(_cfg._schedTuningPath);
+        }
+        if (_cfg._schedTelemetry && !_cfg._schedTelemetryPath.empty()) {
+            scheduler->DumpTelemetryCsv(_cfg._schedTelemetryPath);
+        }
+    }
+    if (!_cfg._convTuningPath.empty()) {
+        ConvMethodTuner::get().Store(_cfg._convTuningPath);
+    }
+}
+
+void ArmPlugin::ExecutableNetwork::InitBatchedGraph() {
+    auto batched = ngraph::clone_function(*_function);
+    for (auto&& parameter : batched->get_parameters()) {
+        auto shape = parameter->get_partial_shape();
+        if (shape.rank().is_dynamic() || (shape.rank().get_length() < 1) ||
+            !shape[0].is_static() || (shape[0].get_length() != 1)) {
+            _cfg._autoBatch = 1;  // only static batch-1 models can be auto-batched
+            return;
+        }
+    }
+    for (auto&& parameter : batched->get_parameters()) {
+        auto shape = parameter->get_shape();
+        shape[0] = _cfg._autoBatch;
+        parameter->set_partial_shape(ngraph::PartialShape{shape});
+    }
+    batched->validate_nodes_and_infer_types();
+    _batchedLifetime = std::make_shared<arm_compute::OffsetLifetimeManager>();
+    _batchedPool = std::make_shared<arm_compute::PoolManager>();
+    _batchedMemoryManager = std::make_shared<arm_compute::MemoryManagerOnDemand>(_batchedLifetime, _batchedPool);
+    _batchedMemoryGroup = std::make_unique<arm_compute::MemoryGroup>(_batchedMemoryManager);
+    try {
+        _executor->runAndWait({
+            [&] {
+                _batchedLayers = Converter{batched, _cfg}.Configure(_batchedMemoryManager, *_batchedMemoryGroup);
+            }
+        });
+    } catch (...) {
+        // Some layer does not validate at batch N, keep single-image execution only
+        _batchedLayers.clear();
+        _cfg._autoBatch = 1;
+        return;
+    }
+    for (auto&& node : batched->get_parameters()) {
+        auto output = node->output(0);
+        auto tensor = _batchedLayers.at(node->get_instance_id())._outputs.at(output)._tensor.get();
+        if (tensor->info()->has_padding()) {
+            _batchedLayers.clear();
+            _cfg._autoBatch = 1;
+            return;
+        }
+        if (tensor->buffer() == nullptr) {
+            static_cast<arm_compute::Tensor*>(tensor)->allocator()->allocate();
+        }
+        _batchedInputs.emplace_back(BatchedIO{node->get_friendly_name(), tensor,
+                                              tensor->info()->total_size() / _cfg._autoBatch});
+    }
+    for (auto&& node : batched->get_results()) {
+        auto input = node->input(0);
+        auto tensor = _batchedLayers.at(node->get_instance_id())._inputs.at(input)->_tensor.get();
+        if (tensor->info()->has_padding()) {
+            _batchedLayers.clear();
+            _batchedInputs.clear();
+            _cfg._autoBatch = 1;
+            return;
+        }
+        if (tensor->buffer() == nullptr) {
+            static_cast<arm_compute::Tensor*>(tensor)->allocator()->allocate();
+        }
+        _batchedOutputs.emplace_back(BatchedIO{node->get_rt_info().at("ResultName").as<std::string>(), tensor,
+                                               tensor->info()->total_size() / _cfg._autoBatch});
+    }
+    _executor->runAndWait({
+        [&] {
+            _batchedMemoryManager->populate(_allocator, 1);
+        }
+    });
+    _batchedMemoryGroupScope = std::make_unique<arm_compute::MemoryGroupResourceScope>(*_batchedMemoryGroup);
+    if (!_cfg._lazyPrepare) {
+        _executor->runAndWait({
+            [&] {
+                for (auto&& layer : _batchedLayers) {
+                    if (layer._function != nullptr) {
+                        layer._function->prepare();
+                    }
+                }
+            }
+        });
+    }
+    _batchedFunction = batched;
+}
+
+std::shared_ptr<ArmPlugin::GraphContext>
+ArmPlugin::ExecutableNetwork::MakeGraphContext(const std::shared_ptr<const ngraph::Function>& function,
+                                               const std::shared_ptr<VariableStateMap>& variableStates,
+                                               const std::shared_ptr<AllocationLedger>& allocationLedger) {
+    auto context = std::make_shared<GraphContext>();
+    context->_function = function;
+#if 1
+    context->_lifetime = std::make_shared<arm_compute::OffsetLifetimeManager>();
+#else
+    context->_lifetime = std::make_shared<arm_compute::BlobLifetimeManager>();
+#endif
+    context->_pool = std::make_shared<arm_compute::PoolManager>();
+    context->_memoryManager = std::make_shared<arm_compute::MemoryManagerOnDemand>(context->_lifetime, context->_pool);
+    context->_memoryGroup = std::make_unique<arm_compute::MemoryGroup>(context->_memoryManager);
+    IE_ASSERT(_executor != nullptr);
+    _executor->runAndWait({
+        [&] {
+            context->_layers = Converter{function, _cfg, variableStates, allocationLedger}.Configure(context->_memoryManager,
+                                                                                                     *context->_memoryGroup);
+        }
+    });
+    // Populate on a stream worker so first touch lands on the node whose cores
+    // run this stream; the kernels scheduled through IEScheduler then stay local
+    _executor->runAndWait({
+        [&] {
+            context->_memoryManager->populate(_allocator, 1);
+        }
+    });
+    context->_memoryGroupScope = std::make_unique<arm_compute::MemoryGroupResourceScope>(*context->_memoryGroup);
+    // ACL functions reshape/interleave their weights on first prepare; doing it
+    // once at load time shares the transformed buffers read-only between the
+    // context's requests and keeps even the first inference on the fast path.
+    // Lazy mode leaves prepare to each function's first run() instead,
+    // amortizing load time across early inferences when many networks are
+    // loaded speculatively.
+    if (!_cfg._lazyPrepare) {
+        _executor->runAndWait({
+            [&] {
+                for (auto&& layer : context->_layers) {
+                    if (layer._function != nullptr) {
+                        layer._function->prepare();
+                    }
+                }
+            }
+        });
+    }
+    return context;
+}
+
+void ArmPlugin::ExecutableNetwork::InitGraph() {
+    _contexts.emplace_back(MakeGraphContext(_function, _variableStates, _allocationLedger));
+    // One more context per additional stream so streams actually execute
+    // concurrently instead of queueing on one tensor set: the clones share
+    // the constant payloads, so the per-context cost is an activation pool
+    // and the ACL-side packed weights. Stateful models keep a single context
+    // (their state tensors live in the primary configure) and so do
+    // weight-streamed ones (the streamer's cursors assume one serial layer
+    // walk at a time).
+    const int streams = std::max(1, _cfg._streamsExecutorConfig._streams);
+    if (_variableStates->empty() && !_cfg._weightStreaming) {
+        for (int stream = 1; stream < streams; ++stream) {
+            _contexts.emplace_back(MakeGraphContext(ngraph::clone_function(*_function), nullptr, nullptr));
+        }
+    }
+    // Per-stream core partitioning only pays off when several contexts can
+    // run at once; with a single context one graph runs at a time, and capping
+    // its kernels to a stream's core share would just idle the rest
+    if (_contexts.size() <= 1) {
+        _streamIntraThreads = 0;
+    }
+    if (_cfg._intraOpThreads > 0) {
+        arm_compute::Scheduler::get().set_num_threads(static_cast<unsigned int>(_cfg._intraOpThreads));
+    }
+    if (!_cfg._cgroupLimits) {
+        if (auto scheduler = dynamic_cast<IEScheduler*>(&arm_compute::Scheduler::get())) {
+            scheduler->SetQuotaAware(false);
+        }
+    }
+    if (!_cfg._schedTuningPath.empty()) {
+        if (auto scheduler = dynamic_cast<IEScheduler*>(&arm_compute::Scheduler::get())) {
+            scheduler->LoadTuning(_cfg._schedTuningPath);
+        }
+    }
+    if (_cfg._schedTelemetry) {
+        if (auto scheduler = dynamic_cast<IEScheduler*>(&arm_compute::Scheduler::get())) {
+            scheduler->EnableTelemetry(true);
+        }
+    }
+    // Like the scheduler, the trace recorder is process-wide: any load asking
+    // for a trace switches it on for everything running in the process
+    if (_cfg._execTrace) {
+        TraceRecorder::get().Enable(true);
+    }
+    // Weight streaming needs the serial order the per-request layer loop
+    // walks; the wavefront executor has no such order, so it opts out
+    if (_cfg._weightStreaming && !_cfg._wavefront) {
+        _weightStreamer = std::unique_ptr<WeightStreamer>{
+            new WeightStreamer{_function, static_cast<std::size_t>(_cfg._weightWindowMb) * 1024 * 1024}};
+    }
+    // Feed the process-wide metrics registry: the fleet-facing fallback-layer
+    // share aggregates over every network loaded in the process
+    std::uint64_t totalLayers = 0;
+    std::uint64_t referenceLayers = 0;
+    for (auto&& node : _function->get_ordered_ops()) {
+        if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node)) {
+            continue;
+        }
+        ++totalLayers;
+        const auto& execType = _contexts.front()->_layers.at(node->get_instance_id())._execType;
+        if ((execType.compare(0, 11, "Arm Compute") != 0) && (execType != "Native") && (execType != "Merged")) {
+            ++referenceLayers;
+        }
+    }
+    Metrics::get().AddLayerCounts(totalLayers, referenceLayers);
 }
 
 void ArmPlugin::ExecutableNetwork::InitExecutor() {
     if (_cfg._exclusiveAsyncRequests) {
         _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
+    } else if (_cfg._sharedExecutor) {
+        // Co-scheduled networks share one machine-wide executor; the handle
+        // caps this network's in-flight tasks to its weighted stream share
+        _taskExecutor = SharedExecutor::get().CreateHandle(_cfg._execWeight);
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg._streamsExecutorConfig);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
-        streamsExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::NONE;
+        // MakeDefaultMultiThreaded may pick its own binding; keep the one configured
+        // through CPU_BIND_THREAD (NONE unless the user asked otherwise)
+        streamsExecutorConfig._threadBindingType = _cfg._streamsExecutorConfig._threadBindingType;
+        // MakeDefaultMultiThreaded sizes streams against the host core count;
+        // inside a container that oversubscribes the cgroup CPU quota, so cap
+        // the total worker count by the detected limit. An explicit
+        // CPU_THREADS_NUM setting wins over the detection.
+        if (_cfg._cgroupLimits && (_cfg._streamsExecutorConfig._threads == 0)) {
+            const auto quota = CgroupLimitedCpus();
+            if ((quota > 0) && (streamsExecutorConfig._streams * streamsExecutorConfig._threadsPerStream > quota)) {
+                streamsExecutorConfig._streams = std::min(streamsExecutorConfig._streams, quota);
+                streamsExecutorConfig._threadsPerStream = std::max(1, quota / std::max(1, streamsExecutorConfig._streams));
+            }
+        }
+        // The ACL scheduler is a process-wide singleton, so with several streams
+        // each stream caps its kernels to its own share of the cores instead of
+        // every kernel's parallel_for spanning all of them
+        if (streamsExecutorConfig._streams > 1) {
+            _streamIntraThreads = std::max(1, streamsExecutorConfig._threadsPerStream);
+        }
         _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
     }
     _executor = _taskExecutor.get();
 }
 
+// "input:1,3,416,416;second:8,16" -> per-input static shapes
+static std::map<std::string, ngraph::PartialShape> ParseReshapeConfig(const std::string& value) {
+    std::map<std::string, ngraph::PartialShape> shapes;
+    std::istringstream inputs{value};
+    std::string token;
+    while (std::getline(inputs, token, ';')) {
+        const auto colon = token.find(':');
+        if (colon == std::string::npos) {
+            IE_THROW() << "Malformed RESHAPE value: " << token;
+        }
+        std::vector<ngraph::Dimension> dims;
+        std::istringstream dimStream{token.substr(colon + 1)};
+        std::string dim;
+        while (std::getline(dimStream, dim, ',')) {
+            dims.emplace_back(std::stoll(dim));
+        }
+        shapes.emplace(token.substr(0, colon), ngraph::PartialShape{dims});
+    }
+    return shapes;
+}
+
+void ArmPlugin::ExecutableNetwork::InitShapeBuckets() {
+    // One bucket per '|'-separated group, each group in the RESHAPE per-input
+    // format: "input:1,128|input:1,256" compiles two reduced-shape variants
+    std::istringstream groups{_cfg._shapeBuckets};
+    std::string group;
+    while (std::getline(groups, group, '|')) {
+        const auto shapes = ParseReshapeConfig(group);
+        // The clone shares the constants, so each bucket reuses the weights
+        // of the full-shape graph and only adds its own activation pool
+        auto bucketFunction = ngraph::clone_function(*_function);
+        for (auto&& parameter : bucketFunction->get_parameters()) {
+            auto itShape = shapes.find(parameter->get_friendly_name());
+            if (itShape == shapes.end()) {
+                continue;
+            }
+            if (!itShape->second.is_static()) {
+                IE_THROW() << "SHAPE_BUCKETS requires static shapes, got " << itShape->second
+                           << " for input " << parameter->get_friendly_name();
+            }
+            parameter->set_partial_shape(itShape->second);
+        }
+        bucketFunction->validate_nodes_and_infer_types();
+        ShapeBucket bucket;
+        bucket._lifetime = std::make_shared<arm_compute::OffsetLifetimeManager>();
+        bucket._pool = std::make_shared<arm_compute::PoolManager>();
+        bucket._memoryManager = std::make_shared<arm_compute::MemoryManagerOnDemand>(bucket._lifetime, bucket._pool);
+        bucket._memoryGroup = std::make_unique<arm_compute::MemoryGroup>(bucket._memoryManager);
+        _executor->runAndWait({
+            [&] {
+                bucket._layers = Converter{bucketFunction, _cfg}.Configure(bucket._memoryManager, *bucket._memoryGroup);
+            }
+        });
+        // The bucket path gathers/scatters raw dense memory; a bucket whose
+        // I/O tensors come out padded would need strided staging, so it is
+        // dropped and its shapes execute on the full-shape graph
+        bool padded = false;
+        for (auto&& node : bucketFunction->get_parameters()) {
+            auto output = node->output(0);
+            auto tensor = bucket._layers.at(node->get_instance_id())._outputs.at(output)._tensor.get();
+            if (tensor->info()->has_padding()) {
+                padded = true;
+                break;
+            }
+            if (tensor->buffer() == nullptr) {
+                static_cast<arm_compute::Tensor*>(tensor)->allocator()->allocate();
+            }
+            bucket._inputs.emplace_back(ShapeBucket::IO{node->get_friendly_name(), tensor, node->get_shape()});
+            bucket._volume += ngraph::shape_size(node->get_shape());
+        }
+        for (auto&& node : bucketFunction->get_results()) {
+            if (padded) {
+                break;
+            }
+            auto input = node->input(0);
+            auto tensor = bucket._layers.at(node->get_instance_id())._inputs.at(input)->_tensor.get();
+            if (tensor->info()->has_padding()) {
+                padded = true;
+                break;
+            }
+            if (tensor->buffer() == nullptr) {
+                static_cast<arm_compute::Tensor*>(tensor)->allocator()->allocate();
+            }
+            bucket._outputs.emplace_back(ShapeBucket::IO{node->get_rt_info().at("ResultName").as<std::string>(), tensor,
+                                                         node->get_input_shape(0)});
+        }
+        if (padded) {
+            continue;
+        }
+        _executor->runAndWait({
+            [&] {
+                bucket._memoryManager->populate(_allocator, 1);
+            }
+        });
+        bucket._memoryGroupScope = std::make_unique<arm_compute::MemoryGroupResourceScope>(*bucket._memoryGroup);
+        if (!_cfg._lazyPrepare) {
+            _executor->runAndWait({
+                [&] {
+                    for (auto&& layer : bucket._layers) {
+                        if (layer._function != nullptr) {
+                            layer._function->prepare();
+                        }
+                    }
+                }
+            });
+        }
+        bucket._function = bucketFunction;
+        _shapeBuckets.emplace_back(std::move(bucket));
+    }
+    // Smallest first, so routing's first fit is the cheapest variant
+    std::stable_sort(_shapeBuckets.begin(), _shapeBuckets.end(),
+                     [] (const ShapeBucket& a, const ShapeBucket& b) { return a._volume < b._volume; });
+}
+
+void ArmPlugin::ExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) {
+    for (auto&& item : config) {
+        if ("RESHAPE" == item.first) {
+            Reshape(ParseReshapeConfig(item.second.as<std::string>()));
+        } else if ("WARMUP" == item.first) {
+            WarmUp();
+        } else if ("REBIND" == item.first) {
+            Rebind();
+        } else if ("DUMP_TRACE" == item.first) {
+            TraceRecorder::get().Dump(item.second.as<std::string>());
+        } else if (CONFIG_KEY_INTERNAL(REQUEST_PRIORITY) == item.first) {
+            // Changes the class stamped on requests created from now on;
+            // existing requests keep the priority they were created with
+            const auto value = item.second.as<std::string>();
+            if ((value != "HIGH") && (value != "NORMAL")) {
+                IE_THROW() << "Unsupported request priority value: " << value;
+            }
+            _cfg._requestPriority = value;
+        } else {
+            IE_THROW(NotFound) << ": " << item.first;
+        }
+    }
+}
+
+void ArmPlugin::ExecutableNetwork::WarmUp() {
+    // One dry run per stream, dispatched through the streams executor so every
+    // stream worker is created and runs a full graph pass: thread stacks and
+    // scheduler queues get faulted, deferred LAZY_PREPARE weight packing
+    // happens now instead of under the first real request, and the activation
+    // pool plus per-request staging arenas are streamed through on the cores
+    // that will reuse them. The staging arenas come zero-initialized, so the
+    // dry pass runs on all-zero inputs and its outputs are simply discarded.
+    const int streams = std::max(1, _cfg._streamsExecutorConfig._streams);
+    std::vector<InferenceEngine::IInferRequestInternal::Ptr> requests;
+    std::vector<InferenceEngine::Task> tasks;
+    for (int stream = 0; stream < streams; ++stream) {
+        auto request = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+        tasks.emplace_back([request] {
+            std::static_pointer_cast<ArmInferRequest>(request)->InferImpl();
+        });
+        requests.emplace_back(std::move(request));
+    }
+    _executor->runAndWait(tasks);
+    // The dry pass seeded any variable states with zeros; drop them back to
+    // uninitialized so the first real inference re-seeds from its own data
+    for (auto&& state : *_variableStates) {
+        state.second->_initialized = false;
+    }
+}
+
+void ArmPlugin::ExecutableNetwork::Rebind() {
+    // Quiesce every context; restore hooks run before traffic resumes, so
+    // this does not contend with real inferences
+    MaintenanceLock lock{*this};
+    RepopulatePools();
+}
+
+void ArmPlugin::ExecutableNetwork::RepopulatePools() {
+    auto rebindPool = [this] (std::unique_ptr<arm_compute::MemoryGroupResourceScope>& scope,
+                              arm_compute::MemoryGroup* group,
+                              const std::shared_ptr<arm_compute::MemoryManagerOnDemand>& manager) {
+        if ((group == nullptr) || (manager == nullptr)) {
+            return;
+        }
+        // Release the pool from the group, drop any old slabs (stale base
+        // addresses after a restore, already freed after hibernation) and
+        // re-populate: the lifetime manager
+        // keeps the offset plan, so re-acquiring maps every managed tensor
+        // onto the fresh slab at its original offset. Pool contents are
+        // transient between runs, so nothing needs to be carried over.
+        scope.reset();
+        manager->clear();
+        _executor->runAndWait({
+            [&] {
+                manager->populate(_allocator, 1);
+            }
+        });
+        scope = std::make_unique<arm_compute::MemoryGroupResourceScope>(*group);
+    };
+    for (auto&& context : _contexts) {
+        rebindPool(context->_memoryGroupScope, context->_memoryGroup.get(), context->_memoryManager);
+        context->_imports.clear();
+    }
+    rebindPool(_batchedMemoryGroupScope, _batchedMemoryGroup.get(), _batchedMemoryManager);
+    for (auto&& bucket : _shapeBuckets) {
+        rebindPool(bucket._memoryGroupScope, bucket._memoryGroup.get(), bucket._memoryManager);
+    }
+    // Requests created before a reshape still execute retired generations
+    for (auto&& retired : _retiredContexts) {
+        rebindPool(retired->_memoryGroupScope, retired->_memoryGroup.get(), retired->_memoryManager);
+        retired->_imports.clear();
+    }
+    // Invalidate the user-buffer imports every request cached; each one
+    // re-imports its I/O on the next run (see ArmInferRequest::ExecuteImpl)
+    ++_bindGeneration;
+}
+
+std::size_t ArmPlugin::ExecutableNetwork::ActiveFootprint() const {
+    return _allocator._allocatedBytes + (_hibernated ? 0 : _weightBytes);
+}
+
+bool ArmPlugin::ExecutableNetwork::TryHibernate() {
+    // Claim maintenance exclusivity only if nothing runs right now; the
+    // caller sits in another network's admission path, so an inference is
+    // never waited on. A queued request already holds its run share while it
+    // waits for its context, so waiters block hibernation too.
+    {
+        std::lock_guard<std::mutex> lock{_stateMutex};
+        if (_exclusive || (_activeRuns != 0) || _hibernated) {
+            return false;
+        }
+        _exclusive = true;
+    }
+    // Rebind's release half without the re-populate: the lifetime managers
+    // keep their offset plans, only the slabs are handed back
+    auto releasePool = [] (std::unique_ptr<arm_compute::MemoryGroupResourceScope>& scope,
+                           const std::shared_ptr<arm_compute::MemoryManagerOnDemand>& manager) {
+        scope.reset();
+        if (manager != nullptr) {
+            manager->clear();
+        }
+    };
+    for (auto&& context : _contexts) {
+        releasePool(context->_memoryGroupScope, context->_memoryManager);
+    }
+    releasePool(_batchedMemoryGroupScope, _batchedMemoryManager);
+    for (auto&& bucket : _shapeBuckets) {
+        releasePool(bucket._memoryGroupScope, bucket._memoryManager);
+    }
+    for (auto&& retired : _retiredContexts) {
+        releasePool(retired->_memoryGroupScope, retired->_memoryManager);
+    }
+    // Weight payloads go back to their backing; the ACL-internal packed
+    // copies stay with the configured layers, which live infer requests pin
+    WeightStreamer::PageOutConstants(_function);
+    {
+        std::lock_guard<std::mutex> lock{_stateMutex};
+        _hibernated = true;
+        _exclusive = false;
+    }
+    _stateCv.notify_all();
+    return true;
+}
+
+void ArmPlugin::ExecutableNetwork::EnterRun() {
+    std::unique_lock<std::mutex> lock{_stateMutex};
+    _stateCv.wait(lock, [this] { return !_exclusive; });
+    if (_hibernated) {
+        // No run can be in flight while hibernated, so this thread becomes
+        // the exclusive waker: re-populate the pools, then let everyone in.
+        // Entrants that raced past the wait re-evaluate its predicate under
+        // the mutex, so exactly one of them gets here.
+        _exclusive = true;
+        lock.unlock();
+        RepopulatePools();
+        lock.lock();
+        _hibernated = false;
+        _exclusive = false;
+        _stateCv.notify_all();
+    }
+    ++_activeRuns;
+    lock.unlock();
+    // Let the lifecycle manager push the coldest idle networks back under
+    // the budget this run's wake-up may have exceeded
+    if (_cfg._modelBudgetMb > 0) {
+        _plugin->_modelLifecycle.Activate(this, static_cast<std::size_t>(_cfg._modelBudgetMb) * 1024 * 1024);
+    }
+}
+
+void ArmPlugin::ExecutableNetwork::ExitRun() {
+    {
+        std::lock_guard<std::mutex> lock{_stateMutex};
+        --_activeRuns;
+    }
+    _stateCv.notify_all();
+}
+
+ArmPlugin::ExecutableNetwork::MaintenanceLock::MaintenanceLock(ExecutableNetwork& network) :
+    _network{network} {
+    std::unique_lock<std::mutex> lock{network._stateMutex};
+    network._stateCv.wait(lock, [&network] { return !network._exclusive && (network._activeRuns == 0); });
+    network._exclusive = true;
+}
+
+ArmPlugin::ExecutableNetwork::MaintenanceLock::~MaintenanceLock() {
+    {
+        std::lock_guard<std::mutex> lock{_network._stateMutex};
+        _network._exclusive = false;
+    }
+    _network._stateCv.notify_all();
+}
+
+ArmPlugin::ExecutableNetwork::GraphLock::GraphLock(ExecutableNetwork& network, GraphContext& context, bool highPriority) :
+    _network{network},
+    _context{context} {
+    Metrics::get().QueueEnter();
+    network.EnterRun();
+    std::unique_lock<std::mutex> lock{context._mutex};
+    if (highPriority) {
+        ++context._highWaiters;
+        context._cv.wait(lock, [&context] { return !context._busy; });
+        --context._highWaiters;
+    } else {
+        context._cv.wait(lock, [&context] {
+            return !context._busy && (context._highWaiters == 0);
+        });
+    }
+    context._busy = true;
+    lock.unlock();
+    Metrics::get().QueueLeave();
+    Metrics::get().GraphEnter();
+}
+
+ArmPlugin::ExecutableNetwork::GraphLock::~GraphLock() {
+    {
+        std::lock_guard<std::mutex> lock{_context._mutex};
+        _context._busy = false;
+    }
+    _context._cv.notify_all();
+    _network.ExitRun();
+    Metrics::get().GraphLeave();
+}
+
+void ArmPlugin::ExecutableNetwork::Reshape(const std::map<std::string, ngraph::PartialShape>& shapes) {
+    if (_cfg._autoBatch > 1) {
+        IE_THROW() << "RESHAPE is not supported together with AUTO_BATCH_SIZE";
+    }
+    if (!_shapeBuckets.empty()) {
+        IE_THROW() << "RESHAPE is not supported together with SHAPE_BUCKETS";
+    }
+    // The stored function is already past the transformation pipeline, so the
+    // conversion decisions (node types and rt_info) survive as-is and only
+    // shape propagation plus the ACL configuration are redone. The clone
+    // shares the constants, so weights are not re-read or copied.
+    auto reshaped = ngraph::clone_function(*_function);
+    bool changed = false;
+    for (auto&& parameter : reshaped->get_parameters()) {
+        auto itShape = shapes.find(parameter->get_friendly_name());
+        if (itShape == shapes.end()) {
+            continue;
+        }
+        if (!itShape->second.is_static()) {
+            IE_THROW() << "RESHAPE requires static shapes, got " << itShape->second
+                       << " for input " << parameter->get_friendly_name();
+        }
+        if (parameter->get_partial_shape() == itShape->second) {
+            continue;
+        }
+        parameter->set_partial_shape(itShape->second);
+        changed = true;
+    }
+    if (!changed) {
+        return;
+    }
+    reshaped->validate_nodes_and_infer_types();
+
+    // Configure the reshaped plan on the side, one context per current one,
+    // so a failure leaves the running plan untouched
+    auto allocationLedger = std::make_shared<AllocationLedger>();
+    std::vector<std::shared_ptr<GraphContext>> contexts;
+    contexts.emplace_back(MakeGraphContext(reshaped, _variableStates, allocationLedger));
+    for (std::size_t context = 1; context < _contexts.size(); ++context) {
+        contexts.emplace_back(MakeGraphContext(ngraph::clone_function(*reshaped), nullptr, nullptr));
+    }
+
+    // The plan swap quiesces every context, like Rebind
+    MaintenanceLock lock{*this};
+    for (auto&& context : _contexts) {
+        _retiredContexts.emplace_back(std::move(context));
+    }
+    _contexts = std::move(contexts);
+    _function = reshaped;
+    _allocationLedger = std::move(allocationLedger);
+
+    // Requests created from now on must see the new shapes in the I/O maps
+    for (auto&& parameter : reshaped->get_parameters()) {
+        auto itInput = _networkInputs.find(parameter->get_friendly_name());
+        if (itInput != _networkInputs.end()) {
+            auto data = itInput->second->getInputData();
+            data->reshape(parameter->get_shape(), data->getLayout());
+        }
+    }
+    for (auto&& result : reshaped->get_results()) {
+        auto itOutput = _networkOutputs.find(result->get_rt_info().at("ResultName").as<std::string>());
+        if (itOutput != _networkOutputs.end()) {
+            itOutput->second->reshape(result->get_input_shape(0), itOutput->second->getLayout());
+        }
+    }
+}
+
 InferenceEngine::IInferRequestInternal::Ptr
 ArmPlugin::ExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                                      InferenceEngine::OutputsDataMap networkOutputs) {
@@ -63,10 +808,82 @@ ArmPlugin::ExecutableNetwork::CreateInferRequestImpl(const std::vector<std::shar
                                              std::static_pointer_cast<ExecutableNetwork>(shared_from_this()));
 }
 
+void ArmPlugin::ExecutableNetwork::Export(std::ostream& model) {
+    // The function here is already transformed by the ArmOptimizations pipeline,
+    // so importing the blob skips it entirely. Conversion decisions and ACL
+    // configuration are re-derived deterministically from the function at import,
+    // which keeps the blob free of ACL version details.
+    std::stringstream xml;
+    std::stringstream bin;
+    ngraph::pass::Manager passManager;
+    passManager.register_pass<ngraph::pass::Serialize>(xml, bin);
+    passManager.run_passes(ngraph::clone_function(*_function));
+    auto writeString = [&] (const std::string& value) {
+        const std::uint64_t size = value.size();
+        model.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        model.write(value.data(), size);
+    };
+    writeString(xml.str());
+    // WEIGHT_COMPRESSION trades export time for a smaller blob and a smaller
+    // import peak; the codec returns the plain payload when it does not shrink
+    writeString(_cfg._weightCompression ? WeightCodec::Compress(bin.str()) : bin.str());
+}
+
+InferenceEngine::IInferRequestInternal::Ptr ArmPlugin::ExecutableNetwork::CreateInferRequest() {
+    InferenceEngine::IInferRequestInternal::Ptr internalRequest;
+    if (this->_plugin && this->_plugin->GetCore() && this->_plugin->GetCore()->isNewAPI()) {
+        internalRequest = CreateInferRequestImpl(_parameters, _results);
+    }
+    if (internalRequest == nullptr) {
+        internalRequest = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    }
+    internalRequest->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<ArmAsyncInferRequest>(std::static_pointer_cast<ArmInferRequest>(internalRequest),
+                                                  _taskExecutor,
+                                                  _callbackExecutor);
+}
+
 InferenceEngine::Parameter ArmPlugin::ExecutableNetwork::GetConfig(const std::string& name) const {
     return _cfg.Get(name);
 }
 
+// Rough arithmetic-intensity estimate (multiply-accumulates per byte of
+// tensor traffic) used to classify the model: convolutions and matmuls
+// dominate the MAC count, every op output plus the constants approximate the
+// memory traffic.
+static bool IsComputeBound(const ngraph::Function& function) {
+    double macs = 0;
+    double bytes = 0;
+    for (auto&& node : function.get_ops()) {
+        for (auto&& output : node->outputs()) {
+            if (output.get_partial_shape().is_static()) {
+                bytes += output.get_element_type().size() * ngraph::shape_size(output.get_shape());
+            }
+        }
+        if ((node->get_input_size() < 2) ||
+            !node->get_input_partial_shape(0).is_static() ||
+            !node->get_input_partial_shape(1).is_static() ||
+            !node->get_output_partial_shape(0).is_static()) {
+            continue;
+        }
+        const std::string type = node->get_type_info().name;
+        const double outElems = static_cast<double>(ngraph::shape_size(node->get_output_shape(0)));
+        if (type.find("GroupConvolution") != std::string::npos) {
+            // Weights are (G, Cout/G, Cin/G, kh, kw): Cin/G*kh*kw MACs per output element
+            const auto& weights = node->get_input_shape(1);
+            macs += outElems * (ngraph::shape_size(weights) / static_cast<double>(weights[0] * weights[1]));
+        } else if (type.find("Convolution") != std::string::npos) {
+            // Weights are (Cout, Cin, kh, kw): Cin*kh*kw MACs per output element
+            const auto& weights = node->get_input_shape(1);
+            macs += outElems * (ngraph::shape_size(weights) / static_cast<double>(weights[0]));
+        } else if (type.find("MatMul") != std::string::npos) {
+            macs += outElems * static_cast<double>(node->get_input_shape(0).back());
+        }
+    }
+    // ~4 MACs per byte moved is roughly where NEON cores stop waiting on memory
+    return (bytes > 0) && ((macs / bytes) >= 4.0);
+}
+
 InferenceEngine::Parameter ArmPlugin::ExecutableNetwork::GetMetric(const std::string& name) const {
     // TODO: return more supported values for metrics
     if (METRIC_KEY(SUPPORTED_METRICS) == name) {
@@ -78,6 +895,8 @@ InferenceEngine::Parameter ArmPlugin::ExecutableNetwork::GetMetric(const std::st
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> configKeys = {
             CONFIG_KEY(PERF_COUNT),
+            CONFIG_KEY(PERFORMANCE_HINT),
+            CONFIG_KEY(PERFORMANCE_HINT_NUM_REQUESTS),
             CONFIG_KEY_INTERNAL(LP_TRANSFORMS_MODE)};
         auto streamExecutorConfigKeys = IStreamsExecutor::Config{}.SupportedKeys();
         for (auto&& configKey : streamExecutorConfigKeys) {
@@ -87,13 +906,221 @@ InferenceEngine::Parameter ArmPlugin::ExecutableNetwork::GetMetric(const std::st
     } else if (METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _function->get_friendly_name());
     } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
-        unsigned int value = _cfg._streamsExecutorConfig._streams;
+        // Derived from the achievable concurrency rather than echoed from the
+        // configuration: the execution contexts bound how many graph runs can
+        // be in flight (stateful and weight-streamed models run one context no
+        // matter how many streams were asked for), each context wants one
+        // executing request, and a compute-bound model gains a second per
+        // context so I/O staging (memory-bound copies) overlaps kernel
+        // execution. For a memory-bound model the staging of an extra request
+        // would contend for the bandwidth the kernels are already waiting on,
+        // so one request per context is the optimum.
+        const unsigned int contexts = static_cast<unsigned int>(std::max<std::size_t>(1, _contexts.size()));
+        const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+        unsigned int value = IsComputeBound(*_function) ? contexts * 2 : contexts;
+        value = std::min(value, std::max(contexts, cores));
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if ("SCHED_TELEMETRY" == name) {
+        // One CSV row per kernel class: split dim, window count, runs, worker
+        // spread (min/max busy seconds) and queue wait; requires SCHED_TELEMETRY
+        std::vector<std::string> rows;
+        if (auto scheduler = dynamic_cast<IEScheduler*>(&arm_compute::Scheduler::get())) {
+            for (auto&& entry : scheduler->GetTelemetry()) {
+                rows.emplace_back(entry.first + ',' +
+                                  std::to_string(entry.second._splitDimension) + ',' +
+                                  std::to_string(entry.second._windowCount) + ',' +
+                                  std::to_string(entry.second._runs) + ',' +
+                                  std::to_string(entry.second._minWorkerTime) + ',' +
+                                  std::to_string(entry.second._maxWorkerTime) + ',' +
+                                  std::to_string(entry.second._queueWait));
+            }
+        }
+        return {rows};
+    } else if ("MEMORY_BREAKDOWN" == name) {
+        // One "component\tbytes" row each for constants, the activation pools
+        // and the per-request I/O staging arena, plus a projection for the
+        // configured request count. Constants are shared by every context;
+        // the activation pools scale with the context count (one per stream,
+        // all included in the allocator total) and staging with N.
+        std::uint64_t constantBytes = 0;
+        for (auto&& node : _function->get_ops()) {
+            if (ngraph::op::is_constant(node)) {
+                constantBytes += node->output(0).get_element_type().size() *
+                                 ngraph::shape_size(node->output(0).get_shape());
+            }
+        }
+        const std::uint64_t activationBytes = _allocator._allocatedBytes.load();
+        const std::uint64_t stagingBytes = _stagingBytesPerRequest.load();
+        const std::uint64_t requests = std::max(1, _cfg._streamsExecutorConfig._streams);
+        return {std::vector<std::string>{
+            "constant_bytes\t" + std::to_string(constantBytes),
+            "activation_pool_bytes\t" + std::to_string(activationBytes),
+            "io_staging_bytes_per_request\t" + std::to_string(stagingBytes),
+            "projected_total_bytes_" + std::to_string(requests) + "_requests\t" +
+                std::to_string(constantBytes + activationBytes + requests * stagingBytes)}};
+    } else if ("MEMORY_TRACE" == name) {
+        // Live allocation attribution: per-bucket totals followed by the
+        // owning-layer records from the Converter ledger, largest first, so
+        // "which layer owns these 300 MB" is one metric call. Buckets are
+        // described at AllocationRecord; the pool slab and per-request staging
+        // totals repeat here so the report stands alone.
+        std::vector<std::string> rows;
+        rows.emplace_back("pool_slab_bytes\t" + std::to_string(_allocator._allocatedBytes.load()));
+        rows.emplace_back("io_staging_bytes_per_request\t" + std::to_string(_stagingBytesPerRequest.load()));
+        std::map<std::string, std::pair<std::uint64_t, std::uint64_t>> buckets;
+        for (auto&& entry : *_allocationLedger) {
+            auto& bucket = buckets[entry._bucket];
+            bucket.first += entry._bytes;
+            ++bucket.second;
+        }
+        for (auto&& bucket : buckets) {
+            rows.emplace_back("bucket\t" + bucket.first + '\t' +
+                              std::to_string(bucket.second.first) + '\t' +
+                              std::to_string(bucket.second.second));
+        }
+        auto ledger = *_allocationLedger;
+        std::stable_sort(ledger.begin(), ledger.end(), [] (const AllocationRecord& a, const AllocationRecord& b) {
+            return a._bytes > b._bytes;
+        });
+        for (auto&& entry : ledger) {
+            rows.emplace_back(entry._owner + '\t' + entry._bucket + '\t' + std::to_string(entry._bytes));
+        }
+        return {rows};
+    } else if ("MEMORY_POOL_SIZE" == name) {
+        // Bytes populated into the activation pools (batched variant included).
+        // The offset plan is computed once per network, so every request and
+        // every load of the same model sees this exact footprint.
+        return {static_cast<uint64_t>(_allocator._allocatedBytes.load())};
+    } else if ("LOAD_TIME_PROFILE" == name) {
+        // One "stage\tcount\ttotal ms" row per LoadNetwork stage (transform
+        // pipeline stages, per-op-type ACL configure)
+        std::vector<std::string> rows;
+        if (_cfg._loadProfile != nullptr) {
+            rows = _cfg._loadProfile->Report();
+        }
+        return {rows};
+    } else if ("PREFERRED_IO_DESCRIPTORS" == name) {
+        // One "direction\tname\tprecision" row per network I/O in the precision
+        // the graph actually computes in. A blob set in this precision is bound
+        // into the kernels directly; any other precision goes through the
+        // conversion staging path
+        std::vector<std::string> rows;
+        for (auto&& node : _function->get_parameters()) {
+            rows.emplace_back("input\t" + node->get_friendly_name() + '\t' +
+                std::string{InferenceEngine::details::convertPrecision(node->get_element_type()).name()});
+        }
+        for (auto&& node : _function->get_results()) {
+            rows.emplace_back("output\t" + node->get_rt_info().at("ResultName").as<std::string>() + '\t' +
+                std::string{InferenceEngine::details::convertPrecision(node->input(0).get_source_output().get_element_type()).name()});
+        }
+        return {rows};
+    } else if ("THROTTLE_STATE" == name) {
+        // Adaptive-throttling controller state: the post-warmup baseline and
+        // current smoothed graph time, the parallelism step applied and the
+        // frame-skip signal; meaningful only with ADAPTIVE_THROTTLING enabled
+        return {std::vector<std::string>{
+            "baseline_ms\t" + std::to_string(_throttleBaselineMs.load()),
+            "smoothed_ms\t" + std::to_string(_throttleSmoothedMs.load()),
+            "parallelism_step\t" + std::to_string(_throttleStep.load()),
+            "frame_skip_recommended\t" + std::string{_throttleOverloaded.load() ? "YES" : "NO"}}};
+    } else if ("FALLBACK_SUMMARY" == name) {
+        // Load-time conversion outcomes: layer counts per exec class, the cost
+        // share of the reference layers (output-bytes proxy, same estimate
+        // IsComputeBound uses) and one row per op type on the reference path,
+        // so a deployment gate can catch fallback regressions without running
+        // and parsing performance counts
+        std::size_t aclCount = 0, nativeCount = 0, referenceCount = 0, mergedCount = 0;
+        double totalBytes = 0.0, referenceBytes = 0.0;
+        std::map<std::string, std::size_t> referenceOps;
+        for (auto&& node : _function->get_ordered_ops()) {
+            if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node)) {
+                continue;
+            }
+            const auto& execType = _contexts.front()->_layers.at(node->get_instance_id())._execType;
+            double bytes = 0.0;
+            for (auto&& output : node->outputs()) {
+                if (output.get_partial_shape().is_static()) {
+                    bytes += output.get_element_type().size() * ngraph::shape_size(output.get_shape());
+                }
+            }
+            totalBytes += bytes;
+            if (execType.compare(0, 11, "Arm Compute") == 0) {
+                ++aclCount;
+            } else if (execType == "Native") {
+                ++nativeCount;
+            } else if (execType == "Merged") {
+                ++mergedCount;
+            } else {
+                ++referenceCount;
+                referenceBytes += bytes;
+                ++referenceOps[node->get_type_name()];
+            }
+        }
+        std::vector<std::string> rows{
+            "acl_layers\t" + std::to_string(aclCount),
+            "native_layers\t" + std::to_string(nativeCount),
+            "reference_layers\t" + std::to_string(referenceCount),
+            "merged_layers\t" + std::to_string(mergedCount),
+            "reference_cost_share_percent\t" +
+                std::to_string(totalBytes > 0.0 ? 100.0 * referenceBytes / totalBytes : 0.0)};
+        for (auto&& op : referenceOps) {
+            rows.emplace_back("reference_op\t" + op.first + '\t' + std::to_string(op.second));
+        }
+        return {rows};
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
 }
 
+void ArmPlugin::ExecutableNetwork::RecordGraphTime(float milliseconds) {
+    std::lock_guard<std::mutex> lock{_throttleMutex};
+    ++_throttleRuns;
+    constexpr std::uint64_t warmupRuns = 16;
+    constexpr std::uint64_t decisionInterval = 32;
+    constexpr float alpha = 0.1f;
+    constexpr int maxStep = 3;
+    if (_throttleRuns <= warmupRuns) {
+        // The warmup average is the unthrottled reference point; weight packing
+        // and cache warming make the very first runs slower, hence the EWMA
+        const float baseline = (_throttleRuns == 1) ? milliseconds :
+            _throttleBaselineMs.load() + alpha * (milliseconds - _throttleBaselineMs.load());
+        _throttleBaselineMs.store(baseline);
+        _throttleSmoothedMs.store(baseline);
+        return;
+    }
+    _throttleSmoothedMs.store(_throttleSmoothedMs.load() + alpha * (milliseconds - _throttleSmoothedMs.load()));
+    // Decide at most every few dozen runs so a single spike can not ratchet
+    // the parallelism down and straight back up
+    if (_throttleRuns < _throttleNextDecision) {
+        return;
+    }
+    _throttleNextDecision = _throttleRuns + decisionInterval;
+    const float baseline = _throttleBaselineMs.load();
+    const float smoothed = _throttleSmoothedMs.load();
+    const int step = _throttleStep.load();
+    if (smoothed > 1.5f * baseline) {
+        _throttleOverloaded.store(true);
+        if ((step < maxStep) && (AdaptiveStreamThreads() > 1)) {
+            _throttleStep.store(step + 1);
+        }
+    } else if (smoothed < 1.15f * baseline) {
+        _throttleOverloaded.store(false);
+        if (step > 0) {
+            _throttleStep.store(step - 1);
+        }
+    }
+}
+
+unsigned int ArmPlugin::ExecutableNetwork::AdaptiveStreamThreads() const {
+    const int step = _throttleStep.load();
+    const int base = (_streamIntraThreads > 0) ? _streamIntraThreads :
+        static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    if ((step == 0) && (_streamIntraThreads <= 0)) {
+        return 0;
+    }
+    return static_cast<unsigned int>(std::max(1, base >> step));
+}
+
 std::shared_ptr<ngraph::Function> ArmPlugin::ExecutableNetwork::GetExecGraphInfo() {
     for (auto&& node : _function->get_ops()) {
         auto& rtInfo = node->get_rt_info();
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <utility>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <map>
@@ -15,15 +18,83 @@
 
 #include "arm_config.hpp"
 #include "arm_infer_request.hpp"
+#include "arm_state.hpp"
+#include "arm_weight_streamer.hpp"
+
+#include <arm_compute/runtime/Allocator.h>
+#include <arm_compute/runtime/OffsetLifetimeManager.h>
+#include <arm_compute/runtime/PoolManager.h>
+#include <arm_compute/runtime/MemoryManagerOnDemand.h>
+#include <arm_compute/runtime/MemoryGroup.h>
+
+#include <arm_compute/runtime/BlobLifetimeManager.h>
 
 namespace ArmPlugin {
 
 class Plugin;
 
+// One graph execution context: the transformed function configured into ACL
+// functions with their tensors, activation pool and admission state. The
+// network builds one context per stream at load time - the clones share the
+// constant payloads, each context re-packs only its own ACL-side weight
+// transforms - and assigns requests to contexts round-robin, so a request
+// serializes only against the other requests of its context and up to one
+// graph run per context is in flight concurrently.
+struct GraphContext {
+    std::shared_ptr<const ngraph::Function>                 _function;
+    Layer::Map                                              _layers;
+    std::shared_ptr<arm_compute::ISimpleLifetimeManager>    _lifetime;
+    std::shared_ptr<arm_compute::PoolManager>               _pool;
+    std::shared_ptr<arm_compute::MemoryManagerOnDemand>     _memoryManager;
+    std::unique_ptr<arm_compute::MemoryGroup>               _memoryGroup;
+    std::unique_ptr<arm_compute::MemoryGroupResourceScope>  _memoryGroupScope;
+    // Priority admission to this context's run (see ExecutableNetwork::
+    // GraphLock): whenever the context frees up, waiting HIGH requests are
+    // admitted before any NORMAL waiter, so an interactive class bypasses
+    // queued batch work. A running graph is never preempted - its
+    // intermediates live in the context's activation pool and ceding the pool
+    // at a layer boundary would corrupt them - so the worst-case extra
+    // latency of a HIGH request is one graph run, not the depth of the queue.
+    std::mutex                                              _mutex;
+    std::condition_variable                                 _cv;
+    bool                                                    _busy = false;
+    int                                                     _highWaiters = 0;
+    // Blob whose memory each I/O tensor currently imports (nullptr for a
+    // request-private padded staging). The tensors are shared by the
+    // context's requests, so a request's cached binding is only valid while
+    // this still names its blob - a sibling's import invalidates it. Touched
+    // only by the admitted request, so the context admission is its lock.
+    std::map<const arm_compute::ITensor*, const InferenceEngine::Blob*> _imports;
+};
+
+// Zero-fills freshly allocated pool memory so its pages are committed on the
+// allocating thread. Combined with running populate on a stream worker (see
+// InitGraph) this keeps the activation pool on the NUMA node whose cores run
+// the stream, avoiding cross-socket traffic on multi-socket machines.
+struct FirstTouchAllocator final : public arm_compute::Allocator {
+    void* allocate(std::size_t size, std::size_t alignment) override;
+    void free(void* ptr) override;
+    // Bytes currently held by the memory manager pools (freed slabs are
+    // subtracted, so a hibernated network reports zero). The offset plans are
+    // computed once per execution context and shared by that context's
+    // requests, so in steady state this is the fixed activation footprint
+    // usable for capacity planning.
+    std::atomic<std::size_t> _allocatedBytes{0};
+    // When set, slabs of at least one huge page are mmap'ed with MAP_HUGETLB
+    // (falling back to MADV_HUGEPAGE) instead of coming from the heap
+    bool                            _hugePages = false;
+    // Mapped size (for munmap) and requested size (for the byte accounting)
+    // per mmap'ed slab; heap slab sizes are tracked separately
+    std::map<void*, std::pair<std::size_t, std::size_t>>    _mappings;
+    std::map<void*, std::size_t>                            _heapSizes;
+    std::mutex                                              _mappingsMutex;
+};
+
 struct ExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
     ExecutableNetwork(const std::shared_ptr<const ngraph::Function>&  func,
                       const Configuration&           cfg,
                       const std::shared_ptr<Plugin>& plugin);
+    ~ExecutableNetwork() override;
 
     InferenceEngine::IInferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
@@ -31,18 +102,214 @@ struct ExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDe
     InferenceEngine::IInferRequestInternal::Ptr
     CreateInferRequestImpl(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                            const std::vector<std::shared_ptr<const ov::Node>>& outputs) override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
     InferenceEngine::Parameter GetMetric(const std::string& name) const override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
+    // Re-runs shape propagation and ACL configuration for new input shapes on
+    // the already transformed function, reusing the conversion decisions and
+    // the weights; reached through the "RESHAPE" SetConfig key. Requests
+    // created before the reshape keep executing the previous plan.
+    void Reshape(const std::map<std::string, ngraph::PartialShape>& shapes);
+    // Runs one zero-input dry inference per stream so the first real request
+    // hits steady-state latency: stream workers get spun up, lazily deferred
+    // weight packing happens, and activation/staging pages are faulted on the
+    // cores that will reuse them. Reached through the "WARMUP" SetConfig key,
+    // typically from a readiness probe before traffic arrives.
+    void WarmUp();
+    // Re-binds the pointer-rich execution state after a process snapshot is
+    // restored at new addresses (CRIU-style clone scale-out): the activation
+    // pools are freed and re-populated from fresh slabs - the offset plan is
+    // kept, only the base addresses change - and _bindGeneration is bumped so
+    // every infer request drops its cached I/O imports on its next run. The
+    // packed weights and constants live on the ordinary heap the restore
+    // brings back as-is, so no reconfiguration or re-prepare is needed.
+    // Reached through the "REBIND" SetConfig key from the restore hook.
+    void Rebind();
+    // Frees and re-populates every activation pool (all contexts, batched,
+    // buckets, retired generations) against the kept offset plan and bumps
+    // _bindGeneration; maintenance exclusivity must be held. Shared by Rebind
+    // and the hibernation wake-up.
+    void RepopulatePools();
+    // Model lifecycle (MODEL_BUDGET_MB): bytes the plugin-wide budget
+    // accounts this network for - pool slabs currently held plus the weight
+    // payloads while awake
+    std::size_t ActiveFootprint() const;
+    // Hibernates the network if no run is in flight right now (never waits):
+    // drops every pool slab and pages the weight payloads out to their
+    // backing. The compiled layers stay configured - live infer requests
+    // hold pointers into them - so waking is RepopulatePools plus demand
+    // paging on the next admission, not a reload. Returns false when a run
+    // is in flight or queued.
+    bool TryHibernate();
+    void Export(std::ostream& model) override;
     std::shared_ptr<ngraph::Function> GetExecGraphInfo() override;
 
     void RegistorTranslations();
     void Translate(std::shared_ptr<const ngraph::Function> function);
     void InitExecutor();
+    void InitGraph();
+    void InitBatchedGraph();
+    void InitShapeBuckets();
 
     std::shared_ptr<const ngraph::Function>                 _function;
     Configuration                                           _cfg;
     std::shared_ptr<Plugin>                                 _plugin;
     std::atomic_int                                         _requestId = {0};
     InferenceEngine::ITaskExecutor*                         _executor = nullptr;
+    // Intra-kernel threads each stream may use when several streams run
+    // concurrently (0 keeps the default); see IEScheduler::SetStreamThreads
+    int                                                     _streamIntraThreads = 0;
+    // Thermal/DVFS adaptation (ADAPTIVE_THROTTLING): RecordGraphTime tracks a
+    // smoothed per-inference graph time against a post-warmup baseline.
+    // Sustained slowdown - frequency throttling, not a one-off spike - steps
+    // the per-stream kernel parallelism down (narrow fan-outs waste less time
+    // synchronizing throttled cores and shed heat so DVFS can recover) and
+    // raises the overload flag exposed by the THROTTLE_STATE metric, letting
+    // frame sources skip work instead of queueing into a throttled device.
+    void RecordGraphTime(float milliseconds);
+    // Effective per-stream kernel thread cap under the current throttle step;
+    // 0 means no cap is to be applied
+    unsigned int AdaptiveStreamThreads() const;
+    std::mutex                                              _throttleMutex;
+    std::uint64_t                                           _throttleRuns = 0;
+    std::uint64_t                                           _throttleNextDecision = 0;
+    std::atomic<float>                                      _throttleBaselineMs{0.0f};
+    std::atomic<float>                                      _throttleSmoothedMs{0.0f};
+    std::atomic_int                                         _throttleStep{0};
+    std::atomic_bool                                        _throttleOverloaded{false};
+    // Builds one execution context for the given function generation:
+    // configures the ACL functions against a fresh memory manager, populates
+    // the activation pool and (unless LAZY_PREPARE) packs the weights.
+    // Variable states and the allocation ledger are only wired into the
+    // primary context; the extra per-stream contexts pass nullptr.
+    std::shared_ptr<GraphContext> MakeGraphContext(const std::shared_ptr<const ngraph::Function>& function,
+                                                   const std::shared_ptr<VariableStateMap>& variableStates,
+                                                   const std::shared_ptr<AllocationLedger>& allocationLedger);
+    // ACL functions are configured once per context at load time, so request
+    // creation only wires I/O blobs. One context per stream; stateful and
+    // weight-streamed models keep a single context (their state tensors and
+    // streaming cursors assume one run at a time).
+    std::vector<std::shared_ptr<GraphContext>>              _contexts;
+    // Admission guard of one graph run on one context; see GraphContext for
+    // the priority rules
+    struct GraphLock {
+        GraphLock(ExecutableNetwork& network, GraphContext& context, bool highPriority);
+        ~GraphLock();
+        GraphLock(const GraphLock&) = delete;
+        GraphLock& operator=(const GraphLock&) = delete;
+        ExecutableNetwork&  _network;
+        GraphContext&       _context;
+    };
+    // Network-wide run/maintenance arbitration: every graph run holds a share
+    // for its duration (EnterRun also wakes a hibernated network and nudges
+    // the model lifecycle manager), while maintenance - Rebind, Reshape's
+    // plan swap, hibernation - runs exclusively, quiescing every context at
+    // once.
+    void EnterRun();
+    void ExitRun();
+    struct RunScope {
+        explicit RunScope(ExecutableNetwork& network) : _network{network} { _network.EnterRun(); }
+        ~RunScope() { _network.ExitRun(); }
+        RunScope(const RunScope&) = delete;
+        RunScope& operator=(const RunScope&) = delete;
+        ExecutableNetwork& _network;
+    };
+    struct MaintenanceLock {
+        explicit MaintenanceLock(ExecutableNetwork& network);
+        ~MaintenanceLock();
+        MaintenanceLock(const MaintenanceLock&) = delete;
+        MaintenanceLock& operator=(const MaintenanceLock&) = delete;
+        ExecutableNetwork& _network;
+    };
+    std::mutex                                              _stateMutex;
+    std::condition_variable                                 _stateCv;
+    int                                                     _activeRuns = 0;
+    bool                                                    _exclusive = false;
+    // Blobs backing constant-fed network I/O, shared read-only by all
+    // requests; the constant tensors themselves already live in _layers
+    std::map<std::string, InferenceEngine::Blob::Ptr>       _constantBlobs;
+    std::mutex                                              _constantBlobsMutex;
+    FirstTouchAllocator                                     _allocator;
+    // I/O staging arena size of one request, reported by the last request
+    // created; feeds the MEMORY_BREAKDOWN metric
+    std::atomic<std::size_t>                                _stagingBytesPerRequest{0};
+    // Bumped by Rebind; requests compare it against the generation of their
+    // cached I/O imports and re-import when the pools have moved
+    std::atomic<std::uint64_t>                              _bindGeneration{0};
+    // Set by TryHibernate, cleared by the next graph admission after it has
+    // re-populated the pools
+    std::atomic_bool                                        _hibernated{false};
+    // Summed byte size of the function's sizeable constants, cached at load
+    // for the lifecycle accounting
+    std::size_t                                             _weightBytes = 0;
+    // Variable states of stateful models (ReadValue/Assign), filled by the
+    // Converter; like the graph itself they are shared by all infer requests,
+    // which expose them through QueryState
+    std::shared_ptr<VariableStateMap>                       _variableStates = std::make_shared<VariableStateMap>();
+    // Allocation ledger of the current graph generation, filled by the
+    // Converter and reported through the MEMORY_TRACE metric
+    std::shared_ptr<AllocationLedger>                       _allocationLedger = std::make_shared<AllocationLedger>();
+    // Bounded weight residency for models larger than device RAM
+    // (WEIGHT_STREAMING); null unless streaming is on. Driven from the
+    // serial layer loop under the graph lock, so no synchronization of its
+    // cursors is needed.
+    std::unique_ptr<WeightStreamer>                         _weightStreamer;
+
+    // Contexts retired by Reshape. Requests created before a reshape still
+    // reference the tensors of their plan, so each old generation (and its
+    // populated pool) stays alive until the network is destroyed.
+    std::vector<std::shared_ptr<GraphContext>>              _retiredContexts;
+
+    // Auto-batching: a batch-N variant of the function compiled at load time.
+    // Concurrent single-image requests gather into its I/O tensors and one of
+    // them runs the batched graph for the whole group (see ArmInferRequest).
+    struct BatchedIO {
+        std::string             _name;
+        arm_compute::ITensor*   _tensor;
+        std::size_t             _sliceBytes;
+    };
+    std::shared_ptr<ngraph::Function>                       _batchedFunction;
+    Layer::Map                                              _batchedLayers;
+    std::shared_ptr<arm_compute::ISimpleLifetimeManager>    _batchedLifetime;
+    std::shared_ptr<arm_compute::PoolManager>               _batchedPool;
+    std::shared_ptr<arm_compute::MemoryManagerOnDemand>     _batchedMemoryManager;
+    std::unique_ptr<arm_compute::MemoryGroup>               _batchedMemoryGroup;
+    std::unique_ptr<arm_compute::MemoryGroupResourceScope>  _batchedMemoryGroupScope;
+    std::vector<BatchedIO>                                  _batchedInputs;
+    std::vector<BatchedIO>                                  _batchedOutputs;
+    std::mutex                                              _batchMutex;
+    std::condition_variable                                 _batchCv;
+    std::vector<ArmInferRequest*>                           _batchRequests;
+    std::uint64_t                                           _batchGeneration = 0;
+
+    // Shape bucketing (SHAPE_BUCKETS): smaller-shape variants of the function
+    // compiled at load time next to the full-shape graph. Each variant is a
+    // clone sharing the constants (weights are configured once and reused by
+    // every bucket) with its own OffsetLifetimeManager plan and activation
+    // pool sized for its shapes. Requests route each inference to the
+    // smallest bucket the actual input fits into (see
+    // ArmInferRequest::TryRunBucketed), so a 128-token sequence stops paying
+    // for the 512-token graph.
+    struct ShapeBucket {
+        struct IO {
+            std::string             _name;
+            arm_compute::ITensor*   _tensor;
+            ngraph::Shape           _shape;
+        };
+        std::shared_ptr<ngraph::Function>                       _function;
+        Layer::Map                                              _layers;
+        std::shared_ptr<arm_compute::ISimpleLifetimeManager>    _lifetime;
+        std::shared_ptr<arm_compute::PoolManager>               _pool;
+        std::shared_ptr<arm_compute::MemoryManagerOnDemand>     _memoryManager;
+        std::unique_ptr<arm_compute::MemoryGroup>               _memoryGroup;
+        std::unique_ptr<arm_compute::MemoryGroupResourceScope>  _memoryGroupScope;
+        std::vector<IO>                                         _inputs;
+        std::vector<IO>                                         _outputs;
+        // Total input elements, the routing order: buckets are kept sorted
+        // ascending so the first fitting bucket is the smallest one
+        std::size_t                                             _volume = 0;
+    };
+    std::vector<ShapeBucket>                                _shapeBuckets;
 };
 }  // namespace ArmPlugin
@@ -0,0 +1,132 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+namespace neon {
+
+// Precomputed plan for a power-of-two complex FFT over one contiguous
+// interleaved row (see the DFT/IDFT converters): the bit-reversal permutation
+// and per-stage twiddle tables are built once at conversion time, so the
+// per-frame work is just permuted loads and butterflies. The twiddles are
+// stored split into real/imaginary arrays, which lets the butterfly loop run
+// four lanes wide through vld2q without shuffles; the scalar tail keeps
+// non-NEON hosts building. One plan is immutable after construction and is
+// shared by all frames and threads of a batch.
+struct FftPlan {
+    static bool Supported(std::size_t length) {
+        return (length >= 2) && ((length & (length - 1)) == 0);
+    }
+
+    FftPlan(std::size_t length, bool inverse) : _length(length), _inverse(inverse) {
+        std::size_t bits = 0;
+        while ((std::size_t{1} << bits) < length) {
+            ++bits;
+        }
+        _reversed.resize(length);
+        for (std::size_t i = 0; i < length; ++i) {
+            std::size_t reversed = 0;
+            for (std::size_t bit = 0; bit < bits; ++bit) {
+                reversed |= ((i >> bit) & 1u) << (bits - 1 - bit);
+            }
+            _reversed[i] = reversed;
+        }
+        const double sign = inverse ? 2.0 : -2.0;
+        for (std::size_t len = 2; len <= length; len <<= 1) {
+            Stage stage;
+            stage._re.resize(len / 2);
+            stage._im.resize(len / 2);
+            for (std::size_t j = 0; j < len / 2; ++j) {
+                const double angle = sign * M_PI * j / len;
+                stage._re[j] = static_cast<float>(std::cos(angle));
+                stage._im[j] = static_cast<float>(std::sin(angle));
+            }
+            _stages.emplace_back(std::move(stage));
+        }
+    }
+
+    // Transforms one interleaved complex row of _length elements; src and dst
+    // must not alias (the permuted copy reads src while writing dst)
+    void Execute(const float* src, float* dst) const {
+        for (std::size_t i = 0; i < _length; ++i) {
+            dst[2 * i + 0] = src[2 * _reversed[i] + 0];
+            dst[2 * i + 1] = src[2 * _reversed[i] + 1];
+        }
+        std::size_t stageIndex = 0;
+        for (std::size_t len = 2; len <= _length; len <<= 1, ++stageIndex) {
+            const auto& stage = _stages[stageIndex];
+            const std::size_t half = len / 2;
+            for (std::size_t block = 0; block < _length; block += len) {
+                float* a = dst + 2 * block;
+                float* b = dst + 2 * (block + half);
+                std::size_t j = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+                for (; j + 4 <= half; j += 4) {
+                    float32x4x2_t va = vld2q_f32(a + 2 * j);
+                    float32x4x2_t vb = vld2q_f32(b + 2 * j);
+                    float32x4_t wr = vld1q_f32(stage._re.data() + j);
+                    float32x4_t wi = vld1q_f32(stage._im.data() + j);
+                    // t = w * b
+                    float32x4_t tr = vfmsq_f32(vmulq_f32(wr, vb.val[0]), wi, vb.val[1]);
+                    float32x4_t ti = vfmaq_f32(vmulq_f32(wr, vb.val[1]), wi, vb.val[0]);
+                    float32x4x2_t out0{{vaddq_f32(va.val[0], tr), vaddq_f32(va.val[1], ti)}};
+                    float32x4x2_t out1{{vsubq_f32(va.val[0], tr), vsubq_f32(va.val[1], ti)}};
+                    vst2q_f32(a + 2 * j, out0);
+                    vst2q_f32(b + 2 * j, out1);
+                }
+#endif
+                for (; j < half; ++j) {
+                    const float br = b[2 * j + 0];
+                    const float bi = b[2 * j + 1];
+                    const float tr = stage._re[j] * br - stage._im[j] * bi;
+                    const float ti = stage._re[j] * bi + stage._im[j] * br;
+                    const float ar = a[2 * j + 0];
+                    const float ai = a[2 * j + 1];
+                    a[2 * j + 0] = ar + tr;
+                    a[2 * j + 1] = ai + ti;
+                    b[2 * j + 0] = ar - tr;
+                    b[2 * j + 1] = ai - ti;
+                }
+            }
+        }
+        if (_inverse) {
+            const float scale = 1.0f / static_cast<float>(_length);
+            std::size_t i = 0;
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+            float32x4_t vscale = vdupq_n_f32(scale);
+            for (; i + 2 <= _length; i += 2) {
+                vst1q_f32(dst + 2 * i, vmulq_f32(vld1q_f32(dst + 2 * i), vscale));
+            }
+#endif
+            for (; i < _length; ++i) {
+                dst[2 * i + 0] *= scale;
+                dst[2 * i + 1] *= scale;
+            }
+        }
+    }
+
+    std::size_t Length() const { return _length; }
+
+private:
+    struct Stage {
+        std::vector<float> _re;
+        std::vector<float> _im;
+    };
+    std::size_t         _length;
+    bool                _inverse;
+    std::vector<std::size_t>    _reversed;
+    std::vector<Stage>          _stages;
+};
+
+}  //  namespace neon
+}  //  namespace ArmPlugin
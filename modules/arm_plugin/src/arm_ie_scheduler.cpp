@@ -2,19 +2,155 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #include <ie_parallel.hpp>
 #include <ie_common.h>
 
+#include <arm_cpu_quota.hpp>
 #include <arm_ie_scheduler.hpp>
+#include <arm_trace.hpp>
 
 using namespace ArmPlugin;
 
 IEScheduler::IEScheduler() {}
 IEScheduler::~IEScheduler() {}
-void IEScheduler::set_num_threads(unsigned int num_threads) {}
+
+static thread_local unsigned int streamThreads = 0;
+
+void IEScheduler::SetStreamThreads(unsigned int numThreads) {
+    streamThreads = numThreads;
+}
+
+void IEScheduler::set_num_threads(unsigned int num_threads) {
+    _numThreads = num_threads;
+}
 
 std::uint32_t IEScheduler::num_threads() const {
-    return parallel_get_max_threads();
+    auto numThreads = _numThreads.load();
+    if (numThreads != 0) {
+        return numThreads;
+    }
+    // parallel_get_max_threads reports every host core even under a container
+    // CPU quota; cap the default by the cgroup limit so ACL does not fan out
+    // onto cores the scheduler will immediately be throttled off of. An
+    // explicit set_num_threads (INTRA_OP_THREADS) bypasses the cap above.
+    const auto maxThreads = parallel_get_max_threads();
+    if (_quotaAware.load(std::memory_order_relaxed)) {
+        const auto quota = CgroupLimitedCpus();
+        if (quota > 0) {
+            return std::min(maxThreads, quota);
+        }
+    }
+    return maxThreads;
+}
+
+void IEScheduler::SetQuotaAware(bool enable) {
+    _quotaAware = enable;
+}
+
+void IEScheduler::EnableTelemetry(bool enable) {
+    _telemetryEnabled = enable;
+}
+
+std::map<std::string, IEScheduler::KernelTelemetry> IEScheduler::GetTelemetry() {
+    std::lock_guard<std::mutex> lock{_telemetryMutex};
+    return {_telemetry.begin(), _telemetry.end()};
+}
+
+void IEScheduler::DumpTelemetryCsv(const std::string& path) {
+    std::ofstream file{path};
+    if (!file.is_open()) {
+        return;
+    }
+    file << "kernel,split_dimension,window_count,runs,min_worker_time,max_worker_time,queue_wait\n";
+    for (auto&& entry : GetTelemetry()) {
+        file << entry.first << ','
+             << entry.second._splitDimension << ','
+             << entry.second._windowCount << ','
+             << entry.second._runs << ','
+             << entry.second._minWorkerTime << ','
+             << entry.second._maxWorkerTime << ','
+             << entry.second._queueWait << '\n';
+    }
+}
+
+void IEScheduler::LoadTuning(const std::string& path) {
+    std::ifstream file{path};
+    if (!file.is_open()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{_tuningMutex};
+    std::string key;
+    int windows = 0;
+    while (std::getline(file, key, '\t') && (file >> windows)) {
+        file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        if (windows > 0) {
+            _tuning[key] = TuneEntry{windows, 0.0f, 0, 0, 0.0f, true};
+        }
+    }
+}
+
+void IEScheduler::StoreTuning(const std::string& path) {
+    std::lock_guard<std::mutex> lock{_tuningMutex};
+    std::ofstream file{path};
+    if (!file.is_open()) {
+        return;
+    }
+    for (auto&& entry : _tuning) {
+        if (entry.second._done) {
+            file << entry.first << '\t' << entry.second._bestWindows << '\n';
+        }
+    }
+}
+
+bool IEScheduler::IsHeterogeneous() {
+    // Double-checked through the atomic: the release store below publishes
+    // the filled _coreClass/_classSpeed together with the flag, so a reader
+    // whose acquire load sees 0/1 may use the topology without the mutex
+    if (_heterogeneous.load(std::memory_order_acquire) < 0) {
+        std::lock_guard<std::mutex> lock{_calibrationMutex};
+        if (_heterogeneous.load(std::memory_order_relaxed) < 0) {
+            const auto& cpuInfo = cpu_info();
+            const auto numCpus = cpuInfo.get_cpu_num();
+            // Enumerate the distinct core models; a cpu's class id is the
+            // index of its model in the enumeration order
+            std::vector<arm_compute::CPUModel> models;
+            _coreClass.resize(numCpus);
+            for (unsigned int cpu = 0; cpu < numCpus; ++cpu) {
+                const auto model = cpuInfo.get_cpu_model(cpu);
+                auto itModel = std::find(models.begin(), models.end(), model);
+                if (itModel == models.end()) {
+                    itModel = models.insert(models.end(), model);
+                }
+                _coreClass[cpu] = static_cast<int>(itModel - models.begin());
+            }
+            _classSpeed.assign(models.size(), 1.0f);
+            _heterogeneous.store((models.size() > 1) ? 1 : 0, std::memory_order_release);
+        }
+    }
+    return _heterogeneous.load(std::memory_order_acquire) == 1;
+}
+
+// Class of the core the calling worker happens to run on right now; workers
+// are not pinned, so this is sampled per claimed span rather than cached
+static int currentCoreClass(const std::vector<int>& coreClass) {
+#ifdef __linux__
+    const int cpu = sched_getcpu();
+    if ((cpu >= 0) && (static_cast<std::size_t>(cpu) < coreClass.size())) {
+        return coreClass[cpu];
+    }
+#endif
+    return 0;
 }
 
 void IEScheduler::Schedule(arm_compute::ICPPKernel* kernel,
@@ -22,6 +158,14 @@ void IEScheduler::Schedule(arm_compute::ICPPKernel* kernel,
                            const arm_compute::Window& max_window,
                            arm_compute::ITensorPack& tensors) {
     IE_ASSERT(kernel != nullptr);
+    // One span per kernel dispatch, nested under the layer span of the
+    // function that scheduled it; recorded manually instead of scoped so the
+    // span name can carry the split decision taken below
+    const bool tracing = TraceRecorder::get().Enabled();
+    TraceRecorder::Clock::time_point traceStart;
+    if (tracing) {
+        traceStart = TraceRecorder::Clock::now();
+    }
 
     auto splitDimension = hints.split_dimension();
 
@@ -31,45 +175,375 @@ void IEScheduler::Schedule(arm_compute::ICPPKernel* kernel,
     }
 
     const int num_iterations = max_window.num_iterations(splitDimension);
-    const int num_threads    = std::min(num_iterations, parallel_get_num_threads());
+    int max_threads          = parallel_get_num_threads();
+    if (_numThreads != 0) {
+        max_threads = std::min(max_threads, static_cast<int>(_numThreads.load()));
+    }
+    if (streamThreads != 0) {
+        max_threads = std::min(max_threads, static_cast<int>(streamThreads));
+    }
+    const int num_threads    = std::min(num_iterations, max_threads);
     if (num_iterations == 0) {
         return;
     }
-    if (!kernel->is_parallelisable()) {
+    // Sub-threshold kernels run inline on the calling thread: for small
+    // elementwise/reshape layers the parallel_for dispatch costs more than the
+    // work itself. The window iteration count gates the first runs (ITensorPack
+    // does not expose tensor sizes cheaply, so iterations stand in for bytes)
+    // and the measured inline time then demotes kernels that turn out too heavy.
+    constexpr static int inlineIterationThreshold = 2048;
+    constexpr static float inlineTimeThreshold = 100e-6f;  // seconds
+    bool runInline = !kernel->is_parallelisable();
+    // Window count of the fanned-out dispatch, shared by telemetry and trace
+    int telemetryWindows = 0;
+    if (!runInline &&
+        (max_window.num_iterations_total() <= static_cast<std::size_t>(inlineIterationThreshold))) {
+        std::lock_guard<std::mutex> lock{_inlineMutex};
+        const auto itTime = _inlineTime.find(kernel->name());
+        runInline = (itTime == _inlineTime.end()) || (itTime->second <= inlineTimeThreshold);
+    }
+    if (runInline) {
         arm_compute::ThreadInfo info;
         info.cpu_info = &cpu_info();
+        const auto start = std::chrono::steady_clock::now();
         if (tensors.empty()) {
             kernel->run(max_window, info);
         } else {
             kernel->run_op(tensors, max_window, info);
         }
+        if (kernel->is_parallelisable()) {
+            const auto seconds = std::chrono::duration<float>{std::chrono::steady_clock::now() - start}.count();
+            std::lock_guard<std::mutex> lock{_inlineMutex};
+            auto itTime = _inlineTime.find(kernel->name());
+            if (itTime == _inlineTime.end()) {
+                _inlineTime.emplace(kernel->name(), seconds);
+            } else {
+                itTime->second = 0.75f * itTime->second + 0.25f * seconds;
+            }
+        }
     } else {
-        int num_windows = 0;
+        // Telemetry samples per-worker busy time and first-start timestamps so the
+        // split imbalance (max/min chunk time) and task-queue wait can be reported
+        const bool telemetry = _telemetryEnabled.load(std::memory_order_relaxed);
+        const auto dispatchStart = std::chrono::steady_clock::now();
+        struct WorkerSample {
+            std::chrono::steady_clock::time_point   _firstStart;
+            float                                   _busy;
+            bool                                    _started;
+        };
+        std::vector<WorkerSample> samples;
+        if (telemetry) {
+            samples.resize(parallel_get_max_threads());
+        }
+        auto runSubWindow = [&] (const arm_compute::Window& win) {
+            arm_compute::ThreadInfo   info;
+            info.cpu_info       = &cpu_info();
+            info.num_threads    = parallel_get_num_threads();
+            info.thread_id      = parallel_get_thread_num();
+            auto doRun = [&] {
+                if (tensors.empty()) {
+                    kernel->run(win, info);
+                } else {
+                    kernel->run_op(tensors, win, info);
+                }
+            };
+            if (!telemetry) {
+                doRun();
+                return;
+            }
+            auto& sample = samples[info.thread_id];
+            const auto start = std::chrono::steady_clock::now();
+            if (!sample._started) {
+                sample._started = true;
+                sample._firstStart = start;
+            }
+            doRun();
+            sample._busy += std::chrono::duration<float>{std::chrono::steady_clock::now() - start}.count();
+        };
+        auto runWindow = [&] (int windowId, int numWindows) {
+            auto win = max_window.split_window(splitDimension, windowId, numWindows);
+            win.validate();
+            runSubWindow(win);
+        };
         switch (hints.strategy()) {
             case arm_compute::IScheduler::StrategyHint::STATIC: {
-                num_windows = num_threads;
+                const int num_windows = num_threads;
+                telemetryWindows = num_windows;
+                if (!IsHeterogeneous() || num_windows < 2) {
+                    InferenceEngine::parallel_for(num_windows, [&] (int workloadId) {
+                        runWindow(workloadId, num_windows);
+                    });
+                    break;
+                }
+                // big.LITTLE: equal splits leave big cores idle while LITTLE cores finish,
+                // so bias the split by per-worker throughput calibrated on previous runs.
+                // Workers are not pinned, so the speeds converge on the average mix each
+                // logical worker sees rather than on exact core frequencies
+                std::vector<float> speed;
+                {
+                    std::lock_guard<std::mutex> lock{_calibrationMutex};
+                    if (_workerSpeed.size() == static_cast<std::size_t>(num_windows)) {
+                        speed = _workerSpeed;
+                    } else {
+                        speed.assign(num_windows, 1.0f);
+                    }
+                }
+                const auto totalSpeed = std::accumulate(speed.begin(), speed.end(), 0.0f);
+                std::vector<int> bounds(num_windows + 1, 0);
+                float cumulative = 0.0f;
+                for (int worker = 0; worker < num_windows; ++worker) {
+                    cumulative += speed[worker];
+                    bounds[worker + 1] = static_cast<int>(num_iterations * (cumulative / totalSpeed) + 0.5f);
+                }
+                bounds[num_windows] = num_iterations;
+                const auto& dim = max_window[splitDimension];
+                std::vector<float> measuredSpeed(num_windows, 0.0f);
+                InferenceEngine::parallel_for(num_windows, [&] (int worker) {
+                    const int iterations = bounds[worker + 1] - bounds[worker];
+                    if (iterations <= 0) {
+                        return;
+                    }
+                    auto win = max_window;
+                    win.set(splitDimension, arm_compute::Window::Dimension(dim.start() + bounds[worker] * dim.step(),
+                                                                           dim.start() + bounds[worker + 1] * dim.step(),
+                                                                           dim.step()));
+                    win.validate();
+                    const auto start = std::chrono::steady_clock::now();
+                    runSubWindow(win);
+                    const auto seconds = std::chrono::duration<float>{std::chrono::steady_clock::now() - start}.count();
+                    if (seconds > 0.0f) {
+                        measuredSpeed[worker] = iterations / seconds;
+                    }
+                });
+                // Normalize to mean 1 before blending so every kernel contributes the same
+                // weight to the relative speeds regardless of its absolute iteration cost
+                const auto measuredTotal = std::accumulate(measuredSpeed.begin(), measuredSpeed.end(), 0.0f);
+                if (measuredTotal > 0.0f) {
+                    std::lock_guard<std::mutex> lock{_calibrationMutex};
+                    if (_workerSpeed.size() != static_cast<std::size_t>(num_windows)) {
+                        _workerSpeed.assign(num_windows, 1.0f);
+                    }
+                    for (int worker = 0; worker < num_windows; ++worker) {
+                        if (measuredSpeed[worker] > 0.0f) {
+                            _workerSpeed[worker] = 0.75f * _workerSpeed[worker] +
+                                                   0.25f * (measuredSpeed[worker] * num_windows / measuredTotal);
+                        }
+                    }
+                }
             }  break;
             case arm_compute::IScheduler::StrategyHint::DYNAMIC: {
-                const int granule_threshold = (hints.threshold() <= 0) ? num_threads : hints.threshold();
-                num_windows = num_iterations > granule_threshold ? granule_threshold : num_iterations;
+                // Work-stealing executor: windows are held in per-worker ranges; a worker
+                // drains its own range through an atomic cursor and then steals leftover
+                // windows from slower workers, so one slow core or a ragged chunk no
+                // longer stalls the whole kernel
+                auto runStealing = [&] (int num_windows) {
+                    if (num_windows <= num_threads) {
+                        InferenceEngine::parallel_for(num_windows, [&] (int workloadId) {
+                            runWindow(workloadId, num_windows);
+                        });
+                        return;
+                    }
+                    if (IsHeterogeneous()) {
+                        // Asymmetric parts: the kernel's blocking is fixed at
+                        // configure time and shared by every core class, so
+                        // the per-class lever the scheduler owns is the
+                        // contiguous span each worker runs between cursor
+                        // visits. One-window spans sized for the LITTLE
+                        // cores keep re-entering the kernel prologue on the
+                        // big ones before their inner loops reach steady
+                        // state, so big-class workers claim proportionally
+                        // longer spans off a shared cursor. The span ratio
+                        // follows the per-class window throughput calibrated
+                        // on previous dispatches (warm-up converges it), and
+                        // the shared cursor keeps the tail self-balancing
+                        // like the homogeneous stealing path.
+                        std::vector<float> classSpeed;
+                        {
+                            std::lock_guard<std::mutex> lock{_calibrationMutex};
+                            classSpeed = _classSpeed;
+                        }
+                        const auto numClasses = classSpeed.size();
+                        const auto slowest = *std::min_element(classSpeed.begin(), classSpeed.end());
+                        std::vector<int> classSpan(numClasses, 1);
+                        for (std::size_t cls = 0; cls < numClasses; ++cls) {
+                            classSpan[cls] = std::max(1, std::min(8, static_cast<int>(classSpeed[cls] / slowest + 0.5f)));
+                        }
+                        // Per-worker-per-class samples; a worker migrating
+                        // between clusters mid-kernel books each span where
+                        // it actually ran
+                        std::vector<float> spanWindows(num_threads * numClasses, 0.0f);
+                        std::vector<float> spanSeconds(num_threads * numClasses, 0.0f);
+                        std::atomic<int> cursor{0};
+                        InferenceEngine::parallel_for(num_threads, [&] (int worker) {
+                            for (;;) {
+                                const int cls = currentCoreClass(_coreClass);
+                                const int begin = cursor.fetch_add(classSpan[cls]);
+                                if (begin >= num_windows) {
+                                    break;
+                                }
+                                const int end = std::min(begin + classSpan[cls], num_windows);
+                                const auto start = std::chrono::steady_clock::now();
+                                for (int windowId = begin; windowId < end; ++windowId) {
+                                    runWindow(windowId, num_windows);
+                                }
+                                spanWindows[worker * numClasses + cls] += end - begin;
+                                spanSeconds[worker * numClasses + cls] +=
+                                    std::chrono::duration<float>{std::chrono::steady_clock::now() - start}.count();
+                            }
+                        });
+                        // Blend the measured per-class throughput into the
+                        // calibration, mean-1 normalized like _workerSpeed so
+                        // every kernel contributes the same weight; blend
+                        // only when every class got sampled, a dispatch too
+                        // short to reach some cluster says nothing about it
+                        std::vector<float> throughput(numClasses, 0.0f);
+                        std::size_t sampled = 0;
+                        for (std::size_t cls = 0; cls < numClasses; ++cls) {
+                            float windows = 0.0f;
+                            float seconds = 0.0f;
+                            for (int worker = 0; worker < num_threads; ++worker) {
+                                windows += spanWindows[worker * numClasses + cls];
+                                seconds += spanSeconds[worker * numClasses + cls];
+                            }
+                            if ((windows > 0.0f) && (seconds > 0.0f)) {
+                                throughput[cls] = windows / seconds;
+                                ++sampled;
+                            }
+                        }
+                        const auto throughputTotal = std::accumulate(throughput.begin(), throughput.end(), 0.0f);
+                        if ((sampled == numClasses) && (throughputTotal > 0.0f)) {
+                            std::lock_guard<std::mutex> lock{_calibrationMutex};
+                            for (std::size_t cls = 0; cls < numClasses; ++cls) {
+                                _classSpeed[cls] = 0.75f * _classSpeed[cls] +
+                                                   0.25f * (throughput[cls] * numClasses / throughputTotal);
+                            }
+                        }
+                        return;
+                    }
+                    std::vector<std::atomic<int>> cursors(num_threads);
+                    auto rangeBegin = [&] (int worker) {return static_cast<int>((static_cast<std::int64_t>(num_windows) * worker) / num_threads);};
+                    for (int worker = 0; worker < num_threads; ++worker) {
+                        cursors[worker].store(rangeBegin(worker), std::memory_order_relaxed);
+                    }
+                    InferenceEngine::parallel_for(num_threads, [&] (int worker) {
+                        auto drain = [&] (int victim) {
+                            const int end = rangeBegin(victim + 1);
+                            for (;;) {
+                                const int windowId = cursors[victim].fetch_add(1);
+                                if (windowId >= end) {
+                                    break;
+                                }
+                                runWindow(windowId, num_windows);
+                            }
+                        };
+                        drain(worker);
+                        for (int victim = (worker + 1) % num_threads; victim != worker; victim = (victim + 1) % num_threads) {
+                            drain(victim);
+                        }
+                    });
+                };
+                // Granularity is tuned per kernel/window-shape key: the first runs try a
+                // few candidate window counts, then the fastest is locked in. A kernel
+                // with an explicit threshold still caps the candidate from above.
+                constexpr static int candidateMultipliers[] = {1, 2, 4, 8};
+                constexpr static int numCandidates = sizeof(candidateMultipliers) / sizeof(candidateMultipliers[0]);
+                constexpr static int samplesPerCandidate = 3;
+                const std::string key = std::string{kernel->name()} + ':' +
+                                        std::to_string(splitDimension) + ':' + std::to_string(num_iterations);
+                int num_windows = 0;
+                bool measuring = false;
+                {
+                    std::lock_guard<std::mutex> lock{_tuningMutex};
+                    auto itEntry = _tuning.find(key);
+                    if (itEntry == _tuning.end()) {
+                        itEntry = _tuning.emplace(key, TuneEntry{0, std::numeric_limits<float>::max(), 0, 0, 0.0f, false}).first;
+                    }
+                    if (itEntry->second._done) {
+                        num_windows = itEntry->second._bestWindows;
+                    } else {
+                        measuring = true;
+                        num_windows = num_threads * candidateMultipliers[itEntry->second._candidate];
+                    }
+                }
+                num_windows = std::min(num_windows, num_iterations);
+                if (hints.threshold() > 0) {
+                    num_windows = std::min(num_windows, hints.threshold());
+                }
+                telemetryWindows = num_windows;
+                if (!measuring) {
+                    runStealing(num_windows);
+                    break;
+                }
+                const auto start = std::chrono::steady_clock::now();
+                runStealing(num_windows);
+                const auto seconds = std::chrono::duration<float>{std::chrono::steady_clock::now() - start}.count();
+                {
+                    std::lock_guard<std::mutex> lock{_tuningMutex};
+                    auto& entry = _tuning[key];
+                    if (entry._done) {
+                        break;
+                    }
+                    entry._accum += seconds;
+                    if (++entry._samples == samplesPerCandidate) {
+                        const auto average = entry._accum / samplesPerCandidate;
+                        if (average < entry._bestTime) {
+                            entry._bestTime = average;
+                            entry._bestWindows = num_windows;
+                        }
+                        entry._samples = 0;
+                        entry._accum = 0.0f;
+                        if (++entry._candidate == numCandidates) {
+                            entry._done = true;
+                        }
+                    }
+                }
             } break;
             default: {
                 IE_ASSERT(!"Unknown strategy");
             }
         }
-        InferenceEngine::parallel_for(num_windows, [&] (int workloadId) {
-            arm_compute::ThreadInfo   info;
-            info.cpu_info       = &cpu_info();
-            info.num_threads    = parallel_get_num_threads();
-            info.thread_id      = parallel_get_thread_num();
-            auto win = max_window.split_window(splitDimension, workloadId, num_windows);
-            win.validate();
-            if (tensors.empty()) {
-                kernel->run(win, info);
-            } else {
-                kernel->run_op(tensors, win, info);
+        if (telemetry) {
+            float minBusy = std::numeric_limits<float>::max();
+            float maxBusy = 0.0f;
+            auto firstStart = std::chrono::steady_clock::time_point::max();
+            for (auto&& sample : samples) {
+                if (!sample._started) {
+                    continue;
+                }
+                minBusy = std::min(minBusy, sample._busy);
+                maxBusy = std::max(maxBusy, sample._busy);
+                firstStart = std::min(firstStart, sample._firstStart);
             }
-        });
+            if (maxBusy > 0.0f) {
+                const auto wait = std::max(0.0f, std::chrono::duration<float>{firstStart - dispatchStart}.count());
+                std::lock_guard<std::mutex> lock{_telemetryMutex};
+                auto itTelemetry = _telemetry.find(kernel->name());
+                if (itTelemetry == _telemetry.end()) {
+                    _telemetry.emplace(kernel->name(),
+                                       KernelTelemetry{splitDimension, telemetryWindows, 1, minBusy, maxBusy, wait});
+                } else {
+                    auto& record = itTelemetry->second;
+                    record._splitDimension = splitDimension;
+                    record._windowCount = telemetryWindows;
+                    ++record._runs;
+                    record._minWorkerTime = 0.75f * record._minWorkerTime + 0.25f * minBusy;
+                    record._maxWorkerTime = 0.75f * record._maxWorkerTime + 0.25f * maxBusy;
+                    record._queueWait = 0.75f * record._queueWait + 0.25f * wait;
+                }
+            }
+        }
+    }
+    if (tracing) {
+        // Kernel identity plus the split decision, so the trace shows how the
+        // dispatch was fanned out without cross-referencing the telemetry
+        char span[TraceRecorder::Event::NameCapacity];
+        if (runInline) {
+            std::snprintf(span, sizeof(span), "%s|inline", kernel->name());
+        } else {
+            std::snprintf(span, sizeof(span), "%s|d%u w%d", kernel->name(),
+                          static_cast<unsigned int>(splitDimension), telemetryWindows);
+        }
+        TraceRecorder::get().Record(span, traceStart, TraceRecorder::Clock::now());
     }
 }
 
@@ -86,12 +560,60 @@ void IEScheduler::schedule_op(arm_compute::ICPPKernel*  kernel,
 }
 
 void IEScheduler::run_workloads(std::vector<arm_compute::IScheduler::Workload>& workloads) {
+    // Workloads carry no kernel identity for the trace either
+    TraceScope trace{"run_workloads"};
+    if (!_telemetryEnabled.load(std::memory_order_relaxed)) {
+        InferenceEngine::parallel_for(workloads.size(), [&] (int workloadId) {
+            arm_compute::ThreadInfo   info;
+            info.cpu_info       = &cpu_info();
+            info.num_threads    = parallel_get_num_threads();
+            info.thread_id      = parallel_get_thread_num();
+            workloads[workloadId](info);
+        });
+        return;
+    }
+    // Workloads carry no kernel identity, so their statistics aggregate under
+    // one "run_workloads" telemetry key
+    const auto dispatchStart = std::chrono::steady_clock::now();
+    std::vector<float> busy(parallel_get_max_threads(), 0.0f);
+    std::vector<std::chrono::steady_clock::time_point> firstStarts(parallel_get_max_threads(),
+                                                                   std::chrono::steady_clock::time_point::max());
     InferenceEngine::parallel_for(workloads.size(), [&] (int workloadId) {
         arm_compute::ThreadInfo   info;
         info.cpu_info       = &cpu_info();
         info.num_threads    = parallel_get_num_threads();
         info.thread_id      = parallel_get_thread_num();
+        const auto start = std::chrono::steady_clock::now();
+        firstStarts[info.thread_id] = std::min(firstStarts[info.thread_id], start);
         workloads[workloadId](info);
+        busy[info.thread_id] += std::chrono::duration<float>{std::chrono::steady_clock::now() - start}.count();
     });
+    float minBusy = std::numeric_limits<float>::max();
+    float maxBusy = 0.0f;
+    auto firstStart = std::chrono::steady_clock::time_point::max();
+    for (std::size_t worker = 0; worker < busy.size(); ++worker) {
+        if (busy[worker] <= 0.0f) {
+            continue;
+        }
+        minBusy = std::min(minBusy, busy[worker]);
+        maxBusy = std::max(maxBusy, busy[worker]);
+        firstStart = std::min(firstStart, firstStarts[worker]);
+    }
+    if (maxBusy > 0.0f) {
+        const auto wait = std::max(0.0f, std::chrono::duration<float>{firstStart - dispatchStart}.count());
+        std::lock_guard<std::mutex> lock{_telemetryMutex};
+        auto itTelemetry = _telemetry.find("run_workloads");
+        if (itTelemetry == _telemetry.end()) {
+            _telemetry.emplace("run_workloads",
+                               KernelTelemetry{0, static_cast<int>(workloads.size()), 1, minBusy, maxBusy, wait});
+        } else {
+            auto& record = itTelemetry->second;
+            record._windowCount = static_cast<int>(workloads.size());
+            ++record._runs;
+            record._minWorkerTime = 0.75f * record._minWorkerTime + 0.25f * minBusy;
+            record._maxWorkerTime = 0.75f * record._maxWorkerTime + 0.25f * maxBusy;
+            record._queueWait = 0.75f * record._queueWait + 0.25f * wait;
+        }
+    }
 }
 
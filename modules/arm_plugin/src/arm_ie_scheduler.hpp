@@ -4,6 +4,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <arm_compute/runtime/Scheduler.h>
 #include <arm_compute/core/CPP/ICPPKernel.h>
 #include <arm_compute/core/ITensorPack.h>
@@ -24,5 +31,75 @@ struct IEScheduler final : public arm_compute::IScheduler {
                      const arm_compute::Window&             window,
                      arm_compute::ITensorPack&              tensors) override;
     void run_workloads(std::vector<arm_compute::IScheduler::Workload>& workloads) override;
+    // Per-stream intra-kernel thread cap, stored thread-local for the calling
+    // stream thread. Lets N concurrent streams partition the cores between them
+    // instead of every kernel's parallel_for spanning all of them.
+    static void SetStreamThreads(unsigned int numThreads);
+    // Converged split-granularity table I/O, see _tuning. The file holds one
+    // "key<TAB>windows" line per converged kernel so warm restarts skip retuning.
+    void LoadTuning(const std::string& path);
+    void StoreTuning(const std::string& path);
+    // Per-kernel-class scheduling statistics gathered while telemetry is enabled.
+    // Spread and wait values are EWMA-smoothed seconds; split dimension and
+    // window count reflect the most recent run.
+    struct KernelTelemetry {
+        std::size_t     _splitDimension;
+        int             _windowCount;
+        std::uint64_t   _runs;
+        float           _minWorkerTime;
+        float           _maxWorkerTime;
+        float           _queueWait;
+    };
+    void EnableTelemetry(bool enable);
+    std::map<std::string, KernelTelemetry> GetTelemetry();
+    void DumpTelemetryCsv(const std::string& path);
+    // Whether the default thread count respects the container cgroup quota
+    // (see CgroupLimitedCpus); CGROUP_LIMITS(NO) switches it off process-wide
+    void SetQuotaAware(bool enable);
+
+private:
+    // True on big.LITTLE parts where cpu models differ across cores
+    bool IsHeterogeneous();
+    // Intra-kernel thread cap, 0 keeps the IE executor default. Allows composing
+    // intra-op splitting with inter-op (wavefront) parallelism.
+    std::atomic<unsigned int> _numThreads{0};
+    // Cap the default thread count by the detected cgroup CPU quota
+    std::atomic<bool>         _quotaAware{true};
+    // Relative per-worker throughput learned online on heterogeneous parts and
+    // used to bias STATIC window splits towards the faster cores
+    std::vector<float>        _workerSpeed;
+    // Core-class topology of asymmetric parts: cpu index -> class id (one id
+    // per distinct core model) and EWMA-smoothed relative window throughput
+    // per class, mean-1 normalized. Calibrated online - warm-up dry runs
+    // converge it before traffic - and consumed by the per-class span
+    // selection of the DYNAMIC work-stealing path (see Schedule)
+    std::vector<int>          _coreClass;
+    std::vector<float>        _classSpeed;
+    std::mutex                _calibrationMutex;
+    // -1 until the topology is enumerated, then 0/1. The release store in
+    // IsHeterogeneous publishes _coreClass and the initial _classSpeed with
+    // it, so workers that see the flag through the acquire load also see the
+    // topology without taking the calibration mutex.
+    std::atomic<int>          _heterogeneous{-1};
+    // Per-kernel split-granularity auto-tuner: the first runs of each
+    // kernel/window-shape key try a few candidate window counts and the
+    // fastest one is locked in for the rest of the process lifetime
+    struct TuneEntry {
+        int     _bestWindows;
+        float   _bestTime;
+        int     _candidate;
+        int     _samples;
+        float   _accum;
+        bool    _done;
+    };
+    std::unordered_map<std::string, TuneEntry>  _tuning;
+    std::mutex                                  _tuningMutex;
+    // Smoothed inline execution time per kernel class, used to demote kernels
+    // that turn out too heavy for the inline fast path (see Schedule)
+    std::unordered_map<std::string, float>      _inlineTime;
+    std::mutex                                  _inlineMutex;
+    std::atomic<bool>                               _telemetryEnabled{false};
+    std::unordered_map<std::string, KernelTelemetry> _telemetry;
+    std::mutex                                      _telemetryMutex;
 };
 }  //  namespace ArmPlugin
@@ -5,9 +5,17 @@
 
 #include <utility>
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <future>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <map>
+#include <unordered_map>
+
+#include <ie_parallel.hpp>
 
 #include <ie_blob.h>
 #include <debug.h>
@@ -17,8 +25,12 @@
 #include <precision_utils.h>
 #include <ngraph/function.hpp>
 #include <ie_ngraph_utils.hpp>
-#include <ngraph/runtime/reference/convert.hpp>
+#include <cpp_interfaces/interface/ie_ivariable_state_internal.hpp>
 
+#include "arm_neon_convert.hpp"
+#include "arm_ie_scheduler.hpp"
+#include "arm_metrics.hpp"
+#include "arm_trace.hpp"
 #include "arm_infer_request.hpp"
 #include "arm_executable_network.hpp"
 #include "arm_plugin.hpp"
@@ -32,6 +44,38 @@ using Time = std::chrono::high_resolution_clock;
 using ns = std::chrono::nanoseconds;
 using fsec = std::chrono::duration<float>;
 
+// Structured profiling annotation built at request init: op type, I/O shapes
+// and element types plus the selected engine, so a profile tells a 1x1x2048
+// convolution from a 7x7x64 one without cross-referencing the IR. Emitted
+// through the per-layer ITT handle and trace span; the ACL kernel name and
+// the scheduler split decision come from the kernel dispatch span nested
+// inside the layer span.
+static std::string ProfilingAnnotation(const ngraph::Node* node, const std::string& execType) {
+    std::ostringstream annotation;
+    annotation << node->get_friendly_name() << '|' << node->get_type_name() << '|';
+    auto printTensor = [&annotation] (const ngraph::element::Type& type, const ngraph::Shape& shape) {
+        annotation << type.get_type_name() << ':';
+        for (std::size_t i = 0; i < shape.size(); ++i) {
+            annotation << (i == 0 ? "" : "x") << shape[i];
+        }
+    };
+    bool first = true;
+    for (auto&& input : node->inputs()) {
+        annotation << (first ? "" : ",");
+        first = false;
+        printTensor(input.get_element_type(), input.get_shape());
+    }
+    annotation << "->";
+    first = true;
+    for (auto&& output : node->outputs()) {
+        annotation << (first ? "" : ",");
+        first = false;
+        printTensor(output.get_element_type(), output.get_shape());
+    }
+    annotation << '|' << execType;
+    return annotation.str();
+}
+
 ArmInferRequest::ArmInferRequest(const InferenceEngine::InputsDataMap&                networkInputs,
                                  const InferenceEngine::OutputsDataMap&               networkOutputs,
                                  const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork) :
@@ -48,26 +92,72 @@ ArmInferRequest::ArmInferRequest(const std::vector<std::shared_ptr<const ov::Nod
 
 void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork) {
     _executableNetwork = executableNetwork;
-#if 1
-    _lifetime = std::make_shared<arm_compute::OffsetLifetimeManager>();
-#else
-    _lifetime = std::make_shared<arm_compute::BlobLifetimeManager>();
-#endif
-    _pool = std::make_shared<arm_compute::PoolManager>();
-    _memoryManager = std::make_shared<arm_compute::MemoryManagerOnDemand>(_lifetime, _pool);
-    _memoryGroup = std::make_unique<arm_compute::MemoryGroup>(_memoryManager);
-
-    auto requestID = std::to_string(_executableNetwork->_requestId.fetch_add(1));
-    Layer::Map layers;
-    IE_ASSERT(_executableNetwork->_executor != nullptr);
-    _executableNetwork->_executor->runAndWait({
-        [&] {
-            layers = Converter{_executableNetwork->_function, _executableNetwork->_cfg}.Configure(_memoryManager, *_memoryGroup);
+    _highPriority = (_executableNetwork->_cfg._requestPriority == "HIGH");
+    const auto requestNumber = _executableNetwork->_requestId.fetch_add(1);
+    auto requestID = std::to_string(requestNumber);
+    // ACL functions are configured once per execution context at network
+    // load; the request binds to one context round-robin and only wires I/O
+    // memory. Node lookups go through the context's function - the extra
+    // contexts execute their own clones of the transformed graph.
+    _graphContext = _executableNetwork->_contexts[static_cast<std::size_t>(requestNumber) %
+                                                  _executableNetwork->_contexts.size()];
+    const auto& function = _graphContext->_function;
+    Layer::Map& layers = _graphContext->_layers;
+    auto alignedSize = [] (const InferenceEngine::TensorDesc& desc) {
+        std::size_t bytes = desc.getPrecision().size();
+        for (auto&& dim : desc.getDims()) {
+            bytes *= dim;
         }
-    });
-    auto allocateMemory = [] (const auto& blobName, const auto& blobDataMap, auto& blobs, auto tensor, auto output) {
+        return (bytes + 63) & ~std::size_t{63};
+    };
+    // Pre-size the blob arena: the measuring pass mirrors the allocation
+    // conditions of allocateMemory below, so carving can never overrun
+    std::size_t arenaBytes = 0;
+    auto measure = [&] (const auto& blobDataMap, const std::string& blobName, const ngraph::Output<ngraph::Node>& output) {
+        auto itData = blobDataMap.find(blobName);
+        if ((itData == blobDataMap.end()) || ngraph::op::is_constant(output.get_node())) {
+            return;
+        }
+        const auto& desc = itData->second->getTensorDesc();
+        arenaBytes += alignedSize(desc);
+        auto networkPrecision = InferenceEngine::details::convertPrecision(output.get_element_type());
+        if (networkPrecision != desc.getPrecision()) {
+            arenaBytes += alignedSize({networkPrecision, desc.getDims(), desc.getLayout()});
+        }
+    };
+    for (auto&& node : function->get_parameters()) {
+        measure(_networkInputs, node->get_friendly_name(), node->output(0));
+    }
+    for (auto&& node : function->get_results()) {
+        measure(_networkOutputs, node->get_rt_info().at("ResultName").as<std::string>(), node->input(0).get_source_output());
+    }
+    // Padded output tensors additionally get a per-request padded staging
+    // area: every run binds either a conforming user buffer or this staging,
+    // so a request never drains outputs through another request's binding
+    for (auto&& node : function->get_results()) {
+        auto outputName = node->get_rt_info().at("ResultName").as<std::string>();
+        auto sourceOutput = node->input(0).get_source_output();
+        if ((_networkOutputs.find(outputName) != _networkOutputs.end()) &&
+            !ngraph::op::is_constant(sourceOutput.get_node())) {
+            auto tensor = layers.at(node->get_instance_id())._inputs.at(node->input(0))->_tensor.get();
+            if (tensor->info()->has_padding()) {
+                arenaBytes += (tensor->info()->total_size() + 63) & ~std::size_t{63};
+            }
+        }
+    }
+    _blobArena.resize(arenaBytes);
+    executableNetwork->_stagingBytesPerRequest = _blobArena.size();
+    auto carve = [this, &alignedSize] (const InferenceEngine::TensorDesc& desc) {
+        auto blob = make_blob_with_precision(desc, static_cast<void*>(_blobArena.data() + _blobArenaOffset));
+        _blobArenaOffset += alignedSize(desc);
+        return blob;
+    };
+    auto allocateMemory = [&executableNetwork, &carve] (const auto& blobName, const auto& blobDataMap, auto& blobs, auto tensor, auto output, bool direct) {
         auto itData = blobDataMap.find(blobName);
-        if (tensor->info()->has_padding() || (itData == blobDataMap.end())) {
+        // Unmarked outputs never import user memory (the producer tensor may
+        // be shared with a sibling Result), so their tensor keeps its own
+        // buffer and the drain copies out of it
+        if ((tensor->info()->has_padding() || (itData == blobDataMap.end()) || !direct) && (tensor->buffer() == nullptr)) {
             tensor->allocator()->allocate();
         }
         auto networkPresion = InferenceEngine::details::convertPrecision(output.get_element_type());
@@ -76,38 +166,46 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
             auto& blobData = itData->second;
             auto& blob = blobs[blobName];
             if (ngraph::op::is_constant(output.get_node())) {
+                // Constant-fed I/O is immutable, so every request shares one
+                // network-level blob instead of allocating its own copy
+                std::lock_guard<std::mutex> lock{executableNetwork->_constantBlobsMutex};
+                auto& sharedBlob = executableNetwork->_constantBlobs[blobName];
                 if (networkPresion == blobData->getTensorDesc().getPrecision()) {
-                    networkBlob = blob = make_blob_with_precision(blobData->getTensorDesc(),
-                                                                static_cast<arm_compute::Tensor*>(tensor)->buffer());
+                    if (sharedBlob == nullptr) {
+                        sharedBlob = make_blob_with_precision(blobData->getTensorDesc(),
+                                                              static_cast<arm_compute::Tensor*>(tensor)->buffer());
+                    }
+                    networkBlob = blob = sharedBlob;
                 } else {
-                    blob = make_blob_with_precision(blobData->getTensorDesc());
-                    blob->allocate();
+                    if (sharedBlob == nullptr) {
+                        sharedBlob = make_blob_with_precision(blobData->getTensorDesc());
+                        sharedBlob->allocate();
+                    }
+                    blob = sharedBlob;
                     networkBlob = make_blob_with_precision({networkPresion,
                                                             blobData->getTensorDesc().getDims(),
                                                             blobData->getTensorDesc().getLayout()},
                                                             static_cast<arm_compute::Tensor*>(tensor)->buffer());
                 }
             } else {
-                blob = make_blob_with_precision(blobData->getTensorDesc());
-                blob->allocate();
+                blob = carve(blobData->getTensorDesc());
                 if (networkPresion == blobData->getTensorDesc().getPrecision()) {
                     networkBlob = blob;
                 } else {
-                    networkBlob = make_blob_with_precision({networkPresion,
-                                                            blobData->getTensorDesc().getDims(),
-                                                            blobData->getTensorDesc().getLayout()});
-                    networkBlob->allocate();
+                    networkBlob = carve({networkPresion,
+                                         blobData->getTensorDesc().getDims(),
+                                         blobData->getTensorDesc().getLayout()});
                 }
             }
         }
         return networkBlob;
     };
-    for (auto&& node : _executableNetwork->_function->get_parameters()) {
+    for (auto&& node : function->get_parameters()) {
         auto nodeName = node->get_friendly_name();
         IE_ASSERT(node->outputs().size() == 1);
         for (auto&& output : node->outputs()) {
             auto tensor = layers.at(node->get_instance_id())._outputs.at(output)._tensor.get();
-            auto str = _executableNetwork->_function->get_friendly_name() + "_" +
+            auto str = function->get_friendly_name() + "_" +
                      requestID + "_preprocessing_" +
                      node->get_friendly_name() + "_" +
                      std::to_string(node->get_instance_id());
@@ -119,19 +217,21 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
                                _networkInputs,
                                _inputs,
                                tensor,
-                               output),
+                               output,
+                               true),
                 _inputs.find(nodeName),
                 "Preprocessing"});
         }
     }
 
-    for (auto&& node : _executableNetwork->_function->get_results()) {
+    for (auto&& node : function->get_results()) {
         IE_ASSERT(node->inputs().size() == 1);
         auto outputName = node->get_rt_info().at("ResultName").as<std::string>();
         auto input = node->input(0);
         auto sourceOutput = input.get_source_output();
         auto tensor = layers.at(node->get_instance_id())._inputs.at(input)->_tensor.get();
-        auto str = _executableNetwork->_function->get_friendly_name() + "_" +
+        const bool direct = (node->get_rt_info().count("DirectOutput") != 0);
+        auto str = function->get_friendly_name() + "_" +
                    requestID + "_postprocessing_" +
                    outputName + "_" +
                    std::to_string(node->get_instance_id());
@@ -143,24 +243,54 @@ void ArmInferRequest::InitArmInferRequest(const std::shared_ptr<ArmPlugin::Execu
                            _networkOutputs,
                            _outputs,
                            tensor,
-                           sourceOutput),
+                           sourceOutput,
+                           direct),
             _outputs.find(outputName),
             "Postprocessing"});
+        auto& ioInfo = _outputInfo.back();
+        ioInfo._direct = direct;
+        if ((ioInfo._blob != nullptr) && !ngraph::op::is_constant(sourceOutput.get_node()) &&
+            tensor->info()->has_padding()) {
+            ioInfo._paddedStaging = _blobArena.data() + _blobArenaOffset;
+            _blobArenaOffset += (tensor->info()->total_size() + 63) & ~std::size_t{63};
+        }
     }
     IE_ASSERT(!_outputInfo.empty());
-    _memoryManager->populate(_allocator, 1);
-    _memoryGroupScope = std::make_unique<arm_compute::MemoryGroupResourceScope>(*_memoryGroup);
-    for (auto&& node : _executableNetwork->_function->get_ordered_ops()) {
+    for (auto&& node : function->get_ordered_ops()) {
         auto& layer = layers.at(node->get_instance_id());
         auto execType = layer._execType;
+        auto annotation = ProfilingAnnotation(node.get(), execType);
         _layers.emplace_back(LayerInfo{
-            std::move(layer),
+            &layer,
             node.get(),
-            openvino::itt::handle(_executableNetwork->_function->get_friendly_name() + "_" +
+            openvino::itt::handle(function->get_friendly_name() + "_" +
                                   requestID + "_" +
-                                  node->get_friendly_name() + "_" +
+                                  annotation + "_" +
                                   std::to_string(node->get_instance_id())),
-            execType});
+            execType,
+            std::move(annotation)});
+    }
+    if (_executableNetwork->_cfg._wavefront) {
+        std::unordered_map<std::size_t, std::size_t> layerIndex;
+        std::size_t index = 0;
+        for (auto&& node : function->get_ordered_ops()) {
+            layerIndex.emplace(node->get_instance_id(), index++);
+        }
+        _layerDeps.resize(_layers.size());
+        for (std::size_t i = 0; i < _layers.size(); ++i) {
+            for (auto&& input : _layers[i]._node->inputs()) {
+                auto producer = layerIndex.at(input.get_source_output().get_node()->get_instance_id());
+                _layerDeps[i]._count++;
+                _layerDeps[producer]._consumers.push_back(i);
+            }
+        }
+    }
+    if (_executableNetwork->_cfg._pmuCounters && !_executableNetwork->_cfg._wavefront) {
+        _pmu = std::unique_ptr<PmuCounters>{new PmuCounters};
+        if (!_pmu->Available()) {
+            // No perf_event access (paranoid level, seccomp) - degrade silently
+            _pmu.reset();
+        }
     }
 }
 
@@ -168,80 +298,525 @@ ArmInferRequest::~ArmInferRequest() {
     _executableNetwork->_requestId--;
 }
 
+void ArmInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& userBlob) {
+    // Negotiated I/O: a blob carrying the network-native precision (reported by
+    // the PREFERRED_IO_DESCRIPTORS metric) is adopted into the port descriptor,
+    // so exactly one buffer exists and the conversion copy disappears; blobs in
+    // any other precision keep going through the conversion staging path
+    if (userBlob != nullptr) {
+        auto adopt = [&] (const auto& ioInfos, auto& blobDataMap) {
+            auto itData = blobDataMap.find(name);
+            if (itData == blobDataMap.end()) {
+                return;
+            }
+            for (auto&& info : ioInfos) {
+                if ((info._itBlob->first == name) && !ngraph::op::is_constant(info._output.get_node())) {
+                    auto nativePrecision = InferenceEngine::details::convertPrecision(info._output.get_element_type());
+                    if ((userBlob->getTensorDesc().getPrecision() == nativePrecision) &&
+                        (itData->second->getTensorDesc().getPrecision() != nativePrecision)) {
+                        itData->second->setPrecision(nativePrecision);
+                    }
+                }
+            }
+        };
+        adopt(_inputInfo, _networkInputs);
+        adopt(_outputInfo, _networkOutputs);
+        // Bucket routing accepts blobs smaller than the registered shape:
+        // dims that fit some bucket are adopted into the port descriptor the
+        // same way the precision is above, so the base-class size check
+        // passes and TryRunBucketed sees the actual extent
+        if (!_executableNetwork->_shapeBuckets.empty()) {
+            const auto& dims = userBlob->getTensorDesc().getDims();
+            auto fitsAnyBucket = [&] (bool isInput) {
+                for (auto&& bucket : _executableNetwork->_shapeBuckets) {
+                    for (auto&& io : isInput ? bucket._inputs : bucket._outputs) {
+                        if (io._name != name) {
+                            continue;
+                        }
+                        if (dims.size() != io._shape.size()) {
+                            return false;
+                        }
+                        bool fits = true;
+                        for (std::size_t i = 0; i < dims.size(); ++i) {
+                            if (isInput ? (dims[i] > io._shape[i]) : (dims[i] < io._shape[i])) {
+                                fits = false;
+                                break;
+                            }
+                        }
+                        if (fits) {
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            };
+            auto itInput = _networkInputs.find(name);
+            if (itInput != _networkInputs.end()) {
+                auto data = itInput->second->getInputData();
+                if ((data->getTensorDesc().getDims() != dims) && fitsAnyBucket(true)) {
+                    data->reshape(dims, data->getLayout());
+                }
+            }
+            auto itOutput = _networkOutputs.find(name);
+            if (itOutput != _networkOutputs.end()) {
+                if ((itOutput->second->getTensorDesc().getDims() != dims) && fitsAnyBucket(false)) {
+                    itOutput->second->reshape(dims, itOutput->second->getLayout());
+                }
+            }
+        }
+    }
+    IInferRequestInternal::SetBlob(name, userBlob);
+}
+
+void ArmInferRequest::LatencyHistogram::Record(const Duration& duration) {
+    auto us = duration.count();
+    std::size_t bucket = 0;
+    while ((bucket + 1 < BucketCount) && (us >= static_cast<float>(1u << (bucket + 1)))) {
+        ++bucket;
+    }
+    ++_buckets[bucket];
+    ++_count;
+}
+
+float ArmInferRequest::LatencyHistogram::Percentile(float percentile) const {
+    if (_count == 0) {
+        return 0.0f;
+    }
+    auto target = percentile / 100.0f * _count;
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < BucketCount; ++bucket) {
+        if (seen + _buckets[bucket] >= target) {
+            auto lower = static_cast<float>(1u << bucket);
+            auto fraction = (_buckets[bucket] != 0) ? (target - seen) / _buckets[bucket] : 0.0f;
+            return lower + fraction * lower;  // interpolate inside [2^b, 2^(b+1))
+        }
+        seen += _buckets[bucket];
+    }
+    return static_cast<float>(1u << (BucketCount - 1));
+}
+
 struct StaticCast {
     template<typename T> operator T*() {return static_cast<T*>(_ptr);}
     void* _ptr;
 };
+
+static double loadAsDouble(const void* data, std::size_t i, const ngraph::element::Type_t type) {
+    switch (type) {
+        case ngraph::element::Type_t::boolean : return static_cast<const std::uint8_t*>(data)[i] != 0;
+        case ngraph::element::Type_t::i8      : return static_cast<const std::int8_t*>(data)[i];
+        case ngraph::element::Type_t::u8      : return static_cast<const std::uint8_t*>(data)[i];
+        case ngraph::element::Type_t::i16     : return static_cast<const std::int16_t*>(data)[i];
+        case ngraph::element::Type_t::u16     : return static_cast<const std::uint16_t*>(data)[i];
+        case ngraph::element::Type_t::i32     : return static_cast<const std::int32_t*>(data)[i];
+        case ngraph::element::Type_t::u32     : return static_cast<const std::uint32_t*>(data)[i];
+        case ngraph::element::Type_t::i64     : return static_cast<double>(static_cast<const std::int64_t*>(data)[i]);
+        case ngraph::element::Type_t::u64     : return static_cast<double>(static_cast<const std::uint64_t*>(data)[i]);
+        case ngraph::element::Type_t::f16     : return static_cast<float>(static_cast<const ngraph::float16*>(data)[i]);
+        case ngraph::element::Type_t::f32     : return static_cast<const float*>(data)[i];
+        default : IE_THROW() << "Unsupported Type: " << type;
+    }
+}
+
+static void storeFromDouble(void* data, std::size_t i, const ngraph::element::Type_t type, const double value) {
+    switch (type) {
+        case ngraph::element::Type_t::boolean : static_cast<std::uint8_t*>(data)[i] = (value != 0.0); break;
+        case ngraph::element::Type_t::i8      : static_cast<std::int8_t*>(data)[i] = static_cast<std::int8_t>(value); break;
+        case ngraph::element::Type_t::u8      : static_cast<std::uint8_t*>(data)[i] = static_cast<std::uint8_t>(value); break;
+        case ngraph::element::Type_t::i16     : static_cast<std::int16_t*>(data)[i] = static_cast<std::int16_t>(value); break;
+        case ngraph::element::Type_t::u16     : static_cast<std::uint16_t*>(data)[i] = static_cast<std::uint16_t>(value); break;
+        case ngraph::element::Type_t::i32     : static_cast<std::int32_t*>(data)[i] = static_cast<std::int32_t>(value); break;
+        case ngraph::element::Type_t::u32     : static_cast<std::uint32_t*>(data)[i] = static_cast<std::uint32_t>(value); break;
+        case ngraph::element::Type_t::i64     : static_cast<std::int64_t*>(data)[i] = static_cast<std::int64_t>(value); break;
+        case ngraph::element::Type_t::u64     : static_cast<std::uint64_t*>(data)[i] = static_cast<std::uint64_t>(value); break;
+        case ngraph::element::Type_t::f16     : static_cast<ngraph::float16*>(data)[i] = ngraph::float16(static_cast<float>(value)); break;
+        case ngraph::element::Type_t::f32     : static_cast<float*>(data)[i] = static_cast<float>(value); break;
+        default : IE_THROW() << "Unsupported Type: " << type;
+    }
+}
+
+// Sparse conversion dispatch: same-precision copies are a straight memcpy,
+// the precision pairs that actually occur (commonTypes) keep their fully
+// specialized NEON converters, and every rare pair goes element-wise through
+// a double intermediate (exact for every integer up to 2^53). Instantiation
+// count stays linear in the number of types instead of the full cross
+// product, which is megabytes of .so and icache on embedded targets.
 static void blobCopy(const Blob::Ptr& src, const Blob::Ptr& dst) {
-    auto apply = [&] (auto convert) {
-        convert(
-            StaticCast{InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<void*>()},
-            StaticCast{InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<void*>()},
-            src->size());
+    const auto srcType = InferenceEngine::details::convertPrecision(src->getTensorDesc().getPrecision());
+    const auto dstType = InferenceEngine::details::convertPrecision(dst->getTensorDesc().getPrecision());
+    auto srcData = InferenceEngine::as<InferenceEngine::MemoryBlob>(src)->rmap().as<void*>();
+    auto dstData = InferenceEngine::as<InferenceEngine::MemoryBlob>(dst)->wmap().as<void*>();
+    if (srcType == dstType) {
+        std::memcpy(dstData, srcData, src->byteSize());
+        return;
+    }
+    if (TypeIn(srcType, commonTypes) && TypeIn(dstType, commonTypes)) {
+        auto apply = [&] (auto convert) {
+            convert(StaticCast{srcData}, StaticCast{dstData}, src->size());
+        };
+        CallSwitch(AP_WRAP(apply, ArmPlugin::neon::convert),
+                   srcType, commonTypes,
+                   dstType, commonTypes);
+        return;
+    }
+    const auto srcTypeT = static_cast<ngraph::element::Type_t>(srcType);
+    const auto dstTypeT = static_cast<ngraph::element::Type_t>(dstType);
+    for (std::size_t i = 0, size = src->size(); i < size; ++i) {
+        storeFromDouble(dstData, i, dstTypeT, loadAsDouble(srcData, i, srcTypeT));
+    }
+}
+
+// Strided copy between a dense user buffer and a padded ACL tensor. Rows stay contiguous
+// on both sides, so each row is a memcpy and rows are distributed over the IE thread pool
+// instead of staging the whole tensor through a temporary dense copy.
+static void paddedTensorCopy(const std::uint8_t* src, const arm_compute::Strides& srcStrides,
+                             std::uint8_t* dst, const arm_compute::Strides& dstStrides,
+                             const arm_compute::TensorShape& shape, std::size_t rowBytes) {
+    std::size_t numRows = 1;
+    for (std::size_t dim = 1; dim < shape.num_dimensions(); ++dim) {
+        numRows *= shape[dim];
+    }
+    InferenceEngine::parallel_for(numRows, [&] (std::size_t row) {
+        std::size_t srcOffset = 0;
+        std::size_t dstOffset = 0;
+        auto rest = row;
+        for (std::size_t dim = 1; dim < shape.num_dimensions(); ++dim) {
+            auto index = rest % shape[dim];
+            rest /= shape[dim];
+            srcOffset += index * srcStrides[dim];
+            dstOffset += index * dstStrides[dim];
+        }
+        std::memcpy(dst + dstOffset, src + srcOffset, rowBytes);
+    });
+}
+
+static arm_compute::Strides DenseStrides(const arm_compute::ITensorInfo* info) {
+    const auto& shape = info->tensor_shape();
+    arm_compute::Strides strides;
+    strides.set(0, info->element_size());
+    for (std::size_t dim = 1; dim < shape.num_dimensions(); ++dim) {
+        strides.set(dim, strides[dim - 1] * shape[dim - 1]);
+    }
+    return strides;
+}
+
+// True when the descriptor's memory layout matches the padded ACL tensor byte
+// for byte: same element size, plain dimension order, no blocking or extra
+// offsets, and byte strides equal to the tensor's. Such a user buffer honours
+// the aligned-output contract and the last layer can write into it directly.
+static bool conformsToTensorLayout(const InferenceEngine::TensorDesc& desc, const arm_compute::ITensorInfo* info) {
+    if (desc.getPrecision().size() != info->element_size()) {
+        return false;
+    }
+    const auto& blocking = desc.getBlockingDesc();
+    const auto& dims = desc.getDims();
+    if ((blocking.getBlockDims() != dims) || (blocking.getOffsetPadding() != 0)) {
+        return false;
+    }
+    for (auto&& offset : blocking.getOffsetPaddingToData()) {
+        if (offset != 0) {
+            return false;
+        }
+    }
+    const auto& order = blocking.getOrder();
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        if (order[i] != i) {
+            return false;
+        }
+    }
+    const auto rank = dims.size();
+    const auto& tensorStrides = info->strides_in_bytes();
+    if (rank != info->num_dimensions()) {
+        return false;
+    }
+    const auto& strides = blocking.getStrides();
+    for (std::size_t i = 0; i < rank; ++i) {
+        if (strides[i] * info->element_size() != tensorStrides[rank - 1 - i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void importPaddedTensor(const void* host, arm_compute::ITensor* tensor) {
+    const auto* info = tensor->info();
+    paddedTensorCopy(static_cast<const std::uint8_t*>(host), DenseStrides(info),
+                     tensor->buffer() + info->offset_first_element_in_bytes(), info->strides_in_bytes(),
+                     info->tensor_shape(), info->tensor_shape()[0] * info->element_size());
+}
+
+static void exportPaddedTensor(const arm_compute::ITensor* tensor, void* host) {
+    const auto* info = tensor->info();
+    paddedTensorCopy(tensor->buffer() + info->offset_first_element_in_bytes(), info->strides_in_bytes(),
+                     static_cast<std::uint8_t*>(host), DenseStrides(info),
+                     info->tensor_shape(), info->tensor_shape()[0] * info->element_size());
+}
+
+// Dense copy of a region between two unpadded buffers of the same rank: the
+// region's rows are memcpy'ed at the offsets they hold in each shape. The
+// shape-bucket path uses it to scatter a short input into a larger bucket
+// tensor and to gather a bucket output back into the full-shape user blob.
+static void denseRegionCopy(const void* src, const ngraph::Shape& srcShape,
+                            void* dst, const ngraph::Shape& dstShape,
+                            const ngraph::Shape& regionShape, std::size_t elementSize) {
+    const auto rank = regionShape.size();
+    auto reverse = [rank] (const ngraph::Shape& shape) {
+        arm_compute::TensorShape reversed;
+        for (std::size_t i = 0; i < rank; ++i) {
+            reversed.set(i, shape[rank - 1 - i], false);
+        }
+        return reversed;
     };
+    auto denseStrides = [rank, elementSize] (const ngraph::Shape& shape) {
+        arm_compute::Strides strides;
+        strides.set(0, elementSize);
+        for (std::size_t i = 1; i < rank; ++i) {
+            strides.set(i, strides[i - 1] * shape[rank - i]);
+        }
+        return strides;
+    };
+    paddedTensorCopy(static_cast<const std::uint8_t*>(src), denseStrides(srcShape),
+                     static_cast<std::uint8_t*>(dst), denseStrides(dstShape),
+                     reverse(regionShape), regionShape.back() * elementSize);
+}
 
-    CallSwitch(
-        AP_WRAP(apply, ngraph::runtime::reference::convert),
-        InferenceEngine::details::convertPrecision(src->getTensorDesc().getPrecision()), merge(allTypes, boolType),
-        InferenceEngine::details::convertPrecision(dst->getTensorDesc().getPrecision()), allTypes);
+template<bool PerfCount>
+void ArmInferRequest::RunGraph() {
+    // Stage samples feed the process-wide metrics registry; one relaxed
+    // atomic increment per stage, cheap enough to stay unconditional
+    auto& metrics = Metrics::get();
+    const auto requestStart = Time::now();
+    PreprocessImpl<PerfCount>();
+    const auto executeStart = Time::now();
+    ExecuteImpl<PerfCount>();
+    const auto postprocessStart = Time::now();
+    PostprocessImpl<PerfCount>();
+    const auto requestEnd = Time::now();
+    metrics.RecordStage(Metrics::Stage::Preprocess, fsec{executeStart - requestStart}.count());
+    metrics.RecordStage(Metrics::Stage::Execute, fsec{postprocessStart - executeStart}.count());
+    metrics.RecordStage(Metrics::Stage::Postprocess, fsec{requestEnd - postprocessStart}.count());
+    metrics.RecordRequest(fsec{requestEnd - requestStart}.count());
 }
 
-void ArmInferRequest::InferImpl() {
+template<bool PerfCount>
+void ArmInferRequest::PreprocessImpl() {
+    // Per-request preprocessing on private memory; runs outside the context
+    // lock so it overlaps the compute stage of other requests on the streams executor
+    TraceScope trace{"Preprocess"};
+    execDataPreprocessing(_inputs);
+    for (auto&& input : _inputInfo) {
+        Time::time_point start;
+        if (PerfCount) start = Time::now();
+        OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, input._profilingTask);
+        const auto& inputBlob = input._itBlob->second;
+        if ((inputBlob.get() != input._boundBlob) && (inputBlob != input._blob)) {
+            if (input._blob->getTensorDesc() == inputBlob->getTensorDesc()) {
+                input._blob = inputBlob;
+            } else {
+                blobCopy(inputBlob, input._blob);
+            }
+        }
+        if (PerfCount) {
+            input._duration += Time::now() - start;
+            input._counter++;
+        }
+    }
+}
+
+template<bool PerfCount>
+void ArmInferRequest::ExecuteImpl() {
     {
-        execDataPreprocessing(_inputs);
+        // The traced span starts before admission, so time spent waiting for
+        // the context shows up as the gap ahead of the first layer
+        TraceScope trace{"Execute"};
+        // Bind I/O into the context's tensors and run the kernels; admission
+        // is priority-aware, so a HIGH request overtakes queued NORMAL ones
+        ExecutableNetwork::GraphLock lock{*_executableNetwork, *_graphContext, _highPriority};
+        const auto bindGeneration = _executableNetwork->_bindGeneration.load();
+        if (bindGeneration != _boundGeneration) {
+            // The network was re-bound (snapshot restore moved the pools);
+            // cached imports point at the old addresses, bind everything anew
+            for (auto&& input : _inputInfo) {
+                input._boundBlob = nullptr;
+            }
+            for (auto&& output : _outputInfo) {
+                output._boundBlob = nullptr;
+            }
+            _boundGeneration = bindGeneration;
+        }
+        // The tensors are shared by the context's requests, so a cached
+        // binding holds only while the context's per-tensor import record
+        // still names this request's blob; a sibling's import in between
+        // forces a re-import here
+        auto& imports = _graphContext->_imports;
         for (auto&& input : _inputInfo) {
-            auto start = Time::now();
-            OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, input._profilingTask);
+            Time::time_point start;
+            if (PerfCount) start = Time::now();
             const auto& inputBlob = input._itBlob->second;
-            if (inputBlob != input._blob) {
-                if (input._blob->getTensorDesc() == inputBlob->getTensorDesc()) {
-                    input._blob = inputBlob;
-                } else {
-                    blobCopy(inputBlob, input._blob);
+            // Blob still bound into the tensor allocator, nothing to do on the hot path
+            if (inputBlob.get() == input._boundBlob) {
+                auto itImport = imports.find(input._tensor);
+                if ((itImport != imports.end()) && (itImport->second == input._boundBlob)) {
+                    continue;
                 }
             }
             if (input._tensor->info()->has_padding()) {
-                arm_compute::Tensor inputTensor;
-                inputTensor.allocator()->init({input._tensor->info()->tensor_shape(), 1, input._tensor->info()->data_type()});
-                inputTensor.allocator()->import_memory(
-                    InferenceEngine::as<InferenceEngine::MemoryBlob>(input._blob)->rmap().as<void*>());
-                input._tensor->copy_from(inputTensor);
+                importPaddedTensor(
+                    InferenceEngine::as<InferenceEngine::MemoryBlob>(input._blob)->rmap().as<void*>(),
+                    input._tensor);
             } else {
                 static_cast<arm_compute::Tensor*>(input._tensor)->allocator()->import_memory(
                     InferenceEngine::as<InferenceEngine::MemoryBlob>(input._blob)->rmap().as<void*>());
+                imports[input._tensor] = input._blob.get();
+                // A conversion-free import binds the user buffer itself, reuse it while the blob is unchanged
+                if (input._blob == inputBlob) {
+                    input._boundBlob = inputBlob.get();
+                }
+            }
+            if (PerfCount) {
+                input._duration += Time::now() - start;
             }
-            input._duration += Time::now() - start;
-            input._counter++;
         }
         for (auto&& output : _outputInfo) {
             if (output._blob != nullptr) {
                 const auto& outputBlob = output._itBlob->second;
+                if (outputBlob.get() == output._boundBlob) {
+                    auto itImport = imports.find(output._tensor);
+                    if ((itImport != imports.end()) && (itImport->second == output._boundBlob)) {
+                        continue;
+                    }
+                }
                 if (!ngraph::op::is_constant(output._output.get_node())) {
-                    if (outputBlob != output._blob) {
+                    // Only a DirectOutput-marked Result may adopt the user
+                    // blob as the tensor backing; an unmarked one (its
+                    // producer tensor is shared, see StoreResultName) keeps
+                    // its own tensor buffer and drains through the
+                    // postprocessing copy
+                    if (output._direct && (outputBlob != output._blob)) {
                         if (output._blob->getTensorDesc() == outputBlob->getTensorDesc()) {
                             output._blob = outputBlob;
                         }
                     }
                     if (!output._tensor->info()->has_padding()) {
-                        static_cast<arm_compute::Tensor*>(output._tensor)->allocator()->import_memory(
-                            InferenceEngine::as<InferenceEngine::MemoryBlob>(output._blob)->wmap().as<void*>());
+                        if (output._direct) {
+                            static_cast<arm_compute::Tensor*>(output._tensor)->allocator()->import_memory(
+                                InferenceEngine::as<InferenceEngine::MemoryBlob>(output._blob)->wmap().as<void*>());
+                            imports[output._tensor] = output._blob.get();
+                            // The user buffer is written directly by the last layer, no postprocessing copy is left
+                            if (output._blob == outputBlob) {
+                                output._boundBlob = outputBlob.get();
+                            }
+                        }
+                        // Unmarked: the tensor writes its own buffer and the
+                        // drain below moves it into this request's staging
+                    } else if (output._paddedStaging != nullptr) {
+                        // Aligned-output contract: a user blob whose strides
+                        // conform to the padded tensor layout is imported and
+                        // written directly, eliminating the drain copy; any
+                        // other blob rebinds this request's padded staging
+                        if (output._direct && conformsToTensorLayout(outputBlob->getTensorDesc(), output._tensor->info())) {
+                            static_cast<arm_compute::Tensor*>(output._tensor)->allocator()->import_memory(
+                                InferenceEngine::as<InferenceEngine::MemoryBlob>(outputBlob)->wmap().as<void*>());
+                            imports[output._tensor] = outputBlob.get();
+                            output._boundBlob = outputBlob.get();
+                        } else {
+                            static_cast<arm_compute::Tensor*>(output._tensor)->allocator()->import_memory(
+                                output._paddedStaging);
+                            imports[output._tensor] = nullptr;
+                            output._boundBlob = nullptr;
+                        }
                     }
                 }
             }
         }
-    }
-    for (auto&& layer : _layers) {
-        if (layer._layer._function != nullptr) {
-            OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, layer._profilingTask);
-            auto start = Time::now();
-            layer._layer._function->run();
-            layer._duration += Time::now() - start;
-            layer._counter++;
+        const bool adaptive = _executableNetwork->_cfg._adaptiveThrottling;
+        Time::time_point graphStart;
+        if (adaptive) graphStart = Time::now();
+        if (_executableNetwork->_cfg._wavefront) {
+            RunLayersWavefront();
+        } else {
+            auto* streamer = _executableNetwork->_weightStreamer.get();
+            if (streamer != nullptr) {
+                streamer->BeginRun();
+            }
+            std::size_t serialIndex = 0;
+            for (auto&& layer : _layers) {
+                if (streamer != nullptr) {
+                    // Kick readahead for the next layers' weights and hand
+                    // back the ones whose last consumer has run
+                    streamer->Advance(serialIndex);
+                }
+                ++serialIndex;
+                if (layer._layer->_function != nullptr) {
+                    OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, layer._profilingTask);
+                    TraceScope layerTrace{layer._annotation.c_str()};
+                    if (PerfCount) {
+                        if (_pmu != nullptr) _pmu->Start();
+                        auto start = Time::now();
+                        layer._layer->_function->run();
+                        auto spent = Duration{Time::now() - start};
+                        if (_pmu != nullptr) {
+                            // Counters follow this thread, so fanned-out kernels are
+                            // sampled on the dispatching thread's share of the work
+                            auto sample = _pmu->Stop();
+                            layer._pmuTotals._cycles       += sample._cycles;
+                            layer._pmuTotals._instructions += sample._instructions;
+                            layer._pmuTotals._cacheRefills += sample._cacheRefills;
+                            layer._pmuTotals._stallCycles  += sample._stallCycles;
+                        }
+                        layer._duration += spent;
+                        layer._counter++;
+                        layer._histogram.Record(spent);
+                    } else {
+                        layer._layer->_function->run();
+                    }
+                }
+            }
+        }
+        if (adaptive) {
+            _executableNetwork->RecordGraphTime(
+                std::chrono::duration<float, std::milli>{Time::now() - graphStart}.count());
+        }
+        // Padded and unmarked outputs read the shared tensors, so they drain
+        // before the lock is released; outputs bound straight into conforming
+        // user memory have nothing left to drain
+        for (auto&& output : _outputInfo) {
+            if ((output._blob != nullptr) && (output._itBlob->second.get() != output._boundBlob) &&
+                !ngraph::op::is_constant(output._output.get_node())) {
+                if (output._tensor->info()->has_padding()) {
+                    Time::time_point start;
+                    if (PerfCount) start = Time::now();
+                    exportPaddedTensor(
+                        output._tensor,
+                        InferenceEngine::as<InferenceEngine::MemoryBlob>(output._blob)->wmap().as<void*>());
+                    if (PerfCount) {
+                        output._duration += Time::now() - start;
+                    }
+                } else if (!output._direct) {
+                    // The tensor kept its own buffer (it may be shared with a
+                    // sibling Result); its contents move to this request's
+                    // staging while no other request can overwrite them
+                    Time::time_point start;
+                    if (PerfCount) start = Time::now();
+                    std::memcpy(InferenceEngine::as<InferenceEngine::MemoryBlob>(output._blob)->wmap().as<void*>(),
+                                output._tensor->buffer(),
+                                output._tensor->info()->total_size());
+                    if (PerfCount) {
+                        output._duration += Time::now() - start;
+                    }
+                }
+            }
         }
     }
+}
+
+template<bool PerfCount>
+void ArmInferRequest::PostprocessImpl() {
+    // Per-request postprocessing into user blobs, again outside the lock
+    TraceScope trace{"Postprocess"};
     for (auto&& output : _outputInfo) {
         if (output._blob != nullptr) {
-            auto start = Time::now();
+            Time::time_point start;
+            if (PerfCount) start = Time::now();
             OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, output._profilingTask);
             const auto& outputBlob = output._itBlob->second;
             if (ngraph::op::is_constant(output._output.get_node())) {
@@ -249,23 +824,306 @@ void ArmInferRequest::InferImpl() {
                     blobCopy(output._blob, outputBlob);
                 }
             } else {
-                if (output._tensor->info()->has_padding()) {
-                    arm_compute::Tensor outputTensor;
-                    outputTensor.allocator()->init({output._tensor->info()->tensor_shape(), 1, output._tensor->info()->data_type()});
-                    outputTensor.allocator()->import_memory(
-                        InferenceEngine::as<InferenceEngine::MemoryBlob>(output._blob)->wmap().as<void*>());
-                    outputTensor.copy_from(*(output._tensor));
-                }
-                if (outputBlob != output._blob) {
-                    if (output._blob->getTensorDesc() != outputBlob->getTensorDesc()) {
+                // An output bound straight into the user blob was already
+                // written by the last layer (negotiated or aligned-output);
+                // an unmarked output drains its staging even when the
+                // descriptors match, since it never adopts the user blob
+                if ((outputBlob != output._blob) && (outputBlob.get() != output._boundBlob)) {
+                    if (!output._direct || (output._blob->getTensorDesc() != outputBlob->getTensorDesc())) {
                         blobCopy(output._blob, outputBlob);
                     }
                 }
             }
-            output._duration += Time::now() - start;
-            output._counter++;
+            if (PerfCount) {
+                output._duration += Time::now() - start;
+                output._counter++;
+            }
+        }
+    }
+}
+
+void ArmInferRequest::RunLayersWavefront() {
+    const auto perfCount = _executableNetwork->_cfg._perfCount;
+    std::vector<std::atomic<int>> pending(_layers.size());
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        pending[i].store(_layerDeps[i]._count, std::memory_order_relaxed);
+    }
+    std::atomic<std::size_t> remaining{_layers.size()};
+    std::promise<void> allDone;
+    std::function<void(std::size_t)> dispatch = [&] (std::size_t index) {
+        auto& layer = _layers[index];
+        if (layer._layer->_function != nullptr) {
+            OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, layer._profilingTask);
+            TraceScope layerTrace{layer._annotation.c_str()};
+            if (perfCount) {
+                auto start = Time::now();
+                layer._layer->_function->run();
+                auto spent = Duration{Time::now() - start};
+                layer._duration += spent;
+                layer._counter++;
+                layer._histogram.Record(spent);
+            } else {
+                layer._layer->_function->run();
+            }
+        }
+        for (auto consumer : _layerDeps[index]._consumers) {
+            if (pending[consumer].fetch_sub(1) == 1) {
+                _executableNetwork->_executor->run([&dispatch, consumer] {dispatch(consumer);});
+            }
+        }
+        if (remaining.fetch_sub(1) == 1) {
+            allDone.set_value();
+        }
+    };
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        if (_layerDeps[i]._count == 0) {
+            _executableNetwork->_executor->run([&dispatch, i] {dispatch(i);});
+        }
+    }
+    allDone.get_future().wait();
+}
+
+bool ArmInferRequest::TryRunBatched() {
+    auto& net = *_executableNetwork;
+    const auto batchSize = static_cast<std::size_t>(net._cfg._autoBatch);
+    // The batched graph gathers raw blob memory, so user blobs must already match the network layout
+    for (auto&& batchedInput : net._batchedInputs) {
+        auto it = _inputs.find(batchedInput._name);
+        if ((it == _inputs.end()) || (it->second->byteSize() != batchedInput._sliceBytes)) {
+            return false;
+        }
+    }
+    for (auto&& batchedOutput : net._batchedOutputs) {
+        auto it = _outputs.find(batchedOutput._name);
+        if ((it == _outputs.end()) || (it->second->byteSize() != batchedOutput._sliceBytes)) {
+            return false;
+        }
+    }
+    // Batched runs bypass the per-context admission but still touch state the
+    // maintenance side frees (the batched tensors and their pool), so every
+    // participant holds a run share: hibernation waits for the batch to drain
+    // and cannot release the pool mid-run
+    ExecutableNetwork::RunScope runScope{net};
+    std::unique_lock<std::mutex> lock{net._batchMutex};
+    net._batchCv.wait(lock, [&] {return net._batchRequests.size() < batchSize;});
+    auto slot = net._batchRequests.size();
+    net._batchRequests.push_back(this);
+    for (auto&& batchedInput : net._batchedInputs) {
+        std::memcpy(batchedInput._tensor->buffer() + slot * batchedInput._sliceBytes,
+                    InferenceEngine::as<InferenceEngine::MemoryBlob>(_inputs.at(batchedInput._name))->rmap().as<const void*>(),
+                    batchedInput._sliceBytes);
+    }
+    auto myGeneration = net._batchGeneration;
+    auto runBatch = [&] {
+        for (auto&& node : net._batchedFunction->get_ordered_ops()) {
+            auto& layer = net._batchedLayers.at(node->get_instance_id());
+            if (layer._function != nullptr) {
+                layer._function->run();
+            }
+        }
+        for (std::size_t i = 0; i < net._batchRequests.size(); ++i) {
+            auto request = net._batchRequests[i];
+            for (auto&& batchedOutput : net._batchedOutputs) {
+                std::memcpy(InferenceEngine::as<InferenceEngine::MemoryBlob>(
+                                request->_outputs.at(batchedOutput._name))->wmap().as<void*>(),
+                            batchedOutput._tensor->buffer() + i * batchedOutput._sliceBytes,
+                            batchedOutput._sliceBytes);
+            }
+        }
+        net._batchRequests.clear();
+        net._batchGeneration++;
+        net._batchCv.notify_all();
+    };
+    if (slot + 1 == batchSize) {
+        runBatch();
+    } else {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(net._cfg._autoBatchTimeout);
+        net._batchCv.wait_until(lock, deadline, [&] {return net._batchGeneration != myGeneration;});
+        if (net._batchGeneration == myGeneration) {
+            // Collection window expired, flush the incomplete batch
+            runBatch();
+        }
+    }
+    return true;
+}
+
+bool ArmInferRequest::TryRunBucketed() {
+    auto& net = *_executableNetwork;
+    // Like the auto-batch path, buckets gather raw dense memory, so user
+    // blobs must carry the network-native element size; anything else falls
+    // back to the full-shape graph and its conversion staging
+    auto fits = [this] (const ExecutableNetwork::ShapeBucket& bucket) {
+        for (auto&& input : bucket._inputs) {
+            auto it = _inputs.find(input._name);
+            if (it == _inputs.end()) {
+                return false;
+            }
+            const auto& desc = it->second->getTensorDesc();
+            const auto& dims = desc.getDims();
+            if ((desc.getPrecision().size() != input._tensor->info()->element_size()) ||
+                (dims.size() != input._shape.size())) {
+                return false;
+            }
+            for (std::size_t i = 0; i < dims.size(); ++i) {
+                if (dims[i] > input._shape[i]) {
+                    return false;
+                }
+            }
+        }
+        for (auto&& output : bucket._outputs) {
+            auto it = _outputs.find(output._name);
+            if (it == _outputs.end()) {
+                return false;
+            }
+            const auto& desc = it->second->getTensorDesc();
+            const auto& dims = desc.getDims();
+            if ((desc.getPrecision().size() != output._tensor->info()->element_size()) ||
+                (dims.size() != output._shape.size())) {
+                return false;
+            }
+            for (std::size_t i = 0; i < dims.size(); ++i) {
+                if (dims[i] < output._shape[i]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    ExecutableNetwork::ShapeBucket* selected = nullptr;
+    for (auto&& bucket : net._shapeBuckets) {  // sorted ascending, the first fit is the smallest
+        if (fits(bucket)) {
+            selected = &bucket;
+            break;
+        }
+    }
+    if (selected == nullptr) {
+        return false;
+    }
+    // Bucket tensors and their activation pool are shared by every request
+    // regardless of its context, so bucket runs serialize through the first
+    // context's priority-aware admission
+    ExecutableNetwork::GraphLock lock{net, *net._contexts.front(), _highPriority};
+    for (auto&& input : selected->_inputs) {
+        const auto& blob = _inputs.at(input._name);
+        const auto& dims = blob->getTensorDesc().getDims();
+        const ngraph::Shape actualShape{dims.begin(), dims.end()};
+        auto host = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob)->rmap().as<const void*>();
+        if (actualShape == input._shape) {
+            std::memcpy(input._tensor->buffer(), host, input._tensor->info()->total_size());
+        } else {
+            // Shorter input: zero the tensor (the pad region behaves like
+            // padding tokens) and scatter the actual data at its dense offsets
+            std::memset(input._tensor->buffer(), 0, input._tensor->info()->total_size());
+            denseRegionCopy(host, actualShape, input._tensor->buffer(), input._shape,
+                            actualShape, input._tensor->info()->element_size());
+        }
+    }
+    for (auto&& node : selected->_function->get_ordered_ops()) {
+        auto& layer = selected->_layers.at(node->get_instance_id());
+        if (layer._function != nullptr) {
+            layer._function->run();
         }
     }
+    for (auto&& output : selected->_outputs) {
+        const auto& blob = _outputs.at(output._name);
+        const auto& dims = blob->getTensorDesc().getDims();
+        const ngraph::Shape userShape{dims.begin(), dims.end()};
+        auto host = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob)->wmap().as<void*>();
+        if (userShape == output._shape) {
+            std::memcpy(host, output._tensor->buffer(), output._tensor->info()->total_size());
+        } else {
+            // Larger user blob: the bucket's result lands at its dense
+            // offsets, the tail past the bucket extent is left untouched
+            denseRegionCopy(output._tensor->buffer(), output._shape, host, userShape,
+                            output._shape, output._tensor->info()->element_size());
+        }
+    }
+    return true;
+}
+
+void ArmInferRequest::InferImpl() {
+    const auto streamThreads = _executableNetwork->_cfg._adaptiveThrottling ?
+        _executableNetwork->AdaptiveStreamThreads() :
+        static_cast<unsigned int>(std::max(0, _executableNetwork->_streamIntraThreads));
+    if (streamThreads > 0) {
+        // Runs on a stream thread: cap this stream's kernels to its core share
+        // (stepped down further while the throttle controller sees overload)
+        IEScheduler::SetStreamThreads(streamThreads);
+    }
+    if (_executableNetwork->_cfg._autoBatch > 1) {
+        const auto start = Time::now();
+        if (TryRunBatched()) {
+            Metrics::get().RecordRequest(fsec{Time::now() - start}.count());
+            return;
+        }
+    }
+    if (!_executableNetwork->_shapeBuckets.empty()) {
+        const auto start = Time::now();
+        if (TryRunBucketed()) {
+            Metrics::get().RecordRequest(fsec{Time::now() - start}.count());
+            return;
+        }
+    }
+    if (_executableNetwork->_cfg._perfCount) {
+        RunGraph<true>();
+    } else {
+        RunGraph<false>();
+    }
+}
+
+void ArmInferRequest::Preprocess() {
+    const auto streamThreads = _executableNetwork->_cfg._adaptiveThrottling ?
+        _executableNetwork->AdaptiveStreamThreads() :
+        static_cast<unsigned int>(std::max(0, _executableNetwork->_streamIntraThreads));
+    if (streamThreads > 0) {
+        // Pipeline stages run on stream threads: cap this stream's kernels to its core share
+        IEScheduler::SetStreamThreads(streamThreads);
+    }
+    // The auto-batch and bucket-routing paths gather/scatter user blobs
+    // themselves, so the whole request runs inside the Execute stage and the
+    // other stages are no-ops
+    if ((_executableNetwork->_cfg._autoBatch > 1) || !_executableNetwork->_shapeBuckets.empty()) {
+        return;
+    }
+    _metricsStart = Time::now();
+    if (_executableNetwork->_cfg._perfCount) {
+        PreprocessImpl<true>();
+    } else {
+        PreprocessImpl<false>();
+    }
+    Metrics::get().RecordStage(Metrics::Stage::Preprocess, fsec{Time::now() - _metricsStart}.count());
+}
+
+void ArmInferRequest::Execute() {
+    if ((_executableNetwork->_cfg._autoBatch > 1) || !_executableNetwork->_shapeBuckets.empty()) {
+        InferImpl();
+        return;
+    }
+    const auto start = Time::now();
+    if (_executableNetwork->_cfg._perfCount) {
+        ExecuteImpl<true>();
+    } else {
+        ExecuteImpl<false>();
+    }
+    Metrics::get().RecordStage(Metrics::Stage::Execute, fsec{Time::now() - start}.count());
+}
+
+void ArmInferRequest::Postprocess() {
+    if ((_executableNetwork->_cfg._autoBatch > 1) || !_executableNetwork->_shapeBuckets.empty()) {
+        return;
+    }
+    const auto start = Time::now();
+    if (_executableNetwork->_cfg._perfCount) {
+        PostprocessImpl<true>();
+    } else {
+        PostprocessImpl<false>();
+    }
+    const auto end = Time::now();
+    auto& metrics = Metrics::get();
+    metrics.RecordStage(Metrics::Stage::Postprocess, fsec{end - start}.count());
+    // End-to-end latency of the pipelined request, from the Preprocess stage
+    // entry; the sync path records the same span inside RunGraph
+    metrics.RecordRequest(fsec{end - _metricsStart}.count());
 }
 
 std::map<std::string, InferenceEngineProfileInfo> ArmInferRequest::GetPerformanceCounts() const {
@@ -275,9 +1133,16 @@ std::map<std::string, InferenceEngineProfileInfo> ArmInferRequest::GetPerformanc
         InferenceEngineProfileInfo info;
         info.execution_index = executionIndex;
         ++executionIndex;
-        info.status = InferenceEngineProfileInfo::EXECUTED;
         info.cpu_uSec = 0;
-        info.realTime_uSec = layer._duration.count() / layer._counter;
+        // With PERF_COUNT off (or before the first inference) nothing was
+        // sampled; report the entry as not run instead of dividing by zero
+        if (layer._counter != 0) {
+            info.status = InferenceEngineProfileInfo::EXECUTED;
+            info.realTime_uSec = static_cast<long long>(layer._duration.count() / layer._counter);
+        } else {
+            info.status = InferenceEngineProfileInfo::NOT_RUN;
+            info.realTime_uSec = 0;
+        }
         auto type = "v" + std::to_string(node->get_type_info().version) + "::" + std::string {node->get_type_name()};
         {
             auto pos = std::copy_n(type.c_str(), std::min(sizeof(info.layer_type) - 1, type.size()), info.layer_type);
@@ -296,7 +1161,7 @@ std::map<std::string, InferenceEngineProfileInfo> ArmInferRequest::GetPerformanc
         fillInfo(input, input._output.get_node(), input._itBlob->first);
     }
     for (auto&& layer : _layers) {
-        if (layer._layer._function != nullptr) {
+        if (layer._layer->_function != nullptr) {
             fillInfo(layer, layer._node, layer._node->get_friendly_name());
         }
     }
@@ -307,3 +1172,72 @@ std::map<std::string, InferenceEngineProfileInfo> ArmInferRequest::GetPerformanc
     }
     return perfMap;
 }
+
+std::map<std::string, ArmInferRequest::LatencyHistogram> ArmInferRequest::GetLatencyHistograms() const {
+    std::map<std::string, LatencyHistogram> histograms;
+    for (auto&& layer : _layers) {
+        if (layer._layer->_function != nullptr) {
+            histograms.emplace(layer._node->get_friendly_name(), layer._histogram);
+        }
+    }
+    return histograms;
+}
+
+std::map<std::string, PmuCounters::Sample> ArmInferRequest::GetPmuCounts() const {
+    std::map<std::string, PmuCounters::Sample> counts;
+    if (_pmu != nullptr) {
+        for (auto&& layer : _layers) {
+            if (layer._layer->_function != nullptr) {
+                counts.emplace(layer._node->get_friendly_name(), layer._pmuTotals);
+            }
+        }
+    }
+    return counts;
+}
+
+namespace {
+// Request-facing view of a network-level variable state. Copies go through a
+// plain tensor imported over the user memory, so they stay correct when the
+// consumer kernels extended the state tensor with padding.
+struct ArmVariableState final : public InferenceEngine::IVariableStateInternal {
+    explicit ArmVariableState(const VariableState::Ptr& state) :
+        InferenceEngine::IVariableStateInternal{state->_name}, _state{state} {}
+    void Reset() override {
+        // ReadValue reseeds the state from its init input on the next run
+        _state->_initialized = false;
+    }
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override {
+        IE_ASSERT(_state->_tensor != nullptr);
+        if (newState->byteSize() != _state->_desc.getPrecision().size() *
+            InferenceEngine::details::product(_state->_desc.getDims())) {
+            IE_THROW() << "Blob size does not match the state size of variable " << _state->_name;
+        }
+        arm_compute::Tensor plain;
+        plain.allocator()->init({_state->_tensor->info()->tensor_shape(), 1, _state->_tensor->info()->data_type()});
+        plain.allocator()->import_memory(InferenceEngine::as<InferenceEngine::MemoryBlob>(newState)->rmap().as<void*>());
+        _state->_tensor->copy_from(plain);
+        plain.allocator()->free();
+        _state->_initialized = true;
+    }
+    InferenceEngine::Blob::CPtr GetState() const override {
+        IE_ASSERT(_state->_tensor != nullptr);
+        auto blob = make_blob_with_precision(_state->_desc);
+        blob->allocate();
+        arm_compute::Tensor plain;
+        plain.allocator()->init({_state->_tensor->info()->tensor_shape(), 1, _state->_tensor->info()->data_type()});
+        plain.allocator()->import_memory(InferenceEngine::as<InferenceEngine::MemoryBlob>(blob)->wmap().as<void*>());
+        plain.copy_from(*_state->_tensor);
+        plain.allocator()->free();
+        return blob;
+    }
+    VariableState::Ptr _state;
+};
+}  // namespace
+
+std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> ArmInferRequest::QueryState() {
+    std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> states;
+    for (auto&& state : *(_executableNetwork->_variableStates)) {
+        states.emplace_back(std::make_shared<ArmVariableState>(state.second));
+    }
+    return states;
+}
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <map>
 #include <string>
 #include <vector>
@@ -18,18 +20,12 @@
 #include "arm_converter/arm_converter.hpp"
 #include "arm_config.hpp"
 #include "arm_itt.hpp"
-
-#include <arm_compute/runtime/Allocator.h>
-#include <arm_compute/runtime/OffsetLifetimeManager.h>
-#include <arm_compute/runtime/PoolManager.h>
-#include <arm_compute/runtime/MemoryManagerOnDemand.h>
-#include <arm_compute/runtime/MemoryGroup.h>
-
-#include <arm_compute/runtime/BlobLifetimeManager.h>
+#include "arm_pmu.hpp"
 
 namespace ArmPlugin {
 
 class ExecutableNetwork;
+struct GraphContext;
 
 struct ArmInferRequest : public InferenceEngine::IInferRequestInternal {
     using Ptr = std::shared_ptr<ArmInferRequest>;
@@ -43,16 +39,50 @@ struct ArmInferRequest : public InferenceEngine::IInferRequestInternal {
     ~ArmInferRequest();
 
     void InferImpl() override;
+    // Accepts blobs in the network-native precision even when the registered
+    // I/O precision differs: the port descriptor is adopted and the
+    // per-inference conversion copy disappears (negotiated I/O)
+    void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& userBlob) override;
+    // Pipeline stage entry points used by ArmAsyncInferRequest; InferImpl runs
+    // the same stages back to back for synchronous Infer
+    void Preprocess();
+    void Execute();
+    void Postprocess();
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    // Wrappers over the network-level variable states (shared by all requests
+    // of the network, like the graph itself); supports get/set/reset
+    std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
+    // Per-layer latency histograms accumulated while PERF_COUNT is enabled;
+    // use LatencyHistogram::Percentile to extract p50/p95/p99
+    std::map<std::string, LatencyHistogram> GetLatencyHistograms() const;
+    // Accumulated PMU samples per layer (PMU_COUNTERS with PERF_COUNT); empty
+    // when sampling is off or perf_event access was denied
+    std::map<std::string, PmuCounters::Sample> GetPmuCounts() const;
 
     using Duration = std::chrono::duration<float, std::micro>;
+    // Fixed log2-bucket latency histogram: bucket b counts runs in [2^b, 2^(b+1)) us.
+    // Recording is allocation-free, so it can sit on the profiled hot path.
+    struct LatencyHistogram {
+        constexpr static std::size_t BucketCount = 24;
+        void Record(const Duration& duration);
+        // Percentile in [0, 100], returns microseconds interpolated inside the hit bucket
+        float Percentile(float percentile) const;
+        std::array<std::uint32_t, BucketCount>  _buckets;
+        std::uint64_t                           _count;
+    };
     struct LayerInfo {
-        Layer                   _layer;
+        Layer*                  _layer;
         ngraph::Node*           _node;
         openvino::itt::handle_t _profilingTask;
         std::string             _execType;
+        // "name|Type|in shapes->out shapes|engine" built at request init,
+        // shared by the ITT handle and the per-layer trace span
+        std::string             _annotation;
+        // Summed PMU readings of this layer's runs (PMU_COUNTERS)
+        PmuCounters::Sample     _pmuTotals;
         Duration                _duration;
         std::size_t             _counter;
+        LatencyHistogram        _histogram;
     };
     struct IOInfo {
         Output                              _output;
@@ -63,20 +93,75 @@ struct ArmInferRequest : public InferenceEngine::IInferRequestInternal {
         std::string                         _execType;
         Duration                            _duration;
         std::size_t                         _counter;
+        // User blob this request last imported into _tensor; the hot path may
+        // skip re-binding it only while the context's per-tensor import
+        // record (GraphContext::_imports) still names it - a sibling request
+        // re-importing the shared tensor invalidates the cached binding
+        const InferenceEngine::Blob*        _boundBlob;
+        // Per-request backing for a padded output tensor, bound before every
+        // run unless the user blob conforms to the tensor layout and is
+        // imported itself (aligned-output contract, see ExecuteImpl)
+        std::uint8_t*                       _paddedStaging;
+        // Output only: the Result carries the DirectOutput mark (see
+        // StoreResultName), so the producer tensor may bind user memory;
+        // unmarked outputs always drain through the staging copy
+        bool                                _direct;
+    };
+    // Per-layer dependency info used by the wavefront executor
+    struct LayerDeps {
+        int                         _count;
+        std::vector<std::size_t>    _consumers;
     };
     std::shared_ptr<ExecutableNetwork>                                          _executableNetwork;
+    // Execution context assigned round-robin at creation; the request caches
+    // pointers into this context's layers and tensors and serializes only
+    // against the other requests of the same context. Holding the shared_ptr
+    // keeps a retired generation alive after a network reshape.
+    std::shared_ptr<GraphContext>                                               _graphContext;
+    // Priority class captured from the network configuration at creation;
+    // HIGH requests bypass queued NORMAL work at the graph admission point
+    bool                                                                        _highPriority = false;
     std::vector<LayerInfo>                                                      _layers;
+    std::vector<LayerDeps>                                                      _layerDeps;
     std::vector<IOInfo>                                                         _inputInfo;
     std::vector<IOInfo>                                                         _outputInfo;
-    arm_compute::Allocator                                                      _allocator;
-    std::shared_ptr<arm_compute::ISimpleLifetimeManager>                        _lifetime;
-    std::shared_ptr<arm_compute::PoolManager>                                   _pool;
-    std::shared_ptr<arm_compute::MemoryManagerOnDemand>                         _memoryManager;
-    std::unique_ptr<arm_compute::MemoryGroup>                                   _memoryGroup;
-    std::unique_ptr<arm_compute::MemoryGroupResourceScope>                      _memoryGroupScope;
 
 private:
     void InitArmInferRequest(const std::shared_ptr<ArmPlugin::ExecutableNetwork>& executableNetwork);
+    // One slab backing every I/O staging blob of this request, sized from the
+    // network I/O descriptors and carved sequentially; a request costs one
+    // heap allocation instead of up to two per boundary, and the whole slab
+    // is returned as a unit when the request dies
+    std::vector<std::uint8_t>   _blobArena;
+    std::size_t                 _blobArenaOffset = 0;
+    // Network bind generation the cached I/O imports belong to; a mismatch
+    // (the network was re-bound after a snapshot restore) forces re-imports
+    std::uint64_t               _boundGeneration = 0;
+    // Per-layer PMU sampling on the serial profiled path; null when disabled
+    // or unavailable. The wavefront path runs layers concurrently on threads
+    // the per-thread counter group cannot follow, so it is not sampled.
+    std::unique_ptr<PmuCounters> _pmu;
+    // PERF_COUNT selects between the profiled path and a tight loop without clock calls
+    template<bool PerfCount>
+    void RunGraph();
+    template<bool PerfCount>
+    void PreprocessImpl();
+    template<bool PerfCount>
+    void ExecuteImpl();
+    template<bool PerfCount>
+    void PostprocessImpl();
+    // Dispatches independent layers concurrently onto the streams executor
+    void RunLayersWavefront();
+    // Joins the network's auto-batch group; returns false when this request's
+    // blobs are incompatible and the single-image path must be used instead
+    bool TryRunBatched();
+    // Routes this inference to the smallest shape bucket the bound input
+    // blobs fit into and runs that variant; returns false when no bucket fits
+    // and the full-shape graph must be used instead
+    bool TryRunBucketed();
+    // Preprocess-stage entry timestamp of the current pipelined run; the
+    // end-to-end latency recorded into the metrics registry spans from here
+    std::chrono::high_resolution_clock::time_point _metricsStart;
 };
 // ! [infer_request:header]
 
@@ -0,0 +1,54 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <sstream>
+
+#include <arm_compute/runtime/Scheduler.h>
+
+#include "arm_isa.hpp"
+
+using namespace ArmPlugin;
+
+std::vector<std::string> ArmPlugin::SupportedIsaExtensions() {
+    const auto& cpuInfo = arm_compute::Scheduler::get().cpu_info();
+    std::vector<std::string> extensions = {"NEON"};
+    if (cpuInfo.has_fp16()) {
+        extensions.emplace_back("FP16");
+    }
+    if (cpuInfo.has_dotprod()) {
+        extensions.emplace_back("DOTPROD");
+    }
+    if (cpuInfo.has_sve()) {
+        extensions.emplace_back("SVE");
+    }
+    if (cpuInfo.has_sve2()) {
+        extensions.emplace_back("SVE2");
+    }
+    if (cpuInfo.has_i8mm()) {
+        extensions.emplace_back("I8MM");
+    }
+    if (cpuInfo.has_bf16()) {
+        extensions.emplace_back("BF16");
+    }
+    return extensions;
+}
+
+bool ArmPlugin::IsaEnabled(const std::string& extension, const std::string& pinList) {
+    auto supported = SupportedIsaExtensions();
+    if (supported.end() == std::find(supported.begin(), supported.end(), extension)) {
+        return false;
+    }
+    if (pinList.empty()) {
+        return true;
+    }
+    std::istringstream stream{pinList};
+    std::string token;
+    while (std::getline(stream, token, ',')) {
+        if (token == extension) {
+            return true;
+        }
+    }
+    return false;
+}
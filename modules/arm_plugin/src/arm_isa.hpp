@@ -0,0 +1,17 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace ArmPlugin {
+// ISA extensions of the executing CPU as reported by the ACL scheduler's
+// CPUInfo; the baseline "NEON" entry is always present
+std::vector<std::string> SupportedIsaExtensions();
+// True when the extension is detected on this CPU and, if a comma-separated
+// KERNEL_ISA pin list is configured, also listed there
+bool IsaEnabled(const std::string& extension, const std::string& pinList);
+}  // namespace ArmPlugin
@@ -0,0 +1,43 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_load_profile.hpp"
+
+using namespace ArmPlugin;
+
+void LoadProfile::Record(const std::string& name, float milliseconds) {
+    auto itIndex = _index.find(name);
+    if (itIndex == _index.end()) {
+        _index.emplace(name, _entries.size());
+        _entries.push_back(Entry{name, 1, milliseconds});
+    } else {
+        auto& entry = _entries[itIndex->second];
+        ++entry._count;
+        entry._milliseconds += milliseconds;
+    }
+}
+
+std::vector<std::string> LoadProfile::Report() const {
+    std::vector<std::string> report;
+    report.reserve(_entries.size());
+    for (auto&& entry : _entries) {
+        report.push_back(entry._name + '\t' +
+                         std::to_string(entry._count) + '\t' +
+                         std::to_string(entry._milliseconds));
+    }
+    return report;
+}
+
+LoadProfileScope::LoadProfileScope(const std::shared_ptr<LoadProfile>& profile, const std::string& name) :
+    _profile{profile},
+    _name{name},
+    _start{std::chrono::high_resolution_clock::now()} {
+}
+
+LoadProfileScope::~LoadProfileScope() {
+    if (_profile != nullptr) {
+        _profile->Record(_name, std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(
+            std::chrono::high_resolution_clock::now() - _start).count());
+    }
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ArmPlugin {
+
+// Accumulates LoadNetwork wall time by named stage (transformation pipeline
+// stages, per-op-type ACL configure), so a slow load can be attributed to the
+// real bottleneck. Entries keep first-recording order; repeated names
+// accumulate. Filled on the single load thread, read afterwards - no locking.
+struct LoadProfile {
+    struct Entry {
+        std::string   _name;
+        std::uint64_t _count;
+        float         _milliseconds;
+    };
+    void Record(const std::string& name, float milliseconds);
+    // One "<name>\t<count>\t<total milliseconds>" row per entry
+    std::vector<std::string> Report() const;
+
+    std::vector<Entry>                           _entries;
+    std::unordered_map<std::string, std::size_t> _index;
+};
+
+// Records the lifetime of the scope into the profile; tolerates a null
+// profile so instrumented code needs no guards
+struct LoadProfileScope {
+    LoadProfileScope(const std::shared_ptr<LoadProfile>& profile, const std::string& name);
+    ~LoadProfileScope();
+    std::shared_ptr<LoadProfile>                   _profile;
+    std::string                                    _name;
+    std::chrono::high_resolution_clock::time_point _start;
+};
+
+}  // namespace ArmPlugin
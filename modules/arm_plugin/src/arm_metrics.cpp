@@ -0,0 +1,102 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+
+#include "arm_metrics.hpp"
+
+using namespace ArmPlugin;
+
+Metrics& Metrics::get() {
+    static Metrics metrics;
+    return metrics;
+}
+
+void Metrics::RecordRequest(float seconds) {
+    const auto us = static_cast<std::uint64_t>(seconds * 1e6f);
+    std::size_t bucket = 0;
+    while ((bucket + 1 < BucketCount) && ((std::uint64_t{1} << (bucket + 1)) <= us)) {
+        ++bucket;
+    }
+    _latencyBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    _latencySumUs.fetch_add(us, std::memory_order_relaxed);
+    _requests.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Metrics::RecordStage(Stage stage, float seconds) {
+    const auto index = static_cast<std::size_t>(stage);
+    _stageUs[index].fetch_add(static_cast<std::uint64_t>(seconds * 1e6f), std::memory_order_relaxed);
+    _stageRuns[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+void Metrics::QueueEnter() {
+    _queueDepth.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Metrics::QueueLeave() {
+    _queueDepth.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void Metrics::GraphEnter() {
+    _inFlight.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Metrics::GraphLeave() {
+    _inFlight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void Metrics::AddLayerCounts(std::uint64_t total, std::uint64_t reference) {
+    _totalLayers.fetch_add(total, std::memory_order_relaxed);
+    _referenceLayers.fetch_add(reference, std::memory_order_relaxed);
+}
+
+std::vector<std::string> Metrics::Snapshot() {
+    std::vector<std::string> lines;
+    const auto requests = _requests.load(std::memory_order_relaxed);
+    lines.emplace_back("arm_plugin_requests_total " + std::to_string(requests));
+    {
+        // Requests per second since the previous scrape; the first scrape has
+        // no baseline window and reports 0
+        std::lock_guard<std::mutex> lock{_snapshotMutex};
+        const auto now = std::chrono::steady_clock::now();
+        float rate = 0.0f;
+        if (_lastSnapshot != std::chrono::steady_clock::time_point{}) {
+            const auto seconds = std::chrono::duration<float>{now - _lastSnapshot}.count();
+            if (seconds > 0.0f) {
+                rate = (requests - _lastRequests) / seconds;
+            }
+        }
+        _lastSnapshot = now;
+        _lastRequests = requests;
+        lines.emplace_back("arm_plugin_request_rate " + std::to_string(rate));
+    }
+    // Cumulative histogram, Prometheus style: bucket b counts requests at or
+    // under 2^(b+1) microseconds
+    std::uint64_t cumulative = 0;
+    for (std::size_t bucket = 0; bucket < BucketCount; ++bucket) {
+        cumulative += _latencyBuckets[bucket].load(std::memory_order_relaxed);
+        lines.emplace_back("arm_plugin_request_latency_us_bucket{le=\"" +
+                           std::to_string(std::uint64_t{1} << (bucket + 1)) + "\"} " +
+                           std::to_string(cumulative));
+    }
+    lines.emplace_back("arm_plugin_request_latency_us_bucket{le=\"+Inf\"} " + std::to_string(cumulative));
+    lines.emplace_back("arm_plugin_request_latency_us_sum " +
+                       std::to_string(_latencySumUs.load(std::memory_order_relaxed)));
+    lines.emplace_back("arm_plugin_request_latency_us_count " + std::to_string(cumulative));
+    lines.emplace_back("arm_plugin_queue_depth " + std::to_string(_queueDepth.load(std::memory_order_relaxed)));
+    lines.emplace_back("arm_plugin_inflight_requests " + std::to_string(_inFlight.load(std::memory_order_relaxed)));
+    constexpr static const char* stageNames[] = {"preprocess", "execute", "postprocess"};
+    for (std::size_t stage = 0; stage < 3; ++stage) {
+        lines.emplace_back("arm_plugin_stage_us_total{stage=\"" + std::string{stageNames[stage]} + "\"} " +
+                           std::to_string(_stageUs[stage].load(std::memory_order_relaxed)));
+        lines.emplace_back("arm_plugin_stage_runs_total{stage=\"" + std::string{stageNames[stage]} + "\"} " +
+                           std::to_string(_stageRuns[stage].load(std::memory_order_relaxed)));
+    }
+    const auto totalLayers = _totalLayers.load(std::memory_order_relaxed);
+    const auto referenceLayers = _referenceLayers.load(std::memory_order_relaxed);
+    lines.emplace_back("arm_plugin_fallback_layer_share " +
+                       std::to_string(totalLayers > 0 ? static_cast<float>(referenceLayers) / totalLayers : 0.0f));
+    return lines;
+}
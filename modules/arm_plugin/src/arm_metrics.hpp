@@ -0,0 +1,73 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ArmPlugin {
+
+/**
+ * @brief Process-wide inference metrics registry.
+ *
+ * Aggregates what fleet dashboards scrape — request rate, end-to-end latency
+ * histogram, graph queue depth, per-stage time and the fallback-layer share —
+ * across every network loaded in the process, so exporting them is one metric
+ * call instead of per-pod glue around GetPerformanceCounts. All hot-path
+ * updates are single relaxed atomic increments; the only lock sits on the
+ * cold Snapshot path, where the since-last-scrape request rate is derived.
+ *
+ * The snapshot is emitted in the Prometheus text exposition format (one
+ * "name{labels} value" line per sample) through the plugin-level
+ * "METRICS_SNAPSHOT" metric, so a sidecar only has to join the lines.
+ */
+struct Metrics {
+    static Metrics& get();
+
+    enum class Stage { Preprocess, Execute, Postprocess };
+
+    /// Completed request with its end-to-end latency (all stages)
+    void RecordRequest(float seconds);
+    /// Time spent in one pipeline stage of one request
+    void RecordStage(Stage stage, float seconds);
+    /// Requests waiting for context admission (around the GraphLock wait)
+    void QueueEnter();
+    void QueueLeave();
+    /// Requests holding the graph
+    void GraphEnter();
+    void GraphLeave();
+    /// Layer counts of a loaded network, feeds the fallback-layer share
+    void AddLayerCounts(std::uint64_t total, std::uint64_t reference);
+
+    std::vector<std::string> Snapshot();
+
+private:
+    Metrics() = default;
+
+    // Log2-bucket latency histogram over microseconds, same bucketing as the
+    // per-layer LatencyHistogram but with atomic buckets so concurrent
+    // requests record without coordination
+    constexpr static std::size_t BucketCount = 24;
+    std::array<std::atomic<std::uint64_t>, BucketCount> _latencyBuckets{};
+    std::atomic<std::uint64_t>  _latencySumUs{0};
+    std::atomic<std::uint64_t>  _requests{0};
+    std::array<std::atomic<std::uint64_t>, 3> _stageUs{};
+    std::array<std::atomic<std::uint64_t>, 3> _stageRuns{};
+    std::atomic<std::int64_t>   _queueDepth{0};
+    std::atomic<std::int64_t>   _inFlight{0};
+    std::atomic<std::uint64_t>  _totalLayers{0};
+    std::atomic<std::uint64_t>  _referenceLayers{0};
+    // Previous-scrape state the request rate is derived from (cold path only)
+    std::mutex                                      _snapshotMutex;
+    std::uint64_t                                   _lastRequests = 0;
+    std::chrono::steady_clock::time_point           _lastSnapshot{};
+};
+
+}  // namespace ArmPlugin
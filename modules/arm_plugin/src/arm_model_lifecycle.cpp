@@ -0,0 +1,56 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_model_lifecycle.hpp"
+
+#include <algorithm>
+
+#include "arm_executable_network.hpp"
+
+namespace ArmPlugin {
+
+void ModelLifecycle::Register(ExecutableNetwork* network) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _entries.push_back({network, ++_tick});
+}
+
+void ModelLifecycle::Unregister(ExecutableNetwork* network) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _entries.erase(std::remove_if(_entries.begin(), _entries.end(),
+                                  [network] (const Entry& entry) { return entry._network == network; }),
+                   _entries.end());
+}
+
+void ModelLifecycle::Activate(ExecutableNetwork* network, std::size_t budgetBytes) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    std::size_t total = 0;
+    for (auto&& entry : _entries) {
+        if (entry._network == network) {
+            entry._lastUse = ++_tick;
+        }
+        total += entry._network->ActiveFootprint();
+    }
+    // Coldest first; a busy network declines (TryHibernate fails) and the
+    // next coldest is tried, so a long-running inference is never waited on
+    std::vector<Entry*> order;
+    for (auto&& entry : _entries) {
+        if (entry._network != network) {
+            order.push_back(&entry);
+        }
+    }
+    std::sort(order.begin(), order.end(), [] (const Entry* lhs, const Entry* rhs) {
+        return lhs->_lastUse < rhs->_lastUse;
+    });
+    for (auto* entry : order) {
+        if (total <= budgetBytes) {
+            break;
+        }
+        const auto before = entry->_network->ActiveFootprint();
+        if (entry->_network->TryHibernate()) {
+            total -= before - entry->_network->ActiveFootprint();
+        }
+    }
+}
+
+}  // namespace ArmPlugin
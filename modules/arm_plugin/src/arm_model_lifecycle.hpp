@@ -0,0 +1,43 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace ArmPlugin {
+
+struct ExecutableNetwork;
+
+// Plugin-level model lifecycle manager (MODEL_BUDGET_MB) for multi-tenant
+// serving, where many models stay loaded but only a few are hot at a time.
+// Live networks register here; every graph admission marks its network hot,
+// and while the sum of active footprints (activation slabs plus resident
+// weights) exceeds the budget, the least recently used idle networks are
+// hibernated: their pool slabs are freed and their weight payloads paged
+// out to the file backing. Re-activation happens transparently on the next
+// admission by re-populating the kept offset plan, so a cold model costs a
+// pool re-populate and demand paging, not a reload.
+struct ModelLifecycle {
+    void Register(ExecutableNetwork* network);
+    void Unregister(ExecutableNetwork* network);
+    // Marks `network` most recently used and hibernates the coldest idle
+    // networks until the remaining active footprints fit `budgetBytes`; the
+    // caller itself is never hibernated
+    void Activate(ExecutableNetwork* network, std::size_t budgetBytes);
+
+private:
+    struct Entry {
+        ExecutableNetwork*  _network;
+        std::uint64_t       _lastUse;
+    };
+    std::mutex          _mutex;
+    std::vector<Entry>  _entries;
+    std::uint64_t       _tick = 0;
+};
+
+}  // namespace ArmPlugin
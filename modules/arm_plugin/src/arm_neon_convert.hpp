@@ -0,0 +1,135 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <ngraph/runtime/reference/convert.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+namespace neon {
+
+// Precision conversion engine for the blobCopy I/O path. The primary template
+// falls back to the scalar ngraph reference loop, hot precision pairs are
+// specialized with NEON intrinsics below.
+template<typename S, typename D>
+void convert(const S* src, D* dst, std::size_t size) {
+    ngraph::runtime::reference::convert(src, dst, size);
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+template<> inline void convert<std::uint8_t, float>(const std::uint8_t* src, float* dst, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t u8 = vld1q_u8(src + i);
+        uint16x8_t lo = vmovl_u8(vget_low_u8(u8));
+        uint16x8_t hi = vmovl_u8(vget_high_u8(u8));
+        vst1q_f32(dst + i +  0, vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))));
+        vst1q_f32(dst + i +  4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))));
+        vst1q_f32(dst + i +  8, vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))));
+        vst1q_f32(dst + i + 12, vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))));
+    }
+    for (; i < size; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+template<> inline void convert<float, std::uint8_t>(const float* src, std::uint8_t* dst, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        uint32x4_t q0 = vcvtq_u32_f32(vld1q_f32(src + i +  0));
+        uint32x4_t q1 = vcvtq_u32_f32(vld1q_f32(src + i +  4));
+        uint32x4_t q2 = vcvtq_u32_f32(vld1q_f32(src + i +  8));
+        uint32x4_t q3 = vcvtq_u32_f32(vld1q_f32(src + i + 12));
+        uint16x8_t lo = vcombine_u16(vmovn_u32(q0), vmovn_u32(q1));
+        uint16x8_t hi = vcombine_u16(vmovn_u32(q2), vmovn_u32(q3));
+        vst1q_u8(dst + i, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+    }
+    for (; i < size; ++i) {
+        dst[i] = static_cast<std::uint8_t>(src[i]);
+    }
+}
+
+template<> inline void convert<std::int64_t, std::int32_t>(const std::int64_t* src, std::int32_t* dst, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        int32x2_t lo = vmovn_s64(vld1q_s64(src + i + 0));
+        int32x2_t hi = vmovn_s64(vld1q_s64(src + i + 2));
+        vst1q_s32(dst + i, vcombine_s32(lo, hi));
+    }
+    for (; i < size; ++i) {
+        dst[i] = static_cast<std::int32_t>(src[i]);
+    }
+}
+
+#if defined(__ARM_FP16_FORMAT_IEEE)
+
+template<> inline void convert<ngraph::float16, float>(const ngraph::float16* src, float* dst, std::size_t size) {
+    auto f16 = reinterpret_cast<const float16_t*>(src);
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        float16x8_t h = vld1q_f16(f16 + i);
+        vst1q_f32(dst + i + 0, vcvt_f32_f16(vget_low_f16(h)));
+        vst1q_f32(dst + i + 4, vcvt_f32_f16(vget_high_f16(h)));
+    }
+    for (; i < size; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+template<> inline void convert<float, ngraph::float16>(const float* src, ngraph::float16* dst, std::size_t size) {
+    auto f16 = reinterpret_cast<float16_t*>(dst);
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        float16x4_t lo = vcvt_f16_f32(vld1q_f32(src + i + 0));
+        float16x4_t hi = vcvt_f16_f32(vld1q_f32(src + i + 4));
+        vst1q_f16(f16 + i, vcombine_f16(lo, hi));
+    }
+    for (; i < size; ++i) {
+        dst[i] = ngraph::float16(src[i]);
+    }
+}
+
+template<> inline void convert<std::uint8_t, ngraph::float16>(const std::uint8_t* src, ngraph::float16* dst, std::size_t size) {
+    auto f16 = reinterpret_cast<float16_t*>(dst);
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint16x8_t u16 = vmovl_u8(vld1_u8(src + i));
+        float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(u16)));
+        float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(u16)));
+        vst1q_f16(f16 + i, vcombine_f16(vcvt_f16_f32(lo), vcvt_f16_f32(hi)));
+    }
+    for (; i < size; ++i) {
+        dst[i] = ngraph::float16(static_cast<float>(src[i]));
+    }
+}
+
+template<> inline void convert<ngraph::float16, std::uint8_t>(const ngraph::float16* src, std::uint8_t* dst, std::size_t size) {
+    auto f16 = reinterpret_cast<const float16_t*>(src);
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        float16x8_t h = vld1q_f16(f16 + i);
+        uint32x4_t lo = vcvtq_u32_f32(vcvt_f32_f16(vget_low_f16(h)));
+        uint32x4_t hi = vcvtq_u32_f32(vcvt_f32_f16(vget_high_f16(h)));
+        uint16x8_t u16 = vcombine_u16(vmovn_u32(lo), vmovn_u32(hi));
+        vst1_u8(dst + i, vmovn_u16(u16));
+    }
+    for (; i < size; ++i) {
+        dst[i] = static_cast<std::uint8_t>(static_cast<float>(src[i]));
+    }
+}
+
+#endif  // defined(__ARM_FP16_FORMAT_IEEE)
+
+#endif  // defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+}  //  namespace neon
+}  //  namespace ArmPlugin
@@ -0,0 +1,279 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+namespace neon {
+
+// NEON polynomial approximations for the transcendental unary ops the ACL
+// function set does not cover (Erf, Cos, Atanh). The scalar libm reference
+// loops behind these ops cost whole percents of transformer latency (GELU's
+// Erf in particular), so the converter routes f32 tensors here instead when
+// FAST_MATH is on; FAST_MATH(NO) keeps the bit-exact libm loops.
+//
+// Accuracy (f32, against libm):
+//   erf    max abs error 1.5e-7 (Abramowitz-Stegun 7.1.26 + exp polynomial)
+//   cos    max abs error ~2 ulp for |x| < 8192, degrading with the single
+//          precision Cody-Waite reduction beyond that
+//   atanh  max rel error ~1e-6 on |x| <= 0.9999, +/-inf at +/-1, NaN outside
+//          the domain, matching libm behavior
+//   swish  max rel error ~1e-6 (one exp per element instead of the
+//          multiply/sigmoid/multiply chain the decomposition emitted)
+//   mish   max rel error ~2e-6 (exp + log + exp fused in registers instead
+//          of the five-op decomposition with four intermediate tensors)
+//
+// Each entry point parallelizes across the load/stream executor the caller
+// runs on, so big activation tensors do not serialize on one core the way
+// the reference loops did.
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+namespace detail {
+
+// floor without relying on the armv8-only vrndmq
+inline float32x4_t vfloorq(const float32x4_t x) {
+    const int32x4_t truncated = vcvtq_s32_f32(x);
+    const float32x4_t rounded = vcvtq_f32_s32(truncated);
+    const uint32x4_t larger = vcgtq_f32(rounded, x);
+    return vsubq_f32(rounded, vreinterpretq_f32_u32(vandq_u32(larger, vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+}
+
+// reciprocal with two Newton refinements (vdivq is armv8-only)
+inline float32x4_t vrecipq(const float32x4_t x) {
+    float32x4_t recip = vrecpeq_f32(x);
+    recip = vmulq_f32(recip, vrecpsq_f32(x, recip));
+    recip = vmulq_f32(recip, vrecpsq_f32(x, recip));
+    return recip;
+}
+
+// cephes expf: clamped to the finite range, max rel error ~2 ulp
+inline float32x4_t vexpq(float32x4_t x) {
+    x = vminq_f32(vdupq_n_f32(88.3762626647950f), vmaxq_f32(vdupq_n_f32(-88.3762626647949f), x));
+    float32x4_t fx = vmlaq_f32(vdupq_n_f32(0.5f), x, vdupq_n_f32(1.44269504088896341f));
+    fx = vfloorq(fx);
+    x = vmlsq_f32(x, fx, vdupq_n_f32(0.693359375f));
+    x = vmlsq_f32(x, fx, vdupq_n_f32(-2.12194440e-4f));
+    float32x4_t y = vdupq_n_f32(1.9875691500e-4f);
+    y = vmlaq_f32(vdupq_n_f32(1.3981999507e-3f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(8.3334519073e-3f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(4.1665795894e-2f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(1.6666665459e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(5.0000001201e-1f), y, x);
+    y = vmlaq_f32(x, y, vmulq_f32(x, x));
+    y = vaddq_f32(y, vdupq_n_f32(1.0f));
+    const int32x4_t pow2n = vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(fx), vdupq_n_s32(127)), 23);
+    return vmulq_f32(y, vreinterpretq_f32_s32(pow2n));
+}
+
+// cephes logf: NaN for negative input, -inf at zero, max rel error ~2 ulp
+inline float32x4_t vlogq(float32x4_t x) {
+    const uint32x4_t invalid = vcleq_f32(x, vdupq_n_f32(0.0f));
+    const uint32x4_t zero = vceqq_f32(x, vdupq_n_f32(0.0f));
+    x = vmaxq_f32(x, vdupq_n_f32(1.17549435e-38f));
+    int32x4_t e = vshrq_n_s32(vreinterpretq_s32_f32(x), 23);
+    x = vreinterpretq_f32_u32(vorrq_u32(
+        vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x007FFFFF)),
+        vdupq_n_u32(0x3F000000)));
+    e = vsubq_s32(e, vdupq_n_s32(126));
+    float32x4_t fe = vcvtq_f32_s32(e);
+    const uint32x4_t small = vcltq_f32(x, vdupq_n_f32(0.707106781186547524f));
+    fe = vsubq_f32(fe, vreinterpretq_f32_u32(vandq_u32(small, vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+    x = vaddq_f32(x, vreinterpretq_f32_u32(vandq_u32(small, vreinterpretq_u32_f32(x))));
+    x = vsubq_f32(x, vdupq_n_f32(1.0f));
+    float32x4_t y = vdupq_n_f32(7.0376836292e-2f);
+    y = vmlaq_f32(vdupq_n_f32(-1.1514610310e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(1.1676998740e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(-1.2420140846e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(1.4249322787e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(-1.6668057665e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(2.0000714765e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(-2.4999993993e-1f), y, x);
+    y = vmlaq_f32(vdupq_n_f32(3.3333331174e-1f), y, x);
+    const float32x4_t x2 = vmulq_f32(x, x);
+    y = vmulq_f32(vmulq_f32(y, x2), x);
+    y = vmlaq_f32(y, fe, vdupq_n_f32(-2.12194440e-4f));
+    y = vmlsq_f32(y, x2, vdupq_n_f32(0.5f));
+    x = vaddq_f32(x, y);
+    x = vmlaq_f32(x, fe, vdupq_n_f32(0.693359375f));
+    // -inf at zero, NaN below it
+    x = vbslq_f32(zero, vdupq_n_f32(-INFINITY), x);
+    return vbslq_f32(invalid, vbslq_f32(zero, vdupq_n_f32(-INFINITY), vdupq_n_f32(NAN)), x);
+}
+
+inline float32x4_t verfq(const float32x4_t x) {
+    // Abramowitz-Stegun 7.1.26: erf(|x|) = 1 - poly(t) * exp(-x^2),
+    // t = 1 / (1 + 0.3275911 |x|); sign restored at the end
+    const float32x4_t ax = vabsq_f32(x);
+    const float32x4_t t = vrecipq(vmlaq_f32(vdupq_n_f32(1.0f), ax, vdupq_n_f32(0.3275911f)));
+    float32x4_t poly = vdupq_n_f32(1.061405429f);
+    poly = vmlaq_f32(vdupq_n_f32(-1.453152027f), poly, t);
+    poly = vmlaq_f32(vdupq_n_f32(1.421413741f), poly, t);
+    poly = vmlaq_f32(vdupq_n_f32(-0.284496736f), poly, t);
+    poly = vmlaq_f32(vdupq_n_f32(0.254829592f), poly, t);
+    poly = vmulq_f32(poly, t);
+    const float32x4_t gauss = vexpq(vnegq_f32(vmulq_f32(ax, ax)));
+    const float32x4_t y = vmlsq_f32(vdupq_n_f32(1.0f), poly, gauss);
+    const uint32x4_t signBit = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000));
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(y), signBit));
+}
+
+inline float32x4_t vcosq(float32x4_t x) {
+    // cephes cos_ps: quadrant decomposition with a two-constant Cody-Waite
+    // pi/4 reduction, then the sin or cos polynomial per quadrant
+    x = vabsq_f32(x);
+    float32x4_t y = vmulq_f32(x, vdupq_n_f32(1.27323954473516f));
+    int32x4_t j = vcvtq_s32_f32(y);
+    j = vaddq_s32(j, vdupq_n_s32(1));
+    j = vandq_s32(j, vdupq_n_s32(~1));
+    y = vcvtq_f32_s32(j);
+    j = vsubq_s32(j, vdupq_n_s32(2));
+    const uint32x4_t signMask = vtstq_s32(vmvnq_s32(j), vdupq_n_s32(4));
+    const uint32x4_t polyMask = vtstq_s32(j, vdupq_n_s32(2));
+    x = vmlaq_f32(x, y, vdupq_n_f32(-0.78515625f));
+    x = vmlaq_f32(x, y, vdupq_n_f32(-2.4187564849853515625e-4f));
+    x = vmlaq_f32(x, y, vdupq_n_f32(-3.77489497744594108e-8f));
+    const float32x4_t z = vmulq_f32(x, x);
+    // cos polynomial
+    float32x4_t yc = vdupq_n_f32(2.443315711809948e-5f);
+    yc = vmlaq_f32(vdupq_n_f32(-1.388731625493765e-3f), yc, z);
+    yc = vmlaq_f32(vdupq_n_f32(4.166664568298827e-2f), yc, z);
+    yc = vmulq_f32(vmulq_f32(yc, z), z);
+    yc = vmlsq_f32(yc, z, vdupq_n_f32(0.5f));
+    yc = vaddq_f32(yc, vdupq_n_f32(1.0f));
+    // sin polynomial
+    float32x4_t ys = vdupq_n_f32(-1.9515295891e-4f);
+    ys = vmlaq_f32(vdupq_n_f32(8.3321608736e-3f), ys, z);
+    ys = vmlaq_f32(vdupq_n_f32(-1.6666654611e-1f), ys, z);
+    ys = vmulq_f32(vmulq_f32(ys, z), x);
+    ys = vaddq_f32(ys, x);
+    float32x4_t result = vbslq_f32(polyMask, ys, yc);
+    return vbslq_f32(signMask, result, vnegq_f32(result));
+}
+
+// tanh for non-negative arguments only (the softplus output mish feeds it):
+// tanh(s) = 1 - 2 / (exp(2s) + 1); the clamped vexpq keeps the denominator
+// finite, so no special casing is needed
+inline float32x4_t vtanhq_nonneg(const float32x4_t s) {
+    const float32x4_t e2s = vexpq(vaddq_f32(s, s));
+    const float32x4_t den = vaddq_f32(e2s, vdupq_n_f32(1.0f));
+    return vmlsq_f32(vdupq_n_f32(1.0f), vdupq_n_f32(2.0f), vrecipq(den));
+}
+
+inline float32x4_t vatanhq(const float32x4_t x) {
+    // atanh(x) = 0.5 * log((1 + x) / (1 - x)); the log supplies +/-inf at
+    // +/-1 and NaN outside the domain
+    const float32x4_t num = vaddq_f32(vdupq_n_f32(1.0f), x);
+    const float32x4_t den = vsubq_f32(vdupq_n_f32(1.0f), x);
+    return vmulq_f32(vdupq_n_f32(0.5f), vlogq(vmulq_f32(num, vrecipq(den))));
+}
+
+// Runs a 4-lane kernel over the whole tensor, parallelized across the
+// executor; the sub-vector tail goes through the same kernel on a padded
+// stack block so every element sees the identical approximation
+template<typename Kernel>
+void transcendental(const float* src, float* dst, std::size_t size, Kernel kernel) {
+    const std::size_t vectors = size / 4;
+    constexpr std::size_t chunkVectors = 4096;
+    const std::size_t chunks = (vectors + chunkVectors - 1) / chunkVectors;
+    if (chunks > 1) {
+        InferenceEngine::parallel_for(chunks, [&] (std::size_t chunk) {
+            const std::size_t begin = chunk * chunkVectors;
+            const std::size_t end = std::min(vectors, begin + chunkVectors);
+            for (std::size_t i = begin; i < end; ++i) {
+                vst1q_f32(dst + i * 4, kernel(vld1q_f32(src + i * 4)));
+            }
+        });
+    } else {
+        for (std::size_t i = 0; i < vectors; ++i) {
+            vst1q_f32(dst + i * 4, kernel(vld1q_f32(src + i * 4)));
+        }
+    }
+    if (const std::size_t tail = size % 4) {
+        float block[4] = {};
+        for (std::size_t i = 0; i < tail; ++i) {
+            block[i] = src[vectors * 4 + i];
+        }
+        vst1q_f32(block, kernel(vld1q_f32(block)));
+        for (std::size_t i = 0; i < tail; ++i) {
+            dst[vectors * 4 + i] = block[i];
+        }
+    }
+}
+
+}  // namespace detail
+
+inline void erf(const float* src, float* dst, std::size_t size) {
+    detail::transcendental(src, dst, size, [] (const float32x4_t x) {return detail::verfq(x);});
+}
+
+inline void cos(const float* src, float* dst, std::size_t size) {
+    detail::transcendental(src, dst, size, [] (const float32x4_t x) {return detail::vcosq(x);});
+}
+
+inline void atanh(const float* src, float* dst, std::size_t size) {
+    detail::transcendental(src, dst, size, [] (const float32x4_t x) {return detail::vatanhq(x);});
+}
+
+// swish(x) = x * sigmoid(beta * x), one fused pass over the tensor
+inline void swish(const float* src, float beta, float* dst, std::size_t size) {
+    detail::transcendental(src, dst, size, [beta] (const float32x4_t x) {
+        const float32x4_t e = detail::vexpq(vnegq_f32(vmulq_f32(x, vdupq_n_f32(beta))));
+        return vmulq_f32(x, detail::vrecipq(vaddq_f32(e, vdupq_n_f32(1.0f))));
+    });
+}
+
+// mish(x) = x * tanh(softplus(x)), one fused pass over the tensor
+inline void mish(const float* src, float* dst, std::size_t size) {
+    detail::transcendental(src, dst, size, [] (const float32x4_t x) {
+        const float32x4_t softplus = detail::vlogq(vaddq_f32(detail::vexpq(x), vdupq_n_f32(1.0f)));
+        return vmulq_f32(x, detail::vtanhq_nonneg(softplus));
+    });
+}
+
+#else  // scalar fallback keeps non-NEON builds linking
+
+inline void erf(const float* src, float* dst, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] = std::erf(src[i]);
+    }
+}
+
+inline void cos(const float* src, float* dst, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] = std::cos(src[i]);
+    }
+}
+
+inline void atanh(const float* src, float* dst, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] = std::atanh(src[i]);
+    }
+}
+
+inline void swish(const float* src, float beta, float* dst, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] = src[i] / (1.0f + std::exp(-beta * src[i]));
+    }
+}
+
+inline void mish(const float* src, float* dst, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] = src[i] * std::tanh(std::log1p(std::exp(src[i])));
+    }
+}
+
+#endif
+
+}  // namespace neon
+}  // namespace ArmPlugin
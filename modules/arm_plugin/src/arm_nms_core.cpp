@@ -0,0 +1,109 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include "arm_nms_core.hpp"
+
+namespace ArmPlugin {
+namespace nms {
+
+void KeptBoxes::Reserve(std::size_t count) {
+    _ymin.reserve(count);
+    _xmin.reserve(count);
+    _ymax.reserve(count);
+    _xmax.reserve(count);
+    _area.reserve(count);
+}
+
+void KeptBoxes::Push(const float* box) {
+    _ymin.push_back(box[0]);
+    _xmin.push_back(box[1]);
+    _ymax.push_back(box[2]);
+    _xmax.push_back(box[3]);
+    _area.push_back((box[2] - box[0]) * (box[3] - box[1]));
+}
+
+bool SuppressedByAny(const float* box, const KeptBoxes& kept, float iouThreshold) {
+    const float ymin = box[0];
+    const float xmin = box[1];
+    const float ymax = box[2];
+    const float xmax = box[3];
+    const float area = (ymax - ymin) * (xmax - xmin);
+    std::size_t count = kept.Size();
+    std::size_t i = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const float32x4_t vymin = vdupq_n_f32(ymin);
+    const float32x4_t vxmin = vdupq_n_f32(xmin);
+    const float32x4_t vymax = vdupq_n_f32(ymax);
+    const float32x4_t vxmax = vdupq_n_f32(xmax);
+    const float32x4_t varea = vdupq_n_f32(area);
+    const float32x4_t vthreshold = vdupq_n_f32(iouThreshold);
+    const float32x4_t vzero = vdupq_n_f32(0.0f);
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t interYmin = vmaxq_f32(vymin, vld1q_f32(kept._ymin.data() + i));
+        float32x4_t interXmin = vmaxq_f32(vxmin, vld1q_f32(kept._xmin.data() + i));
+        float32x4_t interYmax = vminq_f32(vymax, vld1q_f32(kept._ymax.data() + i));
+        float32x4_t interXmax = vminq_f32(vxmax, vld1q_f32(kept._xmax.data() + i));
+        float32x4_t interH = vmaxq_f32(vsubq_f32(interYmax, interYmin), vzero);
+        float32x4_t interW = vmaxq_f32(vsubq_f32(interXmax, interXmin), vzero);
+        float32x4_t inter = vmulq_f32(interH, interW);
+        float32x4_t merged = vsubq_f32(vaddq_f32(varea, vld1q_f32(kept._area.data() + i)), inter);
+        uint32x4_t over = vcgtq_f32(inter, vmulq_f32(vthreshold, merged));
+        uint32x2_t any = vorr_u32(vget_low_u32(over), vget_high_u32(over));
+        if (vget_lane_u32(vpmax_u32(any, any), 0) != 0) {
+            return true;
+        }
+    }
+#endif
+    for (; i < count; ++i) {
+        float interH = std::max(std::min(ymax, kept._ymax[i]) - std::max(ymin, kept._ymin[i]), 0.0f);
+        float interW = std::max(std::min(xmax, kept._xmax[i]) - std::max(xmin, kept._xmin[i]), 0.0f);
+        float inter = interH * interW;
+        if (inter > iouThreshold * (area + kept._area[i] - inter)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<Candidate> RunClassNms(const float* boxes,
+                                   const float* scores,
+                                   std::size_t boxCount,
+                                   float scoreThreshold,
+                                   float iouThreshold,
+                                   std::size_t maxOutput) {
+    std::vector<Candidate> candidates;
+    for (std::size_t box = 0; box < boxCount; ++box) {
+        if (scores[box] > scoreThreshold) {
+            candidates.push_back(Candidate{scores[box], static_cast<int>(box)});
+        }
+    }
+    auto worse = [] (const Candidate& lhs, const Candidate& rhs) {
+        return (lhs.score < rhs.score) || ((lhs.score == rhs.score) && (lhs.box > rhs.box));
+    };
+    std::make_heap(candidates.begin(), candidates.end(), worse);
+    std::vector<Candidate> selected;
+    KeptBoxes kept;
+    kept.Reserve(std::min(maxOutput, candidates.size()));
+    auto heapEnd = candidates.end();
+    while ((selected.size() < maxOutput) && (heapEnd != candidates.begin())) {
+        std::pop_heap(candidates.begin(), heapEnd, worse);
+        --heapEnd;
+        const auto& top = *heapEnd;
+        const float* box = boxes + 4 * top.box;
+        if (!SuppressedByAny(box, kept, iouThreshold)) {
+            kept.Push(box);
+            selected.push_back(top);
+        }
+    }
+    return selected;
+}
+
+}  //  namespace nms
+}  //  namespace ArmPlugin
@@ -0,0 +1,51 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ArmPlugin {
+namespace nms {
+
+// Score/box pair competing for one class slot
+struct Candidate {
+    float score;
+    int   box;
+};
+
+// Surviving boxes in structure-of-arrays layout so the suppression test can
+// compare one candidate against four kept boxes per NEON iteration
+struct KeptBoxes {
+    void Reserve(std::size_t count);
+    // box is [ymin, xmin, ymax, xmax]
+    void Push(const float* box);
+    std::size_t Size() const { return _ymin.size(); }
+    std::vector<float> _ymin;
+    std::vector<float> _xmin;
+    std::vector<float> _ymax;
+    std::vector<float> _xmax;
+    std::vector<float> _area;
+};
+
+// True when box overlaps any kept box with IoU above iouThreshold. The NEON
+// path avoids the division by testing intersection > threshold * union.
+bool SuppressedByAny(const float* box, const KeptBoxes& kept, float iouThreshold);
+
+// Greedy hard-NMS over one class: candidates scoring above scoreThreshold are
+// visited in descending score order (lowest box index wins ties) until
+// maxOutput boxes survive suppression. Candidates sit in a heap, so only the
+// prefix actually inspected gets sorted - with a small maxOutput most of the
+// candidate list is never ordered. boxes holds [ymin, xmin, ymax, xmax] per
+// box; the survivors come back in selection (descending score) order.
+std::vector<Candidate> RunClassNms(const float* boxes,
+                                   const float* scores,
+                                   std::size_t boxCount,
+                                   float scoreThreshold,
+                                   float iouThreshold,
+                                   std::size_t maxOutput);
+
+}  //  namespace nms
+}  //  namespace ArmPlugin
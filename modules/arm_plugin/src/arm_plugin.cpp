@@ -3,6 +3,9 @@
 //
 
 
+#include <algorithm>
+#include <cstring>
+#include <sstream>
 #include <utility>
 #include <memory>
 #include <vector>
@@ -10,12 +13,14 @@
 #include <map>
 
 #include <ie_metric_helpers.hpp>
+#include <ie_icore.hpp>
 #include <ie_plugin_config.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include <ie_input_info.hpp>
 #include <ie_layouts.h>
 #include <ie_algorithm.hpp>
 
+#include <ngraph/attribute_visitor.hpp>
 #include <ngraph/function.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <transformations/rt_info/fused_names_attribute.hpp>
@@ -23,12 +28,18 @@
 
 #include <ie_parallel.hpp>
 #include "arm_ie_scheduler.hpp"
+#include "arm_load_profile.hpp"
+#include "arm_metrics.hpp"
+#include "arm_isa.hpp"
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
 
 #include "arm_plugin.hpp"
+#include "arm_ab_calibration.hpp"
+#include "arm_weight_codec.hpp"
 #include "arm_executable_network.hpp"
 #include "arm_converter/arm_converter.hpp"
 #include "transformations/arm_optimizations.hpp"
+#include "transformations/mixed_precision_storage.hpp"
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -56,11 +67,91 @@ Plugin::~Plugin() {
     ExecutorManager::getInstance()->clear("CPUStreamsExecutor");
 }
 
+namespace {
+// Smaller constants (shape vectors, scalars) are not worth hashing and would
+// bloat the weight store without saving noticeable memory
+constexpr std::size_t weightStoreMinBytes = 1024;
+
+std::uint64_t HashConstantContent(const ngraph::op::Constant& constant) {
+    // FNV-1a over the payload, seeded with element type and shape so equal
+    // bytes viewed under different layouts never land on the same key
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash] (const void* data, const std::size_t size) {
+        auto bytes = static_cast<const std::uint8_t*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+    auto type = static_cast<std::uint64_t>(constant.get_element_type());
+    mix(&type, sizeof(type));
+    for (auto&& dim : constant.get_shape()) {
+        std::uint64_t value = dim;
+        mix(&value, sizeof(value));
+    }
+    mix(constant.get_data_ptr(), constant.get_byte_size());
+    return hash;
+}
+}  // namespace
+
+std::shared_ptr<ngraph::op::Constant> Plugin::DeduplicateConstant(const std::shared_ptr<ngraph::op::Constant>& constant) const {
+    if (constant->get_byte_size() < weightStoreMinBytes) {
+        return std::make_shared<ngraph::op::Constant>(*constant);
+    }
+    auto hash = HashConstantContent(*constant);
+    std::lock_guard<std::mutex> lock{_weightStoreMutex};
+    auto range = _weightStore.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+        auto cached = it->second.lock();
+        if (cached == nullptr) {
+            it = _weightStore.erase(it);
+            continue;
+        }
+        // Hashes can collide, so a hit is trusted only after a full compare
+        if ((cached->get_element_type() == constant->get_element_type()) &&
+            (cached->get_shape() == constant->get_shape()) &&
+            (std::memcmp(cached->get_data_ptr(), constant->get_data_ptr(), constant->get_byte_size()) == 0)) {
+            return std::make_shared<ngraph::op::Constant>(*cached);
+        }
+        ++it;
+    }
+    auto sharedConstant = std::make_shared<ngraph::op::Constant>(*constant);
+    _weightStore.emplace(hash, sharedConstant);
+    return sharedConstant;
+}
+
 std::shared_ptr<ngraph::Function> Plugin::Transform(const std::shared_ptr<const ngraph::Function>& function,
                                                     const Configuration& config) const {
-    auto transformedFunction = ngraph::clone_function(*function);
+    // Pre-seed the clone map with constant copies sharing the original data
+    // buffers, so the transformed function does not duplicate weights while
+    // both copies are alive; large constants additionally go through the
+    // plugin weight store, so a repeated load of the same IR shares the
+    // buffers of the still-loaded instance. Passes replace constants with new
+    // nodes instead of mutating payloads in place, so the sharing is safe.
+    std::shared_ptr<ngraph::Function> transformedFunction;
+    {
+        LoadProfileScope profileScope{config._loadProfile, "Transform/CloneFunction"};
+        ngraph::NodeMap nodeMap;
+        for (auto&& node : function->get_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node)) {
+                auto sharedConstant = DeduplicateConstant(constant);
+                sharedConstant->set_friendly_name(constant->get_friendly_name());
+                sharedConstant->get_rt_info() = constant->get_rt_info();
+                nodeMap.emplace(constant.get(), sharedConstant);
+            }
+        }
+        transformedFunction = ngraph::clone_function(*function, nodeMap);
+    }
     ngraph::pass::Manager passManager;
-    passManager.register_pass<pass::ArmOptimizations>(config._lpt, config._dump);
+    // f16 execution needs FP16 kernels on this CPU (and not excluded by
+    // KERNEL_ISA), and a quantized graph must reach LPT with its original
+    // precisions; otherwise stay in the model's precision
+    if (config._fp16Activations &&
+        IsaEnabled("FP16", config._kernelIsa) &&
+        !ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(function)) {
+        passManager.register_pass<pass::MixedPrecisionStorage>(config._fp32SensitiveOps);
+    }
+    passManager.register_pass<pass::ArmOptimizations>(config._lpt, config._dump, config._loadProfile, config._nodeAffinity,
+                                                      config._costModelPath, config._fastMath);
     passManager.run_passes(transformedFunction);
     return transformedFunction;
 }
@@ -75,11 +166,134 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(cons
     if (function == nullptr) {
          IE_THROW() << "Arm Plugin supports only ngraph cnn network representation";
     }
+    if (cfg._abCalibration) {
+        auto pins = CalibrateNodeAffinity(*this, function, cfg);
+        if (!pins.empty()) {
+            cfg._nodeAffinity = cfg._nodeAffinity.empty() ? pins : cfg._nodeAffinity + ";" + pins;
+        }
+    }
     auto transformedFunction = Transform(function, cfg);
     cfg._lpt = cfg._lpt && ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(function);
     return std::make_shared<ExecutableNetwork>(transformedFunction, cfg, std::static_pointer_cast<Plugin>(shared_from_this()));
 }
 
+InferenceEngine::IExecutableNetworkInternal::Ptr Plugin::ImportNetwork(std::istream& networkModel,
+                                                                       const ConfigMap& config) {
+    auto cfg = Configuration{config, _cfg};
+    auto readString = [&] {
+        std::uint64_t size = 0;
+        networkModel.read(reinterpret_cast<char*>(&size), sizeof(size));
+        std::string value(size, '\0');
+        if (size != 0) {
+            networkModel.read(&value[0], size);
+        }
+        if (!networkModel) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: Failed to read a compiled network blob";
+        }
+        return value;
+    };
+    auto xml = readString();
+    auto bin = readString();
+    InferenceEngine::Blob::Ptr weights;
+    if (WeightCodec::IsCompressed(bin)) {
+        // Blocks stream in parallel straight into the weights blob, so the
+        // compressed image is the only full-size intermediate and the import
+        // peak stays compressed-size + weights instead of 2x weights
+        weights = InferenceEngine::make_shared_blob<std::uint8_t>(
+            {InferenceEngine::Precision::U8, {static_cast<std::size_t>(WeightCodec::DecompressedSize(bin))},
+             InferenceEngine::Layout::C});
+        weights->allocate();
+        WeightCodec::Decompress(bin, weights->buffer().as<std::uint8_t*>());
+        bin.clear();
+        bin.shrink_to_fit();
+    } else if (!bin.empty()) {
+        weights = InferenceEngine::make_shared_blob<std::uint8_t>(
+            {InferenceEngine::Precision::U8, {bin.size()}, InferenceEngine::Layout::C});
+        weights->allocate();
+        std::memcpy(weights->buffer(), bin.data(), bin.size());
+    }
+    auto network = GetCore()->ReadNetwork(xml, weights);
+    auto function = network.getFunction();
+    if (function == nullptr) {
+         IE_THROW() << "Arm Plugin supports only ngraph cnn network representation";
+    }
+    // The blob holds the already transformed function (see ExecutableNetwork::Export),
+    // so the ArmOptimizations pipeline is skipped here for a fast warm start
+    cfg._lpt = cfg._lpt && ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(function);
+    auto executableNetwork =
+        std::make_shared<ExecutableNetwork>(function, cfg, std::static_pointer_cast<Plugin>(shared_from_this()));
+    executableNetwork->setNetworkInputs(network.getInputsInfo());
+    executableNetwork->setNetworkOutputs(network.getOutputsInfo());
+    SetExeNetworkInfo(executableNetwork, function);
+    return executableNetwork;
+}
+
+namespace {
+// Serializes node attributes into a string signature; attribute types without a
+// typed overload end up in the void fallback and mark the node uncacheable, so
+// caching never answers for a node the signature can not fully describe
+struct NodeSignatureVisitor final : public ngraph::AttributeVisitor {
+    void on_adapter(const std::string&, ngraph::ValueAccessor<void>&) override {
+        _complete = false;
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        Append(name, std::to_string(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        Append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::int64_t>& adapter) override {
+        Append(name, std::to_string(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        Append(name, std::to_string(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::int64_t>>& adapter) override {
+        AppendVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::uint64_t>>& adapter) override {
+        AppendVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        AppendVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        for (auto&& value : adapter.get()) {
+            Append(name, value);
+        }
+    }
+    void Append(const std::string& name, const std::string& value) {
+        _signature += (';' + name + '=' + value);
+    }
+    template<typename T>
+    void AppendVector(const std::string& name, const std::vector<T>& values) {
+        for (auto&& value : values) {
+            Append(name, std::to_string(value));
+        }
+    }
+    std::string _signature;
+    bool        _complete = true;
+};
+
+bool MakeNodeSignature(ngraph::Node& node, std::string& signature) {
+    NodeSignatureVisitor visitor;
+    if (!node.visit_attributes(visitor) || !visitor._complete) {
+        return false;
+    }
+    std::ostringstream stream;
+    stream << node.get_type_info().name << ':' << node.get_type_info().version;
+    for (auto&& input : node.inputs()) {
+        stream << ';' << input.get_element_type() << input.get_partial_shape();
+    }
+    for (auto&& output : node.outputs()) {
+        stream << ';' << output.get_element_type() << output.get_partial_shape();
+    }
+    stream << visitor._signature;
+    signature = stream.str();
+    return true;
+}
+}  // namespace
+
 QueryNetworkResult Plugin::QueryNetwork(const CNNNetwork& network, const ConfigMap& config) const {
     QueryNetworkResult res;
     Configuration cfg{config, _cfg, false};
@@ -103,14 +317,47 @@ QueryNetworkResult Plugin::QueryNetwork(const CNNNetwork& network, const ConfigM
             if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node)) {
                 nodeIsSupported = true;
             } else {
-                Converter::Conversion::Ptr layer;
-                try {
-                    layer = converter._conversions.at(node->get_type_info())(*node);
-                } catch(...) {
-                    nodeIsSupported = false;
+                std::string signature;
+                bool cacheable = MakeNodeSignature(*node, signature);
+                bool cached = false;
+                if (cacheable) {
+                    std::lock_guard<std::mutex> lock{_queryCacheMutex};
+                    auto itCache = _queryCache.find(signature);
+                    if (itCache != _queryCache.end()) {
+                        nodeIsSupported = itCache->second;
+                        cached = true;
+                    }
                 }
-                if (layer != nullptr) {
-                    nodeIsSupported = static_cast<bool>(layer->Validate());
+                if (!cached) {
+                    Converter::Conversion::Ptr layer;
+                    try {
+                        layer = converter._conversions.at(node->get_type_info())(*node);
+                    } catch(...) {
+                        nodeIsSupported = false;
+                    }
+                    if (layer != nullptr) {
+                        nodeIsSupported = static_cast<bool>(converter.ValidateIsa(node.get())) &&
+                                          static_cast<bool>(layer->Validate());
+                    }
+                    if (!nodeIsSupported && cfg._ref) {
+                        // Validation failures are retried on the reference path
+                        // before the node is surrendered to the fallback device:
+                        // absorbing it in-process avoids two device-boundary
+                        // copies per occurrence. Converter::Configure applies
+                        // the same pin at load, so the answer holds.
+                        node->get_rt_info()["ArmAffinity"] = std::string{"REF"};
+                        Converter::Conversion::Ptr refLayer;
+                        try {
+                            refLayer = converter._conversions.at(node->get_type_info())(*node);
+                        } catch(...) {}
+                        nodeIsSupported = (refLayer != nullptr) && (refLayer->ExecType() != "Arm Compute") &&
+                                          static_cast<bool>(refLayer->Validate());
+                        node->get_rt_info().erase("ArmAffinity");
+                    }
+                    if (cacheable) {
+                        std::lock_guard<std::mutex> lock{_queryCacheMutex};
+                        _queryCache.emplace(signature, nodeIsSupported);
+                    }
                 }
             }
         }
@@ -127,6 +374,57 @@ QueryNetworkResult Plugin::QueryNetwork(const CNNNetwork& network, const ConfigM
     for (auto&& unsupportedNode : unsupported) {
         supported.erase(unsupportedNode);
     }
+    // Partition-shape pass: HETERO pays a device-boundary copy for every edge
+    // between a supported and an unsupported node, so a small supported island
+    // marooned inside fallback territory costs more in crossings than it saves
+    // in plugin execution. Walk the connected components of supported nodes
+    // (over real ops; constants, parameters and results do not cross devices)
+    // and surrender components with fewer nodes than boundary edges to the
+    // fallback device.
+    {
+        auto isRealOp = [] (const ngraph::Node* node) {
+            return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node);
+        };
+        std::unordered_set<std::string> visited;
+        for (auto&& node : function->get_ops()) {
+            if (!isRealOp(node.get()) || !contains(supported, node->get_friendly_name()) ||
+                contains(visited, node->get_friendly_name())) {
+                continue;
+            }
+            std::vector<ngraph::Node*> component;
+            std::size_t boundaryEdges = 0;
+            std::vector<ngraph::Node*> stack{node.get()};
+            visited.emplace(node->get_friendly_name());
+            while (!stack.empty()) {
+                auto current = stack.back();
+                stack.pop_back();
+                component.push_back(current);
+                auto visit = [&] (ngraph::Node* neighbour) {
+                    if (!isRealOp(neighbour)) {
+                        return;
+                    }
+                    if (!contains(supported, neighbour->get_friendly_name())) {
+                        ++boundaryEdges;
+                    } else if (visited.emplace(neighbour->get_friendly_name()).second) {
+                        stack.push_back(neighbour);
+                    }
+                };
+                for (auto&& input : current->input_values()) {
+                    visit(input.get_node());
+                }
+                for (auto&& output : current->outputs()) {
+                    for (auto&& target : output.get_target_inputs()) {
+                        visit(target.get_node());
+                    }
+                }
+            }
+            if (component.size() < boundaryEdges) {
+                for (auto&& member : component) {
+                    supported.erase(member->get_friendly_name());
+                }
+            }
+        }
+    }
     for (auto&& node : function->get_ops()) {
         if (contains(supported, node->get_friendly_name())) {
             for (auto&& inputNodeOutput : node->input_values()) {
@@ -178,11 +476,16 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
             METRIC_KEY(FULL_DEVICE_NAME),
             METRIC_KEY(OPTIMIZATION_CAPABILITIES),
             METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
-            METRIC_KEY(RANGE_FOR_STREAMS)};
+            METRIC_KEY(RANGE_FOR_STREAMS),
+            METRIC_KEY(IMPORT_EXPORT_SUPPORT),
+            "CPU_ISA_CAPABILITIES",
+            "METRICS_SNAPSHOT"};
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, supportedMetrics);
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> configKeys = {
             CONFIG_KEY(PERF_COUNT),
+            CONFIG_KEY(PERFORMANCE_HINT),
+            CONFIG_KEY(PERFORMANCE_HINT_NUM_REQUESTS),
             CONFIG_KEY_INTERNAL(LP_TRANSFORMS_MODE),
             CONFIG_KEY_INTERNAL(DUMP_GRAPH)};
         auto streamExecutorConfigKeys = IStreamsExecutor::Config{}.SupportedKeys();
@@ -199,8 +502,26 @@ InferenceEngine::Parameter Plugin::GetMetric(const std::string& name, const std:
     } else if (METRIC_KEY(OPTIMIZATION_CAPABILITIES) == name) {
         std::vector<std::string> capabilities = { METRIC_VALUE(FP32), METRIC_VALUE(FP16) };
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
+    } else if (METRIC_KEY(IMPORT_EXPORT_SUPPORT) == name) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if ("CPU_ISA_CAPABILITIES" == name) {
+        // ISA extensions of the executing CPU (NEON baseline plus FP16/DOTPROD/
+        // SVE/SVE2/I8MM/BF16 when present); kernels can be restricted to a
+        // subset through the internal KERNEL_ISA config key
+        return {SupportedIsaExtensions()};
+    } else if ("METRICS_SNAPSHOT" == name) {
+        // Process-wide inference counters (request rate, latency histogram,
+        // queue depth, per-stage time, fallback-layer share) as Prometheus
+        // text exposition lines; a sidecar joins them and serves the scrape
+        return {Metrics::get().Snapshot()};
     } else if (METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS) == name) {
-        IE_SET_METRIC_RETURN(RANGE_FOR_ASYNC_INFER_REQUESTS, std::make_tuple(1u, 1u, 1u));
+        // Requests are decomposed into preprocess/execute/postprocess tasks on
+        // the streams executor (see ArmAsyncInferRequest), so stages of
+        // different in-flight requests overlap: each stream pipelines two
+        // requests usefully. Advertising that keeps AUTO/MULTI from starving
+        // this plugin in heterogeneous deployments.
+        const uint32_t streams = static_cast<uint32_t>(std::max(1, _cfg._streamsExecutorConfig._streams));
+        IE_SET_METRIC_RETURN(RANGE_FOR_ASYNC_INFER_REQUESTS, std::make_tuple(1u, streams * 2, 1u));
     } else if (METRIC_KEY(RANGE_FOR_STREAMS) == name) {
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS,
             std::make_tuple(1u, static_cast<uint32_t>(std::thread::hardware_concurrency())));
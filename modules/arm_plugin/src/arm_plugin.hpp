@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <map>
 #include <unordered_map>
@@ -12,9 +14,11 @@
 
 #include <cpp/ie_cnn_network.h>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+#include <ngraph/op/constant.hpp>
 
 #include "arm_executable_network.hpp"
 #include "arm_config.hpp"
+#include "arm_model_lifecycle.hpp"
 
 namespace ArmPlugin {
 struct Plugin : public InferenceEngine::IInferencePlugin {
@@ -30,6 +34,9 @@ struct Plugin : public InferenceEngine::IInferencePlugin {
     InferenceEngine::IExecutableNetworkInternal::Ptr
     LoadExeNetworkImpl(const InferenceEngine::CNNNetwork& network,
                        const std::map<std::string, std::string>& config) override;
+    InferenceEngine::IExecutableNetworkInternal::Ptr
+    ImportNetwork(std::istream& networkModel,
+                  const std::map<std::string, std::string>& config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name,
                                          const std::map<std::string, InferenceEngine::Parameter>& options) const override;
     InferenceEngine::Parameter GetMetric(const std::string& name,
@@ -38,5 +45,27 @@ struct Plugin : public InferenceEngine::IInferencePlugin {
                                                 const Configuration& config) const;
 
     Configuration _cfg;
+    // Budget-driven hibernation of cold networks (MODEL_BUDGET_MB); networks
+    // loaded with the key set register here and admissions drive the LRU
+    ModelLifecycle _modelLifecycle;
+
+private:
+    // Returns a constant sharing the payload of an identical constant from an
+    // earlier still-alive load when one exists, registering the result in the
+    // weight store otherwise; see the store comment below
+    std::shared_ptr<ngraph::op::Constant> DeduplicateConstant(const std::shared_ptr<ngraph::op::Constant>& constant) const;
+
+    // QueryNetwork support answers memoized by node signature (op type,
+    // precisions, shapes, serialized attributes); nodes whose attributes can
+    // not be fully serialized always take the real validation path
+    mutable std::unordered_map<std::string, bool>   _queryCache;
+    mutable std::mutex                              _queryCacheMutex;
+    // Weight store: constants of live networks keyed by content hash, so
+    // loading the same IR again (blue/green double loads) shares one
+    // read-only buffer per weight instead of duplicating it. Entries are
+    // weak, so an unloaded network's weights are freed as usual; expired
+    // entries are swept on the buckets a lookup visits
+    mutable std::unordered_multimap<std::uint64_t, std::weak_ptr<ngraph::op::Constant>> _weightStore;
+    mutable std::mutex                              _weightStoreMutex;
 };
 }  // namespace ArmPlugin
@@ -0,0 +1,93 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_pmu.hpp"
+
+#ifdef __linux__
+
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+using namespace ArmPlugin;
+
+PmuCounters::PmuCounters() {
+    constexpr static std::uint64_t configs[EventCount] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_STALLED_CYCLES_BACKEND,
+    };
+    for (int event = 0; event < EventCount; ++event) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = configs[event];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // Group under the cycles counter so the events start and stop together
+        const int group = (event == 0) ? -1 : _fds[0];
+        _fds[event] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+        if (_fds[event] == -1) {
+            // All or nothing: partial groups would silently skew the ratios
+            for (int opened = 0; opened < event; ++opened) {
+                close(_fds[opened]);
+                _fds[opened] = -1;
+            }
+            return;
+        }
+    }
+}
+
+PmuCounters::~PmuCounters() {
+    for (int event = 0; event < EventCount; ++event) {
+        if (_fds[event] != -1) {
+            close(_fds[event]);
+        }
+    }
+}
+
+bool PmuCounters::Available() const {
+    return _fds[0] != -1;
+}
+
+void PmuCounters::Start() {
+    if (!Available()) {
+        return;
+    }
+    ioctl(_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PmuCounters::Sample PmuCounters::Stop() {
+    Sample sample;
+    if (!Available()) {
+        return sample;
+    }
+    ioctl(_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    std::uint64_t* values[EventCount] = {
+        &sample._cycles, &sample._instructions, &sample._cacheRefills, &sample._stallCycles};
+    for (int event = 0; event < EventCount; ++event) {
+        if (read(_fds[event], values[event], sizeof(std::uint64_t)) != sizeof(std::uint64_t)) {
+            *values[event] = 0;
+        }
+    }
+    return sample;
+}
+
+#else  // !__linux__
+
+using namespace ArmPlugin;
+
+PmuCounters::PmuCounters() {}
+PmuCounters::~PmuCounters() {}
+bool PmuCounters::Available() const { return false; }
+void PmuCounters::Start() {}
+PmuCounters::Sample PmuCounters::Stop() { return {}; }
+
+#endif
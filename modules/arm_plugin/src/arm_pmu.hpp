@@ -0,0 +1,47 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace ArmPlugin {
+
+// Thin wrapper over a linux perf_event counter group: cycles, instructions,
+// last-level cache refills and backend stall cycles, read around individual
+// layer runs so memory-bound layers (refills/stalls dominate) can be told
+// apart from compute-bound ones (cycles track instructions) without external
+// tooling. The generic hardware events map onto the corresponding ARM PMU
+// events in the kernel.
+//
+// Counters are opened per calling thread, so for kernels that fan out the
+// sample covers the dispatching thread's share of the work; for exact
+// per-layer numbers run the calibration with one intra-op thread. Opening
+// fails without perf_event access (paranoid level, seccomp) - Available()
+// reports it and sampling degrades to a no-op.
+struct PmuCounters {
+    struct Sample {
+        std::uint64_t _cycles       = 0;
+        std::uint64_t _instructions = 0;
+        std::uint64_t _cacheRefills = 0;
+        std::uint64_t _stallCycles  = 0;
+    };
+
+    PmuCounters();
+    ~PmuCounters();
+    PmuCounters(const PmuCounters&) = delete;
+    PmuCounters& operator=(const PmuCounters&) = delete;
+
+    bool Available() const;
+    // Resets and enables the group; pair with Stop() around the measured run
+    void Start();
+    // Disables the group and returns the counts since Start()
+    Sample Stop();
+
+private:
+    constexpr static int EventCount = 4;
+    int _fds[EventCount] = {-1, -1, -1, -1};
+};
+
+}  // namespace ArmPlugin
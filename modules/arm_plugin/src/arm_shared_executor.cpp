@@ -0,0 +1,91 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_shared_executor.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <thread>
+
+#include <threading/ie_executor_manager.hpp>
+#include <threading/ie_istreams_executor.hpp>
+
+using namespace ArmPlugin;
+
+struct SharedExecutor::Client final : public InferenceEngine::ITaskExecutor,
+                                      public std::enable_shared_from_this<Client> {
+    Client(SharedExecutor& owner, const int weight) : _owner{owner}, _weight{weight} {}
+    ~Client() override {
+        _owner.Remove(this);
+    }
+    void run(InferenceEngine::Task task) override {
+        std::lock_guard<std::mutex> lock{_owner._mutex};
+        _pending.emplace_back(std::move(task));
+        Pump();
+    }
+    // Moves queued tasks into the shared executor up to the quota; runs under
+    // the owner's mutex. The completion continuation holds a shared reference,
+    // so a handle released mid-flight stays alive until its tasks drain.
+    void Pump() {
+        while ((_inFlight < _quota) && !_pending.empty()) {
+            auto task = std::move(_pending.front());
+            _pending.pop_front();
+            ++_inFlight;
+            auto self = shared_from_this();
+            _owner._executor->run([self, task] {
+                task();
+                std::lock_guard<std::mutex> lock{self->_owner._mutex};
+                --self->_inFlight;
+                self->Pump();
+            });
+        }
+    }
+    SharedExecutor&                     _owner;
+    int                                 _weight;
+    int                                 _quota = 1;
+    int                                 _inFlight = 0;
+    std::deque<InferenceEngine::Task>   _pending;
+};
+
+SharedExecutor& SharedExecutor::get() {
+    static SharedExecutor instance;
+    return instance;
+}
+
+InferenceEngine::ITaskExecutor::Ptr SharedExecutor::CreateHandle(const int weight) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_executor == nullptr) {
+        // One single-core stream per physical core: client quotas partition
+        // the streams, so weighted shares map directly onto core counts
+        InferenceEngine::IStreamsExecutor::Config config{
+            "ArmSharedStreamsExecutor",
+            std::max(1, static_cast<int>(std::thread::hardware_concurrency()))};
+        config = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(config);
+        config._name = "ArmSharedStreamsExecutor";
+        _streams = std::max(1, config._streams);
+        _executor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(config);
+    }
+    auto client = std::make_shared<Client>(*this, std::max(1, weight));
+    _clients.push_back(client.get());
+    Recompute();
+    return client;
+}
+
+void SharedExecutor::Recompute() {
+    int totalWeight = 0;
+    for (auto client : _clients) {
+        totalWeight += client->_weight;
+    }
+    for (auto client : _clients) {
+        client->_quota = std::max(1, _streams * client->_weight / std::max(1, totalWeight));
+        // A grown quota may unblock queued work immediately
+        client->Pump();
+    }
+}
+
+void SharedExecutor::Remove(Client* client) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _clients.erase(std::remove(_clients.begin(), _clients.end(), client), _clients.end());
+    Recompute();
+}
@@ -0,0 +1,46 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <threading/ie_itask_executor.hpp>
+
+namespace ArmPlugin {
+
+// Process-wide co-scheduler for networks loaded with SHARED_EXECUTOR: one
+// machine-wide streams executor is shared by every participating network,
+// and each network's handle caps its concurrently running tasks to a
+// weighted share of the streams (quota = streams * weight / total weight,
+// at least one). Excess work queues inside the handle instead of spawning
+// more threads, so a cascade of models degrades into weighted time slicing
+// on a fixed thread set rather than collapsing under the context-switch
+// storm of one oversubscribed executor per network. Quotas are recomputed
+// whenever a network joins or leaves, so an unloaded model's share flows
+// back to the survivors.
+class SharedExecutor {
+public:
+    static SharedExecutor& get();
+    // Returns the network's executor handle; the weight sets its share
+    // relative to the other participating networks
+    InferenceEngine::ITaskExecutor::Ptr CreateHandle(const int weight);
+
+private:
+    struct Client;
+    friend struct Client;
+    SharedExecutor() = default;
+    // Both run under _mutex through the public entry points
+    void Recompute();
+    void Remove(Client* client);
+
+    std::mutex                          _mutex;
+    std::vector<Client*>                _clients;
+    InferenceEngine::ITaskExecutor::Ptr _executor;
+    int                                 _streams = 0;
+};
+
+}  // namespace ArmPlugin
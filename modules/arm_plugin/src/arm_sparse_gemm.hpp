@@ -0,0 +1,167 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+namespace sparse {
+
+// Compressed weight format and kernels for structurally pruned f32 models
+// (SPARSE_KERNELS; see NESparseMatMul and NESparseConvolution). The packed
+// ACL GEMM multiplies every zero a pruned model carries; at 80% sparsity
+// that is 5x the needed FLOPs and weight traffic. Weights are recompressed
+// once at configure time into block-CSR - per group of 4 output columns, the
+// k indices whose 1x4 weight block is not entirely zero - so 2:4 and
+// block-pruned layouts collapse naturally and the kernels touch stored
+// blocks only. Below the density threshold the skipped work beats the
+// packed GEMM's better inner loop; the cost model can override the
+// threshold per SoC ("sparse-matmul" / "sparse-conv1x1" techniques).
+
+// Density below which the sparse path wins by default; measured crossover
+// on A55/A76 sits near 40% for both the GEMM and the pointwise kernels
+constexpr float DensityThreshold = 0.4f;
+
+// Block-CSR weights: for every group of 4 output columns (n-block), the k
+// indices and 1x4 weight blocks that survived pruning
+struct BlockCsr {
+    std::vector<std::uint32_t>  _rowStart;  // per n-block entry range, _nblocks + 1
+    std::vector<std::uint32_t>  _k;         // k index per entry
+    std::vector<float>          _weights;   // 4 weights per entry
+    std::size_t                 _nblocks = 0;
+};
+
+// Fraction of non-zero 1x4 blocks of a [K, N] weight matrix held in ngraph
+// row-major layout ([N, K] when transposed); the converter's density check
+template<typename WeightAt>
+float BlockDensity(WeightAt&& weightAt, std::size_t K, std::size_t N) {
+    const std::size_t nblocks = (N + 3) / 4;
+    std::size_t stored = 0;
+    for (std::size_t nb = 0; nb < nblocks; ++nb) {
+        for (std::size_t k = 0; k < K; ++k) {
+            bool nonZero = false;
+            for (std::size_t lane = 0; (lane < 4) && (nb * 4 + lane < N); ++lane) {
+                nonZero = nonZero || (weightAt(nb * 4 + lane, k) != 0.0f);
+            }
+            stored += nonZero;
+        }
+    }
+    return static_cast<float>(stored) / static_cast<float>(nblocks * K);
+}
+
+inline float MatMulBlockDensity(const float* data, std::size_t K, std::size_t N, bool transposeB) {
+    return BlockDensity([&] (std::size_t n, std::size_t k) {
+        return transposeB ? data[n * K + k] : data[k * N + n];
+    }, K, N);
+}
+
+// Fraction of non-zero elements; the per-output-channel compressed
+// pointwise convolution skips whole input channels, so it is element-wise
+inline float ElementDensity(const float* data, std::size_t size) {
+    std::size_t stored = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        stored += (data[i] != 0.0f);
+    }
+    return static_cast<float>(stored) / static_cast<float>(size);
+}
+
+template<typename WeightAt>
+BlockCsr BuildBlockCsr(WeightAt&& weightAt, std::size_t K, std::size_t N) {
+    BlockCsr csr;
+    csr._nblocks = (N + 3) / 4;
+    csr._rowStart.reserve(csr._nblocks + 1);
+    csr._rowStart.push_back(0);
+    for (std::size_t nb = 0; nb < csr._nblocks; ++nb) {
+        for (std::size_t k = 0; k < K; ++k) {
+            float block[4] = {};
+            bool nonZero = false;
+            for (std::size_t lane = 0; (lane < 4) && (nb * 4 + lane < N); ++lane) {
+                block[lane] = weightAt(nb * 4 + lane, k);
+                nonZero = nonZero || (block[lane] != 0.0f);
+            }
+            if (nonZero) {
+                csr._k.push_back(static_cast<std::uint32_t>(k));
+                csr._weights.insert(csr._weights.end(), block, block + 4);
+            }
+        }
+        csr._rowStart.push_back(static_cast<std::uint32_t>(csr._k.size()));
+    }
+    return csr;
+}
+
+// output[nb*4 .. nb*4+3] = bias + sum over stored blocks of input[k] * w[4]
+// for one n-block of one output row; the tail block stores partially
+inline void BlockCsrRow(const BlockCsr& csr, std::size_t nb, const float* input,
+                        const float* bias, float* output, std::size_t N) {
+    const auto begin = csr._rowStart[nb];
+    const auto end = csr._rowStart[nb + 1];
+    const auto n = nb * 4;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    float32x4_t acc = (bias != nullptr) && (n + 4 <= N) ? vld1q_f32(bias + n) : vdupq_n_f32(0.0f);
+    if ((bias != nullptr) && (n + 4 > N)) {
+        float padded[4] = {};
+        for (std::size_t lane = 0; n + lane < N; ++lane) {
+            padded[lane] = bias[n + lane];
+        }
+        acc = vld1q_f32(padded);
+    }
+    for (auto entry = begin; entry != end; ++entry) {
+        acc = vmlaq_n_f32(acc, vld1q_f32(csr._weights.data() + entry * 4), input[csr._k[entry]]);
+    }
+    if (n + 4 <= N) {
+        vst1q_f32(output + n, acc);
+    } else {
+        float spilled[4];
+        vst1q_f32(spilled, acc);
+        for (std::size_t lane = 0; n + lane < N; ++lane) {
+            output[n + lane] = spilled[lane];
+        }
+    }
+#else
+    float acc[4] = {};
+    if (bias != nullptr) {
+        for (std::size_t lane = 0; (lane < 4) && (n + lane < N); ++lane) {
+            acc[lane] = bias[n + lane];
+        }
+    }
+    for (auto entry = begin; entry != end; ++entry) {
+        const auto x = input[csr._k[entry]];
+        for (std::size_t lane = 0; lane < 4; ++lane) {
+            acc[lane] += csr._weights[entry * 4 + lane] * x;
+        }
+    }
+    for (std::size_t lane = 0; (lane < 4) && (n + lane < N); ++lane) {
+        output[n + lane] = acc[lane];
+    }
+#endif
+}
+
+// dst += a * src, the pointwise convolution's per-surviving-channel step
+inline void Saxpy(const float* src, float a, float* dst, std::size_t size) {
+    std::size_t i = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    for (; i + 4 <= size; i += 4) {
+        vst1q_f32(dst + i, vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(src + i), a));
+    }
+#endif
+    for (; i < size; ++i) {
+        dst[i] += a * src[i];
+    }
+}
+
+inline void Fill(float* dst, float value, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        dst[i] = value;
+    }
+}
+
+}  // namespace sparse
+}  // namespace ArmPlugin
@@ -0,0 +1,35 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <ie_layouts.h>
+
+#include <arm_compute/core/ITensor.h>
+
+namespace ArmPlugin {
+
+// Persistent variable state shared by the ReadValue/Assign conversions of one
+// variable. The ReadValue output tensor is excluded from the activation pool,
+// so its buffer survives across inferences: ReadValue seeds it from the init
+// input on the first run (or after a reset) and the matching Assign writes the
+// next value into it at the end of the step, after every other reader of the
+// state has run. Like the ACL functions themselves the states are configured
+// once per network, so all requests of one network observe the same state.
+struct VariableState {
+    using Ptr = std::shared_ptr<VariableState>;
+    std::string                 _name;
+    InferenceEngine::TensorDesc _desc;
+    // The ReadValue output tensor holding the state; owned by the layer map
+    arm_compute::ITensor*       _tensor = nullptr;
+    std::atomic_bool            _initialized{false};
+};
+using VariableStateMap = std::map<std::string, VariableState::Ptr>;
+
+}  //  namespace ArmPlugin
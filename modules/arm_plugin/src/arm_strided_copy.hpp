@@ -0,0 +1,118 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace ArmPlugin {
+namespace strided {
+
+// Strided-block copy engine for layout ops without ACL coverage
+// (ShuffleChannels on arbitrary axes and similar permute-style movement):
+// the destination is walked contiguously as nested loops with a source
+// stride per loop, so a plan fully describes any permutation/reshape-style
+// rearrangement. Planning collapses every dim that is contiguous on both
+// sides into one block, leaving memcpy-sized moves, and execution goes
+// block-parallel over the IE thread pool.
+
+struct CopyPlan {
+    std::vector<std::size_t> _outDims;     // outer loop extents, innermost last
+    std::vector<std::size_t> _srcStrides;  // source elements stepped per loop
+    std::size_t _inner = 1;                // contiguous elements moved per block
+};
+
+inline CopyPlan MakePlan(const std::vector<std::size_t>& out_dims,
+                         const std::vector<std::size_t>& src_strides) {
+    CopyPlan plan;
+    auto dims = out_dims.size();
+    while ((dims > 0) && (src_strides[dims - 1] == plan._inner)) {
+        plan._inner *= out_dims[dims - 1];
+        --dims;
+    }
+    plan._outDims.assign(out_dims.begin(), out_dims.begin() + dims);
+    plan._srcStrides.assign(src_strides.begin(), src_strides.begin() + dims);
+    // Merge adjacent loops whose source strides nest affinely; fewer loops
+    // means larger parallel grains and less index arithmetic per block
+    for (auto d = plan._outDims.size(); d-- > 1;) {
+        if (plan._srcStrides[d - 1] == plan._srcStrides[d] * plan._outDims[d]) {
+            plan._outDims[d - 1] *= plan._outDims[d];
+            plan._srcStrides[d - 1] = plan._srcStrides[d];
+            plan._outDims.erase(plan._outDims.begin() + d);
+            plan._srcStrides.erase(plan._srcStrides.begin() + d);
+        }
+    }
+    return plan;
+}
+
+template<typename T>
+inline void Gather(const T* src, std::size_t stride, T* dst, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        dst[i] = src[i * stride];
+    }
+}
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+inline void Gather(const float* src, std::size_t stride, float* dst, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t lanes = vld1q_dup_f32(src + i * stride);
+        lanes = vld1q_lane_f32(src + (i + 1) * stride, lanes, 1);
+        lanes = vld1q_lane_f32(src + (i + 2) * stride, lanes, 2);
+        lanes = vld1q_lane_f32(src + (i + 3) * stride, lanes, 3);
+        vst1q_f32(dst + i, lanes);
+    }
+    for (; i < count; ++i) {
+        dst[i] = src[i * stride];
+    }
+}
+#endif  // defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+template<typename T>
+inline void Run(const CopyPlan& plan, const T* src, T* dst) {
+    const auto dims = plan._outDims.size();
+    if (dims == 0) {
+        std::memcpy(dst, src, plan._inner * sizeof(T));
+        return;
+    }
+    std::size_t blocks = 1;
+    for (auto d : plan._outDims) {
+        blocks *= d;
+    }
+    // Element-sized blocks become strided gathers along the innermost loop
+    // instead of per-element memcpys
+    if ((plan._inner == 1) && (dims > 1)) {
+        const auto inner_dim = plan._outDims[dims - 1];
+        InferenceEngine::parallel_for(blocks / inner_dim, [&] (std::size_t block) {
+            auto remainder = block;
+            std::size_t source = 0;
+            for (auto d = dims - 1; d-- > 0;) {
+                source += remainder % plan._outDims[d] * plan._srcStrides[d];
+                remainder /= plan._outDims[d];
+            }
+            Gather(src + source, plan._srcStrides[dims - 1], dst + block * inner_dim, inner_dim);
+        });
+        return;
+    }
+    InferenceEngine::parallel_for(blocks, [&] (std::size_t block) {
+        auto remainder = block;
+        std::size_t source = 0;
+        for (auto d = dims; d-- > 0;) {
+            source += remainder % plan._outDims[d] * plan._srcStrides[d];
+            remainder /= plan._outDims[d];
+        }
+        std::memcpy(dst + block * plan._inner, src + source, plan._inner * sizeof(T));
+    });
+}
+
+}  //  namespace strided
+}  //  namespace ArmPlugin
@@ -0,0 +1,68 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <thread>
+
+#include <ie_common.h>
+
+#include "arm_trace.hpp"
+
+using namespace ArmPlugin;
+
+TraceRecorder::TraceRecorder() : _epoch{Clock::now()}, _events(Capacity) {}
+
+TraceRecorder& TraceRecorder::get() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+void TraceRecorder::Enable(bool enable) {
+    _enabled.store(enable, std::memory_order_relaxed);
+}
+
+void TraceRecorder::Record(const char* name, Clock::time_point start, Clock::time_point stop) {
+    auto& event = _events[_next.fetch_add(1, std::memory_order_relaxed) & (Capacity - 1)];
+    std::strncpy(event._name, name, Event::NameCapacity - 1);
+    event._name[Event::NameCapacity - 1] = '\0';
+    event._start = std::chrono::duration_cast<std::chrono::nanoseconds>(start - _epoch).count();
+    event._duration = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    event._thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+}
+
+void TraceRecorder::Dump(const std::string& path) {
+    std::ofstream file{path};
+    if (!file.is_open()) {
+        IE_THROW() << "Arm Plugin: Failed to open trace file for writing: " << path;
+    }
+    const auto written = _next.load(std::memory_order_relaxed);
+    const auto count = std::min<std::uint64_t>(written, Capacity);
+    auto escape = [] (const char* name) {
+        std::string escaped;
+        for (const char* c = name; *c != '\0'; ++c) {
+            if ((*c == '"') || (*c == '\\')) {
+                escaped += '\\';
+            }
+            escaped += (static_cast<unsigned char>(*c) < 0x20) ? ' ' : *c;
+        }
+        return escaped;
+    };
+    // Chrome trace "X" (complete) events; ts/dur are microseconds, fractions
+    // keep the nanosecond resolution of the recorder
+    file << "{\"traceEvents\":[";
+    file << std::fixed << std::setprecision(3);
+    for (std::uint64_t i = written - count; i < written; ++i) {
+        const auto& event = _events[i & (Capacity - 1)];
+        file << (i == (written - count) ? "\n" : ",\n")
+             << "{\"name\":\"" << escape(event._name) << "\",\"cat\":\"arm_plugin\",\"ph\":\"X\""
+             << ",\"pid\":0,\"tid\":" << (event._thread & 0xFFFFFFFFull)
+             << ",\"ts\":" << (static_cast<double>(event._start) / 1000.0)
+             << ",\"dur\":" << (static_cast<double>(event._duration) / 1000.0) << '}';
+    }
+    file << "\n]}\n";
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ArmPlugin {
+
+// Built-in execution tracer: a process-wide fixed-size ring buffer of
+// begin/end timestamps with thread ids, dumped on demand as Chrome trace JSON
+// loadable by chrome://tracing or Perfetto. The ITT tasks on the request hot
+// path need VTune, which does not exist on ARM targets; this records the same
+// regions - pipeline stages, every layer, scheduler kernel dispatches - at
+// the cost of two clock reads and one ring slot per region, so the timelines
+// it shows are the timelines it measured. Recording is enabled per load
+// through EXEC_TRACE and dumped through the "DUMP_TRACE" SetConfig key; when
+// the ring wraps, the newest events win.
+struct TraceRecorder {
+    using Clock = std::chrono::steady_clock;
+    struct Event {
+        // Sized for annotated layer spans (name, shapes, engine), not just
+        // bare kernel names
+        constexpr static std::size_t NameCapacity = 128;
+        char            _name[NameCapacity];
+        // Nanoseconds relative to the recorder epoch
+        std::uint64_t   _start;
+        std::uint64_t   _duration;
+        std::uint64_t   _thread;
+    };
+    constexpr static std::size_t Capacity = 1 << 16;
+
+    static TraceRecorder& get();
+
+    void Enable(bool enable);
+    bool Enabled() const {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    // Allocation-free, callable from any worker thread
+    void Record(const char* name, Clock::time_point start, Clock::time_point stop);
+    // Writes the buffered events as Chrome trace JSON, oldest first. Events
+    // recorded while the dump runs may come out torn; dump between runs for
+    // an exact timeline.
+    void Dump(const std::string& path);
+
+private:
+    TraceRecorder();
+    Clock::time_point           _epoch;
+    std::atomic_bool            _enabled{false};
+    std::atomic<std::uint64_t>  _next{0};
+    std::vector<Event>          _events;
+};
+
+// RAII region around one traced span; a single relaxed load when tracing is
+// off. The name must outlive the scope (layer names are owned by the
+// function, kernel names and literals by the binary).
+struct TraceScope {
+    explicit TraceScope(const char* name) {
+        if (TraceRecorder::get().Enabled()) {
+            _name = name;
+            _start = TraceRecorder::Clock::now();
+        }
+    }
+    ~TraceScope() {
+        if (_name != nullptr) {
+            TraceRecorder::get().Record(_name, _start, TraceRecorder::Clock::now());
+        }
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    const char*                         _name = nullptr;
+    TraceRecorder::Clock::time_point    _start;
+};
+
+}  // namespace ArmPlugin
@@ -0,0 +1,245 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_weight_codec.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+
+using namespace ArmPlugin;
+
+namespace {
+// Image layout: magic, u64 raw size, u32 block size, then per block a u32
+// header (compressed byte count, high bit set when the block is stored raw)
+// followed by its payload. Blocks compress independently so they can
+// decompress in parallel.
+constexpr char magic[4] = {'A', 'W', 'Z', '1'};
+constexpr std::size_t headerBytes = sizeof(magic) + sizeof(std::uint64_t) + sizeof(std::uint32_t);
+constexpr std::size_t blockBytes = 256 * 1024;
+constexpr std::uint32_t rawBlockFlag = 0x80000000u;
+
+constexpr std::size_t minMatch = 4;
+constexpr std::size_t hashBits = 15;
+
+std::uint32_t Load32(const std::uint8_t* ptr) {
+    std::uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+std::uint32_t Hash(std::uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - hashBits);
+}
+
+void PutCount(std::string& out, std::size_t count) {
+    while (count >= 255) {
+        out.push_back(static_cast<char>(255));
+        count -= 255;
+    }
+    out.push_back(static_cast<char>(count));
+}
+
+// Greedy LZ77 over one block: token byte holds literal count and match length
+// in nibbles (15 escapes to 255-coded extension bytes), literals follow, then
+// a 16-bit match offset. The final sequence of a block carries literals only.
+void CompressBlock(const std::uint8_t* src, std::size_t size, std::string& out) {
+    std::vector<std::int32_t> table(std::size_t{1} << hashBits, -1);
+    std::size_t pos = 0;
+    std::size_t literalStart = 0;
+    auto emit = [&] (std::size_t matchPos, std::size_t matchLen) {
+        const auto literals = pos - literalStart;
+        const auto lenCode = (matchLen != 0) ? (matchLen - minMatch) : 0;
+        out.push_back(static_cast<char>(
+            (std::min<std::size_t>(literals, 15) << 4) | std::min<std::size_t>(lenCode, 15)));
+        if (literals >= 15) {
+            PutCount(out, literals - 15);
+        }
+        out.append(reinterpret_cast<const char*>(src + literalStart), literals);
+        if (matchLen != 0) {
+            const auto offset = static_cast<std::uint16_t>(pos - matchPos);
+            out.push_back(static_cast<char>(offset & 0xFF));
+            out.push_back(static_cast<char>(offset >> 8));
+            if (lenCode >= 15) {
+                PutCount(out, lenCode - 15);
+            }
+        }
+    };
+    while (pos + minMatch <= size) {
+        const auto hash = Hash(Load32(src + pos));
+        const auto candidate = table[hash];
+        table[hash] = static_cast<std::int32_t>(pos);
+        if ((candidate >= 0) && (pos - candidate <= 0xFFFF) &&
+            (Load32(src + candidate) == Load32(src + pos))) {
+            std::size_t matchLen = minMatch;
+            while ((pos + matchLen < size) && (src[candidate + matchLen] == src[pos + matchLen])) {
+                ++matchLen;
+            }
+            emit(candidate, matchLen);
+            pos += matchLen;
+            literalStart = pos;
+        } else {
+            ++pos;
+        }
+    }
+    pos = size;
+    emit(0, 0);
+}
+
+std::size_t GetCount(const std::uint8_t*& ptr, const std::uint8_t* end, std::size_t count) {
+    while ((count % 255 == 0) && (count != 0)) {
+        if (ptr == end) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: Truncated compressed weights block";
+        }
+        const auto extra = *ptr++;
+        count += extra;
+        if (extra != 255) {
+            break;
+        }
+    }
+    return count;
+}
+
+void DecompressBlock(const std::uint8_t* src, std::size_t size, std::uint8_t* dst, std::size_t dstSize) {
+    const auto* end = src + size;
+    std::size_t written = 0;
+    while (written < dstSize) {
+        if (src == end) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: Truncated compressed weights block";
+        }
+        const auto token = *src++;
+        std::size_t literals = token >> 4;
+        if (literals == 15) {
+            literals += GetCount(src, end, std::size_t{255}) - 255;
+        }
+        if ((static_cast<std::size_t>(end - src) < literals) || (dstSize - written < literals)) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: Malformed compressed weights block";
+        }
+        std::memcpy(dst + written, src, literals);
+        src += literals;
+        written += literals;
+        if (written == dstSize) {
+            break;
+        }
+        if (static_cast<std::size_t>(end - src) < 2) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: Truncated compressed weights block";
+        }
+        const std::size_t offset = src[0] | (static_cast<std::size_t>(src[1]) << 8);
+        src += 2;
+        std::size_t matchLen = (token & 0x0F);
+        if (matchLen == 15) {
+            matchLen += GetCount(src, end, std::size_t{255}) - 255;
+        }
+        matchLen += minMatch;
+        if ((offset == 0) || (offset > written) || (dstSize - written < matchLen)) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: Malformed compressed weights block";
+        }
+        // Byte-wise copy: matches may overlap their own output (run encoding)
+        for (std::size_t i = 0; i < matchLen; ++i) {
+            dst[written + i] = dst[written + i - offset];
+        }
+        written += matchLen;
+    }
+}
+
+void Put32(std::string& out, std::uint32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+}  // namespace
+
+std::string WeightCodec::Compress(const std::string& data) {
+    const auto* src = reinterpret_cast<const std::uint8_t*>(data.data());
+    const auto blocks = (data.size() + blockBytes - 1) / blockBytes;
+    std::vector<std::string> compressed(blocks);
+    InferenceEngine::parallel_for(blocks, [&] (std::size_t block) {
+        const auto offset = block * blockBytes;
+        CompressBlock(src + offset, std::min(blockBytes, data.size() - offset), compressed[block]);
+    });
+    std::string out;
+    out.reserve(data.size() / 2);
+    out.append(magic, sizeof(magic));
+    const std::uint64_t rawSize = data.size();
+    out.append(reinterpret_cast<const char*>(&rawSize), sizeof(rawSize));
+    Put32(out, static_cast<std::uint32_t>(blockBytes));
+    for (std::size_t block = 0; block < blocks; ++block) {
+        const auto offset = block * blockBytes;
+        const auto raw = std::min(blockBytes, data.size() - offset);
+        if (compressed[block].size() < raw) {
+            Put32(out, static_cast<std::uint32_t>(compressed[block].size()));
+            out.append(compressed[block]);
+        } else {
+            Put32(out, static_cast<std::uint32_t>(raw) | rawBlockFlag);
+            out.append(data, offset, raw);
+        }
+    }
+    // An incompressible payload (already-compressed or high-entropy weights)
+    // ships unframed, so import takes the plain path with no size overhead
+    return (out.size() < data.size()) ? out : data;
+}
+
+bool WeightCodec::IsCompressed(const std::string& data) {
+    return (data.size() >= headerBytes) && (std::memcmp(data.data(), magic, sizeof(magic)) == 0);
+}
+
+std::uint64_t WeightCodec::DecompressedSize(const std::string& data) {
+    if (!IsCompressed(data)) {
+        return 0;
+    }
+    std::uint64_t rawSize;
+    std::memcpy(&rawSize, data.data() + sizeof(magic), sizeof(rawSize));
+    return rawSize;
+}
+
+void WeightCodec::Decompress(const std::string& data, std::uint8_t* dst) {
+    const auto rawSize = DecompressedSize(data);
+    std::uint32_t imageBlockBytes;
+    std::memcpy(&imageBlockBytes, data.data() + sizeof(magic) + sizeof(std::uint64_t), sizeof(imageBlockBytes));
+    if (imageBlockBytes == 0) {
+        IE_THROW(NetworkNotRead) << "Arm Plugin: Malformed compressed weights image";
+    }
+    struct BlockRef {
+        std::size_t _offset;
+        std::uint32_t _header;
+    };
+    // One sequential scan collects the block offsets, then the payloads
+    // decompress in parallel straight into the destination buffer
+    std::vector<BlockRef> blockRefs;
+    std::size_t offset = headerBytes;
+    std::uint64_t produced = 0;
+    while (produced < rawSize) {
+        if (data.size() - offset < sizeof(std::uint32_t)) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: Truncated compressed weights image";
+        }
+        std::uint32_t header;
+        std::memcpy(&header, data.data() + offset, sizeof(header));
+        offset += sizeof(header);
+        const auto payload = header & ~rawBlockFlag;
+        if (data.size() - offset < payload) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: Truncated compressed weights image";
+        }
+        // A raw block is copied out at the full block size, so its payload
+        // must cover that size exactly; a header understating it would send
+        // the copy past the validated region
+        if (((header & rawBlockFlag) != 0) &&
+            (payload != std::min<std::uint64_t>(imageBlockBytes, rawSize - produced))) {
+            IE_THROW(NetworkNotRead) << "Arm Plugin: Malformed compressed weights image";
+        }
+        blockRefs.push_back(BlockRef{offset, header});
+        offset += payload;
+        produced += std::min<std::uint64_t>(imageBlockBytes, rawSize - produced);
+    }
+    const auto* src = reinterpret_cast<const std::uint8_t*>(data.data());
+    InferenceEngine::parallel_for(blockRefs.size(), [&] (std::size_t block) {
+        const auto dstOffset = block * std::size_t{imageBlockBytes};
+        const auto dstSize = std::min<std::size_t>(imageBlockBytes, rawSize - dstOffset);
+        const auto& ref = blockRefs[block];
+        if ((ref._header & rawBlockFlag) != 0) {
+            std::memcpy(dst + dstOffset, src + ref._offset, dstSize);
+        } else {
+            DecompressBlock(src + ref._offset, ref._header, dst + dstOffset, dstSize);
+        }
+    });
+}
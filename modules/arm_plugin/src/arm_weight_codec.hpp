@@ -0,0 +1,33 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace ArmPlugin {
+
+// Block LZ codec for the weights section of exported blobs
+// (WEIGHT_COMPRESSION). The payload is split into independent blocks, each
+// greedily LZ77-compressed (byte literals plus 16-bit-offset matches, LZ4-like
+// token framing); blocks that do not shrink are stored raw. Independence is
+// what the import path relies on: the compressed image is the only full-size
+// intermediate, and blocks stream in parallel straight into the final weights
+// buffer, so peak load memory stays compressed-size + weights instead of
+// 2x weights.
+struct WeightCodec {
+    // Returns the framed compressed image, or the input unchanged when
+    // compression does not pay (the framing marks which one it is)
+    static std::string Compress(const std::string& data);
+    // True when the payload carries the codec framing
+    static bool IsCompressed(const std::string& data);
+    // Size of the decompressed payload, 0 for an unframed one
+    static std::uint64_t DecompressedSize(const std::string& data);
+    // Decompresses into dst (exactly DecompressedSize bytes), blocks in
+    // parallel on the IE thread pool; throws on a malformed image
+    static void Decompress(const std::string& data, std::uint8_t* dst);
+};
+
+}  // namespace ArmPlugin
@@ -0,0 +1,131 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_weight_streamer.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <ngraph/op/constant.hpp>
+
+using namespace ArmPlugin;
+
+#ifdef __linux__
+static void adviseRegion(const std::uint8_t* data, std::size_t bytes, int advice) {
+    static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    // madvise wants a page-aligned start; round the region outward
+    auto addr = reinterpret_cast<std::uintptr_t>(data);
+    auto alignedAddr = addr & ~(pageSize - 1);
+    auto alignedBytes = ((addr + bytes + pageSize - 1) & ~(pageSize - 1)) - alignedAddr;
+    madvise(reinterpret_cast<void*>(alignedAddr), alignedBytes, advice);
+}
+#endif
+
+static void prefetchSpan(const WeightStreamer::Span& span) {
+#ifdef __linux__
+    adviseRegion(span._data, span._bytes, MADV_WILLNEED);
+#else
+    (void)span;
+#endif
+}
+
+static void evictSpan(const WeightStreamer::Span& span) {
+    // PAGEOUT reclaims immediately (clean file pages are dropped, anything
+    // else goes through swap); COLD only deactivates. Both are safe on any
+    // mapping, unlike DONTNEED which would zero anonymous constants.
+#if defined(__linux__) && defined(MADV_PAGEOUT)
+    adviseRegion(span._data, span._bytes, MADV_PAGEOUT);
+#elif defined(__linux__) && defined(MADV_COLD)
+    adviseRegion(span._data, span._bytes, MADV_COLD);
+#else
+    (void)span;
+#endif
+}
+
+WeightStreamer::WeightStreamer(const std::shared_ptr<const ngraph::Function>& function, std::size_t windowBytes) :
+    _windowBytes{windowBytes} {
+    // Serial indices match the per-request layer loop, which walks the same
+    // get_ordered_ops order
+    std::unordered_map<std::size_t, std::size_t> serialIndex;
+    std::size_t index = 0;
+    for (auto&& node : function->get_ordered_ops()) {
+        serialIndex.emplace(node->get_instance_id(), index++);
+    }
+    for (auto&& node : function->get_ordered_ops()) {
+        if (!ngraph::op::is_constant(node)) {
+            continue;
+        }
+        auto constant = std::static_pointer_cast<ngraph::op::Constant>(node);
+        const auto bytes = constant->get_byte_size();
+        if (bytes < MinStreamedBytes) {
+            continue;
+        }
+        Span span{static_cast<const std::uint8_t*>(constant->get_data_ptr()), bytes, SIZE_MAX, 0};
+        for (auto&& input : node->output(0).get_target_inputs()) {
+            const auto consumer = serialIndex.at(input.get_node()->get_instance_id());
+            span._firstConsumer = std::min(span._firstConsumer, consumer);
+            span._lastConsumer = std::max(span._lastConsumer, consumer);
+        }
+        if (span._firstConsumer == SIZE_MAX) {
+            continue;
+        }
+        _spans.emplace_back(span);
+    }
+    std::stable_sort(_spans.begin(), _spans.end(),
+                     [] (const Span& a, const Span& b) { return a._firstConsumer < b._firstConsumer; });
+    _evictOrder.resize(_spans.size());
+    for (std::size_t i = 0; i < _evictOrder.size(); ++i) {
+        _evictOrder[i] = i;
+    }
+    std::stable_sort(_evictOrder.begin(), _evictOrder.end(),
+                     [this] (std::size_t a, std::size_t b) { return _spans[a]._lastConsumer < _spans[b]._lastConsumer; });
+}
+
+std::size_t WeightStreamer::PageOutConstants(const std::shared_ptr<const ngraph::Function>& function) {
+    std::size_t advised = 0;
+    for (auto&& node : function->get_ordered_ops()) {
+        if (!ngraph::op::is_constant(node)) {
+            continue;
+        }
+        auto constant = std::static_pointer_cast<ngraph::op::Constant>(node);
+        const auto bytes = constant->get_byte_size();
+        if (bytes < MinStreamedBytes) {
+            continue;
+        }
+        evictSpan(Span{static_cast<const std::uint8_t*>(constant->get_data_ptr()), bytes, 0, 0});
+        advised += bytes;
+    }
+    return advised;
+}
+
+void WeightStreamer::BeginRun() {
+    _nextPrefetch = 0;
+    _nextEvict = 0;
+    _residentBytes = 0;
+}
+
+void WeightStreamer::Advance(std::size_t index) {
+    // Readahead for everything first consumed within the prefetch distance;
+    // the kernel performs the file reads asynchronously while layers run
+    while ((_nextPrefetch < _spans.size()) &&
+           (_spans[_nextPrefetch]._firstConsumer <= index + PrefetchDistance)) {
+        prefetchSpan(_spans[_nextPrefetch]);
+        _residentBytes += _spans[_nextPrefetch]._bytes;
+        ++_nextPrefetch;
+    }
+    // Hand consumed weights back, oldest last-use first, until the resident
+    // estimate fits the window again; a generous window evicts nothing and
+    // the weights stay warm for the next inference
+    while ((_residentBytes > _windowBytes) && (_nextEvict < _evictOrder.size()) &&
+           (_spans[_evictOrder[_nextEvict]]._lastConsumer < index)) {
+        evictSpan(_spans[_evictOrder[_nextEvict]]);
+        _residentBytes -= _spans[_evictOrder[_nextEvict]]._bytes;
+        ++_nextEvict;
+    }
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <ngraph/function.hpp>
+
+namespace ArmPlugin {
+
+/**
+ * @brief Bounded-residency execution of models larger than device RAM
+ * (WEIGHT_STREAMING).
+ *
+ * The converter aliases unpadded constant tensors straight over the IR
+ * reader's file-backed weight buffer, so weight pages are demand-paged and
+ * individually reclaimable. Left to itself the kernel reclaims them at
+ * random under pressure, which turns a large model into unpredictable
+ * thrashing. This streamer exploits the serial execution order instead:
+ * while layer k runs it asks the kernel to read ahead the weights of the
+ * next layers (madvise WILLNEED - the readahead itself is asynchronous, so
+ * no prefetch thread is needed), and once a constant's last consumer has
+ * run its pages are handed back (madvise PAGEOUT) whenever the resident
+ * weight estimate exceeds the WEIGHT_WINDOW_MB budget. Every inference
+ * re-streams the evicted weights from the file, trading read bandwidth for
+ * a footprint bounded by the window instead of the full weight size.
+ *
+ * All calls are advisory and non-destructive, so constants that are not
+ * file-backed degrade to plain paging. Serial execution only; the
+ * wavefront executor has no single order to stream along.
+ */
+struct WeightStreamer {
+    WeightStreamer(const std::shared_ptr<const ngraph::Function>& function, std::size_t windowBytes);
+
+    /// Resets the streaming cursors; evicted weights re-stream on this run
+    void BeginRun();
+    /// Called as execution reaches serial layer `index` (graph lock held):
+    /// issues readahead for upcoming layers and evicts consumed weights
+    /// while the resident estimate sits above the window
+    void Advance(std::size_t index);
+
+    /// Hands the pages of every sizeable constant of `function` back to
+    /// their backing (madvise PAGEOUT; file-backed weights are dropped,
+    /// anything else goes through swap) and returns the bytes advised out.
+    /// Used by ModelLifecycle when a network hibernates; like the streaming
+    /// calls this is advisory, so the weights demand-page back on first use.
+    static std::size_t PageOutConstants(const std::shared_ptr<const ngraph::Function>& function);
+
+    /// Weights below this size are not worth the madvise round trips
+    constexpr static std::size_t MinStreamedBytes = 64 * 1024;
+    /// How many serial layers ahead readahead is issued; two keeps the next
+    /// layer's weights in flight while the current one runs
+    constexpr static std::size_t PrefetchDistance = 2;
+
+    struct Span {
+        const std::uint8_t*     _data;
+        std::size_t             _bytes;
+        std::size_t             _firstConsumer;
+        std::size_t             _lastConsumer;
+    };
+
+private:
+    std::size_t                 _windowBytes;
+    std::vector<Span>           _spans;         // sorted by first consumer
+    std::vector<std::size_t>    _evictOrder;    // span indices sorted by last consumer
+    std::size_t                 _nextPrefetch = 0;
+    std::size_t                 _nextEvict = 0;
+    std::size_t                 _residentBytes = 0;
+};
+
+}  // namespace ArmPlugin
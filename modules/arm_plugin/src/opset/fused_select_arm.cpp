@@ -0,0 +1,29 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_select_arm.hpp"
+
+using namespace ngraph;
+using namespace ArmPlugin;
+
+opset::ArmFusedSelect::ArmFusedSelect(const ngraph::OutputVector& arguments,
+                                      Predicate predicateA,
+                                      Predicate predicateB,
+                                      Combine combine,
+                                      bool invert)
+    : Op(arguments), m_predicate_a(predicateA), m_predicate_b(predicateB), m_combine(combine), m_invert(invert) {
+    constructor_validate_and_infer_types();
+}
+
+void opset::ArmFusedSelect::validate_and_infer_types() {
+    const auto expected = (m_combine == Combine::None) ? 4 : 6;
+    NODE_VALIDATION_CHECK(this, static_cast<int>(get_input_size()) == expected,
+                          "ArmFusedSelect expects ", expected, " inputs, got ", get_input_size());
+    const auto thenIndex = expected - 2;
+    set_output_type(0, get_input_element_type(thenIndex), get_input_partial_shape(thenIndex));
+}
+
+std::shared_ptr<ngraph::Node> opset::ArmFusedSelect::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    return std::make_shared<ArmFusedSelect>(new_args, m_predicate_a, m_predicate_b, m_combine, m_invert);
+}
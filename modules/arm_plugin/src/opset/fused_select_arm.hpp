@@ -0,0 +1,46 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph_opset.hpp"
+#include "utils.hpp"
+
+namespace ArmPlugin {
+namespace opset {
+
+// Fused compare -> [logical] -> select chain: the comparison masks never
+// materialize as tensors, the converter evaluates the predicates and blends
+// then/else in one pass. Inputs are (a0, a1, then, else) for a single
+// predicate and (a0, a1, b0, b1, then, else) when two comparison results are
+// combined; set_invert covers a LogicalNot on the condition.
+// Built by pass::FuseCompareSelect.
+class ArmFusedSelect : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ArmFusedSelect", "arm_opset");
+
+    enum class Predicate { Equal, NotEqual, Greater, GreaterEqual, Less, LessEqual };
+    enum class Combine { None, And, Or, Xor };
+
+    ArmFusedSelect(const ngraph::OutputVector& arguments,
+                   Predicate predicateA,
+                   Predicate predicateB = Predicate::Equal,
+                   Combine combine = Combine::None,
+                   bool invert = false);
+    void validate_and_infer_types() override;
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    Predicate get_predicate_a() const { return m_predicate_a; }
+    Predicate get_predicate_b() const { return m_predicate_b; }
+    Combine get_combine() const { return m_combine; }
+    bool get_invert() const { return m_invert; }
+
+private:
+    Predicate m_predicate_a;
+    Predicate m_predicate_b;
+    Combine m_combine;
+    bool m_invert;
+};
+}  // namespace opset
+}  // namespace ArmPlugin
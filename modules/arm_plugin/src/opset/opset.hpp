@@ -17,6 +17,8 @@
 #include "strided_slice_arm.hpp"
 #include "transpose_arm.hpp"
 #include "fft_arm.hpp"
+#include "fused_select_arm.hpp"
+#include "softmax_topk_arm.hpp"
 #include "quantize.hpp"
 #include "ngraph_opset.hpp"
 #include "utils.hpp"
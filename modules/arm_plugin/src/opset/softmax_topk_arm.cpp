@@ -0,0 +1,33 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "softmax_topk_arm.hpp"
+
+using namespace ngraph;
+using namespace ArmPlugin;
+
+opset::ArmSoftmaxTopK::ArmSoftmaxTopK(const ngraph::Output<ngraph::Node>& logits,
+                                      std::size_t axis,
+                                      std::size_t k,
+                                      ngraph::op::TopKSortType sort,
+                                      const ngraph::element::Type& indexElementType)
+    : Op({logits}), m_axis(axis), m_k(k), m_sort(sort), m_index_element_type(indexElementType) {
+    constructor_validate_and_infer_types();
+}
+
+void opset::ArmSoftmaxTopK::validate_and_infer_types() {
+    const auto& shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, shape.rank().is_static() && (m_axis < static_cast<std::size_t>(shape.rank().get_length())),
+                          "ArmSoftmaxTopK axis ", m_axis, " is out of the input rank");
+    auto outShape = shape;
+    outShape[m_axis] = static_cast<ngraph::Dimension::value_type>(m_k);
+    set_output_size(2);
+    set_output_type(0, get_input_element_type(0), outShape);
+    set_output_type(1, m_index_element_type, outShape);
+}
+
+std::shared_ptr<ngraph::Node> opset::ArmSoftmaxTopK::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<ArmSoftmaxTopK>(new_args.at(0), m_axis, m_k, m_sort, m_index_element_type);
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph_opset.hpp"
+#include "utils.hpp"
+
+namespace ArmPlugin {
+namespace opset {
+
+// Fused Softmax -> TopK classification tail: softmax is monotone, so the
+// top-k of a softmax equals the top-k of the raw logits, and only the k
+// winners' softmax values ever need computing. The single input is the
+// logits tensor; axis is the shared softmax/top-k axis. Output 0 carries
+// the k softmax values, output 1 the indices, matching the TopK outputs
+// the fusion replaced. Built by pass::SoftmaxTopKFusion.
+class ArmSoftmaxTopK : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ArmSoftmaxTopK", "arm_opset");
+
+    ArmSoftmaxTopK(const ngraph::Output<ngraph::Node>& logits,
+                   std::size_t axis,
+                   std::size_t k,
+                   ngraph::op::TopKSortType sort,
+                   const ngraph::element::Type& indexElementType);
+    void validate_and_infer_types() override;
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    std::size_t get_axis() const { return m_axis; }
+    std::size_t get_k() const { return m_k; }
+    ngraph::op::TopKSortType get_sort_type() const { return m_sort; }
+    const ngraph::element::Type& get_index_element_type() const { return m_index_element_type; }
+
+private:
+    std::size_t m_axis;
+    std::size_t m_k;
+    ngraph::op::TopKSortType m_sort;
+    ngraph::element::Type m_index_element_type;
+};
+}  // namespace opset
+}  // namespace ArmPlugin
@@ -48,4 +48,10 @@ arm_compute::ActivationLayerInfo makeActivationLayerInfo(ngraph::Node* node) {
     }
 }
 }  // namespace opset
+
+bool ForcedToReference(const ngraph::Node* node) {
+    const auto& rtInfo = node->get_rt_info();
+    auto itAffinity = rtInfo.find("ArmAffinity");
+    return (itAffinity != rtInfo.end()) && (itAffinity->second.as<std::string>() == "REF");
+}
 }  // namespace ArmPlugin
@@ -24,6 +24,13 @@ arm_compute::ActivationLayerInfo makeActivationLayerInfo(ngraph::Node* node);
 
 }  // namespace opset
 
+// True when the node carries the "ArmAffinity"="REF" rt_info mark (stamped by
+// ArmOptimizations from the NODE_AFFINITY config key). The Arm-specific
+// substitution passes leave such a node in its generic opset form, so the
+// converter picks the reference implementation for this one node while the
+// rest of the network keeps running on ACL
+bool ForcedToReference(const ngraph::Node* node);
+
 struct SafeCast {
     const char* file;
     const int line;
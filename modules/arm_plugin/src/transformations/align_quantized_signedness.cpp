@@ -0,0 +1,131 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "align_quantized_signedness.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/rt_info.hpp>
+#include <ngraph_ops/type_relaxed.hpp>
+
+#include "opset/opset.hpp"
+
+using namespace ArmPlugin;
+
+namespace {
+// Consumers whose QI wrappers interpret their activation input through a
+// per-tensor prescale QuantizationInfo; shifting that offset absorbs the flip
+bool isQuantizedCompute(const ngraph::Node* node, std::size_t index) {
+    if (ngraph::is_type<opset::ArmConvolution>(node) ||
+        ngraph::is_type<opset::ArmGroupConvolution>(node) ||
+        ngraph::is_type<opset::MatMul>(node)) {
+        return index == 0;
+    }
+    if (ngraph::is_type<opset::Add>(node) || ngraph::is_type<opset::Multiply>(node)) {
+        return (index == 0 || index == 1) &&
+               node->get_output_element_type(0).is_quantized() &&
+               node->get_rt_info().count("QuantizationInfo") != 0;
+    }
+    return false;
+}
+
+// Shift-equivariant data movers: flipping their input codes by -128 flips
+// their output codes by -128, and type inference repropagates the element type
+bool isPassThrough(const ngraph::Node* node, std::size_t index) {
+    return (ngraph::is_type<opset::MaxPool>(node) ||
+            ngraph::is_type<opset::Reshape>(node) ||
+            ngraph::is_type<opset::Squeeze>(node) ||
+            ngraph::is_type<opset::Unsqueeze>(node) ||
+            ngraph::is_type<opset::Transpose>(node) ||
+            ngraph::is_type<opset::Split>(node) ||
+            ngraph::is_type<opset::ArmSplit>(node)) && index == 0;
+}
+
+void shiftQuantizationOffset(ngraph::Node* node, const std::string& name) {
+    auto& rtInfo = node->get_rt_info();
+    auto itInfo = rtInfo.find(name);
+    if (itInfo != rtInfo.end()) {
+        auto uniform = itInfo->second.as<arm_compute::QuantizationInfo>().uniform(0);
+        rtInfo[name] = arm_compute::QuantizationInfo{uniform.scale, uniform.offset - 128};
+    } else {
+        rtInfo[name] = arm_compute::QuantizationInfo{1.f, -128};
+    }
+}
+
+// Gathers every output whose codes flip together with the root; fails when any
+// consumer can not absorb the flip (network outputs, ops that read absolute
+// code values like quantized activations)
+bool collectFlips(const ngraph::Output<ngraph::Node>& output, std::vector<ngraph::Output<ngraph::Node>>& flipped) {
+    flipped.push_back(output);
+    for (auto&& target : output.get_target_inputs()) {
+        auto consumer = target.get_node();
+        if (ngraph::is_type<opset::ArmDequantize>(consumer) ||
+            isQuantizedCompute(consumer, target.get_index())) {
+            continue;
+        }
+        if (isPassThrough(consumer, target.get_index())) {
+            bool supported = true;
+            for (auto&& consumerOutput : consumer->outputs()) {
+                supported = supported && collectFlips(consumerOutput, flipped);
+            }
+            if (supported) {
+                continue;
+            }
+        }
+        return false;
+    }
+    return true;
+}
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::AlignQuantizedSignedness, "AlignQuantizedSignedness", 0);
+bool ArmPlugin::pass::AlignQuantizedSignedness::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    // u8 codes 0..255 map losslessly onto i8 -128..127 by subtracting 128, and
+    // every per-tensor QuantizationInfo offset moves by the same amount. Doing
+    // the rewrite once at load removes the CpuConvertQuantizedSignednessKernel
+    // passes the QI wrappers would otherwise schedule on mixed-sign layers.
+    // Constant (weights) inputs are left alone: their signedness conversion
+    // already happens once at configure time and per-channel QSYMM8 carries no
+    // offset to shift.
+    bool modified = false;
+    for (auto&& node : f->get_ordered_ops()) {
+        if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node)) {
+            continue;
+        }
+        auto relaxed = std::dynamic_pointer_cast<ngraph::op::TypeRelaxedBase>(node);
+        if (relaxed == nullptr || node->get_rt_info().count("QuantizationInfo") == 0) {
+            continue;
+        }
+        for (auto&& output : node->outputs()) {
+            if (output.get_element_type() != ngraph::element::u8) {
+                continue;
+            }
+            std::vector<ngraph::Output<ngraph::Node>> flipped;
+            if (!collectFlips(output, flipped)) {
+                continue;
+            }
+            relaxed->set_overridden_output_type(ngraph::element::i8, output.get_index());
+            shiftQuantizationOffset(node.get(), "QuantizationInfo");
+            for (auto&& flippedOutput : flipped) {
+                for (auto&& target : flippedOutput.get_target_inputs()) {
+                    auto consumer = target.get_node();
+                    if (ngraph::is_type<opset::ArmDequantize>(consumer)) {
+                        shiftQuantizationOffset(consumer, "QuantizationInfo");
+                    } else if (isQuantizedCompute(consumer, target.get_index())) {
+                        auto eltwiseSecondInput = (target.get_index() == 1) &&
+                            (ngraph::is_type<opset::Add>(consumer) || ngraph::is_type<opset::Multiply>(consumer));
+                        shiftQuantizationOffset(consumer, eltwiseSecondInput ? "SecondInputPrescaleInfo"
+                                                                             : "InputPrescaleInfo");
+                    }
+                }
+            }
+            modified = true;
+        }
+    }
+    if (modified) {
+        f->validate_nodes_and_infer_types();
+    }
+    return modified;
+}
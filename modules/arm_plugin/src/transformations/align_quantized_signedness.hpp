@@ -0,0 +1,19 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+
+namespace ArmPlugin {
+namespace pass {
+
+class AlignQuantizedSignedness : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
+
+}  // namespace pass
+}  // namespace ArmPlugin
@@ -4,6 +4,7 @@
 
 #include "transformations/common_optimizations/nop_elimination.hpp"
 #include "transformations/common_optimizations/conv_mul_fusion.hpp"
+#include "transformations/common_optimizations/pad_fusion.hpp"
 #include "transformations/convert_precision.hpp"
 #include "transformations/init_node_info.hpp"
 #include "transformations/decompose_variadic_split.hpp"
@@ -33,11 +34,19 @@
 #include "transformations/op_conversions/convert_subtract.hpp"
 
 #include "conv_bias_fusion.hpp"
+#include "conv_activation_fusion.hpp"
+#include "eltwise_activation_fusion.hpp"
+#include "matmul_bias_fusion.hpp"
+#include "matmul_activation_fusion.hpp"
+#include "transpose_sinking.hpp"
+#include "broadcast_elimination.hpp"
 #include "convert_eltwise.hpp"
 #include "convert_sign.hpp"
 #include "convert_round.hpp"
 #include "convert_comparison.hpp"
 #include "convert_logical.hpp"
+#include "fuse_compare_select.hpp"
+#include "softmax_topk_fusion.hpp"
 #include "convert_strided_slice.hpp"
 #include "convert_strided_slice_arm.hpp"
 #include "convert_group_conv.hpp"
@@ -51,14 +60,11 @@
 #include "convert_split.hpp"
 #include "convert_concat.hpp"
 #include "decompose_swish.hpp"
-#include "convert_shuffle_channels.hpp"
-#include "convert_tile_to_concats.hpp"
 #include "convert_transpose_arm.hpp"
 #include "convert_prelu.hpp"
 #include "convert_gather_arm.hpp"
 #include "convert_mvn_arm.hpp"
 #include "convert_reduce_multi_axis.hpp"
-#include "convert_select.hpp"
 #include "normalizel2_max_fusion.hpp"
 #include "decompose_normalizel2_add.hpp"
 #include "decompose_mish.hpp"
@@ -70,11 +76,21 @@
 #include "finalize_trailing_nodes.hpp"
 #include "transformations/convert_reorg.hpp"
 #include "quantize_fusion.hpp"
+#include "align_quantized_signedness.hpp"
+#include "parallel_constant_folding.hpp"
 #include "store_result_name.hpp"
 #include "replace_power_by_mul.hpp"
 
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
 
 #include <transformations/low_precision/disable_convert_constant_folding_on_const_path.hpp>
 #include <low_precision/common/operation_per_tensor_quantization_restriction.hpp>
@@ -94,6 +110,7 @@
 #include "transformations/serialize.hpp"
 
 
+#include "arm_itt.hpp"
 #include "arm_optimizations.hpp"
 
 NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::ArmOptimizations, "ArmOptimizations", 0);
@@ -137,7 +154,61 @@ void ArmPlugin::pass::ArmOptimizations::Dump(const std::shared_ptr<ngraph::Funct
 
 bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::Function> f) {
     auto quantized = _lpt && ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(f);
+    // Op types present anywhere in the graph, sub-graph bodies included.
+    // Conversion and decomposition passes whose target op can only originate
+    // from the user graph (never from an earlier pass of this pipeline) are
+    // skipped when the op is absent, so their matchers never walk the graph.
+    // Fusions and generic cleanups stay unconditional - their patterns are
+    // built by other passes.
+    // Per-node affinity pins ("name:REF;name:ACL") resolved against the
+    // original friendly names; stamped below while the graph is walked, before
+    // any substitution could rewrite the pinned node
+    std::map<std::string, std::string> affinityPins;
+    if (!_nodeAffinity.empty()) {
+        std::stringstream pins{_nodeAffinity};
+        std::string pin;
+        while (std::getline(pins, pin, ';')) {
+            auto colon = pin.rfind(':');
+            if (colon == std::string::npos) {
+                IE_THROW() << "Invalid NODE_AFFINITY entry: " << pin;
+            }
+            auto affinity = pin.substr(colon + 1);
+            if ((affinity != "REF") && (affinity != "ACL")) {
+                IE_THROW() << "Unsupported NODE_AFFINITY value: " << affinity;
+            }
+            affinityPins.emplace(pin.substr(0, colon), affinity);
+        }
+    }
+    std::unordered_set<std::string> presentOps;
+    {
+        std::vector<std::shared_ptr<ngraph::Function>> functions{f};
+        while (!functions.empty()) {
+            auto function = functions.back();
+            functions.pop_back();
+            for (auto&& node : function->get_ops()) {
+                presentOps.emplace(node->get_type_name());
+                auto itPin = affinityPins.find(node->get_friendly_name());
+                if (itPin != affinityPins.end()) {
+                    node->get_rt_info()["ArmAffinity"] = itPin->second;
+                    affinityPins.erase(itPin);
+                }
+                if (auto subGraph = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node)) {
+                    if (subGraph->get_function() != nullptr) {
+                        functions.push_back(subGraph->get_function());
+                    }
+                }
+            }
+        }
+    }
+    if (!affinityPins.empty()) {
+        IE_THROW() << "NODE_AFFINITY names no node of the network: " << affinityPins.begin()->first;
+    }
+    auto has = [&presentOps] (const char* opType) {
+        return presentOps.find(opType) != presentOps.end();
+    };
     {
+        OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, "ArmOptimizations::Common");
+        LoadProfileScope profileScope{_loadProfile, "Transform/Common"};
         ov::pass::Manager manager;
 
         Dump(f, "initial");
@@ -151,38 +222,81 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::
         manager.register_pass<ngraph::pass::InitNodeInfo>();
         manager.register_pass<pass::StoreResultName>();
         // Resolves dynamism (replaces NonZero), CF needed
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::RemoveFilteringBoxesBySize>();
+        if (has("NonZero")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::RemoveFilteringBoxesBySize>();
+        }
+        // Pre-folds the bulk of the constant subgraphs (weight dequantize
+        // chains in particular) in parallel; the serial pass behind it only
+        // mops up what the wavefront evaluation could not handle
+        manager.register_pass<pass::ParallelConstantFolding>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
         // may introduce fake dynamism
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::NopElimination>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ReplacePowerByMul>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
+        // Sinks layout permutes through elementwise/concat/split chains and cancels
+        // inverse pairs, so only irreducible transposes survive to execution
+        if (has("Transpose")) {
+            auto transposeSinking = manager.register_pass<ov::pass::GraphRewrite>();
+            transposeSinking->add_matcher<pass::TransposeSinkingUnary>();
+            transposeSinking->add_matcher<pass::TransposeSinkingBinary>();
+            transposeSinking->add_matcher<pass::TransposeSinkingConcat>();
+            transposeSinking->add_matcher<pass::TransposeSinkingSplit>();
+            transposeSinking->add_matcher<pass::TransposePairFusion>();
+            manager.register_pass<ngraph::pass::ConstantFolding>();
+        }
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::SoftPlusFusion>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::HSwishFusion>();
 
         // LinOpSequenceFusion must be executed after all decompositions
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::LinOpSequenceFusion>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::RNNCellDecomposition>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::LSTMCellDecomposition>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::GRUCellDecomposition>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertGELU>();
+        if (has("RNNCell")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::RNNCellDecomposition>();
+        }
+        if (has("LSTMCell")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::LSTMCellDecomposition>();
+        }
+        if (has("GRUCell")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::GRUCellDecomposition>();
+        }
+        if (has("Gelu")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertGELU>();
+        }
         manager.register_pass<ngraph::pass::ConstantFolding>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertConv1D>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGroupConv1D>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGroupConvolution>();
+        if (has("Convolution")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertConv1D>();
+        }
+        if (has("GroupConvolution")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGroupConv1D>();
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGroupConvolution>();
+        }
         manager.register_pass<ngraph::pass::ConstantFolding>();
+        // Folds explicit zero-pads into the padding attributes of the consumer
+        // (Convolution, GroupConvolution, their backprops and AvgPool), removing
+        // the Pad node and its tensor. MaxPool is deliberately not folded: its
+        // implicit padding value is -inf, so a zero-pad fold would change results
+        // for all-negative windows.
+        if (has("Pad")) {
+            manager.register_pass<ngraph::pass::PadFusion>();
+        }
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvolutionMultiplyFusion>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::GroupConvolutionMultiplyFusion>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvolutionBackpropDataMultiplyFusion>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::GroupConvolutionBackpropDataMultiplyFusion>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertTensorIteratorToGRUSequence>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertTensorIteratorToLSTMSequence>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertTensorIteratorToRNNSequence>();
+        if (has("TensorIterator")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertTensorIteratorToGRUSequence>();
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertTensorIteratorToLSTMSequence>();
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertTensorIteratorToRNNSequence>();
+        }
         manager.register_pass<ngraph::pass::ConstantFolding>();
 
 
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertInterpolate1ToInterpolate4>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertMVN1ToMVN6>();
+        if (has("Interpolate")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertInterpolate1ToInterpolate4>();
+        }
+        if (has("MVN")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertMVN1ToMVN6>();
+        }
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertQuantizeDequantize>();
         #ifndef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
             manager.register_pass<ngraph::pass::ConvertPrecision>(ngraph::element::f16, ngraph::element::f32);
@@ -207,6 +321,8 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::
 
     using namespace ngraph::pass::low_precision;
     if (quantized) {
+        OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, "ArmOptimizations::LPT");
+        LoadProfileScope profileScope{_loadProfile, "Transform/LPT"};
         Dump(f, "before_common");
         auto supportedPrecisions = std::vector<OperationPrecisionRestriction>({
             OperationPrecisionRestriction::create<ngraph::opset1::Convolution>({
@@ -220,13 +336,20 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::
             OperationPrecisionRestriction::create<ngraph::opset1::GroupConvolution>({
                 {0, {ngraph::element::u8, ngraph::element::i8}},
                 {1, {ngraph::element::u8, ngraph::element::i8}}
+            }),
+            // ACL's lowp GEMM wants signed weights; the data side converts
+            // signedness inside NEFullyConnectedLayerQI when needed
+            OperationPrecisionRestriction::create<ngraph::opset1::MatMul>({
+                {0, {ngraph::element::u8, ngraph::element::i8}},
+                {1, {ngraph::element::i8}}
             })
         });
 
         auto perTensorQuantization = std::vector<OperationPerTensorQuantizationRestriction>({
             OperationPerTensorQuantizationRestriction::create<ngraph::opset1::Convolution>({0}),
             OperationPerTensorQuantizationRestriction::create<ngraph::opset1::ConvolutionBackpropData>({0}),
-            OperationPerTensorQuantizationRestriction::create<ngraph::opset1::GroupConvolution>({0})
+            OperationPerTensorQuantizationRestriction::create<ngraph::opset1::GroupConvolution>({0}),
+            OperationPerTensorQuantizationRestriction::create<ngraph::opset1::MatMul>({0})
         });
 
         ov::pass::Manager lptManager;
@@ -241,24 +364,67 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::
     }
 
     {
+        OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, "ArmOptimizations::ArmSpecific");
+        LoadProfileScope profileScope{_loadProfile, "Transform/ArmSpecific"};
         Dump(f, "before_arm_specific_transformations");
         ov::pass::Manager manager;
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::LogSoftmaxDecomposition>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGRN>();
+        if (has("LogSoftmax")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::LogSoftmaxDecomposition>();
+        }
+        if (has("GRN")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGRN>();
+        }
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::NormalizeL2Fusion>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DecomposeNormalizeL2Add>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertNormalizeL2ToArm>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertReduceMultiAxis>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ReduceL1Decomposition>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ReduceL2Decomposition>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertReduceMeanToPooling>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertReduceMaxToPooling>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertReduceSumToPooling>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertMod>();
+        if (has("ReduceL1")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ReduceL1Decomposition>();
+        }
+        if (has("ReduceL2")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ReduceL2Decomposition>();
+        }
+        if (has("ReduceMean")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertReduceMeanToPooling>();
+        }
+        if (has("ReduceMax")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertReduceMaxToPooling>();
+        }
+        if (has("ReduceSum")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertReduceSumToPooling>();
+        }
+        // Reduce-to-pooling is not a universal win: on small planes the
+        // pooling kernel dispatch and layout overhead beats the gain, and on
+        // some little-core SoCs it loses even at size. The decision consults
+        // the per-SoC cost table when one is configured (COST_MODEL_PATH);
+        // answering true keeps the reduction as is.
+        manager.get_pass_config()->set_callback<ngraph::pass::ConvertReduceMeanToPooling,
+                                                ngraph::pass::ConvertReduceMaxToPooling,
+                                                ngraph::pass::ConvertReduceSumToPooling>(
+            [this] (const std::shared_ptr<const ngraph::Node>& node) -> bool {
+                if (!node->get_input_partial_shape(0).is_static()) {
+                    return false;
+                }
+                const auto elements = ngraph::shape_size(node->get_input_shape(0));
+                return !_costModel.Wins("reduce-to-pooling", elements, elements >= 4096);
+            });
+        if (has("Mod")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertMod>();
+        }
         manager.register_pass<ngraph::pass::ConstantFolding>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DecomposeSwish>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DecomposeMish>();
+        // With FAST_MATH on the converter has single-pass fused kernels for
+        // Swish and Mish, so the nodes stay whole; the decompositions remain
+        // the strict-mode path
+        if (has("Swish") && !_fastMath) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DecomposeSwish>();
+        }
+        if (has("Mish") && !_fastMath) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DecomposeMish>();
+        }
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::BroadcastPRelu>();
+        // Collapse compare->[logical]->select chains before the rewrites
+        // below expand the survivors into their multi-pass Select form
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::FuseCompareSelect>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertLogical>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertComparison>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertTranspose>();
@@ -266,24 +432,55 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertRound>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertSign>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertCeiling>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DecomposeVariadicSplit>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertStridedSliceToArm>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertStridedSlice>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertBatchNormInferenceV0toV5>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertBatchNormInference>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertShuffleChannels>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertInterpolate>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertMVN>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertReorgYolo>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertMaxPool1D>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertAvgPool1D>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::BroadcastSelect>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGather>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertGather8ToGather7>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertDFT>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertIDFT>();
+        if (has("VariadicSplit")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::DecomposeVariadicSplit>();
+        }
+        if (has("StridedSlice")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertStridedSliceToArm>();
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertStridedSlice>();
+        }
+        if (has("BatchNormInference")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertBatchNormInferenceV0toV5>();
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertBatchNormInference>();
+        }
+        if (has("Interpolate")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertInterpolate>();
+        }
+        if (has("MVN")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertMVN>();
+        }
+        if (has("ReorgYolo")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertReorgYolo>();
+        }
+        if (has("MaxPool")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertMaxPool1D>();
+        }
+        if (has("AvgPool")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertAvgPool1D>();
+        }
+        if (has("Gather")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertGather>();
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertGather8ToGather7>();
+        }
+        if (has("DFT")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertDFT>();
+        }
+        if (has("IDFT")) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertIDFT>();
+        }
         manager.register_pass<ngraph::pass::ConstantFolding>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvBiasFusion>();
+        // Quantized graphs fuse activations inside ConvolutionQuantizeFusion,
+        // which still needs the conv -> activation -> FQ chain intact
+        if (!quantized) {
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::MatMulBiasFusion>();
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvActivationFusion>();
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::MatMulActivationFusion>();
+            manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::EltwiseActivationFusion>();
+        }
+        // Classification tails: select the top-k on the raw logits and
+        // compute only the winners' softmax values
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::SoftmaxTopKFusion>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertMatMulToFC>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
@@ -291,11 +488,13 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertArmConvertLike>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertDivide>();
+        // ACL arithmetic kernels broadcast natively; drop explicit Broadcasts in
+        // front of eltwise consumers so only the leftovers get tiled below
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::BroadcastElimination>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertBroadcast3>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<ngraph::pass::ConvertBroadcastToTiles>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertEltwise>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
-        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertTile>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertSplit>();
         manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<pass::ConvertConcat>();
         manager.register_pass<pass::FinalizeTrailingNodes>();
@@ -310,6 +509,8 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::
     }
 
     if (quantized) {
+        OV_ITT_SCOPED_TASK(Itt::Domains::ArmPlugin, "ArmOptimizations::QuantizedFusions");
+        LoadProfileScope profileScope{_loadProfile, "Transform/QuantizedFusions"};
         Dump(f, "before_arm");
         ov::pass::Manager manager;
         {
@@ -320,6 +521,16 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::
         {
             auto pass = manager.register_pass<ov::pass::GraphRewrite>();
             pass->add_matcher<pass::DequantizeInputFusion>();
+            // Folds the weights-side dequantize Multiply into a per-channel
+            // prescale so per-channel (depthwise) chains stay quantized instead
+            // of dropping to an fp32 convolution between convert sandwiches
+            pass->add_matcher<pass::WeightsDequantizeFusion>();
+        }
+        {
+            // Runs once the dequantizes exist as ArmDequantize and before
+            // AddDequantizeOnInputs breaks the eltwise chains back to fp32
+            auto pass = manager.register_pass<ov::pass::GraphRewrite>();
+            pass->add_matcher<pass::EltwiseQuantizeFusion>();
         }
         {
             auto pass = manager.register_pass<ov::pass::GraphRewrite>();
@@ -327,6 +538,16 @@ bool ArmPlugin::pass::ArmOptimizations::run_on_function(std::shared_ptr<ngraph::
             pass->add_matcher<pass::ConvertBiasToI32>();
             pass->add_matcher<pass::ConvertQuantize>();
         }
+        {
+            // Collapses ArmQuantize(ArmDequantize(x)) left between two quantized
+            // regions into one requantize, dropping the fp32 staging tensor
+            // (4x the int8 size) from the activation pool
+            auto pass = manager.register_pass<ov::pass::GraphRewrite>();
+            pass->add_matcher<pass::FoldRequantize>();
+        }
+        // With all quantized ops in their final form, fold remaining u8
+        // activations into i8 so no runtime signedness conversions are left
+        manager.register_pass<pass::AlignQuantizedSignedness>();
         manager.register_pass<ngraph::pass::ConstantFolding>();
         manager.run_passes(f);
     }
@@ -4,21 +4,38 @@
 
 #pragma once
 
+#include <memory>
+
 #include <ngraph/pass/graph_rewrite.hpp>
 
+#include "arm_cost_model.hpp"
+#include "arm_load_profile.hpp"
+
 namespace ArmPlugin {
 namespace pass {
 
 class ArmOptimizations: public ngraph::pass::FunctionPass {
 public:
     NGRAPH_RTTI_DECLARATION;
-    ArmOptimizations(const bool lpt, const bool dump) : _lpt{lpt}, _dump{dump} {}
+    ArmOptimizations(const bool lpt, const bool dump, const std::shared_ptr<LoadProfile>& loadProfile = nullptr,
+                     const std::string& nodeAffinity = {}, const std::string& costModelPath = {}, const bool fastMath = true) :
+        _lpt{lpt}, _dump{dump}, _loadProfile{loadProfile}, _nodeAffinity{nodeAffinity}, _costModel{costModelPath}, _fastMath{fastMath} {}
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
     void Dump(const std::shared_ptr<ngraph::Function>& f, const std::string& postfix);
 
     bool _lpt = false;
     bool _dump = false;
+    std::shared_ptr<LoadProfile> _loadProfile;
+    // "name:REF;name:ACL" list from the NODE_AFFINITY config key, stamped on
+    // the matching nodes as the "ArmAffinity" rt_info before any pass runs
+    std::string _nodeAffinity;
+    // Shape-dependent transform decisions consult this instead of firing on
+    // pattern match alone (COST_MODEL_PATH)
+    CostModel _costModel;
+    // With FAST_MATH on, Swish and Mish stay whole for the fused NEON
+    // converters instead of being decomposed into multi-op chains
+    bool _fastMath = true;
 };
 }  // namespace pass
 }  // namespace ArmPlugin
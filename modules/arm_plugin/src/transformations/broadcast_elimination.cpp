@@ -0,0 +1,100 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "broadcast_elimination.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include <ngraph/rt_info.hpp>
+
+#include "opset/opset.hpp"
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+using namespace ArmPlugin;
+
+namespace {
+// Right-aligned numpy merge; returns false when the shapes do not broadcast
+bool numpy_merge(const ngraph::Shape& lhs, const ngraph::Shape& rhs, ngraph::Shape& merged) {
+    merged.resize(std::max(lhs.size(), rhs.size()));
+    for (std::size_t i = 0; i < merged.size(); ++i) {
+        auto l = i < merged.size() - lhs.size() ? 1 : lhs[i - (merged.size() - lhs.size())];
+        auto r = i < merged.size() - rhs.size() ? 1 : rhs[i - (merged.size() - rhs.size())];
+        if (l != r && l != 1 && r != 1) {
+            return false;
+        }
+        merged[i] = std::max(l, r);
+    }
+    return true;
+}
+
+bool is_broadcasting_consumer(const ngraph::Node* node) {
+    return ngraph::is_type<opset::Add>(node) ||
+           ngraph::is_type<opset::Subtract>(node) ||
+           ngraph::is_type<opset::Multiply>(node) ||
+           ngraph::is_type<opset::Divide>(node) ||
+           ngraph::is_type<opset::Minimum>(node) ||
+           ngraph::is_type<opset::Maximum>(node) ||
+           ngraph::is_type<opset::SquaredDifference>(node) ||
+           ngraph::is_type<opset::Power>(node) ||
+           ngraph::is_type<opset::Select>(node);
+}
+
+bool has_numpy_autob(const ngraph::Node* node) {
+    if (auto select = ngraph::as_type<const opset::Select>(node)) {
+        return select->get_auto_broadcast().m_type == ngraph::op::AutoBroadcastType::NUMPY;
+    }
+    return node->get_autob().m_type == ngraph::op::AutoBroadcastType::NUMPY;
+}
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::BroadcastElimination, "BroadcastElimination", 0);
+ArmPlugin::pass::BroadcastElimination::BroadcastElimination() {
+    auto broadcast_pattern = ngraph::pattern::wrap_type<opset::Broadcast>(ngraph::pattern::has_static_shape());
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(broadcast_pattern, "BroadcastElimination"),
+                     [=](ngraph::pattern::Matcher& m) {
+        auto broadcast = std::dynamic_pointer_cast<opset::Broadcast>(m.get_match_root());
+        if (!broadcast) {
+            return false;
+        }
+        auto mode = broadcast->get_broadcast_spec().m_type;
+        if (mode != ngraph::op::BroadcastType::NUMPY && mode != ngraph::op::BroadcastType::BIDIRECTIONAL) {
+            return false;
+        }
+        auto data = broadcast->input_value(0);
+        if (data.get_partial_shape().is_dynamic()) {
+            return false;
+        }
+        auto targets = broadcast->output(0).get_target_inputs();
+        if (targets.empty()) {
+            return false;
+        }
+        // Every consumer must broadcast natively and keep its output shape
+        // once it is fed the unexpanded operand
+        for (auto&& target : targets) {
+            auto consumer = target.get_node();
+            if (!is_broadcasting_consumer(consumer) || !has_numpy_autob(consumer)) {
+                return false;
+            }
+            ngraph::Shape merged{};
+            for (auto&& input : consumer->inputs()) {
+                const auto& shape = input.get_source_output() == broadcast->output(0) ?
+                    data.get_shape() : input.get_shape();
+                ngraph::Shape next;
+                if (!numpy_merge(merged, shape, next)) {
+                    return false;
+                }
+                merged = next;
+            }
+            if (merged != consumer->get_output_shape(0)) {
+                return false;
+            }
+        }
+        for (auto&& target : targets) {
+            target.replace_source_output(data);
+        }
+        return true;
+    });
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "conv_activation_fusion.hpp"
+
+#include <memory>
+
+#include <ngraph/rt_info.hpp>
+
+#include "opset/opset.hpp"
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+using namespace ArmPlugin;
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::ConvActivationFusion, "ConvActivationFusion", 0);
+ArmPlugin::pass::ConvActivationFusion::ConvActivationFusion() {
+    auto conv_pattern = ngraph::pattern::wrap_type<opset::ArmConvolution,
+                                                   opset::ArmGroupConvolution>(ngraph::pattern::consumers_count(1));
+    auto activation_pattern = ngraph::pattern::wrap_type<opset::Sigmoid,
+                                                         opset::Tanh,
+                                                         opset::Relu,
+                                                         opset::Abs,
+                                                         opset::Elu,
+                                                         opset::SoftPlus,
+                                                         opset::HSwish,
+                                                         opset::PRelu,
+                                                         opset::Clamp>({conv_pattern});
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(activation_pattern, "ConvActivationFusion"),
+                     [=](ngraph::pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_value_map();
+        auto conv = pattern_map[conv_pattern].get_node_shared_ptr();
+        auto activation = pattern_map[activation_pattern].get_node_shared_ptr();
+
+        if (conv->get_rt_info().count("ActivationLayerInfo") != 0) {
+            return false;
+        }
+        if (auto prelu = std::dynamic_pointer_cast<opset::PRelu>(activation)) {
+            // makeActivationLayerInfo takes the slope as a single f32 scalar
+            auto slope = std::dynamic_pointer_cast<opset::Constant>(prelu->input_value(1).get_node_shared_ptr());
+            if (!slope || ngraph::shape_size(slope->get_shape()) != 1 ||
+                slope->get_element_type() != ngraph::element::f32) {
+                return false;
+            }
+        }
+
+        auto activationLayerInfo = opset::makeActivationLayerInfo(activation.get());
+        if (!activationLayerInfo.enabled()) {
+            return false;
+        }
+
+        conv->get_rt_info().emplace("ActivationLayerInfo", activationLayerInfo);
+        ngraph::copy_runtime_info({conv, activation}, conv);
+        conv->set_friendly_name(activation->get_friendly_name());
+        ngraph::replace_node(activation, conv);
+        return true;
+    });
+}
@@ -13,7 +13,7 @@ ArmPlugin::pass::ConvertConcat::ConvertConcat() {
 
     ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
         auto concat = std::dynamic_pointer_cast<opset::Concat>(m.get_match_root());
-        if (!concat) {
+        if (!concat || ForcedToReference(concat.get())) {
             return false;
         }
 
@@ -15,7 +15,7 @@ template <class T>
 ngraph::matcher_pass_callback ArmPlugin::pass::ConvertArmConvertBase::convert_to_arm_convert() {
     return [&](ngraph::pattern::Matcher& m) {
         auto convert = m.get_match_root();
-        if (!std::dynamic_pointer_cast<T>(convert)) {
+        if (!std::dynamic_pointer_cast<T>(convert) || ForcedToReference(convert.get())) {
             return false;
         }
 
@@ -31,7 +31,7 @@ static bool is_decomposable(unsigned int res) {
 
 template <typename T>
 static bool convert_fft(const std::shared_ptr<T>& fft, bool inverse) {
-    if (!fft) {
+    if (!fft || ForcedToReference(fft.get())) {
         return false;
     }
 
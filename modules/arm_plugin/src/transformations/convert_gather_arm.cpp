@@ -13,7 +13,7 @@ ArmPlugin::pass::ConvertGather::ConvertGather() {
 
     ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
         auto gather = std::dynamic_pointer_cast<opset::Gather>(m.get_match_root());
-        if (!gather) {
+        if (!gather || ForcedToReference(gather.get())) {
             return false;
         }
 
@@ -71,7 +71,7 @@ ArmPlugin::pass::ConvertInterpolate::ConvertInterpolate() {
 
     ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
         auto interp = std::dynamic_pointer_cast<opset::Interpolate>(m.get_match_root());
-        if (!interp) {
+        if (!interp || ForcedToReference(interp.get())) {
             return false;
         }
 
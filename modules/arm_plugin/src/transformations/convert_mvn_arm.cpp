@@ -13,7 +13,7 @@ ArmPlugin::pass::ConvertMVN::ConvertMVN() {
 
     ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
         auto mvn = std::dynamic_pointer_cast<opset::MVN>(m.get_match_root());
-        if (!mvn) {
+        if (!mvn || ForcedToReference(mvn.get())) {
             return false;
         }
 
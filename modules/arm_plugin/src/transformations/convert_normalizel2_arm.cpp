@@ -13,7 +13,7 @@ ArmPlugin::pass::ConvertNormalizeL2ToArm::ConvertNormalizeL2ToArm() {
 
     ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
         auto norml2 = std::dynamic_pointer_cast<opset::NormalizeL2>(m.get_match_root());
-        if (!norml2) {
+        if (!norml2 || ForcedToReference(norml2.get())) {
             return false;
         }
 
@@ -1,6 +1,8 @@
 // Copyright (C) 2020-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <set>
+
 #include <ngraph/rt_info.hpp>
 
 #include "opset/opset.hpp"
@@ -27,6 +29,22 @@ ngraph::matcher_pass_callback ArmPlugin::pass::ConvertReduceMultiAxisBase::conve
             IE_THROW() << "Reduce op only supports constant multiple reduction axes.";
         }
         auto axes = reduction_axes->cast_vector<int64_t>();
+        // Trailing contiguous axes over f32 stay intact: the converter lowers
+        // them to the single-pass native reduction, which beats the per-axis
+        // chain and its intermediate tensors
+        {
+            const auto rank = static_cast<int64_t>(reduce->get_input_shape(0).size());
+            std::set<int64_t> normalized;
+            for (auto axis : axes) {
+                normalized.emplace(axis < 0 ? rank + axis : axis);
+            }
+            if ((reduce->get_input_element_type(0) == ngraph::element::f32) &&
+                !normalized.empty() &&
+                (*normalized.begin() == rank - static_cast<int64_t>(normalized.size())) &&
+                (*normalized.rbegin() == rank - 1)) {
+                return false;
+            }
+        }
         ngraph::NodeVector new_ops;
         std::shared_ptr<ngraph::Node> node = reduce->input_value(0).get_node_shared_ptr();
         for (auto axis : axes) {
@@ -12,7 +12,7 @@ ArmPlugin::pass::ConvertSplit::ConvertSplit() {
     register_matcher(std::make_shared<ngraph::pattern::Matcher>(ngraph::pattern::wrap_type<opset::Split>(), "ConvertSplit"),
         [](ngraph::pattern::Matcher& m) {
             auto split = std::dynamic_pointer_cast<opset::Split>(m.get_match_root());
-            if (!split) {
+            if (!split || ForcedToReference(split.get())) {
                 return false;
             }
             if (split->get_input_shape(0).size() > 4) {
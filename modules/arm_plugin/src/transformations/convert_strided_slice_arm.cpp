@@ -13,7 +13,7 @@ ArmPlugin::pass::ConvertStridedSliceToArm::ConvertStridedSliceToArm() {
 
     ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
         auto slice = std::dynamic_pointer_cast<opset::StridedSlice>(m.get_match_root());
-        if (!slice) {
+        if (!slice || ForcedToReference(slice.get())) {
             return false;
         }
 
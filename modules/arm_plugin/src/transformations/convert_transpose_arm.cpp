@@ -13,7 +13,7 @@ ArmPlugin::pass::ConvertTranspose::ConvertTranspose() {
 
     ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
         auto transpose = std::dynamic_pointer_cast<opset::Transpose>(m.get_match_root());
-        if (!transpose) {
+        if (!transpose || ForcedToReference(transpose.get())) {
             return false;
         }
 
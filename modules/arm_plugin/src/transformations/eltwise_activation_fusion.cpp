@@ -0,0 +1,63 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "eltwise_activation_fusion.hpp"
+
+#include <memory>
+
+#include <ngraph/rt_info.hpp>
+
+#include "opset/opset.hpp"
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+using namespace ArmPlugin;
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::EltwiseActivationFusion, "EltwiseActivationFusion", 0);
+ArmPlugin::pass::EltwiseActivationFusion::EltwiseActivationFusion() {
+    auto eltwise_pattern = ngraph::pattern::wrap_type<opset::Add,
+                                                      opset::Subtract,
+                                                      opset::Multiply>(ngraph::pattern::consumers_count(1));
+    auto activation_pattern = ngraph::pattern::wrap_type<opset::Sigmoid,
+                                                         opset::Tanh,
+                                                         opset::Relu,
+                                                         opset::Abs,
+                                                         opset::Elu,
+                                                         opset::SoftPlus,
+                                                         opset::HSwish,
+                                                         opset::PRelu,
+                                                         opset::Clamp>({eltwise_pattern});
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(activation_pattern, "EltwiseActivationFusion"),
+                     [=](ngraph::pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_value_map();
+        auto eltwise = pattern_map[eltwise_pattern].get_node_shared_ptr();
+        auto activation = pattern_map[activation_pattern].get_node_shared_ptr();
+
+        if (eltwise->get_rt_info().count("ActivationLayerInfo") != 0) {
+            return false;
+        }
+        // ACL applies the fused activation to float tensors only
+        if (!eltwise->get_output_element_type(0).is_real()) {
+            return false;
+        }
+        if (auto prelu = std::dynamic_pointer_cast<opset::PRelu>(activation)) {
+            auto slope = std::dynamic_pointer_cast<opset::Constant>(prelu->input_value(1).get_node_shared_ptr());
+            if (!slope || ngraph::shape_size(slope->get_shape()) != 1 ||
+                slope->get_element_type() != ngraph::element::f32) {
+                return false;
+            }
+        }
+
+        auto activationLayerInfo = opset::makeActivationLayerInfo(activation.get());
+        if (!activationLayerInfo.enabled()) {
+            return false;
+        }
+
+        eltwise->get_rt_info().emplace("ActivationLayerInfo", activationLayerInfo);
+        ngraph::copy_runtime_info({eltwise, activation}, eltwise);
+        eltwise->set_friendly_name(activation->get_friendly_name());
+        ngraph::replace_node(activation, eltwise);
+        return true;
+    });
+}
@@ -25,5 +25,41 @@ bool ArmPlugin::pass::FinalizeTrailingNodes::run_on_function(std::shared_ptr<ngr
             }
         }
     }
+    // Strip semantically-null trailing chains: ops in front of a Result that
+    // do not change the bytes of the tensor (a Convert to the same type, the
+    // reshape family - dense row-major tensors only reinterpret the shape)
+    // still cost a kernel run and keep the real producer's tensor behind a
+    // copy. The user-visible output name is pinned before rewiring, so
+    // stripping never renames the output (StoreResultName keeps an existing
+    // entry).
+    for (auto&& result : f->get_results()) {
+        auto source = result->input_value(0);
+        result->get_rt_info().emplace("ResultName", ngraph::op::util::get_ie_output_name(source));
+        for (;;) {
+            auto node = source.get_node_shared_ptr();
+            bool strippable = false;
+            if (ov::is_type<opset::Convert>(node)) {
+                strippable = node->get_input_element_type(0) == node->get_output_element_type(0);
+            } else if (ov::is_type<opset::Reshape>(node) || ov::is_type<opset::Squeeze>(node) ||
+                       ov::is_type<opset::Unsqueeze>(node)) {
+                strippable = node->get_input_partial_shape(0).is_static() &&
+                             node->get_output_partial_shape(0).is_static();
+            }
+            if (!strippable) {
+                break;
+            }
+            // A Parameter wired straight into the Result would leave no layer
+            // between the input and output bindings; keep the last copy op
+            if (ngraph::op::is_parameter(node->input_value(0).get_node())) {
+                break;
+            }
+            source = node->input_value(0);
+            is_modified = true;
+        }
+        if (source != result->input_value(0)) {
+            result->input(0).replace_source_output(source);
+            result->validate_and_infer_types();
+        }
+    }
     return is_modified;
 }
@@ -0,0 +1,138 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "opset/opset.hpp"
+#include "transformations/fuse_compare_select.hpp"
+
+using namespace ArmPlugin;
+
+namespace {
+using Predicate = opset::ArmFusedSelect::Predicate;
+using Combine = opset::ArmFusedSelect::Combine;
+
+bool PredicateOf(const std::shared_ptr<ngraph::Node>& node, Predicate& predicate) {
+    if (ngraph::is_type<opset::Equal>(node.get())) {
+        predicate = Predicate::Equal;
+    } else if (ngraph::is_type<opset::NotEqual>(node.get())) {
+        predicate = Predicate::NotEqual;
+    } else if (ngraph::is_type<opset::Greater>(node.get())) {
+        predicate = Predicate::Greater;
+    } else if (ngraph::is_type<opset::GreaterEqual>(node.get())) {
+        predicate = Predicate::GreaterEqual;
+    } else if (ngraph::is_type<opset::Less>(node.get())) {
+        predicate = Predicate::Less;
+    } else if (ngraph::is_type<opset::LessEqual>(node.get())) {
+        predicate = Predicate::LessEqual;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// The fused kernel evaluates predicates on one operand type and blends
+// another; both must be types the converter instantiates
+bool SupportedCompareType(const ngraph::element::Type& type) {
+    return (type == ngraph::element::i32) || (type == ngraph::element::i64) ||
+           (type == ngraph::element::f16) || (type == ngraph::element::f32);
+}
+
+bool SupportedValueType(const ngraph::element::Type& type) {
+    return (type == ngraph::element::u8) || SupportedCompareType(type);
+}
+
+bool SoleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_target_inputs(0).size() == 1;
+}
+
+// Same-shape comparison whose mask feeds only this chain
+bool FusableComparison(const std::shared_ptr<ngraph::Node>& node, const ngraph::PartialShape& shape, Predicate& predicate) {
+    return PredicateOf(node, predicate) && SoleConsumer(node) &&
+           node->get_input_partial_shape(0).same_scheme(shape) &&
+           node->get_input_partial_shape(1).same_scheme(shape) &&
+           (node->get_input_element_type(0) == node->get_input_element_type(1)) &&
+           SupportedCompareType(node->get_input_element_type(0));
+}
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::FuseCompareSelect, "FuseCompareSelect", 0);
+ArmPlugin::pass::FuseCompareSelect::FuseCompareSelect() {
+    auto select = ngraph::pattern::wrap_type<opset::Select>({ngraph::pattern::any_input(),
+                                                             ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+                                                             ngraph::pattern::any_input(ngraph::pattern::has_static_shape())},
+                                                            ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        auto select = std::dynamic_pointer_cast<opset::Select>(m.get_match_root());
+        if (!select) {
+            return false;
+        }
+        // Broadcasts keep the existing Select paths; the fused kernel runs
+        // element-for-element
+        const auto& shape = select->get_output_partial_shape(0);
+        if (!select->get_input_partial_shape(0).same_scheme(shape) ||
+            !select->get_input_partial_shape(1).same_scheme(shape) ||
+            !select->get_input_partial_shape(2).same_scheme(shape) ||
+            (select->get_input_element_type(1) != select->get_input_element_type(2)) ||
+            !SupportedValueType(select->get_input_element_type(1))) {
+            return false;
+        }
+
+        bool invert = false;
+        auto condition = select->input_value(0).get_node_shared_ptr();
+        std::vector<std::shared_ptr<ngraph::Node>> fused{select};
+        if (ngraph::is_type<opset::LogicalNot>(condition.get())) {
+            if (!SoleConsumer(condition)) {
+                return false;
+            }
+            invert = true;
+            fused.emplace_back(condition);
+            condition = condition->input_value(0).get_node_shared_ptr();
+        }
+
+        Predicate predicateA = Predicate::Equal;
+        Predicate predicateB = Predicate::Equal;
+        Combine combine = Combine::None;
+        ngraph::OutputVector arguments;
+        if (FusableComparison(condition, shape, predicateA)) {
+            arguments = {condition->input_value(0), condition->input_value(1)};
+            fused.emplace_back(condition);
+        } else {
+            if (ngraph::is_type<opset::LogicalAnd>(condition.get())) {
+                combine = Combine::And;
+            } else if (ngraph::is_type<opset::LogicalOr>(condition.get())) {
+                combine = Combine::Or;
+            } else if (ngraph::is_type<opset::LogicalXor>(condition.get())) {
+                combine = Combine::Xor;
+            } else {
+                return false;
+            }
+            auto compareA = condition->input_value(0).get_node_shared_ptr();
+            auto compareB = condition->input_value(1).get_node_shared_ptr();
+            if (!SoleConsumer(condition) ||
+                !FusableComparison(compareA, shape, predicateA) ||
+                !FusableComparison(compareB, shape, predicateB) ||
+                (compareA->get_input_element_type(0) != compareB->get_input_element_type(0))) {
+                return false;
+            }
+            arguments = {compareA->input_value(0), compareA->input_value(1),
+                         compareB->input_value(0), compareB->input_value(1)};
+            fused.emplace_back(condition);
+            fused.emplace_back(compareA);
+            fused.emplace_back(compareB);
+        }
+        arguments.emplace_back(select->input_value(1));
+        arguments.emplace_back(select->input_value(2));
+
+        auto fusedSelect = std::make_shared<opset::ArmFusedSelect>(arguments, predicateA, predicateB, combine, invert);
+        fusedSelect->set_friendly_name(select->get_friendly_name());
+        ngraph::copy_runtime_info(fused, fusedSelect);
+        ngraph::replace_node(select, fusedSelect);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(select, "FuseCompareSelect");
+    register_matcher(m, callback);
+}
@@ -0,0 +1,22 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ArmPlugin {
+namespace pass {
+
+// Collapses compare->select and compare->logical->select chains into a
+// single ArmFusedSelect, so the boolean mask (and the Select(ones, zeros)
+// the ConvertComparison rewrite would add behind it) never materializes as a
+// tensor. Must run before ConvertLogical/ConvertComparison, which rewrite
+// the same patterns into the multi-pass form this fusion avoids.
+class FuseCompareSelect: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FuseCompareSelect();
+};
+}  // namespace pass
+}  // namespace ArmPlugin
@@ -0,0 +1,62 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "matmul_activation_fusion.hpp"
+
+#include <memory>
+
+#include <ngraph/rt_info.hpp>
+
+#include "opset/opset.hpp"
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+using namespace ArmPlugin;
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::MatMulActivationFusion, "MatMulActivationFusion", 0);
+ArmPlugin::pass::MatMulActivationFusion::MatMulActivationFusion() {
+    auto matmul_pattern = ngraph::pattern::wrap_type<opset::MatMul,
+                                                     opset::ArmMatMulBias>(ngraph::pattern::consumers_count(1));
+    auto activation_pattern = ngraph::pattern::wrap_type<opset::Sigmoid,
+                                                         opset::Tanh,
+                                                         opset::Relu,
+                                                         opset::Abs,
+                                                         opset::Elu,
+                                                         opset::SoftPlus,
+                                                         opset::HSwish,
+                                                         opset::PRelu,
+                                                         opset::Clamp>({matmul_pattern});
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(activation_pattern, "MatMulActivationFusion"),
+                     [=](ngraph::pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_value_map();
+        auto matmul = pattern_map[matmul_pattern].get_node_shared_ptr();
+        auto activation = pattern_map[activation_pattern].get_node_shared_ptr();
+
+        if (matmul->get_rt_info().count("ActivationLayerInfo") != 0) {
+            return false;
+        }
+        // The fused activation runs in the GEMM epilogue on float tensors only
+        if (!matmul->get_output_element_type(0).is_real()) {
+            return false;
+        }
+        if (auto prelu = std::dynamic_pointer_cast<opset::PRelu>(activation)) {
+            auto slope = std::dynamic_pointer_cast<opset::Constant>(prelu->input_value(1).get_node_shared_ptr());
+            if (!slope || ngraph::shape_size(slope->get_shape()) != 1 ||
+                slope->get_element_type() != ngraph::element::f32) {
+                return false;
+            }
+        }
+
+        auto activationLayerInfo = opset::makeActivationLayerInfo(activation.get());
+        if (!activationLayerInfo.enabled()) {
+            return false;
+        }
+
+        matmul->get_rt_info().emplace("ActivationLayerInfo", activationLayerInfo);
+        ngraph::copy_runtime_info({matmul, activation}, matmul);
+        matmul->set_friendly_name(activation->get_friendly_name());
+        ngraph::replace_node(activation, matmul);
+        return true;
+    });
+}
@@ -1,5 +1,6 @@
 // Copyright (C) 2020-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
+//
 
 #pragma once
 
@@ -8,10 +9,11 @@
 namespace ArmPlugin {
 namespace pass {
 
-class BroadcastSelect: public ngraph::pass::MatcherPass {
+class MatMulActivationFusion: public ngraph::pass::MatcherPass {
 public:
     NGRAPH_RTTI_DECLARATION;
-    BroadcastSelect();
+    MatMulActivationFusion();
 };
+
 }  // namespace pass
 }  // namespace ArmPlugin
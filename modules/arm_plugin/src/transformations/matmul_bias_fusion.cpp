@@ -36,6 +36,10 @@ ArmPlugin::pass::MatMulBiasFusion::MatMulBiasFusion() {
         if (matmul->get_shape().size() != 2) {
             return false;
         }
+        if (matmul->output(0).get_target_inputs().size() != 1 ||
+            ngraph::shape_size(bias->get_shape()) != matmul->get_shape().back()) {
+            return false;
+        }
 
         ngraph::NodeVector new_ops;
         if (matmul->get_transpose_a()) {
@@ -47,9 +51,9 @@ ArmPlugin::pass::MatMulBiasFusion::MatMulBiasFusion() {
         auto matmul_bias = std::make_shared<opset::ArmMatMulBias>(input_a, input_b, bias, matmul->get_transpose_b());
         new_ops.push_back(matmul_bias);
 
-        matmul_bias->set_friendly_name(matmul->get_friendly_name());
-        ngraph::copy_runtime_info(matmul, new_ops);
-        ngraph::replace_node(matmul, matmul_bias);
+        matmul_bias->set_friendly_name(add->get_friendly_name());
+        ngraph::copy_runtime_info({matmul, add}, new_ops);
+        ngraph::replace_node(add, matmul_bias);
         return true;
     };
 
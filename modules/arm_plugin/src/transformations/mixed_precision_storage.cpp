@@ -0,0 +1,65 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/pass/manager.hpp>
+#include "transformations/convert_precision.hpp"
+
+#include "opset/opset.hpp"
+#include "mixed_precision_storage.hpp"
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::MixedPrecisionStorage, "MixedPrecisionStorage", 0);
+
+ArmPlugin::pass::MixedPrecisionStorage::MixedPrecisionStorage(const std::string& sensitiveOps) {
+    std::size_t begin = 0;
+    while (begin < sensitiveOps.size()) {
+        auto end = sensitiveOps.find(',', begin);
+        if (end == std::string::npos) {
+            end = sensitiveOps.size();
+        }
+        if (end != begin) {
+            _sensitiveOps.emplace(sensitiveOps.substr(begin, end - begin));
+        }
+        begin = end + 1;
+    }
+}
+
+bool ArmPlugin::pass::MixedPrecisionStorage::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    {
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::ConvertPrecision>(ngraph::element::f32, ngraph::element::f16);
+        manager.run_passes(f);
+    }
+    bool widened = false;
+    for (auto&& node : f->get_ordered_ops()) {
+        if (_sensitiveOps.find(node->get_type_name()) == _sensitiveOps.end()) {
+            continue;
+        }
+        for (auto&& input : node->inputs()) {
+            if (input.get_element_type() == ngraph::element::f16) {
+                auto convert = std::make_shared<opset::Convert>(input.get_source_output(), ngraph::element::f32);
+                input.replace_source_output(convert);
+            }
+        }
+        node->validate_and_infer_types();
+        for (auto&& output : node->outputs()) {
+            if (output.get_element_type() == ngraph::element::f32) {
+                auto consumers = output.get_target_inputs();
+                auto convert = std::make_shared<opset::Convert>(output, ngraph::element::f16);
+                for (auto&& consumer : consumers) {
+                    if (consumer.get_node() != convert.get()) {
+                        consumer.replace_source_output(convert);
+                    }
+                }
+            }
+        }
+        widened = true;
+    }
+    if (widened) {
+        f->validate_nodes_and_infer_types();
+    }
+    return true;
+}
@@ -0,0 +1,30 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <string>
+#include <unordered_set>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ArmPlugin {
+namespace pass {
+
+// Stores inter-layer activations in f16 while executing numerically
+// sensitive layers in f32: the function is converted to f16 wholesale, then
+// layers whose type is on the allowlist get widening converts on their f16
+// inputs and a narrowing convert after each output. Halves the activation
+// pool for f32 models at the cost of the boundary converts.
+class MixedPrecisionStorage : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    // sensitiveOps - comma-separated op type names kept in f32
+    explicit MixedPrecisionStorage(const std::string& sensitiveOps);
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    std::unordered_set<std::string> _sensitiveOps;
+};
+}  // namespace pass
+}  // namespace ArmPlugin
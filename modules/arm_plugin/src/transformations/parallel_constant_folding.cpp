@@ -0,0 +1,125 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <unordered_set>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pass/constant_folding.hpp>
+
+#include "opset/opset.hpp"
+#include "arm_neon_convert.hpp"
+#include "parallel_constant_folding.hpp"
+
+using namespace ArmPlugin;
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::ParallelConstantFolding, "ParallelConstantFolding", 0);
+
+// Vectorized fast path for the Convert nodes dequantized-weights chains are
+// made of; covers the pairs that occur there, everything else returns null
+// and takes the generic constant_fold route
+static std::shared_ptr<ngraph::op::Constant> FoldConvertNeon(const std::shared_ptr<ngraph::Node>& node) {
+    // Honor the DisableConstantFolding marker the same way constant_fold
+    // does: DisableConvertConstantFoldingOnConstPath protects exactly the
+    // i8/u8->f32 dequantization Converts with it, and folding those here
+    // would collapse the dequantize chains before LPT ever sees them
+    if (ov::pass::constant_folding_is_disabled(node)) {
+        return nullptr;
+    }
+    auto convert = ngraph::as_type_ptr<opset::Convert>(node);
+    if (convert == nullptr || convert->get_destination_type() != ngraph::element::f32) {
+        return nullptr;
+    }
+    auto constant = ngraph::as_type_ptr<opset::Constant>(convert->input_value(0).get_node_shared_ptr());
+    if (constant == nullptr) {
+        return nullptr;
+    }
+    const auto& shape = constant->get_shape();
+    const auto size = ngraph::shape_size(shape);
+    std::vector<float> buffer(size);
+    switch (static_cast<ngraph::element::Type_t>(constant->get_element_type())) {
+        case ngraph::element::Type_t::u8 :
+            neon::convert(static_cast<const std::uint8_t*>(constant->get_data_ptr()), buffer.data(), size);
+            break;
+        case ngraph::element::Type_t::i8 :
+            neon::convert(static_cast<const std::int8_t*>(constant->get_data_ptr()), buffer.data(), size);
+            break;
+        case ngraph::element::Type_t::f16 :
+            neon::convert(static_cast<const ngraph::float16*>(constant->get_data_ptr()), buffer.data(), size);
+            break;
+        default :
+            return nullptr;
+    }
+    return std::make_shared<ngraph::op::Constant>(ngraph::element::f32, shape, buffer.data());
+}
+
+static std::shared_ptr<ngraph::op::Constant> FoldNode(const std::shared_ptr<ngraph::Node>& node) {
+    if (auto folded = FoldConvertNeon(node)) {
+        return folded;
+    }
+    // constant_fold respects the DisableConstantFolding markers and evaluates
+    // through the op's own evaluator, exactly like the serial pass would
+    ngraph::OutputVector folded(node->get_output_size());
+    if (node->constant_fold(folded, node->input_values())) {
+        return ngraph::as_type_ptr<ngraph::op::Constant>(folded.front().get_node_shared_ptr());
+    }
+    return nullptr;
+}
+
+bool ArmPlugin::pass::ParallelConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    bool foldedAny = false;
+    // Nodes constant_fold declined once are final: retrying them every
+    // wavefront would make unfoldable chains quadratic
+    std::unordered_set<ngraph::Node*> unfoldable;
+    for (;;) {
+        // One wavefront: every node whose inputs are all constants already.
+        // Folding a wavefront exposes the next one, so chains advance one
+        // node per round while independent chains fold concurrently.
+        std::vector<std::shared_ptr<ngraph::Node>> frontier;
+        for (auto&& node : f->get_ordered_ops()) {
+            if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node) ||
+                (node->get_output_size() != 1) || (node->get_input_size() == 0) ||
+                (unfoldable.find(node.get()) != unfoldable.end()) ||
+                !node->get_output_partial_shape(0).is_static()) {
+                continue;
+            }
+            bool allConstant = true;
+            for (auto&& input : node->input_values()) {
+                if (!ngraph::op::is_constant(input.get_node())) {
+                    allConstant = false;
+                    break;
+                }
+            }
+            if (allConstant) {
+                frontier.emplace_back(node);
+            }
+        }
+        if (frontier.empty()) {
+            break;
+        }
+        std::vector<std::shared_ptr<ngraph::op::Constant>> results(frontier.size());
+        InferenceEngine::parallel_for(frontier.size(), [&] (std::size_t index) {
+            results[index] = FoldNode(frontier[index]);
+        });
+        bool progressed = false;
+        for (std::size_t index = 0; index < frontier.size(); ++index) {
+            auto& node = frontier[index];
+            if (results[index] == nullptr) {
+                unfoldable.emplace(node.get());
+                continue;
+            }
+            results[index]->set_friendly_name(node->get_friendly_name());
+            ngraph::copy_runtime_info(node, results[index]);
+            ngraph::replace_node(node, results[index]);
+            progressed = true;
+            foldedAny = true;
+        }
+        if (!progressed) {
+            break;
+        }
+    }
+    return foldedAny;
+}
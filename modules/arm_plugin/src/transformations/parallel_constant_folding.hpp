@@ -0,0 +1,25 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ArmPlugin {
+namespace pass {
+
+// Pre-folds constant subgraphs in parallel before the serial ngraph
+// ConstantFolding runs. Each wavefront collects the nodes whose inputs are
+// all constants and evaluates them concurrently on the load-time thread pool,
+// so independent weight-transformation chains (dequantize, transpose, reshape
+// of different layers) fold on different cores instead of one. Convert nodes,
+// the bulk of dequantized-weights folding, are evaluated through the NEON
+// conversion kernels instead of the scalar reference loop. Whatever this pass
+// cannot evaluate is left for the regular ConstantFolding behind it.
+class ParallelConstantFolding : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
+}  // namespace pass
+}  // namespace ArmPlugin
@@ -77,6 +77,8 @@ std::shared_ptr<ngraph::Node> makeTypeRelaxed(const ngraph::Node* node,
     CASE(opset::MatMul)
     CASE(opset::AvgPool)
     CASE(opset::ReduceMean)
+    CASE(opset::Add)
+    CASE(opset::Multiply)
     IE_ASSERT(!"Arm Plugin: Unregistered type: ") << node;
 #undef CASE
 }
@@ -422,6 +424,153 @@ ArmPlugin::pass::DequantizeInputFusion::DequantizeInputFusion() {
         });
 }
 
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::EltwiseQuantizeFusion, "EltwiseQuantizeFusion", 0);
+ArmPlugin::pass::EltwiseQuantizeFusion::EltwiseQuantizeFusion() {
+    auto dq0_pattern = ngraph::pattern::wrap_type<opset::ArmDequantize>(ngraph::pattern::consumers_count(1));
+    auto dq1_pattern = ngraph::pattern::wrap_type<opset::ArmDequantize>(ngraph::pattern::consumers_count(1));
+    auto eltwise_pattern = ngraph::pattern::wrap_type<
+        opset::Add,
+        opset::Multiply>({dq0_pattern, dq1_pattern}, ngraph::pattern::consumers_count(1));
+    auto fq_pattern = ngraph::pattern::wrap_type<opset::FakeQuantize>({
+        eltwise_pattern,
+        ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+        ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+        ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+        ngraph::pattern::any_input(ngraph::pattern::has_static_shape())},
+        ngraph::pattern::has_static_shape());
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(fq_pattern, "EltwiseQuantizeFusion"),
+        [=](ngraph::pattern::Matcher& m) {
+            auto pattern_map = m.get_pattern_value_map();
+            auto dq0 = pattern_map[dq0_pattern].get_node_shared_ptr();
+            auto dq1 = pattern_map[dq1_pattern].get_node_shared_ptr();
+            auto eltwise = pattern_map[eltwise_pattern].get_node_shared_ptr();
+            auto fakeQuantize = safe_cast<opset::FakeQuantize>(pattern_map[fq_pattern].get_node_shared_ptr());
+            auto realType = eltwise->get_output_element_type(0);
+            auto quantizedType = fakeQuantize->get_output_element_type(0);
+            if (!(realType.is_real() && quantizedType.is_quantized())) {
+                return false;
+            }
+            // ACL arithmetic kernels rescale mismatched per-tensor quantization
+            // internally, but only within one signedness
+            if (dq0->get_input_element_type(0) != quantizedType ||
+                dq1->get_input_element_type(0) != quantizedType) {
+                return false;
+            }
+            auto quantizationInfo = makeQuantizationInfo(getFloatVector(fakeQuantize->input_value(1).get_node()),
+                                                         getFloatVector(fakeQuantize->input_value(2).get_node()),
+                                                         getFloatVector(fakeQuantize->input_value(3).get_node()),
+                                                         getFloatVector(fakeQuantize->input_value(4).get_node()));
+            if (!allEqualToFirst(quantizationInfo.first) || !allEqualToFirst(quantizationInfo.second)) {
+                return false;
+            }
+
+            std::vector<ngraph::Output<ngraph::Node>> newInputs{
+                ngraph::op::TemporaryReplaceOutputType{dq0->input_value(0), realType}.get(),
+                ngraph::op::TemporaryReplaceOutputType{dq1->input_value(0), realType}.get()};
+            auto newNode = makeTypeRelaxed(eltwise.get(), newInputs, Types{realType, realType}, Types{quantizedType});
+            newNode->set_friendly_name(eltwise->get_friendly_name() + '_' + fakeQuantize->get_friendly_name());
+            ngraph::copy_runtime_info({dq0, dq1, eltwise, fakeQuantize}, newNode);
+            newNode->get_rt_info()["InputPrescaleInfo"] =
+                dq0->get_rt_info().at("QuantizationInfo").as<arm_compute::QuantizationInfo>();
+            newNode->get_rt_info()["SecondInputPrescaleInfo"] =
+                dq1->get_rt_info().at("QuantizationInfo").as<arm_compute::QuantizationInfo>();
+            newNode->get_rt_info()["QuantizationInfo"] =
+                arm_compute::QuantizationInfo{1.f/quantizationInfo.first[0], static_cast<std::int32_t>(std::round(quantizationInfo.second[0]))};
+            ngraph::replace_node(fakeQuantize, newNode);
+            return true;
+        });
+}
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::WeightsDequantizeFusion, "WeightsDequantizeFusion", 0);
+ArmPlugin::pass::WeightsDequantizeFusion::WeightsDequantizeFusion() {
+    auto weights_pattern = ngraph::pattern::wrap_type<opset::Constant>();
+    auto convert_pattern = ngraph::pattern::wrap_type<opset::Convert>({weights_pattern},
+                               ngraph::pattern::consumers_count(1));
+    auto scale_pattern = ngraph::pattern::wrap_type<opset::Constant>();
+    auto mul_pattern = ngraph::pattern::wrap_type<opset::Multiply>(
+                           {std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{
+                               convert_pattern,
+                               weights_pattern}),
+                           scale_pattern},
+                           ngraph::pattern::consumers_count(1));
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(mul_pattern, "WeightsDequantizeFusion"),
+        [=](ngraph::pattern::Matcher& m) {
+            auto pattern_map = m.get_pattern_value_map();
+            auto weights = pattern_map[weights_pattern].get_node_shared_ptr();
+            if (weights->get_output_element_type(0) != ngraph::element::i8) {
+                return false;
+            }
+            auto mul = pattern_map[mul_pattern].get_node_shared_ptr();
+            auto realType = mul->get_output_element_type(0);
+            if (!realType.is_real()) {
+                return false;
+            }
+            auto node = mul->output(0).get_target_inputs().begin()->get_node()->shared_from_this();
+            if (!(ngraph::is_type<opset::ArmConvolution>(node) ||
+                  ngraph::is_type<opset::ArmGroupConvolution>(node) ||
+                  ngraph::is_type<opset::MatMul>(node)) ||
+                !node->get_output_element_type(0).is_quantized()) {
+                return false;
+            }
+            if (node->input_value(1) != mul->output(0)) {
+                return false;
+            }
+            auto scales = getFloatVector(pattern_map[scale_pattern].get_node());
+            // QSYMM8_PER_CHANNEL carries positive scales and no offsets
+            if (std::any_of(std::begin(scales), std::end(scales), [] (float scale) {return scale <= 0.f;})) {
+                return false;
+            }
+            auto weightsShape = weights->get_output_shape(0);
+            std::size_t outputChannels;
+            if (ngraph::is_type<opset::MatMul>(node)) {
+                outputChannels = node->get_output_shape(0).back();
+            } else if (ngraph::is_type<opset::ArmGroupConvolution>(node)) {
+                outputChannels = weightsShape.at(0) * weightsShape.at(1);
+            } else {
+                outputChannels = weightsShape.at(0);
+            }
+            if (scales.size() != 1 && scales.size() != outputChannels) {
+                return false;
+            }
+            if (scales.size() == 1) {
+                scales.resize(outputChannels, scales.front());
+            }
+            // Per-channel output requantization may already sit in the prescale
+            // slot (see ConvolutionQuantizeFusion); fold both factors together
+            auto itPrescale = node->get_rt_info().find("WeightsPrescaleInfo");
+            if (itPrescale != node->get_rt_info().end()) {
+                auto prescale = itPrescale->second.as<arm_compute::QuantizationInfo>().scale();
+                if (prescale.size() != scales.size()) {
+                    return false;
+                }
+                for (std::size_t i = 0; i < scales.size(); ++i) {
+                    scales[i] *= prescale[i];
+                }
+            }
+
+            std::vector<ngraph::Output<ngraph::Node>> newInputs;
+            Types inputTypes;
+            for (auto&& input : node->inputs()) {
+                inputTypes.emplace_back(realType);
+                newInputs.emplace_back(
+                    ngraph::op::TemporaryReplaceOutputType{input.get_source_output(), realType}.get());
+            }
+            newInputs[1] = ngraph::op::TemporaryReplaceOutputType{weights->output(0), realType}.get();
+            auto newNode = makeTypeRelaxed(node.get(), newInputs, inputTypes, Types{node->get_output_element_type(0)});
+            newNode->set_friendly_name(node->get_friendly_name());
+            std::vector<std::shared_ptr<ngraph::Node>> nodesToCopyRTI{node, mul};
+            auto itConvert = pattern_map.find(convert_pattern);
+            if (itConvert != pattern_map.end()) {
+                nodesToCopyRTI.emplace_back(itConvert->second.get_node_shared_ptr());
+            }
+            ngraph::copy_runtime_info(nodesToCopyRTI, newNode);
+            newNode->get_rt_info()["WeightsPrescaleInfo"] =
+                arm_compute::QuantizationInfo{scales, std::vector<std::int32_t>(scales.size(), 0)};
+            ngraph::replace_node(node, newNode);
+            return true;
+        });
+}
+
 NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::AddDequantizeOnInputs, "AddDequantizeOnInputs", 0);
 ArmPlugin::pass::AddDequantizeOnInputs::AddDequantizeOnInputs() {
     auto node_pattern = ngraph::pattern::wrap_type<
@@ -472,6 +621,41 @@ ArmPlugin::pass::AddDequantizeOnInputs::AddDequantizeOnInputs() {
         });
 }
 
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::FoldRequantize, "FoldRequantize", 0);
+ArmPlugin::pass::FoldRequantize::FoldRequantize() {
+    auto dq_pattern = ngraph::pattern::wrap_type<opset::ArmDequantize>(ngraph::pattern::consumers_count(1));
+    auto q_pattern = ngraph::pattern::wrap_type<opset::ArmQuantize>({dq_pattern});
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(q_pattern, "FoldRequantize"),
+        [=](ngraph::pattern::Matcher& m) {
+            auto pattern_map = m.get_pattern_value_map();
+            auto dequantize = pattern_map[dq_pattern].get_node_shared_ptr();
+            auto quantize = pattern_map[q_pattern].get_node_shared_ptr();
+            auto inputType = dequantize->get_input_element_type(0);
+            auto outputType = quantize->get_output_element_type(0);
+            if (!inputType.is_quantized() || !outputType.is_quantized()) {
+                return false;
+            }
+            auto itDqInfo = dequantize->get_rt_info().find("QuantizationInfo");
+            auto itQInfo = quantize->get_rt_info().find("QuantizationInfo");
+            if (itDqInfo == dequantize->get_rt_info().end() || itQInfo == quantize->get_rt_info().end()) {
+                return false;
+            }
+            // Per-channel requantize keeps the explicit fp32 scale arithmetic
+            if (itDqInfo->second.as<arm_compute::QuantizationInfo>().scale().size() != 1 ||
+                itQInfo->second.as<arm_compute::QuantizationInfo>().scale().size() != 1) {
+                return false;
+            }
+            auto newNode = std::make_shared<ngraph::op::TypeRelaxed<opset::ArmQuantize>>(Types{inputType}, Types{outputType},
+                                                                                         dequantize->input_value(0));
+            newNode->set_friendly_name(quantize->get_friendly_name());
+            ngraph::copy_runtime_info({dequantize, quantize}, newNode);
+            newNode->get_rt_info()["InputPrescaleInfo"] = itDqInfo->second.as<arm_compute::QuantizationInfo>();
+            newNode->get_rt_info()["QuantizationInfo"] = itQInfo->second.as<arm_compute::QuantizationInfo>();
+            ngraph::replace_node(quantize, newNode);
+            return true;
+        });
+}
+
 NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::ConvertBiasToI32, "ConvertBiasToI32", 0);
 ArmPlugin::pass::ConvertBiasToI32::ConvertBiasToI32() {
     auto conv = ngraph::pattern::wrap_type<
@@ -34,6 +34,18 @@ public:
     DequantizeInputFusion();
 };
 
+class EltwiseQuantizeFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    EltwiseQuantizeFusion();
+};
+
+class WeightsDequantizeFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    WeightsDequantizeFusion();
+};
+
 class AddDequantizeOnInputs: public ngraph::pass::MatcherPass {
 public:
     NGRAPH_RTTI_DECLARATION;
@@ -46,5 +58,11 @@ public:
     ConvertBiasToI32();
 };
 
+class FoldRequantize: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FoldRequantize();
+};
+
 }  // namespace pass
 }  // namespace ArmPlugin
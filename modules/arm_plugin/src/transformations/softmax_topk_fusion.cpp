@@ -0,0 +1,54 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "opset/opset.hpp"
+#include "transformations/softmax_topk_fusion.hpp"
+
+using namespace ArmPlugin;
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::SoftmaxTopKFusion, "SoftmaxTopKFusion", 0);
+ArmPlugin::pass::SoftmaxTopKFusion::SoftmaxTopKFusion() {
+    auto softmax = ngraph::pattern::wrap_type<opset::Softmax>(ngraph::pattern::has_static_shape());
+    auto topk = ngraph::pattern::wrap_type<opset::TopK>({softmax, ngraph::pattern::any_input()});
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        auto topk = std::dynamic_pointer_cast<opset::TopK>(m.get_match_root());
+        if (!topk) {
+            return false;
+        }
+        auto softmax = std::dynamic_pointer_cast<opset::Softmax>(topk->input_value(0).get_node_shared_ptr());
+        if (!softmax) {
+            return false;
+        }
+        // Another consumer still needs the full softmax tensor; only MIN mode
+        // would invert the selection (softmax is monotone increasing, so MAX
+        // carries over to the logits unchanged)
+        if ((softmax->output(0).get_target_inputs().size() != 1) ||
+            (topk->get_mode() != ngraph::op::TopKMode::MAX)) {
+            return false;
+        }
+        const auto& type = softmax->get_input_element_type(0);
+        if ((type != ngraph::element::f32) && (type != ngraph::element::f16)) {
+            return false;
+        }
+        // get_k() resolves only a constant k input; 0 means it is dynamic
+        const auto k = topk->get_k();
+        const auto axis = static_cast<std::size_t>(topk->get_axis());
+        if ((k == 0) || (axis != softmax->get_axis())) {
+            return false;
+        }
+
+        auto fused = std::make_shared<opset::ArmSoftmaxTopK>(softmax->input_value(0), axis, k,
+                                                             topk->get_sort_type(), topk->get_index_element_type());
+        fused->set_friendly_name(topk->get_friendly_name());
+        ngraph::copy_runtime_info({softmax, topk}, fused);
+        ngraph::replace_node(topk, fused);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(topk, "SoftmaxTopKFusion");
+    register_matcher(m, callback);
+}
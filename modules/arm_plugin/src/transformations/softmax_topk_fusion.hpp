@@ -0,0 +1,23 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ArmPlugin {
+namespace pass {
+
+// Collapses the Softmax -> TopK tail every classification head ends with
+// into a single ArmSoftmaxTopK. Softmax is monotone, so the winners can be
+// selected on the raw logits and only their softmax values computed: the
+// full softmax tensor - written, re-read and sorted by the separate ops -
+// never materializes. Fires only when the softmax feeds the top-k alone
+// and both work along the same axis.
+class SoftmaxTopKFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    SoftmaxTopKFusion();
+};
+}  // namespace pass
+}  // namespace ArmPlugin
@@ -14,6 +14,25 @@ bool ArmPlugin::pass::StoreResultName::run_on_function(std::shared_ptr<ngraph::F
         auto sourceOutput = input.get_source_output();
         const auto outputName = ngraph::op::util::get_ie_output_name(sourceOutput);
         node->get_rt_info().emplace("ResultName", outputName);
+        // Mark Results whose producer tensor may be bound straight into the
+        // user blob (see ArmInferRequest::ExecuteImpl). Binding imports the
+        // one shared tensor, so a source output feeding several Results - and
+        // constant or parameter sources, which bind elsewhere - keep the copy
+        // path. Re-evaluated on every run; the last one, after the trailing
+        // chains are stripped, has the final wiring and wins.
+        node->get_rt_info().erase("DirectOutput");
+        if (!ngraph::op::is_constant(sourceOutput.get_node()) &&
+            !ngraph::op::is_parameter(sourceOutput.get_node())) {
+            std::size_t resultConsumers = 0;
+            for (auto&& target : sourceOutput.get_target_inputs()) {
+                if (ngraph::op::is_output(target.get_node())) {
+                    ++resultConsumers;
+                }
+            }
+            if (resultConsumers == 1) {
+                node->get_rt_info().emplace("DirectOutput", std::string{"YES"});
+            }
+        }
     }
     return false;
 }
@@ -0,0 +1,258 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transpose_sinking.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/graph_util.hpp>
+#include <ngraph/rt_info.hpp>
+
+#include "opset/opset.hpp"
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+using namespace ArmPlugin;
+
+namespace {
+std::shared_ptr<opset::Constant> transpose_order(const std::shared_ptr<ngraph::Node>& transpose) {
+    return std::dynamic_pointer_cast<opset::Constant>(transpose->input_value(1).get_node_shared_ptr());
+}
+
+bool single_consumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->output(0).get_target_inputs().size() == 1;
+}
+
+bool is_identity(const std::vector<std::int64_t>& order) {
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        if (order[i] != static_cast<std::int64_t>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::int64_t> invert_order(const std::vector<std::int64_t>& order) {
+    std::vector<std::int64_t> inverted(order.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        inverted[order[i]] = i;
+    }
+    return inverted;
+}
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::TransposeSinkingUnary, "TransposeSinkingUnary", 0);
+ArmPlugin::pass::TransposeSinkingUnary::TransposeSinkingUnary() {
+    auto transpose_pattern = ngraph::pattern::wrap_type<opset::Transpose>({ngraph::pattern::any_input(),
+                                                                           ngraph::pattern::wrap_type<opset::Constant>()},
+                                                                          ngraph::pattern::consumers_count(1));
+    auto unary_pattern = ngraph::pattern::wrap_type<opset::Sigmoid,
+                                                    opset::Tanh,
+                                                    opset::Relu,
+                                                    opset::Abs,
+                                                    opset::Elu,
+                                                    opset::Sqrt,
+                                                    opset::SoftPlus,
+                                                    opset::HSwish,
+                                                    opset::Exp,
+                                                    opset::Log,
+                                                    opset::Negative,
+                                                    opset::Clamp>({transpose_pattern});
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(unary_pattern, "TransposeSinkingUnary"),
+                     [=](ngraph::pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_value_map();
+        auto transpose = pattern_map[transpose_pattern].get_node_shared_ptr();
+        auto unary = pattern_map[unary_pattern].get_node_shared_ptr();
+
+        auto new_unary = unary->clone_with_new_inputs({transpose->input_value(0)});
+        auto new_transpose = transpose->clone_with_new_inputs({new_unary, transpose->input_value(1)});
+        new_transpose->set_friendly_name(unary->get_friendly_name());
+        ngraph::copy_runtime_info({transpose, unary}, {new_unary, new_transpose});
+        ngraph::replace_node(unary, new_transpose);
+        return true;
+    });
+}
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::TransposeSinkingBinary, "TransposeSinkingBinary", 0);
+ArmPlugin::pass::TransposeSinkingBinary::TransposeSinkingBinary() {
+    auto eltwise_pattern = ngraph::pattern::wrap_type<opset::Add,
+                                                      opset::Subtract,
+                                                      opset::Multiply,
+                                                      opset::Divide,
+                                                      opset::Minimum,
+                                                      opset::Maximum,
+                                                      opset::SquaredDifference,
+                                                      opset::Power>();
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(eltwise_pattern, "TransposeSinkingBinary"),
+                     [=](ngraph::pattern::Matcher& m) {
+        auto eltwise = m.get_match_root();
+        auto lhs = eltwise->input_value(0).get_node_shared_ptr();
+        auto rhs = eltwise->input_value(1).get_node_shared_ptr();
+
+        auto as_sinkable_transpose = [] (const std::shared_ptr<ngraph::Node>& node) -> std::shared_ptr<opset::Transpose> {
+            auto transpose = std::dynamic_pointer_cast<opset::Transpose>(node);
+            if (transpose && single_consumer(transpose) && transpose_order(transpose)) {
+                return transpose;
+            }
+            return nullptr;
+        };
+        auto lhs_transpose = as_sinkable_transpose(lhs);
+        auto rhs_transpose = as_sinkable_transpose(rhs);
+
+        if (lhs_transpose && rhs_transpose) {
+            auto lhs_order = transpose_order(lhs_transpose)->cast_vector<std::int64_t>();
+            auto rhs_order = transpose_order(rhs_transpose)->cast_vector<std::int64_t>();
+            if (lhs_order != rhs_order) {
+                return false;
+            }
+            auto new_eltwise = eltwise->clone_with_new_inputs({lhs_transpose->input_value(0), rhs_transpose->input_value(0)});
+            auto new_transpose = lhs_transpose->clone_with_new_inputs({new_eltwise, lhs_transpose->input_value(1)});
+            new_transpose->set_friendly_name(eltwise->get_friendly_name());
+            ngraph::copy_runtime_info({lhs_transpose, rhs_transpose, eltwise}, {new_eltwise, new_transpose});
+            ngraph::replace_node(eltwise, new_transpose);
+            return true;
+        }
+
+        auto transpose = lhs_transpose ? lhs_transpose : rhs_transpose;
+        auto constant = std::dynamic_pointer_cast<opset::Constant>(lhs_transpose ? rhs : lhs);
+        if (!transpose || !constant) {
+            return false;
+        }
+        auto order = transpose_order(transpose)->cast_vector<std::int64_t>();
+        ngraph::Output<ngraph::Node> new_constant = constant;
+        if (ngraph::shape_size(constant->get_shape()) != 1) {
+            // A non-scalar constant has to be counter-permuted to keep broadcasting intact
+            if (constant->get_shape().size() != order.size()) {
+                return false;
+            }
+            new_constant = std::make_shared<opset::Transpose>(constant,
+                opset::Constant::create(ngraph::element::i64, ngraph::Shape{order.size()}, invert_order(order)));
+        }
+
+        auto new_eltwise = lhs_transpose ?
+            eltwise->clone_with_new_inputs({transpose->input_value(0), new_constant}) :
+            eltwise->clone_with_new_inputs({new_constant, transpose->input_value(0)});
+        auto new_transpose = transpose->clone_with_new_inputs({new_eltwise, transpose->input_value(1)});
+        new_transpose->set_friendly_name(eltwise->get_friendly_name());
+        ngraph::copy_runtime_info({transpose, eltwise}, {new_eltwise, new_transpose});
+        ngraph::replace_node(eltwise, new_transpose);
+        return true;
+    });
+}
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::TransposeSinkingConcat, "TransposeSinkingConcat", 0);
+ArmPlugin::pass::TransposeSinkingConcat::TransposeSinkingConcat() {
+    auto concat_pattern = ngraph::pattern::wrap_type<opset::Concat>();
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(concat_pattern, "TransposeSinkingConcat"),
+                     [=](ngraph::pattern::Matcher& m) {
+        auto concat = std::dynamic_pointer_cast<opset::Concat>(m.get_match_root());
+        if (!concat || concat->get_input_size() == 0) {
+            return false;
+        }
+
+        std::vector<std::int64_t> order;
+        ngraph::OutputVector new_inputs;
+        for (const auto& input : concat->input_values()) {
+            auto transpose = std::dynamic_pointer_cast<opset::Transpose>(input.get_node_shared_ptr());
+            if (!transpose || !single_consumer(transpose) || !transpose_order(transpose)) {
+                return false;
+            }
+            auto input_order = transpose_order(transpose)->cast_vector<std::int64_t>();
+            if (order.empty()) {
+                order = input_order;
+            } else if (order != input_order) {
+                return false;
+            }
+            new_inputs.push_back(transpose->input_value(0));
+        }
+
+        auto axis = concat->get_axis();
+        if (axis < 0) {
+            axis += order.size();
+        }
+        auto new_concat = std::make_shared<opset::Concat>(new_inputs, order[axis]);
+        auto new_transpose = std::make_shared<opset::Transpose>(new_concat,
+            opset::Constant::create(ngraph::element::i64, ngraph::Shape{order.size()}, order));
+        new_transpose->set_friendly_name(concat->get_friendly_name());
+        ngraph::copy_runtime_info(concat, {new_concat, new_transpose});
+        ngraph::replace_node(concat, new_transpose);
+        return true;
+    });
+}
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::TransposeSinkingSplit, "TransposeSinkingSplit", 0);
+ArmPlugin::pass::TransposeSinkingSplit::TransposeSinkingSplit() {
+    auto transpose_pattern = ngraph::pattern::wrap_type<opset::Transpose>({ngraph::pattern::any_input(),
+                                                                           ngraph::pattern::wrap_type<opset::Constant>()},
+                                                                          ngraph::pattern::consumers_count(1));
+    auto split_pattern = ngraph::pattern::wrap_type<opset::Split>({transpose_pattern,
+                                                                   ngraph::pattern::wrap_type<opset::Constant>()});
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(split_pattern, "TransposeSinkingSplit"),
+                     [=](ngraph::pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_value_map();
+        auto transpose = pattern_map[transpose_pattern].get_node_shared_ptr();
+        auto split = std::dynamic_pointer_cast<opset::Split>(pattern_map[split_pattern].get_node_shared_ptr());
+
+        auto order = transpose_order(transpose)->cast_vector<std::int64_t>();
+        auto axis_constant = std::dynamic_pointer_cast<opset::Constant>(split->input_value(1).get_node_shared_ptr());
+        auto axis = axis_constant->cast_vector<std::int64_t>()[0];
+        if (axis < 0) {
+            axis += order.size();
+        }
+
+        auto new_split = std::make_shared<opset::Split>(transpose->input_value(0),
+            opset::Constant::create(ngraph::element::i64, ngraph::Shape{}, {order[axis]}),
+            split->get_num_splits());
+        new_split->set_friendly_name(split->get_friendly_name());
+        ngraph::NodeVector new_ops{new_split};
+        for (std::size_t i = 0; i < split->get_output_size(); ++i) {
+            auto output_transpose = std::make_shared<opset::Transpose>(new_split->output(i),
+                opset::Constant::create(ngraph::element::i64, ngraph::Shape{order.size()}, order));
+            output_transpose->set_friendly_name(split->get_friendly_name() + "." + std::to_string(i));
+            new_ops.push_back(output_transpose);
+            for (auto&& consumer : split->output(i).get_target_inputs()) {
+                consumer.replace_source_output(output_transpose);
+            }
+        }
+        ngraph::copy_runtime_info({transpose, split}, new_ops);
+        return true;
+    });
+}
+
+NGRAPH_RTTI_DEFINITION(ArmPlugin::pass::TransposePairFusion, "TransposePairFusion", 0);
+ArmPlugin::pass::TransposePairFusion::TransposePairFusion() {
+    auto inner_pattern = ngraph::pattern::wrap_type<opset::Transpose>({ngraph::pattern::any_input(),
+                                                                       ngraph::pattern::wrap_type<opset::Constant>()},
+                                                                      ngraph::pattern::consumers_count(1));
+    auto outer_pattern = ngraph::pattern::wrap_type<opset::Transpose>({inner_pattern,
+                                                                       ngraph::pattern::wrap_type<opset::Constant>()});
+
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(outer_pattern, "TransposePairFusion"),
+                     [=](ngraph::pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_value_map();
+        auto inner = pattern_map[inner_pattern].get_node_shared_ptr();
+        auto outer = pattern_map[outer_pattern].get_node_shared_ptr();
+
+        auto inner_order = transpose_order(inner)->cast_vector<std::int64_t>();
+        auto outer_order = transpose_order(outer)->cast_vector<std::int64_t>();
+        std::vector<std::int64_t> combined(outer_order.size());
+        for (std::size_t i = 0; i < outer_order.size(); ++i) {
+            combined[i] = inner_order[outer_order[i]];
+        }
+
+        if (is_identity(combined)) {
+            return ngraph::replace_output_update_name(outer->output(0), inner->input_value(0));
+        }
+        auto new_transpose = std::make_shared<opset::Transpose>(inner->input_value(0),
+            opset::Constant::create(ngraph::element::i64, ngraph::Shape{combined.size()}, combined));
+        new_transpose->set_friendly_name(outer->get_friendly_name());
+        ngraph::copy_runtime_info({inner, outer}, new_transpose);
+        ngraph::replace_node(outer, new_transpose);
+        return true;
+    });
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ArmPlugin {
+namespace pass {
+
+class TransposeSinkingUnary: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeSinkingUnary();
+};
+
+class TransposeSinkingBinary: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeSinkingBinary();
+};
+
+class TransposeSinkingConcat: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeSinkingConcat();
+};
+
+class TransposeSinkingSplit: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposeSinkingSplit();
+};
+
+class TransposePairFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    TransposePairFusion();
+};
+
+}  // namespace pass
+}  // namespace ArmPlugin
@@ -0,0 +1,337 @@
+// Copyright (C) 2020-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Per-op converter microbenchmarks. Each case builds a single-op function,
+// runs it through the Arm transformation pipeline and Converter::Configure -
+// exactly the path a loaded network takes - and times the configured kernel
+// over representative shapes and precisions, reporting the mean latency plus
+// GB/s and GFLOPS. Output is a stable tab-separated table, so two builds can
+// be compared with a plain diff (or joined on the first two columns) to gate
+// per-kernel regressions.
+//
+// Regression gate mode: --store <file> writes the measured latencies as a
+// baseline for the machine it ran on; --baseline <file> [--threshold <pct>]
+// compares against a stored baseline and exits non-zero when any case is
+// slower by more than the threshold (default 10%). Baselines are per SoC -
+// store one per target and select it in CI by the board name.
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include <arm_compute/runtime/Allocator.h>
+#include <arm_compute/runtime/OffsetLifetimeManager.h>
+#include <arm_compute/runtime/PoolManager.h>
+#include <arm_compute/runtime/MemoryManagerOnDemand.h>
+#include <arm_compute/runtime/MemoryGroup.h>
+
+#include "arm_config.hpp"
+#include "arm_converter/arm_converter.hpp"
+#include "transformations/arm_optimizations.hpp"
+#include "opset/opset.hpp"
+
+using namespace ArmPlugin;
+
+namespace {
+
+struct BenchCase {
+    std::string                         _op;
+    // Shape/precision signature, the stable join key of the report
+    std::string                         _signature;
+    std::shared_ptr<ngraph::Function>   _function;
+    // Multiply-accumulates count as two floating point operations
+    double                              _flops;
+};
+
+std::string Signature(const ngraph::Shape& shape, const ngraph::element::Type& type, const std::string& extra = {}) {
+    std::ostringstream signature;
+    for (std::size_t i = 0; i < shape.size(); ++i) {
+        signature << (i == 0 ? "" : "x") << shape[i];
+    }
+    if (!extra.empty()) {
+        signature << '/' << extra;
+    }
+    signature << '/' << type.get_type_name();
+    return signature.str();
+}
+
+BenchCase MakeConvolution(const ngraph::Shape& input, std::size_t filters, std::size_t kernel,
+                          const ngraph::element::Type& type) {
+    auto parameter = std::make_shared<opset::Parameter>(type, input);
+    const ngraph::Shape weightsShape{filters, input[1], kernel, kernel};
+    auto weights = opset::Constant::create(type, weightsShape,
+                                           std::vector<float>(ngraph::shape_size(weightsShape), 0.01f));
+    const std::ptrdiff_t pad = static_cast<std::ptrdiff_t>(kernel / 2);
+    auto convolution = std::make_shared<opset::Convolution>(parameter, weights,
+                                                            ngraph::Strides{1, 1},
+                                                            ngraph::CoordinateDiff{pad, pad},
+                                                            ngraph::CoordinateDiff{pad, pad},
+                                                            ngraph::Strides{1, 1});
+    auto function = std::make_shared<ngraph::Function>(convolution, ngraph::ParameterVector{parameter});
+    const auto& output = convolution->get_shape();
+    const double macs = static_cast<double>(ngraph::shape_size(output)) * input[1] * kernel * kernel;
+    std::ostringstream extra;
+    extra << filters << 'f' << kernel << 'x' << kernel;
+    return {"Convolution", Signature(input, type, extra.str()), function, 2.0 * macs};
+}
+
+BenchCase MakeMatMul(std::size_t m, std::size_t n, std::size_t k, const ngraph::element::Type& type) {
+    auto parameter = std::make_shared<opset::Parameter>(type, ngraph::Shape{m, k});
+    auto weights = opset::Constant::create(type, ngraph::Shape{k, n},
+                                           std::vector<float>(k * n, 0.01f));
+    auto matMul = std::make_shared<opset::MatMul>(parameter, weights);
+    auto function = std::make_shared<ngraph::Function>(matMul, ngraph::ParameterVector{parameter});
+    std::ostringstream extra;
+    extra << m << 'x' << k << 'x' << n;
+    return {"MatMul", Signature({m, k}, type, extra.str()), function, 2.0 * m * n * k};
+}
+
+BenchCase MakeAdd(const ngraph::Shape& shape, const ngraph::element::Type& type) {
+    auto lhs = std::make_shared<opset::Parameter>(type, shape);
+    auto rhs = std::make_shared<opset::Parameter>(type, shape);
+    auto add = std::make_shared<opset::Add>(lhs, rhs);
+    auto function = std::make_shared<ngraph::Function>(add, ngraph::ParameterVector{lhs, rhs});
+    return {"Add", Signature(shape, type), function, static_cast<double>(ngraph::shape_size(shape))};
+}
+
+BenchCase MakeSigmoid(const ngraph::Shape& shape, const ngraph::element::Type& type) {
+    auto parameter = std::make_shared<opset::Parameter>(type, shape);
+    auto sigmoid = std::make_shared<opset::Sigmoid>(parameter);
+    auto function = std::make_shared<ngraph::Function>(sigmoid, ngraph::ParameterVector{parameter});
+    // exp + add + divide per element
+    return {"Sigmoid", Signature(shape, type), function, 3.0 * ngraph::shape_size(shape)};
+}
+
+BenchCase MakeMaxPool(const ngraph::Shape& shape, const ngraph::element::Type& type) {
+    auto parameter = std::make_shared<opset::Parameter>(type, shape);
+    auto pool = std::make_shared<opset::MaxPool>(parameter,
+                                                 ngraph::Strides{2, 2},
+                                                 ngraph::Shape{0, 0}, ngraph::Shape{0, 0},
+                                                 ngraph::Shape{2, 2});
+    auto function = std::make_shared<ngraph::Function>(pool, ngraph::ParameterVector{parameter});
+    return {"MaxPool", Signature(shape, type, "2x2s2"), function,
+            static_cast<double>(ngraph::shape_size(shape))};
+}
+
+BenchCase MakeSoftmax(const ngraph::Shape& shape, const ngraph::element::Type& type) {
+    auto parameter = std::make_shared<opset::Parameter>(type, shape);
+    auto softmax = std::make_shared<opset::Softmax>(parameter, 1);
+    auto function = std::make_shared<ngraph::Function>(softmax, ngraph::ParameterVector{parameter});
+    // max + subtract + exp + sum + divide per element
+    return {"Softmax", Signature(shape, type), function, 5.0 * ngraph::shape_size(shape)};
+}
+
+struct CaseResult {
+    std::string _execType;
+    double      _meanUs = 0.0;
+    double      _gbps = 0.0;
+    double      _gflops = 0.0;
+};
+
+CaseResult RunCase(const BenchCase& benchCase) {
+    ngraph::pass::Manager passManager;
+    passManager.register_pass<pass::ArmOptimizations>(false, false);
+    passManager.run_passes(benchCase._function);
+
+    Configuration cfg;
+    auto lifetime = std::make_shared<arm_compute::OffsetLifetimeManager>();
+    auto pool = std::make_shared<arm_compute::PoolManager>();
+    auto memoryManager = std::make_shared<arm_compute::MemoryManagerOnDemand>(lifetime, pool);
+    arm_compute::MemoryGroup memoryGroup{memoryManager};
+    auto layers = Converter{benchCase._function, cfg}.Configure(memoryManager, memoryGroup);
+
+    arm_compute::Allocator allocator;
+    memoryManager->populate(allocator, 1);
+    arm_compute::MemoryGroupResourceScope scope{memoryGroup};
+
+    // Bind I/O exactly like ExecutableNetwork does for constant-free requests
+    std::size_t ioBytes = 0;
+    for (auto&& parameter : benchCase._function->get_parameters()) {
+        auto tensor = layers.at(parameter->get_instance_id())._outputs.at(parameter->output(0))._tensor.get();
+        if (tensor->buffer() == nullptr) {
+            static_cast<arm_compute::Tensor*>(tensor)->allocator()->allocate();
+        }
+        // The byte pattern decodes to small positive values in both f32 and
+        // f16, keeping the kernels clear of denormals and NaNs
+        std::memset(tensor->buffer(), 0x3c, tensor->info()->total_size());
+        ioBytes += tensor->info()->total_size();
+    }
+    for (auto&& result : benchCase._function->get_results()) {
+        auto tensor = layers.at(result->get_instance_id())._inputs.at(result->input(0))->_tensor.get();
+        if (tensor->buffer() == nullptr) {
+            static_cast<arm_compute::Tensor*>(tensor)->allocator()->allocate();
+        }
+        ioBytes += tensor->info()->total_size();
+    }
+
+    std::string execType;
+    for (auto&& node : benchCase._function->get_ordered_ops()) {
+        if (ngraph::op::is_parameter(node) || ngraph::op::is_output(node) || ngraph::op::is_constant(node)) {
+            continue;
+        }
+        const auto& layerExecType = layers.at(node->get_instance_id())._execType;
+        if (!layerExecType.empty()) {
+            execType = layerExecType;
+            break;
+        }
+    }
+
+    auto runGraph = [&layers] {
+        for (auto&& layer : layers) {
+            if (layer._function != nullptr) {
+                layer._function->run();
+            }
+        }
+    };
+    for (auto&& layer : layers) {
+        if (layer._function != nullptr) {
+            layer._function->prepare();
+        }
+    }
+    constexpr int warmupIterations = 5;
+    for (int i = 0; i < warmupIterations; ++i) {
+        runGraph();
+    }
+
+    // Fixed time budget per case; enough iterations to average out scheduler
+    // noise while keeping the whole suite in seconds
+    using Clock = std::chrono::steady_clock;
+    constexpr auto budget = std::chrono::milliseconds{200};
+    std::size_t iterations = 0;
+    const auto start = Clock::now();
+    Clock::time_point stop;
+    do {
+        runGraph();
+        ++iterations;
+        stop = Clock::now();
+    } while (stop - start < budget);
+
+    const double seconds = std::chrono::duration<double>{stop - start}.count();
+    CaseResult result;
+    result._execType = execType;
+    result._meanUs = seconds * 1e6 / iterations;
+    result._gbps = static_cast<double>(ioBytes) * iterations / seconds / 1e9;
+    result._gflops = benchCase._flops * iterations / seconds / 1e9;
+    return result;
+}
+
+// Baseline files are the report itself (op, case and mean_us columns), so a
+// stored run doubles as the reference and stays hand-readable
+std::map<std::string, double> LoadBaseline(const std::string& path) {
+    std::ifstream file{path};
+    if (!file.is_open()) {
+        std::cerr << "Failed to open baseline file: " << path << std::endl;
+        std::exit(2);
+    }
+    std::map<std::string, double> baseline;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields{line};
+        std::string op;
+        std::string signature;
+        std::string exec;
+        double meanUs = 0.0;
+        if ((std::getline(fields, op, '\t')) && std::getline(fields, signature, '\t') &&
+            std::getline(fields, exec, '\t') && (fields >> meanUs) && (exec != "SKIPPED")) {
+            baseline.emplace(op + '\t' + signature, meanUs);
+        }
+    }
+    return baseline;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string storePath;
+    std::string baselinePath;
+    double thresholdPercent = 10.0;
+    for (int arg = 1; arg < argc; ++arg) {
+        const std::string option = argv[arg];
+        if ((option == "--store") && (arg + 1 < argc)) {
+            storePath = argv[++arg];
+        } else if ((option == "--baseline") && (arg + 1 < argc)) {
+            baselinePath = argv[++arg];
+        } else if ((option == "--threshold") && (arg + 1 < argc)) {
+            thresholdPercent = std::stod(argv[++arg]);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--store <file>] [--baseline <file>] [--threshold <percent>]" << std::endl;
+            return 2;
+        }
+    }
+    const auto& f32 = ngraph::element::f32;
+    const auto& f16 = ngraph::element::f16;
+    std::vector<BenchCase> cases;
+    cases.emplace_back(MakeConvolution({1, 64, 56, 56}, 64, 3, f32));
+    cases.emplace_back(MakeConvolution({1, 128, 28, 28}, 128, 3, f32));
+    cases.emplace_back(MakeConvolution({1, 64, 56, 56}, 64, 3, f16));
+    cases.emplace_back(MakeConvolution({1, 3, 224, 224}, 32, 7, f32));
+    cases.emplace_back(MakeMatMul(256, 256, 256, f32));
+    cases.emplace_back(MakeMatMul(64, 1000, 2048, f32));
+    cases.emplace_back(MakeMatMul(256, 256, 256, f16));
+    cases.emplace_back(MakeAdd({1, 64, 56, 56}, f32));
+    cases.emplace_back(MakeAdd({1, 256, 56, 56}, f32));
+    cases.emplace_back(MakeSigmoid({1, 64, 56, 56}, f32));
+    cases.emplace_back(MakeMaxPool({1, 64, 112, 112}, f32));
+    cases.emplace_back(MakeSoftmax({1, 1000}, f32));
+
+    std::map<std::string, double> baseline;
+    if (!baselinePath.empty()) {
+        baseline = LoadBaseline(baselinePath);
+    }
+    std::ofstream store;
+    if (!storePath.empty()) {
+        store.open(storePath);
+        if (!store.is_open()) {
+            std::cerr << "Failed to open baseline file for writing: " << storePath << std::endl;
+            return 2;
+        }
+    }
+
+    int regressions = 0;
+    std::cout << "op\tcase\texec\tmean_us\tGB/s\tGFLOPS" << std::endl;
+    for (auto&& benchCase : cases) {
+        std::ostringstream row;
+        double meanUs = 0.0;
+        bool skipped = false;
+        try {
+            const auto result = RunCase(benchCase);
+            meanUs = result._meanUs;
+            row << benchCase._op << '\t' << benchCase._signature << '\t' << result._execType << '\t'
+                << std::fixed << std::setprecision(2)
+                << result._meanUs << '\t' << result._gbps << '\t' << result._gflops;
+        } catch (const std::exception& e) {
+            // f16 cases on CPUs without FP16 kernels land here; keep the row
+            // so the diff against a capable machine stays aligned
+            skipped = true;
+            row << benchCase._op << '\t' << benchCase._signature << "\tSKIPPED\t" << e.what();
+        }
+        std::cout << row.str() << std::endl;
+        if (store.is_open()) {
+            store << row.str() << '\n';
+        }
+        if (!skipped && !baseline.empty()) {
+            auto itBaseline = baseline.find(benchCase._op + '\t' + benchCase._signature);
+            if ((itBaseline != baseline.end()) &&
+                (meanUs > itBaseline->second * (1.0 + thresholdPercent / 100.0))) {
+                std::cerr << "REGRESSION\t" << benchCase._op << '\t' << benchCase._signature
+                          << std::fixed << std::setprecision(2)
+                          << "\tbaseline " << itBaseline->second << " us\tnow " << meanUs << " us"
+                          << std::endl;
+                ++regressions;
+            }
+        }
+    }
+    return (regressions > 0) ? 1 : 0;
+}
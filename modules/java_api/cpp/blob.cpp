@@ -159,78 +159,109 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_Blob_BlobLong(JNIEnv *env, jobje
     return 0;
 }
 
+static Blob::Ptr *wrapPreallocatedBlob(TensorDesc *tDesc, void *matDataAddr)
+{
+    auto precision = tDesc->getPrecision();
+
+    Blob::Ptr *blob = new Blob::Ptr();
+
+    switch (precision) {
+        case Precision::FP32:
+        {
+            float *data = (float *) matDataAddr;
+            *blob = make_shared_blob<float>((*tDesc), data);
+            break;
+        }
+        case Precision::Q78:
+        case Precision::I16:
+        case Precision::FP16:
+        {
+            short *data = (short *) matDataAddr;
+            *blob = make_shared_blob<short>((*tDesc), data);
+            break;
+        }
+        case Precision::U8:
+        {
+            uint8_t *data = (uint8_t *) matDataAddr;
+            *blob = make_shared_blob<uint8_t>((*tDesc), data);
+            break;
+        }
+        case Precision::I8:
+        {
+            int8_t *data = (int8_t *) matDataAddr;
+            *blob = make_shared_blob<int8_t>((*tDesc), data);
+            break;
+        }
+        case Precision::I32:
+        {
+            int32_t *data = (int32_t *) matDataAddr;
+            *blob = make_shared_blob<int32_t>((*tDesc), data);
+            break;
+        }
+        case Precision::BF16:
+        {
+            short *data = (short *) matDataAddr;
+            *blob = make_shared_blob<short>((*tDesc), data);
+            break;
+        }
+        default: {
+            delete blob;
+            throw std::runtime_error("Unsupported precision value!");
+        }
+    }
+
+    return blob;
+}
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Blob_BlobCArray(JNIEnv *env, jobject obj, jlong tensorDescAddr, jlong matDataAddr)
 {
     static const char method_name[] = "BlobCArray";
-    Blob::Ptr *blob = nullptr;
     try
     {
         TensorDesc *tDesc = (TensorDesc *)tensorDescAddr;
 
-        auto precision = tDesc->getPrecision();
+        return (jlong)wrapPreallocatedBlob(tDesc, (void *)matDataAddr);
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
 
-        std::vector<size_t> dims = tDesc->getDims();
-        blob = new Blob::Ptr();
+    return 0;
+}
 
-        switch (precision) {
-            case Precision::FP32:
-            {
-                float *data = (float *) matDataAddr;
-                *blob = make_shared_blob<float>((*tDesc), data);
-                break;
-            }
-            case Precision::Q78:
-            case Precision::I16:
-            case Precision::FP16:
-            {
-                short *data = (short *) matDataAddr;
-                *blob = make_shared_blob<short>((*tDesc), data);
-                break;
-            }
-            case Precision::U8:
-            {
-                uint8_t *data = (uint8_t *) matDataAddr;
-                *blob = make_shared_blob<uint8_t>((*tDesc), data);
-                break;
-            }
-            case Precision::I8:
-            {
-                int8_t *data = (int8_t *) matDataAddr;
-                *blob = make_shared_blob<int8_t>((*tDesc), data);
-                break;
-            }
-            case Precision::I32:
-            {
-                int32_t *data = (int32_t *) matDataAddr;
-                *blob = make_shared_blob<int32_t>((*tDesc), data);
-                break;
-            }
-            case Precision::BF16:
-            {
-                short *data = (short *) matDataAddr;
-                *blob = make_shared_blob<short>((*tDesc), data);
-                break;
-            }
-            default: {
-                delete blob;
-                throw std::runtime_error("Unsupported precision value!");
-            }
-        }
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Blob_BlobDirectBuffer(JNIEnv *env, jobject obj, jlong tensorDescAddr, jobject data)
+{
+    static const char method_name[] = "BlobDirectBuffer";
+    try
+    {
+        TensorDesc *tDesc = (TensorDesc *)tensorDescAddr;
 
-        return (jlong)blob;
+        void *address = env->GetDirectBufferAddress(data);
+        if (address == nullptr)
+            throw std::runtime_error("Buffer is not a direct java.nio buffer!");
+
+        jlong capacity = env->GetDirectBufferCapacity(data);
+        size_t blobByteSize = tDesc->getPrecision().size();
+        for (size_t dim : tDesc->getDims())
+            blobByteSize *= dim;
+        if (capacity < 0 || (size_t)capacity < blobByteSize)
+            throw std::runtime_error("Buffer capacity is less than the blob byte size!");
+
+        // The blob wraps the buffer memory directly; the Java side keeps the
+        // buffer reachable for the blob lifetime
+        return (jlong)wrapPreallocatedBlob(tDesc, address);
     }
     catch (const std::exception &e)
     {
-        if (blob) {
-            delete blob;
-        }
         throwJavaException(env, &e, method_name);
     }
     catch (...)
     {
-        if (blob) {
-            delete blob;
-        }
         throwJavaException(env, 0, method_name);
     }
 
@@ -51,14 +51,12 @@ JNIEXPORT jobject JNICALL Java_org_intel_openvino_CNNNetwork_GetInputsInfo(JNIEn
         CNNNetwork *network = (CNNNetwork *)addr;
         const InputsDataMap &inputs_map = network->getInputsInfo();
 
-        jclass hashMapClass = env->FindClass("java/util/HashMap");
-        jmethodID hashMapInit = env->GetMethodID(hashMapClass, "<init>", "()V");
-        jobject hashMapObj = env->NewObject(hashMapClass, hashMapInit);
-        jmethodID hashMapPut = env->GetMethodID(hashMapClass, "put",
-                                                "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+        const JniCache &ids = getJniCache();
+        jobject hashMapObj = env->NewObject(ids.hashMap_class, ids.hashMap_init_id);
+        jmethodID hashMapPut = ids.hashMap_put_id;
 
-        jclass inputInfoClass = env->FindClass("org/intel/openvino/InputInfo");
-        jmethodID inputInfoConstructor = env->GetMethodID(inputInfoClass,"<init>","(J)V");
+        jclass inputInfoClass = ids.inputInfo_class;
+        jmethodID inputInfoConstructor = ids.inputInfo_init_id;
 
         for (const auto &item : inputs_map) {
             jobject inputInfoObj = env->NewObject(inputInfoClass, inputInfoConstructor, (jlong)(item.second.get()));
@@ -86,14 +84,12 @@ JNIEXPORT jobject JNICALL Java_org_intel_openvino_CNNNetwork_GetOutputsInfo(JNIE
         CNNNetwork *network = (CNNNetwork *)addr;
         const OutputsDataMap &outputs_map = network->getOutputsInfo();
 
-        jclass hashMapClass = env->FindClass("java/util/HashMap");
-        jmethodID hashMapInit = env->GetMethodID(hashMapClass, "<init>", "()V");
-        jobject hashMapObj = env->NewObject(hashMapClass, hashMapInit);
-        jmethodID hashMapPut = env->GetMethodID(hashMapClass, "put",
-                                                "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+        const JniCache &ids = getJniCache();
+        jobject hashMapObj = env->NewObject(ids.hashMap_class, ids.hashMap_init_id);
+        jmethodID hashMapPut = ids.hashMap_put_id;
 
-        jclass outputInfoClass = env->FindClass("org/intel/openvino/Data");
-        jmethodID outputInfoConstructor = env->GetMethodID(outputInfoClass,"<init>","(J)V");
+        jclass outputInfoClass = ids.data_class;
+        jmethodID outputInfoConstructor = ids.data_init_id;
 
         for (const auto &item : outputs_map) {
             jobject outputInfoObj = env->NewObject(outputInfoClass, outputInfoConstructor, (jlong)(item.second.get()));
@@ -139,11 +135,9 @@ JNIEXPORT jobject JNICALL Java_org_intel_openvino_CNNNetwork_getInputShapes(JNIE
         CNNNetwork *network = (CNNNetwork *)addr;
         std::map<std::string, std::vector<size_t>> shapes = network->getInputShapes();
 
-        jclass hashMapClass = env->FindClass("java/util/HashMap");
-        jmethodID hashMapInit = env->GetMethodID(hashMapClass, "<init>", "()V");
-        jobject hashMapObj = env->NewObject(hashMapClass, hashMapInit);
-        jmethodID hashMapPut = env->GetMethodID(hashMapClass, "put",
-                                                "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+        const JniCache &ids = getJniCache();
+        jobject hashMapObj = env->NewObject(ids.hashMap_class, ids.hashMap_init_id);
+        jmethodID hashMapPut = ids.hashMap_put_id;
 
         for (const auto &item : shapes) {
             jintArray result = env->NewIntArray(item.second.size());
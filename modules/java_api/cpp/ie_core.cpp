@@ -1,11 +1,65 @@
 #include <jni.h>   // JNI header provided by JDK
 #include <inference_engine.hpp>
+#include <ngraph/graph_util.hpp>
+
+#include <sys/stat.h>
+#include <map>
+#include <mutex>
 
 #include "openvino_java.hpp"
 #include "jni_common.hpp"
 
 using namespace InferenceEngine;
 
+// Process-wide parsed model cache. Several Core instances (one per
+// classloader) read the same IR on start-up; parsing it once and handing out
+// clones of the ngraph function is much cheaper than re-reading the files.
+// A cached entry is dropped when the model files change on disk.
+struct CachedModel
+{
+    time_t xml_mtime;
+    time_t bin_mtime;
+    CNNNetwork network;
+};
+
+static std::mutex model_cache_mutex;
+static std::map<std::string, CachedModel> model_cache;
+
+static time_t fileModificationTime(const std::string &path)
+{
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 ? st.st_mtime : 0;
+}
+
+static CNNNetwork readNetworkCached(Core *core, const std::string &xml, const std::string &bin)
+{
+    time_t xml_mtime = fileModificationTime(xml);
+    time_t bin_mtime = bin.empty() ? 0 : fileModificationTime(bin);
+    std::string key = xml + "|" + bin;
+
+    const std::lock_guard<std::mutex> lock(model_cache_mutex);
+
+    auto it = model_cache.find(key);
+    if (it == model_cache.end() || it->second.xml_mtime != xml_mtime || it->second.bin_mtime != bin_mtime)
+    {
+        CachedModel model;
+        model.xml_mtime = xml_mtime;
+        model.bin_mtime = bin_mtime;
+        model.network = bin.empty() ? core->ReadNetwork(xml) : core->ReadNetwork(xml, bin);
+        it = model_cache.emplace(key, CachedModel()).first;
+        it->second = std::move(model);
+    }
+
+    // The clone keeps the returned networks independent, so one caller
+    // reshaping its copy does not affect the others
+    CNNNetwork &cached = it->second.network;
+    if (auto function = cached.getFunction())
+        return CNNNetwork(ngraph::clone_function(*function));
+
+    // Pre-ngraph formats cannot be cloned here; share the parsed instance
+    return cached;
+}
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_IECore_GetCore(JNIEnv *env, jobject obj)
 {
     static const char method_name[] = "GetCore";
@@ -56,7 +110,7 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_IECore_ReadNetwork1(JNIEnv *env,
         Core *core = (Core *)coreAddr;
 
         CNNNetwork *network = new CNNNetwork();
-        *network = core->ReadNetwork(n_xml, n_bin);
+        *network = readNetworkCached(core, n_xml, n_bin);
 
         return (jlong)network;
     }
@@ -81,7 +135,7 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_IECore_ReadNetwork(JNIEnv *env,
         Core *core = (Core *)coreAddr;
 
         CNNNetwork *network = new CNNNetwork();
-        *network = core->ReadNetwork(n_xml);
+        *network = readNetworkCached(core, n_xml, "");
 
         return (jlong)network;
     }
@@ -0,0 +1,238 @@
+#include <inference_engine.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "openvino_java.hpp"
+#include "jni_common.hpp"
+
+using namespace InferenceEngine;
+
+// Pool of infer requests sharing one completion pipeline: submitted jobs run
+// on whichever request is idle, the Java callback sees the finished request id
+// before the request returns to the idle pool.
+struct InferQueue
+{
+    std::vector<InferRequest> requests;
+    std::deque<size_t> idle_ids;
+    std::mutex mutex;
+    std::condition_variable cv;
+    JavaVM *jvm = nullptr;
+    jint version = 0;
+    jobject callback = nullptr;
+    jmethodID callback_accept_id = nullptr;
+};
+
+static void completionHandler(InferQueue *queue, size_t id)
+{
+    jobject callback;
+    jmethodID accept_id;
+    {
+        const std::lock_guard<std::mutex> lock(queue->mutex);
+        callback = queue->callback;
+        accept_id = queue->callback_accept_id;
+    }
+
+    if (callback != nullptr) {
+        JNIEnv *env;
+        JavaVMAttachArgs args;
+        args.version = queue->version;
+        args.name = NULL;
+        args.group = NULL;
+#ifdef _JAVASOFT_JNI_H_
+        queue->jvm->AttachCurrentThread((void **)&env, &args);
+#else
+        queue->jvm->AttachCurrentThread(&env, &args);
+#endif
+        env->CallVoidMethod(callback, accept_id, (jint)id);
+        if (env->ExceptionCheck())
+            env->ExceptionClear();
+        queue->jvm->DetachCurrentThread();
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->idle_ids.push_back(id);
+    }
+    queue->cv.notify_all();
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferQueue_Create(JNIEnv *env, jobject obj, jlong netAddr, jint jobs)
+{
+    static const char method_name[] = "Create";
+    InferQueue *queue = nullptr;
+    try
+    {
+        if (jobs <= 0)
+            throw std::runtime_error("Number of jobs must be positive!");
+
+        ExecutableNetwork *executable_network = (ExecutableNetwork *)netAddr;
+
+        queue = new InferQueue();
+        env->GetJavaVM(&queue->jvm);
+        queue->version = env->GetVersion();
+
+        for (jint id = 0; id < jobs; ++id) {
+            queue->requests.push_back(executable_network->CreateInferRequest());
+            queue->idle_ids.push_back(id);
+        }
+        for (jint id = 0; id < jobs; ++id) {
+            queue->requests[id].SetCompletionCallback(
+                    [queue, id] {
+                        completionHandler(queue, id);
+            });
+        }
+
+        return (jlong)queue;
+    }
+    catch (const std::exception &e)
+    {
+        delete queue;
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        delete queue;
+        throwJavaException(env, 0, method_name);
+    }
+    return 0;
+}
+
+JNIEXPORT jint JNICALL Java_org_intel_openvino_InferQueue_GetIdleRequestId(JNIEnv *env, jobject obj, jlong addr)
+{
+    static const char method_name[] = "GetIdleRequestId";
+    try
+    {
+        InferQueue *queue = (InferQueue *)addr;
+
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        queue->cv.wait(lock, [queue] { return !queue->idle_ids.empty(); });
+
+        size_t id = queue->idle_ids.front();
+        queue->idle_ids.pop_front();
+
+        return (jint)id;
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferQueue_GetRequest(JNIEnv *env, jobject obj, jlong addr, jint id)
+{
+    static const char method_name[] = "GetRequest";
+    try
+    {
+        InferQueue *queue = (InferQueue *)addr;
+
+        if (id < 0 || (size_t)id >= queue->requests.size())
+            throw std::runtime_error("No request with such id in the queue!");
+
+        // InferRequest is a shared handle: the copy the wrapper owns and the
+        // queue entry drive the same underlying request
+        InferRequest *infer_request = new InferRequest(queue->requests[id]);
+
+        return (jlong)infer_request;
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+    return 0;
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferQueue_StartAsync(JNIEnv *env, jobject obj, jlong addr, jint id)
+{
+    static const char method_name[] = "StartAsync";
+    try
+    {
+        InferQueue *queue = (InferQueue *)addr;
+
+        if (id < 0 || (size_t)id >= queue->requests.size())
+            throw std::runtime_error("No request with such id in the queue!");
+
+        queue->requests[id].StartAsync();
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferQueue_SetCompletionCallback(JNIEnv *env, jobject obj, jlong addr, jobject callback)
+{
+    static const char method_name[] = "SetCompletionCallback";
+    try
+    {
+        InferQueue *queue = (InferQueue *)addr;
+
+        jclass callback_class = env->GetObjectClass(callback);
+        jmethodID accept_id = env->GetMethodID(callback_class, "accept", "(I)V");
+        jobject callback_glob = env->NewGlobalRef(callback);
+
+        const std::lock_guard<std::mutex> lock(queue->mutex);
+        if (queue->callback != nullptr)
+            env->DeleteGlobalRef(queue->callback);
+        queue->callback = callback_glob;
+        queue->callback_accept_id = accept_id;
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferQueue_WaitAll(JNIEnv *env, jobject obj, jlong addr)
+{
+    static const char method_name[] = "WaitAll";
+    try
+    {
+        InferQueue *queue = (InferQueue *)addr;
+
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        queue->cv.wait(lock, [queue] { return queue->idle_ids.size() == queue->requests.size(); });
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferQueue_delete(JNIEnv *env, jobject, jlong addr)
+{
+    InferQueue *queue = (InferQueue *)addr;
+
+    {
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        queue->cv.wait(lock, [queue] { return queue->idle_ids.size() == queue->requests.size(); });
+    }
+
+    if (queue->callback != nullptr)
+        env->DeleteGlobalRef(queue->callback);
+
+    delete queue;
+}
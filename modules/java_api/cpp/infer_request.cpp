@@ -1,4 +1,5 @@
 #include <inference_engine.hpp>
+#include <cstring>
 #include <mutex>
 
 #include "openvino_java.hpp"
@@ -73,6 +74,32 @@ JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *env, jo
     return 0;
 }
 
+JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequest_WaitTimeout(JNIEnv *env, jobject obj, jlong addr, jlong timeout)
+{
+    static const char method_name[] = "WaitTimeout";
+    try
+    {
+        InferRequest *infer_request = (InferRequest *)addr;
+
+        InferenceEngine::StatusCode status_code = infer_request->Wait(static_cast<int64_t>(timeout));
+
+        auto code = status_code_map.find(status_code);
+        if (code == status_code_map.end())
+            throw std::runtime_error("No such StatusCode value!");
+
+        return (jint)(code->second);
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+    return 0;
+}
+
 static std::mutex map_mutex;
 static std::map<jlong, jobject> runnable_glob_map;
 
@@ -85,7 +112,15 @@ JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequest_SetCompletionCallbac
         InferRequest *infer_request = (InferRequest *)addr;
         jobject runnable_glob = env->NewGlobalRef(runnable);
 
-        runnable_glob_map.insert( std::make_pair(addr, runnable_glob) );
+        // Replacing the listener must release the previous global ref,
+        // otherwise every re-registration pins another Java object forever
+        auto it = runnable_glob_map.find(addr);
+        if (it != runnable_glob_map.end()) {
+            env->DeleteGlobalRef(it->second);
+            it->second = runnable_glob;
+        } else {
+            runnable_glob_map.insert( std::make_pair(addr, runnable_glob) );
+        }
 
         JavaVM* jvm;
         env->GetJavaVM(&jvm);
@@ -104,9 +139,7 @@ JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequest_SetCompletionCallbac
                     jvm->AttachCurrentThread(&myNewEnv, &args);
 #endif
 
-                    jclass runnable_class = myNewEnv->GetObjectClass(runnable_glob);
-                    jmethodID run_method_id = myNewEnv->GetMethodID(runnable_class, "run","()V");
-                    myNewEnv->CallNonvirtualVoidMethod(runnable_glob, runnable_class, run_method_id);
+                    myNewEnv->CallVoidMethod(runnable_glob, getJniCache().runnable_run_id);
 
                     jvm->DetachCurrentThread();
         });
@@ -170,6 +203,97 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetBlob(JNIEnv *env,
     }
 }
 
+// Returns the blob slice layout for batched scatter/gather: the per-image
+// byte count, after checking the buffer count matches the blob batch dimension
+static size_t batchSliceBytes(MemoryBlob::Ptr &blob, jsize buffers)
+{
+    const std::vector<size_t> &dims = blob->getTensorDesc().getDims();
+    if (dims.empty() || dims[0] != (size_t)buffers)
+        throw std::runtime_error("Number of buffers does not match the blob batch dimension!");
+
+    return blob->byteSize() / buffers;
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetBlobBatch(JNIEnv *env, jobject obj, jlong addr, jstring input_name, jobjectArray buffers)
+{
+    static const char method_name[] = "SetBlobBatch";
+    try
+    {
+        InferRequest *infer_request = (InferRequest *)addr;
+
+        Blob::Ptr blob = infer_request->GetBlob(jstringToString(env, input_name));
+        MemoryBlob::Ptr mBlob = as<MemoryBlob>(blob);
+        if (!mBlob)
+            throw std::runtime_error("Target Blob cannot be cast to the MemoryBlob!");
+
+        jsize n = env->GetArrayLength(buffers);
+        size_t sliceBytes = batchSliceBytes(mBlob, n);
+
+        LockedMemory<void> lmem = mBlob->wmap();
+        uint8_t *dst = lmem.as<uint8_t *>();
+
+        for (jsize i = 0; i < n; ++i) {
+            jobject buffer = env->GetObjectArrayElement(buffers, i);
+            void *src = env->GetDirectBufferAddress(buffer);
+            if (src == nullptr)
+                throw std::runtime_error("Buffer is not a direct java.nio buffer!");
+            if (env->GetDirectBufferCapacity(buffer) < (jlong)sliceBytes)
+                throw std::runtime_error("Buffer capacity is less than the blob slice byte size!");
+
+            std::memcpy(dst + i * sliceBytes, src, sliceBytes);
+            env->DeleteLocalRef(buffer);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_GetBlobBatch(JNIEnv *env, jobject obj, jlong addr, jstring output_name, jobjectArray buffers)
+{
+    static const char method_name[] = "GetBlobBatch";
+    try
+    {
+        InferRequest *infer_request = (InferRequest *)addr;
+
+        Blob::Ptr blob = infer_request->GetBlob(jstringToString(env, output_name));
+        MemoryBlob::Ptr mBlob = as<MemoryBlob>(blob);
+        if (!mBlob)
+            throw std::runtime_error("Target Blob cannot be cast to the MemoryBlob!");
+
+        jsize n = env->GetArrayLength(buffers);
+        size_t sliceBytes = batchSliceBytes(mBlob, n);
+
+        LockedMemory<const void> lmem = mBlob->rmap();
+        const uint8_t *src = lmem.as<const uint8_t *>();
+
+        for (jsize i = 0; i < n; ++i) {
+            jobject buffer = env->GetObjectArrayElement(buffers, i);
+            void *dst = env->GetDirectBufferAddress(buffer);
+            if (dst == nullptr)
+                throw std::runtime_error("Buffer is not a direct java.nio buffer!");
+            if (env->GetDirectBufferCapacity(buffer) < (jlong)sliceBytes)
+                throw std::runtime_error("Buffer capacity is less than the blob slice byte size!");
+
+            std::memcpy(dst, src + i * sliceBytes, sliceBytes);
+            env->DeleteLocalRef(buffer);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+}
+
 JNIEXPORT jobject JNICALL Java_org_intel_openvino_InferRequest_GetPerformanceCounts(JNIEnv *env, jobject, jlong addr)
 {
     static const char method_name[] = "GetPerformanceCounts";
@@ -179,18 +303,15 @@ JNIEXPORT jobject JNICALL Java_org_intel_openvino_InferRequest_GetPerformanceCou
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> performance;
         performance = infer_request->GetPerformanceCounts();
 
-        jclass hashMap_class = env->FindClass("java/util/LinkedHashMap");
-        jmethodID init_method_id = env->GetMethodID(hashMap_class, "<init>", "()V");
-        jobject hashMap_object = env->NewObject(hashMap_class, init_method_id);
-        jmethodID put_method_id = env->GetMethodID(hashMap_class, "put",
-                                                "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+        const JniCache &ids = getJniCache();
+        jobject hashMap_object = env->NewObject(ids.linkedHashMap_class, ids.linkedHashMap_init_id);
+        jmethodID put_method_id = ids.linkedHashMap_put_id;
 
-        jclass IEProfileInfo_class = env->FindClass("org/intel/openvino/InferenceEngineProfileInfo");
-        jmethodID IEProfileInfo_init_id = env->GetMethodID(IEProfileInfo_class,"<init>",
-                                                           "(Lorg/intel/openvino/InferenceEngineProfileInfo$LayerStatus;JJLjava/lang/String;Ljava/lang/String;I)V");
+        jclass IEProfileInfo_class = ids.profileInfo_class;
+        jmethodID IEProfileInfo_init_id = ids.profileInfo_init_id;
 
-        jclass layerStatus_enum = env->FindClass("org/intel/openvino/InferenceEngineProfileInfo$LayerStatus");
-        jmethodID valueOf_method_id = env->GetStaticMethodID(layerStatus_enum,"valueOf","(I)Lorg/intel/openvino/InferenceEngineProfileInfo$LayerStatus;");
+        jclass layerStatus_enum = ids.layerStatus_class;
+        jmethodID valueOf_method_id = ids.layerStatus_valueOf_id;
 
         for (const auto& itr : performance) {
             InferenceEngine::InferenceEngineProfileInfo ie_prof_info = itr.second;
@@ -224,11 +345,95 @@ JNIEXPORT jobject JNICALL Java_org_intel_openvino_InferRequest_GetPerformanceCou
     return 0;
 }
 
+JNIEXPORT jobjectArray JNICALL Java_org_intel_openvino_InferRequest_GetPerformanceLayerNames(JNIEnv *env, jobject, jlong addr)
+{
+    static const char method_name[] = "GetPerformanceLayerNames";
+    try
+    {
+        InferRequest *infer_request = (InferRequest *)addr;
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> performance;
+        performance = infer_request->GetPerformanceCounts();
+
+        jobjectArray names = env->NewObjectArray((jsize)performance.size(), getJniCache().string_class, nullptr);
+
+        jsize id = 0;
+        for (const auto &itr : performance) {
+            jstring name = env->NewStringUTF(itr.first.c_str());
+            env->SetObjectArrayElement(names, id++, name);
+            env->DeleteLocalRef(name);
+        }
+
+        return names;
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+    return 0;
+}
+
+// Record layout written per profiled layer, native byte order: int32 layer id
+// (index into GetPerformanceLayerNames), int32 LayerStatus value, int64 real
+// time and int64 cpu time in microseconds. Must match InferRequest.PERF_RECORD_BYTES
+static constexpr size_t perf_record_bytes = 24;
+
+JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequest_GetPerformanceCountsRaw(JNIEnv *env, jobject, jlong addr, jobject buffer)
+{
+    static const char method_name[] = "GetPerformanceCountsRaw";
+    try
+    {
+        InferRequest *infer_request = (InferRequest *)addr;
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> performance;
+        performance = infer_request->GetPerformanceCounts();
+
+        uint8_t *out = (uint8_t *)env->GetDirectBufferAddress(buffer);
+        if (out == nullptr)
+            throw std::runtime_error("Buffer is not a direct java.nio buffer!");
+        if (env->GetDirectBufferCapacity(buffer) < (jlong)(performance.size() * perf_record_bytes))
+            throw std::runtime_error("Buffer capacity is less than the performance record table size!");
+
+        int32_t id = 0;
+        for (const auto &itr : performance) {
+            auto it = layer_status_map.find(itr.second.status);
+            if (it == layer_status_map.end())
+                throw std::runtime_error("No such LayerStatus value!");
+
+            int32_t status = it->second;
+            int64_t real_time = itr.second.realTime_uSec;
+            int64_t cpu_time = itr.second.cpu_uSec;
+
+            std::memcpy(out, &id, sizeof(id));
+            std::memcpy(out + 4, &status, sizeof(status));
+            std::memcpy(out + 8, &real_time, sizeof(real_time));
+            std::memcpy(out + 16, &cpu_time, sizeof(cpu_time));
+            out += perf_record_bytes;
+            ++id;
+        }
+
+        return (jint)performance.size();
+    }
+    catch (const std::exception &e)
+    {
+        throwJavaException(env, &e, method_name);
+    }
+    catch (...)
+    {
+        throwJavaException(env, 0, method_name);
+    }
+    return 0;
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_delete(JNIEnv *env, jobject, jlong addr)
 {
+    const std::lock_guard<std::mutex> lock(map_mutex);
     auto it = runnable_glob_map.find(addr);
     if (it != runnable_glob_map.end()) {
         env->DeleteGlobalRef(it->second);
+        runnable_glob_map.erase(it);
     }
 
     InferRequest *infer_request = (InferRequest *)addr;
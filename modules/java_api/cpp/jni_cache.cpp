@@ -0,0 +1,92 @@
+#include "jni_cache.hpp"
+
+static JniCache cache;
+
+const JniCache &getJniCache()
+{
+    return cache;
+}
+
+static jclass globalClassRef(JNIEnv *env, const char *name)
+{
+    jclass local = env->FindClass(name);
+    jclass global = (jclass)env->NewGlobalRef(local);
+    env->DeleteLocalRef(local);
+    return global;
+}
+
+extern "C" JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *)
+{
+    JNIEnv *env = nullptr;
+    if (vm->GetEnv((void **)&env, JNI_VERSION_1_6) != JNI_OK)
+        return JNI_ERR;
+
+    cache.exception_class = globalClassRef(env, "java/lang/Exception");
+
+    cache.map_class = globalClassRef(env, "java/util/Map");
+    cache.map_entrySet_id = env->GetMethodID(cache.map_class, "entrySet", "()Ljava/util/Set;");
+
+    cache.hashMap_class = globalClassRef(env, "java/util/HashMap");
+    cache.hashMap_init_id = env->GetMethodID(cache.hashMap_class, "<init>", "()V");
+    cache.hashMap_put_id = env->GetMethodID(cache.hashMap_class, "put",
+                                            "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+
+    cache.linkedHashMap_class = globalClassRef(env, "java/util/LinkedHashMap");
+    cache.linkedHashMap_init_id = env->GetMethodID(cache.linkedHashMap_class, "<init>", "()V");
+    cache.linkedHashMap_put_id = env->GetMethodID(cache.linkedHashMap_class, "put",
+                                                  "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+
+    cache.set_class = globalClassRef(env, "java/util/Set");
+    cache.set_iterator_id = env->GetMethodID(cache.set_class, "iterator", "()Ljava/util/Iterator;");
+
+    cache.iterator_class = globalClassRef(env, "java/util/Iterator");
+    cache.iterator_hasNext_id = env->GetMethodID(cache.iterator_class, "hasNext", "()Z");
+    cache.iterator_next_id = env->GetMethodID(cache.iterator_class, "next", "()Ljava/lang/Object;");
+
+    cache.mapEntry_class = globalClassRef(env, "java/util/Map$Entry");
+    cache.mapEntry_getKey_id = env->GetMethodID(cache.mapEntry_class, "getKey", "()Ljava/lang/Object;");
+    cache.mapEntry_getValue_id = env->GetMethodID(cache.mapEntry_class, "getValue", "()Ljava/lang/Object;");
+
+    cache.string_class = globalClassRef(env, "java/lang/String");
+    cache.string_toString_id = env->GetMethodID(cache.string_class, "toString", "()Ljava/lang/String;");
+
+    cache.runnable_class = globalClassRef(env, "java/lang/Runnable");
+    cache.runnable_run_id = env->GetMethodID(cache.runnable_class, "run", "()V");
+
+    cache.inputInfo_class = globalClassRef(env, "org/intel/openvino/InputInfo");
+    cache.inputInfo_init_id = env->GetMethodID(cache.inputInfo_class, "<init>", "(J)V");
+
+    cache.data_class = globalClassRef(env, "org/intel/openvino/Data");
+    cache.data_init_id = env->GetMethodID(cache.data_class, "<init>", "(J)V");
+
+    cache.profileInfo_class = globalClassRef(env, "org/intel/openvino/InferenceEngineProfileInfo");
+    cache.profileInfo_init_id = env->GetMethodID(cache.profileInfo_class, "<init>",
+            "(Lorg/intel/openvino/InferenceEngineProfileInfo$LayerStatus;JJLjava/lang/String;Ljava/lang/String;I)V");
+
+    cache.layerStatus_class = globalClassRef(env, "org/intel/openvino/InferenceEngineProfileInfo$LayerStatus");
+    cache.layerStatus_valueOf_id = env->GetStaticMethodID(cache.layerStatus_class, "valueOf",
+            "(I)Lorg/intel/openvino/InferenceEngineProfileInfo$LayerStatus;");
+
+    return JNI_VERSION_1_6;
+}
+
+extern "C" JNIEXPORT void JNICALL JNI_OnUnload(JavaVM *vm, void *)
+{
+    JNIEnv *env = nullptr;
+    if (vm->GetEnv((void **)&env, JNI_VERSION_1_6) != JNI_OK)
+        return;
+
+    env->DeleteGlobalRef(cache.exception_class);
+    env->DeleteGlobalRef(cache.map_class);
+    env->DeleteGlobalRef(cache.hashMap_class);
+    env->DeleteGlobalRef(cache.linkedHashMap_class);
+    env->DeleteGlobalRef(cache.set_class);
+    env->DeleteGlobalRef(cache.iterator_class);
+    env->DeleteGlobalRef(cache.mapEntry_class);
+    env->DeleteGlobalRef(cache.string_class);
+    env->DeleteGlobalRef(cache.runnable_class);
+    env->DeleteGlobalRef(cache.inputInfo_class);
+    env->DeleteGlobalRef(cache.data_class);
+    env->DeleteGlobalRef(cache.profileInfo_class);
+    env->DeleteGlobalRef(cache.layerStatus_class);
+}
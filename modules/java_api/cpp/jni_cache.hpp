@@ -0,0 +1,58 @@
+#ifndef OPENVINO_JAVA_JNI_CACHE_HPP
+#define OPENVINO_JAVA_JNI_CACHE_HPP
+
+#include <jni.h>
+
+// One-time cache of the JNI class references and method IDs the bindings use,
+// resolved in JNI_OnLoad so per-call conversion helpers skip the
+// FindClass/GetMethodID lookups. Classes are held as global references;
+// method IDs stay valid as long as their class is alive, which the global
+// reference guarantees.
+struct JniCache
+{
+    jclass exception_class;
+
+    jclass map_class;
+    jmethodID map_entrySet_id;
+
+    jclass hashMap_class;
+    jmethodID hashMap_init_id;
+    jmethodID hashMap_put_id;
+
+    jclass linkedHashMap_class;
+    jmethodID linkedHashMap_init_id;
+    jmethodID linkedHashMap_put_id;
+
+    jclass set_class;
+    jmethodID set_iterator_id;
+
+    jclass iterator_class;
+    jmethodID iterator_hasNext_id;
+    jmethodID iterator_next_id;
+
+    jclass mapEntry_class;
+    jmethodID mapEntry_getKey_id;
+    jmethodID mapEntry_getValue_id;
+
+    jclass string_class;
+    jmethodID string_toString_id;
+
+    jclass runnable_class;
+    jmethodID runnable_run_id;
+
+    jclass inputInfo_class;
+    jmethodID inputInfo_init_id;
+
+    jclass data_class;
+    jmethodID data_init_id;
+
+    jclass profileInfo_class;
+    jmethodID profileInfo_init_id;
+
+    jclass layerStatus_class;
+    jmethodID layerStatus_valueOf_id;
+};
+
+const JniCache &getJniCache();
+
+#endif  // OPENVINO_JAVA_JNI_CACHE_HPP
@@ -1,20 +1,18 @@
 #include <jni.h>   // JNI header provided by JDK
 #include <stdio.h> // C Standard IO Header
 
+#include "jni_cache.hpp"
+
 static void throwJavaException(JNIEnv *env, const std::exception *e, const char *method)
 {
     std::string what = "unknown exception";
-    jclass je = 0;
 
     if(e){
         std::string exception_type = "InferenceEngineException";
         what = '\n' + exception_type + ": " + '\n' + '\t' + std::string(method) + ": " + e->what();
     }
-    
-    if (!je)
-        je = env->FindClass("java/lang/Exception");
 
-    env->ThrowNew(je, what.c_str());
+    env->ThrowNew(getJniCache().exception_class, what.c_str());
 
     (void)method;
 }
@@ -45,25 +43,17 @@ static std::map<std::string, std::string> javaMapToMap(JNIEnv *env, jobject java
     static const char method_name[] = "javaMapToMap";
     try
     {
-        jclass map_class = env->GetObjectClass(java_map);
-        jmethodID entrySet_method_id = env->GetMethodID(map_class, "entrySet", "()Ljava/util/Set;");
-        jobject entry_set = env->CallObjectMethod(java_map, entrySet_method_id);
-        
-        jclass set_class = env->FindClass("java/util/Set");
-        jmethodID iterator_method_id = env->GetMethodID(set_class, "iterator", "()Ljava/util/Iterator;");
-        jobject iterator = env->CallObjectMethod(entry_set, iterator_method_id);
-        
-        jclass iterator_class = env->FindClass("java/util/Iterator");
-        jmethodID hasNext_method_id = env->GetMethodID(iterator_class, "hasNext", "()Z");
-        jmethodID next_method_id = env->GetMethodID(iterator_class, "next", "()Ljava/lang/Object;");
-        bool hasNext = (bool) (env->CallBooleanMethod(iterator, hasNext_method_id) == JNI_TRUE);
+        const JniCache &ids = getJniCache();
+        jobject entry_set = env->CallObjectMethod(java_map, ids.map_entrySet_id);
+        jobject iterator = env->CallObjectMethod(entry_set, ids.set_iterator_id);
 
-        jclass mapentry_class = (env)->FindClass("java/util/Map$Entry");
-        jmethodID get_key_method_id = env->GetMethodID(mapentry_class, "getKey", "()Ljava/lang/Object;");
-        jmethodID get_value_method_id = env->GetMethodID(mapentry_class, "getValue", "()Ljava/lang/Object;");
+        jmethodID hasNext_method_id = ids.iterator_hasNext_id;
+        jmethodID next_method_id = ids.iterator_next_id;
+        bool hasNext = (bool) (env->CallBooleanMethod(iterator, hasNext_method_id) == JNI_TRUE);
 
-        jclass string_class = env->FindClass("java/lang/String");
-        jmethodID to_string_method_id = env->GetMethodID(string_class, "toString", "()Ljava/lang/String;");
+        jmethodID get_key_method_id = ids.mapEntry_getKey_id;
+        jmethodID get_value_method_id = ids.mapEntry_getValue_id;
+        jmethodID to_string_method_id = ids.string_toString_id;
 
         std::map<std::string, std::string> c_map;
 
@@ -96,25 +86,17 @@ static std::map<std::string, std::vector<size_t>> javaMapToMap_1(JNIEnv *env, jo
     static const char method_name[] = "javaMapToMap";
     try
     {
-        jclass map_class = env->GetObjectClass(java_map);
-        jmethodID entrySet_method_id = env->GetMethodID(map_class, "entrySet", "()Ljava/util/Set;");
-        jobject entry_set = env->CallObjectMethod(java_map, entrySet_method_id);
-        
-        jclass set_class = env->FindClass("java/util/Set");
-        jmethodID iterator_method_id = env->GetMethodID(set_class, "iterator", "()Ljava/util/Iterator;");
-        jobject iterator = env->CallObjectMethod(entry_set, iterator_method_id);
-        
-        jclass iterator_class = env->FindClass("java/util/Iterator");
-        jmethodID hasNext_method_id = env->GetMethodID(iterator_class, "hasNext", "()Z");
-        jmethodID next_method_id = env->GetMethodID(iterator_class, "next", "()Ljava/lang/Object;");
-        bool hasNext = (bool) (env->CallBooleanMethod(iterator, hasNext_method_id) == JNI_TRUE);
+        const JniCache &ids = getJniCache();
+        jobject entry_set = env->CallObjectMethod(java_map, ids.map_entrySet_id);
+        jobject iterator = env->CallObjectMethod(entry_set, ids.set_iterator_id);
 
-        jclass mapentry_class = (env)->FindClass("java/util/Map$Entry");
-        jmethodID get_key_method_id = env->GetMethodID(mapentry_class, "getKey", "()Ljava/lang/Object;");
-        jmethodID get_value_method_id = env->GetMethodID(mapentry_class, "getValue", "()Ljava/lang/Object;");
+        jmethodID hasNext_method_id = ids.iterator_hasNext_id;
+        jmethodID next_method_id = ids.iterator_next_id;
+        bool hasNext = (bool) (env->CallBooleanMethod(iterator, hasNext_method_id) == JNI_TRUE);
 
-        jclass string_class = env->FindClass("java/lang/String");
-        jmethodID to_string_method_id = env->GetMethodID(string_class, "toString", "()Ljava/lang/String;");
+        jmethodID get_key_method_id = ids.mapEntry_getKey_id;
+        jmethodID get_value_method_id = ids.mapEntry_getValue_id;
+        jmethodID to_string_method_id = ids.string_toString_id;
 
         std::map<std::string, std::vector<size_t>> c_map;
 
@@ -43,10 +43,15 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_CNNNetwork_delete(JNIEnv *, jobje
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Infer(JNIEnv *, jobject, jlong);
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_StartAsync(JNIEnv *, jobject, jlong);
 JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *, jobject, jlong, jint);
+JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequest_WaitTimeout(JNIEnv *, jobject, jlong, jlong);
 JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequest_SetCompletionCallback(JNIEnv *, jobject, jlong, jobject);
 JNIEXPORT long JNICALL Java_org_intel_openvino_InferRequest_GetBlob(JNIEnv *, jobject, jlong, jstring);
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetBlob(JNIEnv *, jobject, jlong, jstring, jlong);
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetBlobBatch(JNIEnv *, jobject, jlong, jstring, jobjectArray);
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_GetBlobBatch(JNIEnv *, jobject, jlong, jstring, jobjectArray);
 JNIEXPORT jobject JNICALL Java_org_intel_openvino_InferRequest_GetPerformanceCounts(JNIEnv *, jobject, jlong);
+JNIEXPORT jobjectArray JNICALL Java_org_intel_openvino_InferRequest_GetPerformanceLayerNames(JNIEnv *, jobject, jlong);
+JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequest_GetPerformanceCountsRaw(JNIEnv *, jobject, jlong, jobject);
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_delete(JNIEnv *, jobject, jlong);
 
 //
@@ -56,6 +61,17 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_ExecutableNetwork_CreateInferReq
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_ExecutableNetwork_GetMetric(JNIEnv *, jobject, jlong, jstring);
 JNIEXPORT void JNICALL Java_org_intel_openvino_ExecutableNetwork_delete(JNIEnv *, jobject, jlong);
 
+//
+// InferQueue
+//
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferQueue_Create(JNIEnv *, jobject, jlong, jint);
+JNIEXPORT jint JNICALL Java_org_intel_openvino_InferQueue_GetIdleRequestId(JNIEnv *, jobject, jlong);
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferQueue_GetRequest(JNIEnv *, jobject, jlong, jint);
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferQueue_StartAsync(JNIEnv *, jobject, jlong, jint);
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferQueue_SetCompletionCallback(JNIEnv *, jobject, jlong, jobject);
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferQueue_WaitAll(JNIEnv *, jobject, jlong);
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferQueue_delete(JNIEnv *, jobject, jlong);
+
 //
 // Blob
 //
@@ -66,6 +82,7 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_Blob_BlobFloat(JNIEnv *, jobject
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Blob_BlobInt(JNIEnv *, jobject, jlong, jintArray);
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Blob_BlobLong(JNIEnv *, jobject, jlong, jlongArray);
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Blob_BlobCArray(JNIEnv *, jobject, jlong, jlong);
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Blob_BlobDirectBuffer(JNIEnv *, jobject, jlong, jobject);
 JNIEXPORT jint JNICALL Java_org_intel_openvino_Blob_size(JNIEnv *, jobject ,jlong);
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Blob_rmap(JNIEnv *, jobject, jlong);
 JNIEXPORT void JNICALL Java_org_intel_openvino_Blob_delete(JNIEnv *, jobject, jlong);
@@ -30,6 +30,16 @@ public class Blob extends IEWrapper {
         super(BlobCArray(tensorDesc.nativeObj, cArray));
     }
 
+    /**
+     * Wraps the memory of a direct {@link java.nio.ByteBuffer} without copying it.
+     *
+     * <p>The caller must keep the buffer reachable and its contents valid for the
+     * whole lifetime of the blob.
+     */
+    public Blob(TensorDesc tensorDesc, java.nio.ByteBuffer data) {
+        super(BlobDirectBuffer(tensorDesc.getNativeObjAddr(), data));
+    }
+
     public TensorDesc getTensorDesc() {
         return new TensorDesc(GetTensorDesc(nativeObj));
     }
@@ -57,6 +67,8 @@ public class Blob extends IEWrapper {
 
     private static native long BlobCArray(long tensorDesc, long cArray);
 
+    private static native long BlobDirectBuffer(long tensorDesc, java.nio.ByteBuffer data);
+
     private static native int size(long addr);
 
     private static native long rmap(long addr);
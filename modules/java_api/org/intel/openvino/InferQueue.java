@@ -0,0 +1,57 @@
+package org.intel.openvino;
+
+import java.util.function.IntConsumer;
+
+/**
+ * Pool of infer requests that dispatches submitted jobs to idle requests.
+ *
+ * <p>Reserve a request with {@link #GetIdleRequestId} (blocks until one is idle), fill its inputs
+ * through {@link #GetRequest} and submit it with {@link #StartAsync}. The completion callback
+ * receives the finished request id and may read its outputs before the request returns to the
+ * idle pool.
+ */
+public class InferQueue extends IEWrapper {
+
+    public InferQueue(ExecutableNetwork network, int jobs) {
+        super(Create(network.getNativeObjAddr(), jobs));
+    }
+
+    /** Blocks until a request is idle, reserves it and returns its id. */
+    public int GetIdleRequestId() {
+        return GetIdleRequestId(nativeObj);
+    }
+
+    public InferRequest GetRequest(int id) {
+        return new InferRequest(GetRequest(nativeObj, id));
+    }
+
+    public void StartAsync(int id) {
+        StartAsync(nativeObj, id);
+    }
+
+    /** Called from the completion thread with the finished request id. */
+    public void SetCompletionCallback(IntConsumer callback) {
+        SetCompletionCallback(nativeObj, callback);
+    }
+
+    /** Blocks until every request in the queue is idle. */
+    public void WaitAll() {
+        WaitAll(nativeObj);
+    }
+
+    /*----------------------------------- native methods -----------------------------------*/
+    private static native long Create(long netAddr, int jobs);
+
+    private static native int GetIdleRequestId(long addr);
+
+    private static native long GetRequest(long addr, int id);
+
+    private static native void StartAsync(long addr, int id);
+
+    private static native void SetCompletionCallback(long addr, IntConsumer callback);
+
+    private static native void WaitAll(long addr);
+
+    @Override
+    protected native void delete(long nativeObj);
+}
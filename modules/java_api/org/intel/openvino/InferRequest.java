@@ -20,6 +20,19 @@ public class InferRequest extends IEWrapper {
         SetBlob(nativeObj, name, blob.getNativeObjAddr());
     }
 
+    /**
+     * Scatters per-image direct buffers into the batched input blob in one JNI crossing. The
+     * array length must match the blob batch dimension.
+     */
+    public void SetBlobBatch(String name, java.nio.ByteBuffer[] data) {
+        SetBlobBatch(nativeObj, name, data);
+    }
+
+    /** Gathers the batched output blob into per-image direct buffers in one JNI crossing. */
+    public void GetBlobBatch(String name, java.nio.ByteBuffer[] data) {
+        GetBlobBatch(nativeObj, name, data);
+    }
+
     public void StartAsync() {
         StartAsync(nativeObj);
     }
@@ -28,6 +41,11 @@ public class InferRequest extends IEWrapper {
         return StatusCode.valueOf(Wait(nativeObj, waitMode.getValue()));
     }
 
+    /** Waits up to timeoutMillis for the result to become available. */
+    public StatusCode Wait(long timeoutMillis) {
+        return StatusCode.valueOf(WaitTimeout(nativeObj, timeoutMillis));
+    }
+
     public void SetCompletionCallback(Runnable runnable) {
         SetCompletionCallback(nativeObj, runnable);
     }
@@ -36,6 +54,29 @@ public class InferRequest extends IEWrapper {
         return GetPerformanceCounts(nativeObj);
     }
 
+    /** Byte size of one record written by {@link #GetPerformanceCounts(java.nio.ByteBuffer)}. */
+    public static final int PERF_RECORD_BYTES = 24;
+
+    /**
+     * Returns the profiled layer names ordered by the layer ids used in
+     * {@link #GetPerformanceCounts(java.nio.ByteBuffer)}. The set is stable for a loaded network,
+     * so the table only needs to be fetched once.
+     */
+    public String[] GetPerformanceLayerNames() {
+        return GetPerformanceLayerNames(nativeObj);
+    }
+
+    /**
+     * Fills the direct buffer with one {@link #PERF_RECORD_BYTES}-byte record per profiled layer
+     * and returns the record count. Each record holds, in native byte order: the layer id (int),
+     * the {@link InferenceEngineProfileInfo.LayerStatus} value (int), the real time and the cpu
+     * time in microseconds (both long). Reusing one buffer across calls avoids the per-call
+     * allocations of {@link #GetPerformanceCounts()}.
+     */
+    public int GetPerformanceCounts(java.nio.ByteBuffer buffer) {
+        return GetPerformanceCountsRaw(nativeObj, buffer);
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native void Infer(long addr);
 
@@ -43,14 +84,24 @@ public class InferRequest extends IEWrapper {
 
     private static native int Wait(long addr, int wait_mode);
 
+    private static native int WaitTimeout(long addr, long timeoutMillis);
+
     private static native void SetCompletionCallback(long addr, Runnable runnable);
 
     private static native long GetBlob(long addr, String name);
 
     private static native void SetBlob(long addr, String name, long blobAddr);
 
+    private static native void SetBlobBatch(long addr, String name, java.nio.ByteBuffer[] data);
+
+    private static native void GetBlobBatch(long addr, String name, java.nio.ByteBuffer[] data);
+
     private static native Map<String, InferenceEngineProfileInfo> GetPerformanceCounts(long addr);
 
+    private static native String[] GetPerformanceLayerNames(long addr);
+
+    private static native int GetPerformanceCountsRaw(long addr, java.nio.ByteBuffer buffer);
+
     @Override
     protected native void delete(long nativeObj);
 }
@@ -0,0 +1,186 @@
+import org.intel.openvino.*;
+
+import java.nio.ByteBuffer;
+import java.security.SecureRandom;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/*
+JNI-layer throughput benchmark: measures end-to-end requests per second and
+latency percentiles of the java bindings across request-pool sizes and input
+modes (heap array vs direct buffer), so binding regressions show up in numbers
+rather than in production.
+*/
+public class Main {
+
+    static final int WARMUP_ROUNDS = 2;
+
+    static int blobByteSize(TensorDesc tDesc) {
+        int size = 1;
+        for (int dim : tDesc.getDims()) {
+            size *= dim;
+        }
+        return size;
+    }
+
+    static double percentile(double[] sortedValues, int p) {
+        int index = (int) Math.ceil(p / 100.0 * sortedValues.length) - 1;
+        return sortedValues[Math.max(index, 0)];
+    }
+
+    static double runConfiguration(
+            ExecutableNetwork network,
+            Map<String, TensorDesc> inputs,
+            int nireq,
+            boolean direct,
+            int niter) {
+        InferQueue queue = new InferQueue(network, nireq);
+        InferRequest[] requests = new InferRequest[nireq];
+        for (int i = 0; i < nireq; i++) {
+            requests[i] = queue.GetRequest(i);
+        }
+
+        SecureRandom rand = new SecureRandom();
+        Map<String, byte[]> randomData = new java.util.HashMap<>();
+        for (Map.Entry<String, TensorDesc> entry : inputs.entrySet()) {
+            byte[] data = new byte[blobByteSize(entry.getValue())];
+            rand.nextBytes(data);
+            randomData.put(entry.getKey(), data);
+        }
+
+        // In direct mode each request owns one buffer per input, wrapped by
+        // the blob once; refilling the buffer is the whole submission cost.
+        // In array mode a fresh heap-backed blob is set on every submission.
+        Map<String, ByteBuffer[]> directBuffers = new java.util.HashMap<>();
+        if (direct) {
+            for (Map.Entry<String, TensorDesc> entry : inputs.entrySet()) {
+                ByteBuffer[] buffers = new ByteBuffer[nireq];
+                for (int i = 0; i < nireq; i++) {
+                    buffers[i] = ByteBuffer.allocateDirect(blobByteSize(entry.getValue()));
+                    requests[i].SetBlob(entry.getKey(), new Blob(entry.getValue(), buffers[i]));
+                }
+                directBuffers.put(entry.getKey(), buffers);
+            }
+        }
+
+        for (int round = 0; round < WARMUP_ROUNDS; round++) {
+            for (int i = 0; i < nireq; i++) {
+                int id = queue.GetIdleRequestId();
+                fillInputs(requests[id], id, inputs, randomData, directBuffers, direct);
+                queue.StartAsync(id);
+            }
+            queue.WaitAll();
+        }
+
+        final long[] submitNs = new long[nireq];
+        final double[] latenciesMs = new double[niter];
+        final AtomicInteger completed = new AtomicInteger(0);
+        queue.SetCompletionCallback(
+                id ->
+                        latenciesMs[completed.getAndIncrement()] =
+                                (System.nanoTime() - submitNs[id]) / 1e6);
+
+        long startNs = System.nanoTime();
+        for (int iter = 0; iter < niter; iter++) {
+            int id = queue.GetIdleRequestId();
+            fillInputs(requests[id], id, inputs, randomData, directBuffers, direct);
+            submitNs[id] = System.nanoTime();
+            queue.StartAsync(id);
+        }
+        queue.WaitAll();
+        double elapsedSec = (System.nanoTime() - startNs) / 1e9;
+
+        Arrays.sort(latenciesMs);
+        double throughput = niter / elapsedSec;
+        System.out.println(
+                String.format(
+                        "nireq=%-3d input=%-6s  %8.2f req/s  latency ms p50=%.2f p90=%.2f"
+                                + " p99=%.2f",
+                        nireq,
+                        direct ? "direct" : "array",
+                        throughput,
+                        percentile(latenciesMs, 50),
+                        percentile(latenciesMs, 90),
+                        percentile(latenciesMs, 99)));
+        return throughput;
+    }
+
+    static void fillInputs(
+            InferRequest request,
+            int id,
+            Map<String, TensorDesc> inputs,
+            Map<String, byte[]> randomData,
+            Map<String, ByteBuffer[]> directBuffers,
+            boolean direct) {
+        for (Map.Entry<String, TensorDesc> entry : inputs.entrySet()) {
+            if (direct) {
+                ByteBuffer buffer = directBuffers.get(entry.getKey())[id];
+                buffer.rewind();
+                buffer.put(randomData.get(entry.getKey()));
+            } else {
+                request.SetBlob(
+                        entry.getKey(), new Blob(entry.getValue(), randomData.get(entry.getKey())));
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        try {
+            System.loadLibrary(IECore.NATIVE_LIBRARY_NAME);
+        } catch (UnsatisfiedLinkError e) {
+            System.err.println("Failed to load Inference Engine library\n" + e);
+            System.exit(1);
+        }
+
+        ArgumentParser parser = new ArgumentParser("This is a JNI-layer benchmarking application");
+        parser.addArgument("-m", "path to model .xml");
+        parser.addArgument("-d", "device");
+        parser.addArgument("-niter", "number of iterations per configuration");
+        parser.addArgument("-nireq", "comma-separated request-pool sizes");
+        parser.addArgument("-mode", "input modes: array, direct or both");
+        parser.parseArgs(args);
+
+        String xmlPath = parser.get("-m", null);
+        String device = parser.get("-d", "CPU");
+        int niter = parser.getInteger("-niter", 200);
+        String nireqList = parser.get("-nireq", "1,2,4");
+        String mode = parser.get("-mode", "both");
+
+        if (xmlPath == null) {
+            System.out.println("Error: Missed argument: -m");
+            return;
+        }
+
+        IECore core = new IECore();
+        CNNNetwork net = core.ReadNetwork(xmlPath);
+
+        Map<String, InputInfo> inputsInfo = net.getInputsInfo();
+        Map<String, TensorDesc> inputs = new java.util.HashMap<>();
+        for (Map.Entry<String, InputInfo> entry : inputsInfo.entrySet()) {
+            entry.getValue().setPrecision(Precision.U8);
+            inputs.put(entry.getKey(), entry.getValue().getTensorDesc());
+        }
+
+        ExecutableNetwork executableNetwork = core.LoadNetwork(net, device);
+
+        List<Boolean> modes = new ArrayList<>();
+        if (mode.equals("array") || mode.equals("both")) modes.add(false);
+        if (mode.equals("direct") || mode.equals("both")) modes.add(true);
+        if (modes.isEmpty()) {
+            System.out.println("Error: Incorrect argument: '-mode'");
+            return;
+        }
+
+        System.out.println(
+                "Measuring " + niter + " iterations per configuration on " + device + ":");
+        for (String token : nireqList.split(",")) {
+            int nireq = Integer.parseInt(token.trim());
+            for (boolean direct : modes) {
+                runConfiguration(executableNetwork, inputs, nireq, direct, niter);
+            }
+        }
+    }
+}
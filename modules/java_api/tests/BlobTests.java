@@ -46,6 +46,40 @@ public class BlobTests extends IETest {
         Assert.assertArrayEquals("Data", data, out);
     }
 
+    @Test
+    public void testGetBlobFromDirectByteBuffer() {
+        int[] dimsArr = {1, 1, 2, 2};
+        TensorDesc tDesc = new TensorDesc(Precision.U8, dimsArr, Layout.NHWC);
+
+        byte[] data = {4, 22, 0, -1};
+        java.nio.ByteBuffer buffer = java.nio.ByteBuffer.allocateDirect(data.length);
+        buffer.put(data);
+
+        Blob blob = new Blob(tDesc, buffer);
+
+        byte[] out = new byte[blob.size()];
+        blob.rmap().get(out);
+
+        Assert.assertArrayEquals(blob.getTensorDesc().getDims(), dimsArr);
+        Assert.assertArrayEquals("Data", data, out);
+    }
+
+    @Test
+    public void testBlobFromHeapByteBufferThrows() {
+        int[] dimsArr = {1, 1, 2, 2};
+        TensorDesc tDesc = new TensorDesc(Precision.U8, dimsArr, Layout.NHWC);
+
+        java.nio.ByteBuffer buffer = java.nio.ByteBuffer.allocate(4);
+
+        String exceptionMessage = "";
+        try {
+            Blob blob = new Blob(tDesc, buffer);
+        } catch (Exception e) {
+            exceptionMessage = e.getMessage();
+        }
+        Assert.assertTrue(exceptionMessage.contains("direct"));
+    }
+
     @Test
     public void testGetBlobFromLong() {
         int[] dimsArr = {1, 2, 1, 2};
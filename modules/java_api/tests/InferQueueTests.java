@@ -0,0 +1,37 @@
+import static org.junit.Assert.*;
+
+import org.intel.openvino.*;
+import org.junit.Before;
+import org.junit.Test;
+
+import java.util.concurrent.atomic.AtomicInteger;
+
+public class InferQueueTests extends IETest {
+    IECore core;
+    CNNNetwork net;
+    ExecutableNetwork executableNetwork;
+
+    @Before
+    public void setUp() {
+        core = new IECore();
+        net = core.ReadNetwork(modelXml);
+        executableNetwork = core.LoadNetwork(net, device);
+    }
+
+    @Test
+    public void testInferQueue() {
+        int jobs = 4;
+        InferQueue inferQueue = new InferQueue(executableNetwork, 2);
+
+        final AtomicInteger completed = new AtomicInteger(0);
+        inferQueue.SetCompletionCallback(id -> completed.incrementAndGet());
+
+        for (int i = 0; i < jobs; i++) {
+            int id = inferQueue.GetIdleRequestId();
+            inferQueue.StartAsync(id);
+        }
+        inferQueue.WaitAll();
+
+        assertEquals("InferQueue", jobs, completed.get());
+    }
+}
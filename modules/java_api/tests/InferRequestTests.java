@@ -53,6 +53,14 @@ public class InferRequestTests extends IETest {
         assertEquals("StartAsync", StatusCode.OK, statusCode);
     }
 
+    @Test
+    public void testWaitWithTimeout() {
+        inferRequest.StartAsync();
+        StatusCode statusCode = inferRequest.Wait(10000L);
+
+        assertEquals("WaitWithTimeout", StatusCode.OK, statusCode);
+    }
+
     @Test
     public void testSetCompletionCallback() {
         inferRequest.SetCompletionCallback(
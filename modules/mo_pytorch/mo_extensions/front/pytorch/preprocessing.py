@@ -0,0 +1,84 @@
+"""
+ Copyright (C) 2018-2022 Intel Corporation
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+"""
+import numpy as np
+
+from openvino.tools.mo.front.common.partial_infer.utils import int64_array
+from openvino.tools.mo.front.common.replacement import FrontReplacementPattern
+from openvino.tools.mo.front.tf.graph_utils import create_op_node_with_second_input
+from openvino.tools.mo.graph.graph import Graph
+from openvino.tools.mo.ops.elementwise import Mul, Sub
+from openvino.tools.mo.ops.transpose import Transpose
+from openvino.tools.mo.utils.error import Error
+
+
+def _parse_floats(value):
+    if value is None or value == '':
+        return None
+    return [float(v) for v in str(value).split(',')]
+
+
+class FoldInputPreprocessing(FrontReplacementPattern):
+    """Folds deployment-side input preprocessing into the emitted IR: an
+    optional NHWC->NCHW layout transpose (mo_pytorch.convert layout='NHWC',
+    for models fed raw camera/decoder frames), then per-channel mean
+    subtraction and scale division (mean=[...], scale=[...]). Inside the graph
+    the plugin vectorizes and parallelizes these ops and can fuse them with
+    adjacent stages, instead of a NumPy pass per frame before inference.
+    """
+    enabled = True
+
+    def find_and_replace_pattern(self, graph: Graph):
+        argv = graph.graph['cmd_params']
+        layout = getattr(argv, 'input_frame_layout', None) or ''
+        mean = _parse_floats(getattr(argv, 'input_mean', None))
+        scale = _parse_floats(getattr(argv, 'input_scale', None))
+        if not layout and mean is None and scale is None:
+            return
+        if layout and layout not in ('NCHW', 'NHWC'):
+            raise Error('Unsupported input layout "{}", expected NCHW or NHWC'.format(layout))
+
+        for param in graph.get_op_nodes(op='Parameter'):
+            shape = param.soft_get('shape', None)
+            if shape is None or len(shape) < 2:
+                continue
+            tail = param
+            if layout == 'NHWC':
+                if len(shape) != 4:
+                    raise Error('layout=NHWC expects a 4D input, got shape {}'.format(shape))
+                # The model was traced with NCHW inputs; the deployed network
+                # takes the frame as produced and transposes inside the graph
+                param['shape'] = int64_array([shape[0], shape[2], shape[3], shape[1]])
+                transpose = create_op_node_with_second_input(graph, Transpose, int64_array([0, 3, 1, 2]),
+                                                             {'name': param.name + '/nhwc_to_nchw'})
+                tail.out_port(0).get_connection().insert_node(transpose)
+                tail = transpose
+            # Mean/scale apply after the transpose, so the channel dim is
+            # always axis 1 regardless of the frame layout
+            broadcast = np.ones(len(shape), dtype=np.int64)
+            broadcast[1] = -1
+            if mean is not None:
+                sub = create_op_node_with_second_input(graph, Sub,
+                                                       np.array(mean, dtype=np.float32).reshape(broadcast),
+                                                       {'name': param.name + '/mean'})
+                tail.out_port(0).get_connection().insert_node(sub)
+                tail = sub
+            if scale is not None:
+                # MO convention: scale divides, so fold the reciprocal into a Mul
+                mul = create_op_node_with_second_input(graph, Mul,
+                                                       (1.0 / np.array(scale, dtype=np.float32)).reshape(broadcast),
+                                                       {'name': param.name + '/scale'})
+                tail.out_port(0).get_connection().insert_node(mul)
+                tail = mul
@@ -18,6 +18,9 @@
 
 import os
 import sys
+import shutil
+import hashlib
+import tempfile
 import logging as log
 
 import openvino.tools.mo as mo
@@ -104,7 +107,125 @@ def _prepare_ir(argv, old_api=False):
         return graph, None
 
 
+def _conversion_hash(model, args):
+    """Content hash identifying one conversion: model structure and weights,
+    the mo_extensions sources and the conversion arguments. Any change to
+    either produces a different IR, so any change invalidates the cache entry.
+    """
+    digest = hashlib.sha256()
+    # Extractor and loader sources: an updated extension changes the emitted IR
+    ext_dir = os.path.join(os.path.dirname(__file__), 'mo_extensions')
+    for root, _, files in sorted(os.walk(ext_dir)):
+        for name in sorted(files):
+            if name.endswith('.py'):
+                digest.update(os.path.relpath(os.path.join(root, name), ext_dir).encode())
+                with open(os.path.join(root, name), 'rb') as f:
+                    digest.update(f.read())
+    # Conversion arguments: the same model with a different input shape or
+    # mean/scale is a different IR. Output placement does not affect content.
+    for arg in sorted(args):
+        if arg not in ('output_dir', 'model_name'):
+            digest.update('{}={}'.format(arg, args[arg]).encode())
+    # Model structure and weights; repr covers non-parameter attributes like
+    # paddings and activation choices that state_dict does not carry
+    digest.update(model.__class__.__name__.encode())
+    digest.update(repr(model).encode())
+    for name, tensor in sorted(model.state_dict().items()):
+        digest.update(name.encode())
+        digest.update(str(tensor.dtype).encode())
+        digest.update(str(list(tensor.shape)).encode())
+        digest.update(tensor.detach().cpu().contiguous().numpy().tobytes())
+    return digest.hexdigest()
+
+
+def export_compiled_blob(model_xml, blob_path, device='CPU', config=None):
+    """Compiles a converted IR on this host and stores the compiled blob, so
+    deployed devices import it and skip graph transformation and validation
+    entirely at boot. The blob comes from the plugin's export/import feature
+    and embeds its conversion decisions, so the compiling host needs the
+    target device's plugin loadable and a config matching the target (for the
+    ARM plugin, state the target ISA through its KERNEL_ISA key when the
+    build host CPU differs from the fleet).
+    """
+    try:
+        from openvino.inference_engine import IECore
+    except ImportError:
+        raise Exception('OpenVINO runtime with the {} plugin is required to export a compiled blob'.format(device))
+    ie = IECore()
+    net = ie.read_network(model=model_xml)
+    exec_net = ie.load_network(net, device, config or {})
+    exec_net.export(blob_path)
+    log.info('Compiled blob stored to {}'.format(blob_path))
+
+
+def _float_list(value):
+    if isinstance(value, (list, tuple)):
+        return ','.join(str(float(v)) for v in value)
+    return str(float(value))
+
+
 def convert(model, **args):
+    # Input preprocessing folded into the IR: mean is subtracted and scale
+    # divides per channel, layout='NHWC' accepts raw frames and transposes
+    # inside the graph (see mo_extensions FoldInputPreprocessing), so the
+    # NumPy normalization pass deployments run per frame moves into the
+    # plugin where it is vectorized and parallelized
+    mean = args.pop('mean', None)
+    scale = args.pop('scale', None)
+    layout = args.pop('layout', None)
+    if mean is not None:
+        args['input_mean'] = _float_list(mean)
+    if scale is not None:
+        args['input_scale'] = _float_list(scale)
+    if layout is not None:
+        args['input_frame_layout'] = str(layout)
+    # Optional compile step after conversion: export_blob names the blob file,
+    # export_blob_device/export_blob_config select and configure the plugin
+    export_blob = args.pop('export_blob', None)
+    export_blob_device = args.pop('export_blob_device', 'CPU')
+    export_blob_config = args.pop('export_blob_config', None)
+    # Content-addressed conversion cache: with cache_dir set (or the
+    # MO_PYTORCH_CACHE_DIR environment variable) a repeated conversion of an
+    # unchanged model becomes a file copy of the stored IR
+    cache_dir = args.pop('cache_dir', os.environ.get('MO_PYTORCH_CACHE_DIR'))
+    cache_entry = None
+    cached = False
+    if cache_dir:
+        cache_entry = os.path.join(cache_dir, _conversion_hash(model, args))
+        output_dir = args.get('output_dir', '.')
+        if os.path.isdir(cache_entry):
+            log.info('Conversion cache hit: {}'.format(cache_entry))
+            os.makedirs(output_dir, exist_ok=True)
+            for name in os.listdir(cache_entry):
+                shutil.copy(os.path.join(cache_entry, name), output_dir)
+            cached = True
+
+    if not cached:
+        _convert(model, **args)
+
+    if export_blob:
+        model_name = args.get('model_name', model.__class__.__name__)
+        model_xml = os.path.join(args.get('output_dir', '.'), model_name + '.xml')
+        export_compiled_blob(model_xml, export_blob, export_blob_device, export_blob_config)
+
+    if cache_entry is not None and not cached:
+        model_name = args.get('model_name', model.__class__.__name__)
+        os.makedirs(cache_dir, exist_ok=True)
+        # Stage into a temporary sibling and rename, so concurrent CI jobs
+        # never observe a partially written entry
+        staging = tempfile.mkdtemp(dir=cache_dir)
+        for ext in ('.xml', '.bin', '.mapping'):
+            produced = os.path.join(args.get('output_dir', '.'), model_name + ext)
+            if os.path.exists(produced):
+                shutil.copy(produced, staging)
+        try:
+            os.rename(staging, cache_entry)
+        except OSError:
+            # Another job stored the same entry first; its copy is identical
+            shutil.rmtree(staging, ignore_errors=True)
+
+
+def _convert(model, **args):
     mo.main.prepare_ir = _prepare_ir
 
     parser = get_common_cli_parser()